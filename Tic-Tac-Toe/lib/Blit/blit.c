@@ -0,0 +1,284 @@
+/*
+*********************************************************************************************************
+*                                             2D BLITTER
+*
+* Note(s) : (1) See 'blit.h'.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "blit.h"
+
+#if defined(__linux__)
+#include "stm32f429i_discovery_lcd.h" // BSP_POSIX_LCD_FrameBufferGet()
+#endif
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+#if (BLIT_DMA2D_EN > 0u)
+static OS_SEM BlitSem;                // Posted by the transfer complete interrupt, see Note #2 of blit.h
+static volatile CPU_BOOLEAN BlitBusy; // A transfer was started and not waited for
+#endif
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN BlitClip(const blit_surf_t *const dst, CPU_INT32S *const x, CPU_INT32S *const y, const blit_surf_t *const src, blit_rect_t *const rect);
+static void BlitStart(void);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+/**
+ * \brief Create the completion semaphore and set the DMA2D up, before the first transfer
+ * \param [OUT] p_err - error of the semaphore creation
+ */
+void BlitInit(OS_ERR *const p_err)
+{
+#if (BLIT_DMA2D_EN > 0u)
+    OSSemCreate((OS_SEM *)&BlitSem,
+                (CPU_CHAR *)"Blit Sem",
+                (OS_SEM_CTR)0,
+                (OS_ERR *)p_err);
+    if (*p_err != OS_ERR_NONE)
+    {
+        return;
+    }
+    BlitHw_Init();
+#else
+    *p_err = OS_ERR_NONE;
+#endif
+}
+
+/**
+ * \brief Wait for the end of the last transfer, see Note #2 of blit.h
+ * \param [OUT] p_err - OS_ERR_NONE, or the error of the semaphore pend
+ */
+void BlitWait(OS_ERR *const p_err)
+{
+#if (BLIT_DMA2D_EN > 0u)
+    CPU_TS ts;
+
+    *p_err = OS_ERR_NONE;
+    if (BlitBusy == DEF_TRUE)
+    {
+        OSSemPend((OS_SEM *)&BlitSem,
+                  (OS_TICK)0,
+                  (OS_OPT)OS_OPT_PEND_BLOCKING,
+                  (CPU_TS *)&ts,
+                  (OS_ERR *)p_err);
+        BlitBusy = DEF_FALSE;
+    }
+#else
+    *p_err = OS_ERR_NONE;
+#endif
+}
+
+#if (BLIT_DMA2D_EN > 0u)
+/**
+ * \brief End of a transfer, called by the DMA2D interrupt
+ */
+void BlitDone(void)
+{
+    OS_ERR err;
+
+    OSSemPost((OS_SEM *)&BlitSem, (OS_OPT)OS_OPT_POST_1, (OS_ERR *)&err);
+}
+#endif
+
+/**
+ * \brief A surface of width x height pixels, lines next to each other
+ */
+void BlitSurfInit(blit_surf_t *const surf, void *const pixels, const CPU_INT16U width, const CPU_INT16U height, const CPU_INT08U format)
+{
+    surf->pixels = pixels;
+    surf->width = width;
+    surf->height = height;
+    surf->pitch = width;
+    surf->format = format;
+}
+
+/**
+ * \brief Pixels at a board address, e.g. a framebuffer of the LCD: the host ones are in BSP_POSIX
+ */
+void *BlitFrameBuffer(const uint32_t address)
+{
+#if defined(__linux__)
+    return (void *)BSP_POSIX_LCD_FrameBufferGet(address);
+#else
+    return (void *)address;
+#endif
+}
+
+/**
+ * \return bytes per pixel
+ */
+CPU_INT08U BlitPixelSize(const CPU_INT08U format)
+{
+    switch (format)
+    {
+    case BLIT_FMT_ARGB8888:
+        return 4u;
+    case BLIT_FMT_RGB888:
+        return 3u;
+    case BLIT_FMT_RGB565:
+        return 2u;
+    default:
+        return 1u;
+    }
+}
+
+/**
+ * \brief Fill a rectangle with a colour
+ * \return DEF_FAIL if the format of the destination is not an output format (A8)
+ */
+CPU_BOOLEAN BlitFill(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const CPU_INT32S w, const CPU_INT32S h, const uint32_t colour)
+{
+    blit_rect_t rect = {x, y, w, h};
+    CPU_INT32S dst_x = x; // Same place, dst is its own source for the clipping
+    CPU_INT32S dst_y = y;
+
+    if (dst->format == BLIT_FMT_A8)
+    {
+        return DEF_FAIL;
+    }
+    if (BlitClip(dst, &dst_x, &dst_y, dst, &rect) == DEF_FALSE)
+    {
+        return DEF_OK;
+    }
+
+    BlitStart();
+#if (BLIT_DMA2D_EN > 0u)
+    BlitHw_Fill(dst, &rect, colour);
+#else
+    BlitSw_Fill(dst, &rect, colour);
+#endif
+    return DEF_OK;
+}
+
+/**
+ * \brief Copy a rectangle of src to x, y of dst, converting the pixels if the formats differ
+ * \return DEF_FAIL if the format of a surface does not fit (A8)
+ */
+CPU_BOOLEAN BlitCopy(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const blit_surf_t *const src, const blit_rect_t *const rect)
+{
+    blit_rect_t clip = *rect;
+    CPU_INT32S dst_x = x;
+    CPU_INT32S dst_y = y;
+
+    if ((dst->format == BLIT_FMT_A8) || (src->format == BLIT_FMT_A8))
+    {
+        return DEF_FAIL;
+    }
+    if (BlitClip(dst, &dst_x, &dst_y, src, &clip) == DEF_FALSE)
+    {
+        return DEF_OK;
+    }
+
+    BlitStart();
+#if (BLIT_DMA2D_EN > 0u)
+    BlitHw_Copy(dst, dst_x, dst_y, src, &clip);
+#else
+    BlitSw_Copy(dst, dst_x, dst_y, src, &clip);
+#endif
+    return DEF_OK;
+}
+
+/**
+ * \brief Blend a rectangle of src over x, y of dst
+ * \details The alpha of a source pixel is multiplied by the alpha of colour.  An A8 source is in the RGB of
+ * colour, e.g. a mask of glyphs or shapes.
+ * \return DEF_FAIL if the format of the destination is not an output format (A8)
+ */
+CPU_BOOLEAN BlitBlend(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const blit_surf_t *const src, const blit_rect_t *const rect, const uint32_t colour)
+{
+    blit_rect_t clip = *rect;
+    CPU_INT32S dst_x = x;
+    CPU_INT32S dst_y = y;
+
+    if (dst->format == BLIT_FMT_A8)
+    {
+        return DEF_FAIL;
+    }
+    if (BlitClip(dst, &dst_x, &dst_y, src, &clip) == DEF_FALSE)
+    {
+        return DEF_OK;
+    }
+
+    BlitStart();
+#if (BLIT_DMA2D_EN > 0u)
+    BlitHw_Blend(dst, dst_x, dst_y, src, &clip, colour);
+#else
+    BlitSw_Blend(dst, dst_x, dst_y, src, &clip, colour);
+#endif
+    return DEF_OK;
+}
+
+/**
+ * \brief Clip a rectangle of src, and its place x, y in dst, to both surfaces
+ * \return DEF_FALSE if nothing is left
+ */
+static CPU_BOOLEAN BlitClip(const blit_surf_t *const dst, CPU_INT32S *const x, CPU_INT32S *const y, const blit_surf_t *const src, blit_rect_t *const rect)
+{
+    CPU_INT32S d;
+
+    d = (rect->x < *x) ? rect->x : *x; // Out of either surface on the left
+    if (d < 0)
+    {
+        rect->x -= d;
+        *x -= d;
+        rect->w += d;
+    }
+    d = (rect->y < *y) ? rect->y : *y;
+    if (d < 0)
+    {
+        rect->y -= d;
+        *y -= d;
+        rect->h += d;
+    }
+    if (rect->w > (CPU_INT32S)src->width - rect->x)
+    {
+        rect->w = (CPU_INT32S)src->width - rect->x;
+    }
+    if (rect->w > (CPU_INT32S)dst->width - *x)
+    {
+        rect->w = (CPU_INT32S)dst->width - *x;
+    }
+    if (rect->h > (CPU_INT32S)src->height - rect->y)
+    {
+        rect->h = (CPU_INT32S)src->height - rect->y;
+    }
+    if (rect->h > (CPU_INT32S)dst->height - *y)
+    {
+        rect->h = (CPU_INT32S)dst->height - *y;
+    }
+    return ((rect->w > 0) && (rect->h > 0)) ? DEF_TRUE : DEF_FALSE;
+}
+
+/**
+ * \brief Wait for the previous transfer, the new one is started by the caller, see Note #2 of blit.h
+ */
+static void BlitStart(void)
+{
+#if (BLIT_DMA2D_EN > 0u)
+    OS_ERR err;
+
+    BlitWait(&err);
+    BlitBusy = DEF_TRUE;
+#endif
+}
@@ -0,0 +1,101 @@
+/*
+*********************************************************************************************************
+*                                             2D BLITTER
+*
+* Note(s) : (1) Fill, copy, pixel format conversion & alpha blend of rectangles between surfaces, on the
+*               DMA2D (Chrom-ART) when the MCU has one, else on the CPU (blit_sw.c), e.g. on the host.
+*
+*           (2) With the DMA2D, BlitFill() & co. start the transfer and return: the calling task runs on,
+*               or waits in BlitWait() for the transfer complete interrupt to post BlitSem, instead of
+*               writing the pixels itself.  A transfer waits for the previous one to end before it starts.
+*               The software backend is done when BlitXxx() returns.
+*
+*           (3) The CPU must not write the pixels of a transfer in progress: BlitWait() before drawing with
+*               the BSP_LCD_xxx() functions, or reading the result.
+*
+*           (4) One task uses the blitter at a time, the compositor in the applications (see 'disp.h').
+*
+*           (5) Colours are ARGB8888, converted to the format of the destination.  The rectangles are
+*               clipped to the surfaces.
+*********************************************************************************************************
+*/
+
+#ifndef BLIT_H
+#define BLIT_H
+
+#include "os.h"
+#include "stm32f4xx_hal.h"
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#ifndef BLIT_DMA2D_EN
+#if defined(DMA2D)
+#define BLIT_DMA2D_EN 1u // The MCU has a DMA2D, see Note #1
+#else
+#define BLIT_DMA2D_EN 0u
+#endif
+#endif
+
+/* Pixel formats, the colour modes of the DMA2D */
+#define BLIT_FMT_ARGB8888 (CPU_INT08U)0
+#define BLIT_FMT_RGB888 (CPU_INT08U)1
+#define BLIT_FMT_RGB565 (CPU_INT08U)2
+#define BLIT_FMT_A8 (CPU_INT08U)9 // Alpha only, source of BlitBlend()
+
+/*
+*********************************************************************************************************
+*                                            DATA STRUCTURES
+*********************************************************************************************************
+*/
+
+typedef struct blit_surf
+{
+    void *pixels;      // First pixel of the first line
+    CPU_INT16U width;  // Pixels
+    CPU_INT16U height; // Lines
+    CPU_INT16U pitch;  // Pixels from a line to the next
+    CPU_INT08U format; // BLIT_FMT_xxx
+} blit_surf_t;
+
+typedef struct blit_rect
+{
+    CPU_INT32S x;
+    CPU_INT32S y;
+    CPU_INT32S w;
+    CPU_INT32S h;
+} blit_rect_t;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void BlitInit(OS_ERR *const p_err);
+void BlitWait(OS_ERR *const p_err);
+void BlitSurfInit(blit_surf_t *const surf, void *const pixels, const CPU_INT16U width, const CPU_INT16U height, const CPU_INT08U format);
+void *BlitFrameBuffer(const uint32_t address);
+CPU_INT08U BlitPixelSize(const CPU_INT08U format);
+
+CPU_BOOLEAN BlitFill(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const CPU_INT32S w, const CPU_INT32S h, const uint32_t colour);
+CPU_BOOLEAN BlitCopy(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const blit_surf_t *const src, const blit_rect_t *const rect);
+CPU_BOOLEAN BlitBlend(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const blit_surf_t *const src, const blit_rect_t *const rect, const uint32_t colour);
+
+/* Backends, called by blit.c with the rectangles clipped */
+void BlitSw_Fill(const blit_surf_t *const dst, const blit_rect_t *const rect, const uint32_t colour);
+void BlitSw_Copy(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const blit_surf_t *const src, const blit_rect_t *const rect);
+void BlitSw_Blend(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const blit_surf_t *const src, const blit_rect_t *const rect, const uint32_t colour);
+
+#if (BLIT_DMA2D_EN > 0u)
+void BlitHw_Init(void);
+void BlitHw_Fill(const blit_surf_t *const dst, const blit_rect_t *const rect, const uint32_t colour);
+void BlitHw_Copy(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const blit_surf_t *const src, const blit_rect_t *const rect);
+void BlitHw_Blend(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const blit_surf_t *const src, const blit_rect_t *const rect, const uint32_t colour);
+void BlitDone(void);
+#endif
+
+#endif
@@ -0,0 +1,165 @@
+/*
+*********************************************************************************************************
+*                                      2D BLITTER, DMA2D BACKEND
+*
+* Note(s) : (1) The blitter on the Chrom-ART accelerator (see 'blit.h').  blit.c calls it with the
+*               rectangles clipped, once the previous transfer is over, and waits in BlitWait() for the
+*               transfer complete (or error) interrupt.
+*
+*           (2) The interrupts are enabled per transfer and disabled by the handler: the BSP_LCD_xxx()
+*               functions poll their own DMA2D transfers, which must not post BlitSem.
+*
+*           (3) Fill is register to memory, copy memory to memory (with pixel format conversion if the
+*               formats differ), blend memory to memory with the destination as background.  The alpha of
+*               the source is multiplied by the one of the colour, an A8 source takes the RGB of the colour.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "blit.h"
+
+#if (BLIT_DMA2D_EN > 0u)
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+/* DMA2D registers, RM0090 */
+#define BLIT_DMA2D_CR_START DEF_BIT_00
+#define BLIT_DMA2D_CR_TEIE DEF_BIT_08
+#define BLIT_DMA2D_CR_TCIE DEF_BIT_09
+#define BLIT_DMA2D_CR_MODE_M2M (0u << 16)
+#define BLIT_DMA2D_CR_MODE_M2M_PFC (1u << 16)
+#define BLIT_DMA2D_CR_MODE_M2M_BLEND (2u << 16)
+#define BLIT_DMA2D_CR_MODE_R2M (3u << 16)
+#define BLIT_DMA2D_ISR_TEIF DEF_BIT_00
+#define BLIT_DMA2D_ISR_TCIF DEF_BIT_01
+#define BLIT_DMA2D_PFCCR_AM_MUL (2u << 16) // Alpha of the pixel times ALPHA
+#define BLIT_DMA2D_PFCCR_ALPHA_POS 24u
+#define BLIT_DMA2D_NLR_PL_POS 16u
+
+#ifdef CPU_CFG_KA_IPL_BOUNDARY
+#define BLIT_DMA2D_IRQ_PRIO CPU_CFG_KA_IPL_BOUNDARY // Kernel aware, the ISR posts
+#else
+#define BLIT_DMA2D_IRQ_PRIO 0u
+#endif
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static uint32_t BlitHw_Address(const blit_surf_t *const surf, const CPU_INT32S x, const CPU_INT32S y);
+static uint32_t BlitHw_Colour(const CPU_INT08U format, const uint32_t colour);
+static void BlitHw_Start(const uint32_t mode, const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const CPU_INT32S w, const CPU_INT32S h);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+void BlitHw_Init(void)
+{
+    __HAL_RCC_DMA2D_CLK_ENABLE();
+    HAL_NVIC_SetPriority(DMA2D_IRQn, BLIT_DMA2D_IRQ_PRIO, 0u);
+    HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+}
+
+void BlitHw_Fill(const blit_surf_t *const dst, const blit_rect_t *const rect, const uint32_t colour)
+{
+    DMA2D->OCOLR = BlitHw_Colour(dst->format, colour);
+    BlitHw_Start(BLIT_DMA2D_CR_MODE_R2M, dst, rect->x, rect->y, rect->w, rect->h);
+}
+
+void BlitHw_Copy(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const blit_surf_t *const src, const blit_rect_t *const rect)
+{
+    DMA2D->FGMAR = BlitHw_Address(src, rect->x, rect->y);
+    DMA2D->FGOR = (uint32_t)(src->pitch - rect->w);
+    DMA2D->FGPFCCR = src->format;
+    BlitHw_Start((dst->format == src->format) ? BLIT_DMA2D_CR_MODE_M2M : BLIT_DMA2D_CR_MODE_M2M_PFC,
+                 dst, x, y, rect->w, rect->h);
+}
+
+void BlitHw_Blend(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const blit_surf_t *const src, const blit_rect_t *const rect, const uint32_t colour)
+{
+    DMA2D->FGMAR = BlitHw_Address(src, rect->x, rect->y);
+    DMA2D->FGOR = (uint32_t)(src->pitch - rect->w);
+    DMA2D->FGCOLR = colour & 0x00FFFFFFu;
+    DMA2D->FGPFCCR = src->format | BLIT_DMA2D_PFCCR_AM_MUL | ((colour >> 24) << BLIT_DMA2D_PFCCR_ALPHA_POS);
+    DMA2D->BGMAR = BlitHw_Address(dst, x, y);
+    DMA2D->BGOR = (uint32_t)(dst->pitch - rect->w);
+    DMA2D->BGPFCCR = dst->format;
+    BlitHw_Start(BLIT_DMA2D_CR_MODE_M2M_BLEND, dst, x, y, rect->w, rect->h);
+}
+
+/**
+ * \brief Transfer complete or error, see Note #2
+ */
+void DMA2D_IRQHandler(void)
+{
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();
+    CPU_CRITICAL_EXIT();
+
+    if ((DMA2D->ISR & (BLIT_DMA2D_ISR_TCIF | BLIT_DMA2D_ISR_TEIF)) != 0u)
+    {
+        DMA2D->IFCR = BLIT_DMA2D_ISR_TCIF | BLIT_DMA2D_ISR_TEIF;
+        DMA2D->CR &= ~(BLIT_DMA2D_CR_TCIE | BLIT_DMA2D_CR_TEIE);
+        BlitDone();
+    }
+
+    OSIntExit();
+}
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static uint32_t BlitHw_Address(const blit_surf_t *const surf, const CPU_INT32S x, const CPU_INT32S y)
+{
+    return (uint32_t)(uintptr_t)surf->pixels + ((uint32_t)y * surf->pitch + (uint32_t)x) * BlitPixelSize(surf->format);
+}
+
+/**
+ * \return an ARGB8888 colour in the output format, for OCOLR
+ */
+static uint32_t BlitHw_Colour(const CPU_INT08U format, const uint32_t colour)
+{
+    switch (format)
+    {
+    case BLIT_FMT_RGB888:
+        return colour & 0x00FFFFFFu;
+    case BLIT_FMT_RGB565:
+        return ((colour >> 8) & 0xF800u) | ((colour >> 5) & 0x07E0u) | ((colour >> 3) & 0x001Fu);
+    default:
+        return colour;
+    }
+}
+
+/**
+ * \brief Set the output & start the transfer, the source registers are set by the caller
+ */
+static void BlitHw_Start(const uint32_t mode, const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const CPU_INT32S w, const CPU_INT32S h)
+{
+    DMA2D->OPFCCR = dst->format;
+    DMA2D->OMAR = BlitHw_Address(dst, x, y);
+    DMA2D->OOR = (uint32_t)(dst->pitch - w);
+    DMA2D->NLR = ((uint32_t)w << BLIT_DMA2D_NLR_PL_POS) | (uint32_t)h;
+    DMA2D->IFCR = BLIT_DMA2D_ISR_TCIF | BLIT_DMA2D_ISR_TEIF;
+    DMA2D->CR = mode | BLIT_DMA2D_CR_TCIE | BLIT_DMA2D_CR_TEIE | BLIT_DMA2D_CR_START;
+}
+
+#endif
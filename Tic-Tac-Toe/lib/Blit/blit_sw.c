@@ -0,0 +1,310 @@
+/*
+*********************************************************************************************************
+*                                       2D BLITTER, CPU BACKEND
+*
+* Note(s) : (1) The blitter without a DMA2D, e.g. on the host (see 'blit.h').  blit.c calls it with the
+*               rectangles clipped.
+*
+*           (2) Fills write 64-bit words, two ARGB8888 or four RGB565 pixels per store, once the line is
+*               aligned.  Copies in the same format are a memcpy() per line, which the C library does as
+*               wide as the CPU allows.
+*
+*           (3) Blending follows the DMA2D with an opaque destination: each channel is
+*               (fg * a + bg * (255 - a)) / 255, rounded, a the alpha of the source times the one of the
+*               colour.  An alpha of 255 writes the source colour, 0 keeps the destination.  An A8 mask in
+*               an opaque colour over ARGB8888, the glyphs & circles of the compositor, takes a shorter loop.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include <string.h>
+#include "blit.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define BLIT_SW_DIV255(v) (((v) + 128u + (((v) + 128u) >> 8)) >> 8) // v / 255 rounded, v <= 255 * 255
+
+typedef uint64_t __attribute__((__may_alias__)) blit_word_t; // Wide store over the pixels, see Note #2
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static CPU_INT08U *BlitSw_Pixel(const blit_surf_t *const surf, const CPU_INT32S x, const CPU_INT32S y);
+static uint32_t BlitSw_Read(const CPU_INT08U format, const CPU_INT08U *const p);
+static void BlitSw_Write(const CPU_INT08U format, CPU_INT08U *const p, const uint32_t colour);
+static void BlitSw_Fill32(uint32_t *line, CPU_INT32S w, const uint32_t colour);
+static void BlitSw_Fill16(uint16_t *line, CPU_INT32S w, const uint16_t colour);
+static void BlitSw_Mask32(uint32_t *line, const CPU_INT08U *const mask, const CPU_INT32S w, const uint32_t colour);
+static uint32_t BlitSw_Mix(const uint32_t fg, const uint32_t bg, const CPU_INT32U a);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+void BlitSw_Fill(const blit_surf_t *const dst, const blit_rect_t *const rect, const uint32_t colour)
+{
+    CPU_INT08U pixel[4];
+    CPU_INT08U size = BlitPixelSize(dst->format);
+    CPU_INT32S y;
+    CPU_INT32S x;
+    CPU_INT08U *line;
+
+    BlitSw_Write(dst->format, pixel, colour);
+    for (y = rect->y; y < rect->y + rect->h; y++)
+    {
+        line = BlitSw_Pixel(dst, rect->x, y);
+        switch (dst->format)
+        {
+        case BLIT_FMT_ARGB8888:
+            BlitSw_Fill32((uint32_t *)line, rect->w, colour);
+            break;
+        case BLIT_FMT_RGB565:
+            BlitSw_Fill16((uint16_t *)line, rect->w, (uint16_t)(pixel[0] | (pixel[1] << 8)));
+            break;
+        default:
+            for (x = 0; x < rect->w; x++)
+            {
+                memcpy(&line[x * size], pixel, size);
+            }
+            break;
+        }
+    }
+}
+
+void BlitSw_Copy(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const blit_surf_t *const src, const blit_rect_t *const rect)
+{
+    CPU_INT08U dst_size = BlitPixelSize(dst->format);
+    CPU_INT08U src_size = BlitPixelSize(src->format);
+    CPU_INT08U *dst_line;
+    CPU_INT08U *src_line;
+    CPU_INT32S line;
+    CPU_INT32S i;
+
+    for (line = 0; line < rect->h; line++)
+    {
+        dst_line = BlitSw_Pixel(dst, x, y + line);
+        src_line = BlitSw_Pixel(src, rect->x, rect->y + line);
+        if (dst->format == src->format)
+        {
+            memmove(dst_line, src_line, (size_t)rect->w * dst_size);
+        }
+        else
+        {
+            for (i = 0; i < rect->w; i++)
+            {
+                BlitSw_Write(dst->format, &dst_line[i * dst_size], BlitSw_Read(src->format, &src_line[i * src_size]));
+            }
+        }
+    }
+}
+
+void BlitSw_Blend(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const blit_surf_t *const src, const blit_rect_t *const rect, const uint32_t colour)
+{
+    CPU_INT08U dst_size = BlitPixelSize(dst->format);
+    CPU_INT08U src_size = BlitPixelSize(src->format);
+    CPU_INT32U alpha_colour = colour >> 24;
+    CPU_INT08U *dst_line;
+    CPU_INT08U *src_line;
+    CPU_INT32U fg;
+    CPU_INT32U bg;
+    CPU_INT32U a;
+    CPU_INT32S line;
+    CPU_INT32S i;
+
+    for (line = 0; line < rect->h; line++)
+    {
+        dst_line = BlitSw_Pixel(dst, x, y + line);
+        src_line = BlitSw_Pixel(src, rect->x, rect->y + line);
+        if ((src->format == BLIT_FMT_A8) && (dst->format == BLIT_FMT_ARGB8888) && (alpha_colour == 255u))
+        {
+            BlitSw_Mask32((uint32_t *)dst_line, src_line, rect->w, colour);
+            continue;
+        }
+        for (i = 0; i < rect->w; i++)
+        {
+            if (src->format == BLIT_FMT_A8)
+            {
+                fg = ((CPU_INT32U)src_line[i] << 24) | (colour & 0x00FFFFFFu);
+            }
+            else
+            {
+                fg = BlitSw_Read(src->format, &src_line[i * src_size]);
+            }
+            a = BLIT_SW_DIV255((fg >> 24) * alpha_colour);
+            if (a == 0u)
+            {
+                continue;
+            }
+            if (a == 255u) // The formula gives the source colour, opaque
+            {
+                BlitSw_Write(dst->format, &dst_line[i * dst_size], fg | 0xFF000000u);
+                continue;
+            }
+            bg = BlitSw_Read(dst->format, &dst_line[i * dst_size]);
+            BlitSw_Write(dst->format, &dst_line[i * dst_size], BlitSw_Mix(fg, bg, a));
+        }
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static CPU_INT08U *BlitSw_Pixel(const blit_surf_t *const surf, const CPU_INT32S x, const CPU_INT32S y)
+{
+    return (CPU_INT08U *)surf->pixels + ((CPU_INT32U)y * surf->pitch + (CPU_INT32U)x) * BlitPixelSize(surf->format);
+}
+
+/**
+ * \return the pixel in ARGB8888, the missing bits replicated from the upper ones like the DMA2D does
+ */
+static uint32_t BlitSw_Read(const CPU_INT08U format, const CPU_INT08U *const p)
+{
+    CPU_INT32U v;
+    CPU_INT32U r;
+    CPU_INT32U g;
+    CPU_INT32U b;
+
+    switch (format)
+    {
+    case BLIT_FMT_ARGB8888:
+        return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    case BLIT_FMT_RGB888:
+        return 0xFF000000u | (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+    case BLIT_FMT_RGB565:
+        v = (CPU_INT32U)p[0] | ((CPU_INT32U)p[1] << 8);
+        r = (v >> 11) & 0x1Fu;
+        g = (v >> 5) & 0x3Fu;
+        b = v & 0x1Fu;
+        return 0xFF000000u | (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+    default:
+        return (uint32_t)p[0] << 24; // A8
+    }
+}
+
+static void BlitSw_Write(const CPU_INT08U format, CPU_INT08U *const p, const uint32_t colour)
+{
+    CPU_INT32U v;
+
+    switch (format)
+    {
+    case BLIT_FMT_ARGB8888:
+        p[3] = (CPU_INT08U)(colour >> 24);
+        /* fall through */
+    case BLIT_FMT_RGB888:
+        p[0] = (CPU_INT08U)colour;
+        p[1] = (CPU_INT08U)(colour >> 8);
+        p[2] = (CPU_INT08U)(colour >> 16);
+        break;
+    case BLIT_FMT_RGB565:
+        v = ((colour >> 8) & 0xF800u) | ((colour >> 5) & 0x07E0u) | ((colour >> 3) & 0x001Fu);
+        p[0] = (CPU_INT08U)v;
+        p[1] = (CPU_INT08U)(v >> 8);
+        break;
+    default:
+        p[0] = (CPU_INT08U)(colour >> 24);
+        break;
+    }
+}
+
+/**
+ * \brief Fill a line of ARGB8888 pixels, two per store once aligned, see Note #2
+ */
+static void BlitSw_Fill32(uint32_t *line, CPU_INT32S w, const uint32_t colour)
+{
+    blit_word_t word = ((blit_word_t)colour << 32) | colour;
+    blit_word_t *p;
+
+    if ((w > 0) && (((uintptr_t)line & (sizeof(blit_word_t) - 1u)) != 0u))
+    {
+        *line++ = colour;
+        w--;
+    }
+    p = (blit_word_t *)line;
+    for (; w >= 2; w -= 2)
+    {
+        *p++ = word;
+    }
+    if (w > 0)
+    {
+        *(uint32_t *)p = colour;
+    }
+}
+
+/**
+ * \brief Fill a line of RGB565 pixels, four per store once aligned, see Note #2
+ */
+static void BlitSw_Fill16(uint16_t *line, CPU_INT32S w, const uint16_t colour)
+{
+    blit_word_t word = colour * (blit_word_t)0x0001000100010001u;
+    blit_word_t *p;
+
+    while ((w > 0) && (((uintptr_t)line & (sizeof(blit_word_t) - 1u)) != 0u))
+    {
+        *line++ = colour;
+        w--;
+    }
+    p = (blit_word_t *)line;
+    for (; w >= 4; w -= 4)
+    {
+        *p++ = word;
+    }
+    line = (uint16_t *)p;
+    while (w-- > 0)
+    {
+        *line++ = colour;
+    }
+}
+
+/**
+ * \brief Blend a line of an A8 mask in an opaque colour over ARGB8888 pixels, the case of the glyphs & the
+ * circles, without the conversions of BlitSw_Blend()
+ */
+static void BlitSw_Mask32(uint32_t *line, const CPU_INT08U *const mask, const CPU_INT32S w, const uint32_t colour)
+{
+    CPU_INT32S i;
+
+    for (i = 0; i < w; i++)
+    {
+        if (mask[i] == 0xFFu)
+        {
+            line[i] = colour;
+        }
+        else if (mask[i] != 0u)
+        {
+            line[i] = BlitSw_Mix(colour, line[i], mask[i]);
+        }
+    }
+}
+
+/**
+ * \return fg of alpha a over bg, the alpha of the result, then the colour channels, see Note #3
+ */
+static uint32_t BlitSw_Mix(const uint32_t fg, const uint32_t bg, const CPU_INT32U a)
+{
+    uint32_t out;
+    CPU_INT32U shift;
+
+    out = (a + BLIT_SW_DIV255((bg >> 24) * (255u - a))) << 24;
+    for (shift = 0u; shift < 24u; shift += 8u)
+    {
+        out |= BLIT_SW_DIV255(((fg >> shift) & 0xFFu) * a + ((bg >> shift) & 0xFFu) * (255u - a)) << shift;
+    }
+    return out;
+}
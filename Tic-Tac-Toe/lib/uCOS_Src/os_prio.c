@@ -54,6 +54,9 @@ void  OS_PrioInit (void)
     for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
          OSPrioTbl[i] = 0u;
     }
+#if (OS_PRIO_TBL_2LVL > 0u)
+    OSPrioTblGrp = 0u;
+#endif
 
 #if (OS_CFG_TASK_IDLE_EN == 0u)
     OS_PrioInsert ((OS_PRIO)(OS_CFG_PRIO_MAX - 1u));            /* Insert what would be the idle task                   */
@@ -72,6 +75,14 @@ void  OS_PrioInit (void)
 * Returns    : The priority of the Highest Priority Task (HPT) waiting for the event
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With the two-level bitmap, bit 'n' of 'OSPrioTblGrp' (counting from the MSB) is set when 'OSPrioTbl[n]'
+*                 is non-zero.  The lookup is then always two count leading zeros, whatever OS_CFG_PRIO_MAX is:
+*
+*                     OSPrioTblGrp   [1 0 1 0 ...]
+*                                     |   |
+*                                     |   +--> OSPrioTbl[2]  [0 0 0 1 ...]  -> prio = 2 * 32 + 3
+*                                     +------> OSPrioTbl[0]  [0 0 1 0 ...]  -> prio = 0 * 32 + 2  (highest)
 ************************************************************************************************************************
 */
 
@@ -89,6 +100,14 @@ OS_PRIO  OS_PrioGetHighest (void)
     }
 
 
+#elif (OS_PRIO_TBL_2LVL > 0u)                                /* Summary word + leaf words (see Note #2)              */
+    CPU_DATA  ix;
+
+
+    ix = CPU_CntLeadZeros(OSPrioTblGrp);
+    return ((OS_PRIO)((ix * (CPU_CFG_DATA_SIZE * 8u)) + CPU_CntLeadZeros(OSPrioTbl[ix])));
+
+
 #else
     CPU_DATA  *p_tbl;
     OS_PRIO    prio;
@@ -141,6 +160,9 @@ void  OS_PrioInsert (OS_PRIO  prio)
     ix             = (OS_PRIO)(prio /  (CPU_CFG_DATA_SIZE * 8u));
     bit_nbr        = (CPU_DATA)prio & ((CPU_CFG_DATA_SIZE * 8u) - 1u);
     OSPrioTbl[ix] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr);
+#if (OS_PRIO_TBL_2LVL > 0u)
+    OSPrioTblGrp  |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - ix);
+#endif
 #endif
 }
 
@@ -179,5 +201,10 @@ void  OS_PrioRemove (OS_PRIO  prio)
     ix             =   (OS_PRIO)(prio  /   (CPU_CFG_DATA_SIZE * 8u));
     bit_nbr        =   (CPU_DATA)prio  &  ((CPU_CFG_DATA_SIZE * 8u) - 1u);
     OSPrioTbl[ix] &= ~((CPU_DATA)  1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr));
+#if (OS_PRIO_TBL_2LVL > 0u)
+    if (OSPrioTbl[ix] == 0u) {                                  /* Last priority of this entry, clear its summary bit   */
+        OSPrioTblGrp &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - ix));
+    }
+#endif
 #endif
 }
@@ -0,0 +1,245 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                    RAM Ring Buffer Trace Recorder
+*
+* File      : os_trace_events.h
+* Version   : V3.08.00
+*********************************************************************************************************
+* Note(s)   : (1) Included by 'os_trace.h' when OS_CFG_TRACE_EN is enabled, this file maps the kernel's
+*                 OS_TRACE_xxx() hooks on the recorder of 'os_trace_rec.c'.  Hooks not defined here stay
+*                 empty (see 'os_trace.h').
+*
+*             (2) The application calls OS_TRACE_INIT() & OS_TRACE_START() before OSInit(), so the
+*                 creation of the kernel tasks is recorded as well.
+*
+*             (3) Task & kernel object IDs are assigned by the recorder on creation, in the 'TaskID',
+*                 'SemID', ... members the kernel reserves for tracers.  An OS_Q is identified by the
+*                 ID of its message queue.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_TRACE_EVENTS_H
+#define  OS_TRACE_EVENTS_H
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "os_trace_rec.h"
+
+
+/*
+*********************************************************************************************************
+*                                              RECORDER
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_INIT()                                    OS_TraceRecInit()
+#define  OS_TRACE_START()                                   OS_TraceRecStart()
+#define  OS_TRACE_STOP()                                    OS_TraceRecStop()
+#define  OS_TRACE_CLEAR()                                   OS_TraceRecClr()
+
+
+/*
+*********************************************************************************************************
+*                                             ISR & TICK
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_ISR_ENTER()                               OS_TraceRecEvt(OS_TRACE_EVT_ISR_ENTER,          0u, 0u)
+#define  OS_TRACE_ISR_EXIT()                                OS_TraceRecEvt(OS_TRACE_EVT_ISR_EXIT,           0u, 0u)
+#define  OS_TRACE_ISR_EXIT_TO_SCHEDULER()                   OS_TraceRecEvt(OS_TRACE_EVT_ISR_EXIT_TO_SCHED,  0u, 0u)
+#define  OS_TRACE_TICK_INCREMENT(OSTickCtr)                 OS_TraceRecEvt(OS_TRACE_EVT_TICK,               0u, (CPU_INT32U)(OSTickCtr))
+
+#define  OS_TRACE_ISR_REGISTER(isr_id, isr_name, isr_prio)  OS_TraceRecEvt(OS_TRACE_EVT_ISR_REGISTER, (CPU_INT16U)(isr_id), (CPU_INT32U)(isr_prio))
+#define  OS_TRACE_ISR_BEGIN(isr_id)                         OS_TraceRecEvt(OS_TRACE_EVT_ISR_BEGIN,    (CPU_INT16U)(isr_id), 0u)
+#define  OS_TRACE_ISR_END()                                 OS_TraceRecEvt(OS_TRACE_EVT_ISR_END,      0u,                   0u)
+
+
+/*
+*********************************************************************************************************
+*                                                TASKS
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_TASK_EVT(evt, p_tcb, arg)                 OS_TraceRecEvt((evt), OS_TRACE_REC_TASK_ID(p_tcb), (CPU_INT32U)(arg))
+
+#define  OS_TRACE_TASK_CREATE(p_tcb)                        OS_TraceRecTaskCreate(p_tcb)
+#define  OS_TRACE_TASK_CREATE_FAILED(p_tcb)                 OS_TRACE_TASK_EVT(OS_TRACE_EVT_TASK_CREATE_FAILED,    p_tcb, 0u)
+#define  OS_TRACE_TASK_DEL(p_tcb)                           OS_TRACE_TASK_EVT(OS_TRACE_EVT_TASK_DEL,              p_tcb, 0u)
+#define  OS_TRACE_TASK_READY(p_tcb)                         OS_TRACE_TASK_EVT(OS_TRACE_EVT_TASK_READY,            p_tcb, 0u)
+#define  OS_TRACE_TASK_SWITCHED_IN(p_tcb)                   OS_TRACE_TASK_EVT(OS_TRACE_EVT_TASK_SWITCHED_IN,      p_tcb, 0u)
+#define  OS_TRACE_TASK_DLY(dly_ticks)                       OS_TraceRecEvt(OS_TRACE_EVT_TASK_DLY, 0u, (CPU_INT32U)(dly_ticks))
+#define  OS_TRACE_TASK_SUSPEND(p_tcb)                       OS_TRACE_TASK_EVT(OS_TRACE_EVT_TASK_SUSPEND,          p_tcb, 0u)
+#define  OS_TRACE_TASK_SUSPENDED(p_tcb)                     OS_TRACE_TASK_EVT(OS_TRACE_EVT_TASK_SUSPENDED,        p_tcb, 0u)
+#define  OS_TRACE_TASK_RESUME(p_tcb)                        OS_TRACE_TASK_EVT(OS_TRACE_EVT_TASK_RESUME,           p_tcb, 0u)
+#define  OS_TRACE_TASK_PREEMPT(p_tcb)                       OS_TRACE_TASK_EVT(OS_TRACE_EVT_TASK_PREEMPT,          p_tcb, 0u)
+#define  OS_TRACE_TASK_PRIO_CHANGE(p_tcb, prio)             OS_TRACE_TASK_EVT(OS_TRACE_EVT_TASK_PRIO_CHANGE,      p_tcb, prio)
+#define  OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb, prio)      OS_TRACE_TASK_EVT(OS_TRACE_EVT_TASK_PRIO_INHERIT,     p_tcb, prio)
+#define  OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb, prio)   OS_TRACE_TASK_EVT(OS_TRACE_EVT_TASK_PRIO_DISINHERIT,  p_tcb, prio)
+#define  OS_TRACE_RWLOCK_TASK_PRIO_INHERIT(p_tcb, prio)     OS_TRACE_TASK_EVT(OS_TRACE_EVT_TASK_PRIO_INHERIT,     p_tcb, prio)
+#define  OS_TRACE_RWLOCK_TASK_PRIO_DISINHERIT(p_tcb, prio)  OS_TRACE_TASK_EVT(OS_TRACE_EVT_TASK_PRIO_DISINHERIT,  p_tcb, prio)
+
+
+/*
+*********************************************************************************************************
+*                                            KERNEL OBJECTS
+*
+* Note(s) : (1) The xxx_FAILED events are also recorded on the argument checks, where the object pointer
+*               may be NULL: its ID is then recorded as 0.
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_OBJ_EVT(evt, id)                          OS_TraceRecEvt((evt), (id), 0u)
+#define  OS_TRACE_OBJ_EVT_FAILED(evt, p_obj, id)            OS_TraceRecEvt((evt), (((p_obj) != 0) ? (p_obj)->id : 0u), 0u)
+
+                                                                /* ----------------- TASK SEMAPHORES ------------------ */
+#define  OS_TRACE_TASK_SEM_CREATE(p_tcb, p_name)            OS_TraceRecObjCreate(&(p_tcb)->SemID, OS_TRACE_OBJ_TYPE_TASK_SEM, (p_name))
+#define  OS_TRACE_TASK_SEM_POST(p_tcb)                      OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_POST,         (p_tcb)->SemID)
+#define  OS_TRACE_TASK_SEM_POST_FAILED(p_tcb)               OS_TRACE_OBJ_EVT_FAILED(OS_TRACE_EVT_OBJ_POST_FAILED, p_tcb, SemID)
+#define  OS_TRACE_TASK_SEM_PEND(p_tcb)                      OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_PEND,         (p_tcb)->SemID)
+#define  OS_TRACE_TASK_SEM_PEND_FAILED(p_tcb)               OS_TRACE_OBJ_EVT_FAILED(OS_TRACE_EVT_OBJ_PEND_FAILED, p_tcb, SemID)
+#define  OS_TRACE_TASK_SEM_PEND_BLOCK(p_tcb)                OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_PEND_BLOCK,   (p_tcb)->SemID)
+                                                                /* ----------------- TASK MESSAGE QUEUES -------------- */
+#define  OS_TRACE_TASK_MSG_Q_CREATE(p_msg_q, p_name)        OS_TraceRecObjCreate(&(p_msg_q)->MsgQID, OS_TRACE_OBJ_TYPE_TASK_Q, (p_name))
+#define  OS_TRACE_TASK_MSG_Q_POST(p_msg_q)                  OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_POST,         (p_msg_q)->MsgQID)
+#define  OS_TRACE_TASK_MSG_Q_POST_FAILED(p_msg_q)           OS_TRACE_OBJ_EVT_FAILED(OS_TRACE_EVT_OBJ_POST_FAILED, p_msg_q, MsgQID)
+#define  OS_TRACE_TASK_MSG_Q_PEND(p_msg_q)                  OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_PEND,         (p_msg_q)->MsgQID)
+#define  OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q)           OS_TRACE_OBJ_EVT_FAILED(OS_TRACE_EVT_OBJ_PEND_FAILED, p_msg_q, MsgQID)
+#define  OS_TRACE_TASK_MSG_Q_PEND_BLOCK(p_msg_q)            OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_PEND_BLOCK,   (p_msg_q)->MsgQID)
+                                                                /* ---------------------- MUTEXES --------------------- */
+#define  OS_TRACE_MUTEX_CREATE(p_mutex, p_name)             OS_TraceRecObjCreate(&(p_mutex)->MutexID, OS_OBJ_TYPE_MUTEX, (p_name))
+#define  OS_TRACE_MUTEX_DEL(p_mutex)                        OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_DEL,          (p_mutex)->MutexID)
+#define  OS_TRACE_MUTEX_POST(p_mutex)                       OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_POST,         (p_mutex)->MutexID)
+#define  OS_TRACE_MUTEX_POST_FAILED(p_mutex)                OS_TRACE_OBJ_EVT_FAILED(OS_TRACE_EVT_OBJ_POST_FAILED, p_mutex, MutexID)
+#define  OS_TRACE_MUTEX_PEND(p_mutex)                       OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_PEND,         (p_mutex)->MutexID)
+#define  OS_TRACE_MUTEX_PEND_FAILED(p_mutex)                OS_TRACE_OBJ_EVT_FAILED(OS_TRACE_EVT_OBJ_PEND_FAILED, p_mutex, MutexID)
+#define  OS_TRACE_MUTEX_PEND_BLOCK(p_mutex)                 OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_PEND_BLOCK,   (p_mutex)->MutexID)
+                                                                /* ---------------- READER-WRITER LOCKS --------------- */
+#define  OS_TRACE_RWLOCK_CREATE(p_lock, p_name)             OS_TraceRecObjCreate(&(p_lock)->RwLockID, OS_OBJ_TYPE_RWLOCK, (p_name))
+#define  OS_TRACE_RWLOCK_DEL(p_lock)                        OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_DEL,          (p_lock)->RwLockID)
+#define  OS_TRACE_RWLOCK_POST(p_lock)                       OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_POST,         (p_lock)->RwLockID)
+#define  OS_TRACE_RWLOCK_POST_FAILED(p_lock)                OS_TRACE_OBJ_EVT_FAILED(OS_TRACE_EVT_OBJ_POST_FAILED, p_lock, RwLockID)
+#define  OS_TRACE_RWLOCK_PEND(p_lock)                       OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_PEND,         (p_lock)->RwLockID)
+#define  OS_TRACE_RWLOCK_PEND_FAILED(p_lock)                OS_TRACE_OBJ_EVT_FAILED(OS_TRACE_EVT_OBJ_PEND_FAILED, p_lock, RwLockID)
+#define  OS_TRACE_RWLOCK_PEND_BLOCK(p_lock)                 OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_PEND_BLOCK,   (p_lock)->RwLockID)
+                                                                /* -------------------- SEMAPHORES -------------------- */
+#define  OS_TRACE_SEM_CREATE(p_sem, p_name)                 OS_TraceRecObjCreate(&(p_sem)->SemID, OS_OBJ_TYPE_SEM, (p_name))
+#define  OS_TRACE_SEM_DEL(p_sem)                            OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_DEL,          (p_sem)->SemID)
+#define  OS_TRACE_SEM_POST(p_sem)                           OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_POST,         (p_sem)->SemID)
+#define  OS_TRACE_SEM_POST_FAILED(p_sem)                    OS_TRACE_OBJ_EVT_FAILED(OS_TRACE_EVT_OBJ_POST_FAILED, p_sem, SemID)
+#define  OS_TRACE_SEM_PEND(p_sem)                           OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_PEND,         (p_sem)->SemID)
+#define  OS_TRACE_SEM_PEND_FAILED(p_sem)                    OS_TRACE_OBJ_EVT_FAILED(OS_TRACE_EVT_OBJ_PEND_FAILED, p_sem, SemID)
+#define  OS_TRACE_SEM_PEND_BLOCK(p_sem)                     OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_PEND_BLOCK,   (p_sem)->SemID)
+                                                                /* ------------------ MESSAGE QUEUES ------------------ */
+#define  OS_TRACE_Q_CREATE(p_q, p_name)                     OS_TraceRecObjCreate(&(p_q)->MsgQ.MsgQID, OS_OBJ_TYPE_Q, (p_name))
+#define  OS_TRACE_Q_DEL(p_q)                                OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_DEL,          (p_q)->MsgQ.MsgQID)
+#define  OS_TRACE_Q_POST(p_q)                               OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_POST,         (p_q)->MsgQ.MsgQID)
+#define  OS_TRACE_Q_POST_FAILED(p_q)                        OS_TRACE_OBJ_EVT_FAILED(OS_TRACE_EVT_OBJ_POST_FAILED, p_q, MsgQ.MsgQID)
+#define  OS_TRACE_Q_PEND(p_q)                               OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_PEND,         (p_q)->MsgQ.MsgQID)
+#define  OS_TRACE_Q_PEND_FAILED(p_q)                        OS_TRACE_OBJ_EVT_FAILED(OS_TRACE_EVT_OBJ_PEND_FAILED, p_q, MsgQ.MsgQID)
+#define  OS_TRACE_Q_PEND_BLOCK(p_q)                         OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_PEND_BLOCK,   (p_q)->MsgQ.MsgQID)
+                                                                /* ------------------- EVENT FLAGS -------------------- */
+#define  OS_TRACE_FLAG_CREATE(p_grp, p_name)                OS_TraceRecObjCreate(&(p_grp)->FlagID, OS_OBJ_TYPE_FLAG, (p_name))
+#define  OS_TRACE_FLAG_DEL(p_grp)                           OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_DEL,          (p_grp)->FlagID)
+#define  OS_TRACE_FLAG_POST(p_grp)                          OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_POST,         (p_grp)->FlagID)
+#define  OS_TRACE_FLAG_POST_FAILED(p_grp)                   OS_TRACE_OBJ_EVT_FAILED(OS_TRACE_EVT_OBJ_POST_FAILED, p_grp, FlagID)
+#define  OS_TRACE_FLAG_PEND(p_grp)                          OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_PEND,         (p_grp)->FlagID)
+#define  OS_TRACE_FLAG_PEND_FAILED(p_grp)                   OS_TRACE_OBJ_EVT_FAILED(OS_TRACE_EVT_OBJ_PEND_FAILED, p_grp, FlagID)
+#define  OS_TRACE_FLAG_PEND_BLOCK(p_grp)                    OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_PEND_BLOCK,   (p_grp)->FlagID)
+                                                                /* ---------------- MEMORY PARTITIONS ----------------- */
+#define  OS_TRACE_MEM_CREATE(p_mem, p_name)                 OS_TraceRecObjCreate(&(p_mem)->MemID, OS_OBJ_TYPE_MEM, (p_name))
+#define  OS_TRACE_MEM_PUT(p_mem)                            OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_POST,         (p_mem)->MemID)
+#define  OS_TRACE_MEM_PUT_FAILED(p_mem)                     OS_TRACE_OBJ_EVT_FAILED(OS_TRACE_EVT_OBJ_POST_FAILED, p_mem, MemID)
+#define  OS_TRACE_MEM_GET(p_mem)                            OS_TRACE_OBJ_EVT(OS_TRACE_EVT_OBJ_PEND,         (p_mem)->MemID)
+#define  OS_TRACE_MEM_GET_FAILED(p_mem)                     OS_TRACE_OBJ_EVT_FAILED(OS_TRACE_EVT_OBJ_PEND_FAILED, p_mem, MemID)
+
+
+/*
+*********************************************************************************************************
+*                                          KERNEL API ENTRY
+*
+* Note(s) : (1) The API is entered before its arguments are checked, so the object pointer may be NULL.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TRACE_API_ENTER_EN > 0u)
+#define  OS_TRACE_API_ENTER(api, p_obj, id)                 OS_TraceRecEvt(OS_TRACE_EVT_API_ENTER, (api), (CPU_INT32U)(((p_obj) != 0) ? (p_obj)->id : 0u))
+
+#define  OS_TRACE_MUTEX_DEL_ENTER(p_mutex, opt)                            OS_TRACE_API_ENTER(OS_TRACE_API_MUTEX_DEL,       p_mutex, MutexID)
+#define  OS_TRACE_MUTEX_POST_ENTER(p_mutex, opt)                           OS_TRACE_API_ENTER(OS_TRACE_API_MUTEX_POST,      p_mutex, MutexID)
+#define  OS_TRACE_MUTEX_PEND_ENTER(p_mutex, timeout, opt, p_ts)            OS_TRACE_API_ENTER(OS_TRACE_API_MUTEX_PEND,      p_mutex, MutexID)
+#define  OS_TRACE_TASK_MSG_Q_POST_ENTER(p_msg_q, p_void, msg_size, opt)    OS_TRACE_API_ENTER(OS_TRACE_API_TASK_MSG_Q_POST, p_msg_q, MsgQID)
+#define  OS_TRACE_TASK_MSG_Q_PEND_ENTER(p_msg_q, timeout, opt, p_msg_size, p_ts) \
+                                                                           OS_TRACE_API_ENTER(OS_TRACE_API_TASK_MSG_Q_PEND, p_msg_q, MsgQID)
+#define  OS_TRACE_TASK_SEM_POST_ENTER(p_tcb, opt)                          OS_TRACE_API_ENTER(OS_TRACE_API_TASK_SEM_POST,   p_tcb,   SemID)
+#define  OS_TRACE_TASK_SEM_PEND_ENTER(p_tcb, timeout, opt, p_ts)           OS_TRACE_API_ENTER(OS_TRACE_API_TASK_SEM_PEND,   p_tcb,   SemID)
+#define  OS_TRACE_TASK_RESUME_ENTER(p_tcb)                                 OS_TRACE_API_ENTER(OS_TRACE_API_TASK_RESUME,     p_tcb,   TaskID)
+#define  OS_TRACE_TASK_SUSPEND_ENTER(p_tcb)                                OS_TRACE_API_ENTER(OS_TRACE_API_TASK_SUSPEND,    p_tcb,   TaskID)
+#define  OS_TRACE_RWLOCK_DEL_ENTER(p_lock, opt)                            OS_TRACE_API_ENTER(OS_TRACE_API_RWLOCK_DEL,      p_lock,  RwLockID)
+#define  OS_TRACE_RWLOCK_POST_ENTER(p_lock, opt)                           OS_TRACE_API_ENTER(OS_TRACE_API_RWLOCK_POST,     p_lock,  RwLockID)
+#define  OS_TRACE_RWLOCK_RD_PEND_ENTER(p_lock, timeout, opt, p_ts)         OS_TRACE_API_ENTER(OS_TRACE_API_RWLOCK_RD_PEND,  p_lock,  RwLockID)
+#define  OS_TRACE_RWLOCK_WR_PEND_ENTER(p_lock, timeout, opt, p_ts)         OS_TRACE_API_ENTER(OS_TRACE_API_RWLOCK_WR_PEND,  p_lock,  RwLockID)
+#define  OS_TRACE_SEM_DEL_ENTER(p_sem, opt)                                OS_TRACE_API_ENTER(OS_TRACE_API_SEM_DEL,         p_sem,   SemID)
+#define  OS_TRACE_SEM_POST_ENTER(p_sem, opt)                               OS_TRACE_API_ENTER(OS_TRACE_API_SEM_POST,        p_sem,   SemID)
+#define  OS_TRACE_SEM_PEND_ENTER(p_sem, timeout, opt, p_ts)                OS_TRACE_API_ENTER(OS_TRACE_API_SEM_PEND,        p_sem,   SemID)
+#define  OS_TRACE_Q_DEL_ENTER(p_q, opt)                                    OS_TRACE_API_ENTER(OS_TRACE_API_Q_DEL,           p_q,     MsgQ.MsgQID)
+#define  OS_TRACE_Q_POST_ENTER(p_q, p_void, msg_size, opt)                 OS_TRACE_API_ENTER(OS_TRACE_API_Q_POST,          p_q,     MsgQ.MsgQID)
+#define  OS_TRACE_Q_PEND_ENTER(p_q, timeout, opt, p_msg_size, p_ts)        OS_TRACE_API_ENTER(OS_TRACE_API_Q_PEND,          p_q,     MsgQ.MsgQID)
+#define  OS_TRACE_FLAG_DEL_ENTER(p_grp, opt)                               OS_TRACE_API_ENTER(OS_TRACE_API_FLAG_DEL,        p_grp,   FlagID)
+#define  OS_TRACE_FLAG_POST_ENTER(p_grp, flags, opt)                       OS_TRACE_API_ENTER(OS_TRACE_API_FLAG_POST,       p_grp,   FlagID)
+#define  OS_TRACE_FLAG_PEND_ENTER(p_grp, flags, timeout, opt, p_ts)        OS_TRACE_API_ENTER(OS_TRACE_API_FLAG_PEND,       p_grp,   FlagID)
+#define  OS_TRACE_MEM_PUT_ENTER(p_mem, p_blk)                              OS_TRACE_API_ENTER(OS_TRACE_API_MEM_PUT,         p_mem,   MemID)
+#define  OS_TRACE_MEM_GET_ENTER(p_mem)                                     OS_TRACE_API_ENTER(OS_TRACE_API_MEM_GET,         p_mem,   MemID)
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           KERNEL API EXIT
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TRACE_API_EXIT_EN > 0u)
+#define  OS_TRACE_API_EXIT(api, RetVal)                     OS_TraceRecEvt(OS_TRACE_EVT_API_EXIT, (api), (CPU_INT32U)(RetVal))
+
+#define  OS_TRACE_MUTEX_DEL_EXIT(RetVal)                    OS_TRACE_API_EXIT(OS_TRACE_API_MUTEX_DEL,       RetVal)
+#define  OS_TRACE_MUTEX_POST_EXIT(RetVal)                   OS_TRACE_API_EXIT(OS_TRACE_API_MUTEX_POST,      RetVal)
+#define  OS_TRACE_MUTEX_PEND_EXIT(RetVal)                   OS_TRACE_API_EXIT(OS_TRACE_API_MUTEX_PEND,      RetVal)
+#define  OS_TRACE_TASK_MSG_Q_POST_EXIT(RetVal)              OS_TRACE_API_EXIT(OS_TRACE_API_TASK_MSG_Q_POST, RetVal)
+#define  OS_TRACE_TASK_MSG_Q_PEND_EXIT(RetVal)              OS_TRACE_API_EXIT(OS_TRACE_API_TASK_MSG_Q_PEND, RetVal)
+#define  OS_TRACE_TASK_SEM_POST_EXIT(RetVal)                OS_TRACE_API_EXIT(OS_TRACE_API_TASK_SEM_POST,   RetVal)
+#define  OS_TRACE_TASK_SEM_PEND_EXIT(RetVal)                OS_TRACE_API_EXIT(OS_TRACE_API_TASK_SEM_PEND,   RetVal)
+#define  OS_TRACE_TASK_RESUME_EXIT(RetVal)                  OS_TRACE_API_EXIT(OS_TRACE_API_TASK_RESUME,     RetVal)
+#define  OS_TRACE_TASK_SUSPEND_EXIT(RetVal)                 OS_TRACE_API_EXIT(OS_TRACE_API_TASK_SUSPEND,    RetVal)
+#define  OS_TRACE_RWLOCK_DEL_EXIT(RetVal)                   OS_TRACE_API_EXIT(OS_TRACE_API_RWLOCK_DEL,      RetVal)
+#define  OS_TRACE_RWLOCK_POST_EXIT(RetVal)                  OS_TRACE_API_EXIT(OS_TRACE_API_RWLOCK_POST,     RetVal)
+#define  OS_TRACE_RWLOCK_RD_PEND_EXIT(RetVal)               OS_TRACE_API_EXIT(OS_TRACE_API_RWLOCK_RD_PEND,  RetVal)
+#define  OS_TRACE_RWLOCK_WR_PEND_EXIT(RetVal)               OS_TRACE_API_EXIT(OS_TRACE_API_RWLOCK_WR_PEND,  RetVal)
+#define  OS_TRACE_SEM_DEL_EXIT(RetVal)                      OS_TRACE_API_EXIT(OS_TRACE_API_SEM_DEL,         RetVal)
+#define  OS_TRACE_SEM_POST_EXIT(RetVal)                     OS_TRACE_API_EXIT(OS_TRACE_API_SEM_POST,        RetVal)
+#define  OS_TRACE_SEM_PEND_EXIT(RetVal)                     OS_TRACE_API_EXIT(OS_TRACE_API_SEM_PEND,        RetVal)
+#define  OS_TRACE_Q_DEL_EXIT(RetVal)                        OS_TRACE_API_EXIT(OS_TRACE_API_Q_DEL,           RetVal)
+#define  OS_TRACE_Q_POST_EXIT(RetVal)                       OS_TRACE_API_EXIT(OS_TRACE_API_Q_POST,          RetVal)
+#define  OS_TRACE_Q_PEND_EXIT(RetVal)                       OS_TRACE_API_EXIT(OS_TRACE_API_Q_PEND,          RetVal)
+#define  OS_TRACE_FLAG_DEL_EXIT(RetVal)                     OS_TRACE_API_EXIT(OS_TRACE_API_FLAG_DEL,        RetVal)
+#define  OS_TRACE_FLAG_POST_EXIT(RetVal)                    OS_TRACE_API_EXIT(OS_TRACE_API_FLAG_POST,       RetVal)
+#define  OS_TRACE_FLAG_PEND_EXIT(RetVal)                    OS_TRACE_API_EXIT(OS_TRACE_API_FLAG_PEND,       RetVal)
+#define  OS_TRACE_MEM_PUT_EXIT(RetVal)                      OS_TRACE_API_EXIT(OS_TRACE_API_MEM_PUT,         RetVal)
+#define  OS_TRACE_MEM_GET_EXIT(RetVal)                      OS_TRACE_API_EXIT(OS_TRACE_API_MEM_GET,         RetVal)
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
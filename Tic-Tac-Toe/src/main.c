@@ -5,6 +5,10 @@
 */
 
 #include "main.h"
+#include "disp.h"
+#include "touch.h"
+
+#include <string.h>
 
 /*
 *********************************************************************************************************
@@ -21,6 +25,8 @@
 #define BOT_PLAYER_PRIO 3u
 #define HUMAN_PLAYER_PRIO 3u
 #define ANALYSIS_PRIO 4u
+#define COMPOSITOR_PRIO 2u // Above the players, see 'disp.h'
+#define TOUCH_PRIO 2u      // Driver of the touch screen, above HumanPlayer, see 'touch.h'
 
 /* Debug logger */
 // typedef unsigned char LOG_MASK    //typedef not working
@@ -39,6 +45,8 @@
 #define BOARD_SIZE BOARD_SIDE_SIZE * BOARD_SIDE_SIZE
 #define CIRCLE_RADIUS (uint16_t)20
 #define CROSS_SIZE (uint16_t)20
+#define BOT_COLOUR LCD_COLOR_GREEN
+#define HUMAN_COLOUR LCD_COLOR_RED
 
 /* Data structures */
 typedef struct tuples
@@ -47,6 +55,12 @@ typedef struct tuples
     uint16_t Y;
 } tuple;
 
+typedef struct boards
+{
+    CPU_INT08U cells[BOARD_SIZE];
+    CPU_INT08U moves;
+} board_t; // Snapshot of the game the players publish, read by DrawBoard & Analysis
+
 /*
 *********************************************************************************************************
 *                                           GLOBAL VARIABLES
@@ -72,7 +86,8 @@ static TS_StateTypeDef TS_State;
 CPU_INT08U board[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0}; // 0 is empty, 1 is bot player, 2 is human player
 CPU_INT08U moves = 0;
 tuple gridCenterCoordinates[9] = {{40, 280}, {120, 280}, {200, 280}, {40, 200}, {120, 200}, {200, 200}, {40, 120}, {120, 120}, {200, 120}};
-OS_MUTEX mutex;
+OS_SEQLOCK seqlock_board; // The players write the board in turn & publish it, the readers copy it
+static board_t board_buf[2];
 
 /*
 *********************************************************************************************************
@@ -92,9 +107,10 @@ static void SystemClock_Config(void);
 static void LCD_Init(void);
 static void PrintResult(uint8_t who);
 static void GameOver(void);
-static void drawCross(const uint16_t x, const uint16_t y, const uint16_t size);
-static void drawMark();
+static void drawCross(disp_batch_t *const batch, const uint16_t x, const uint16_t y, const uint16_t size);
+static void drawMark(disp_batch_t *const batch, const board_t *const shown);
 static void logger(const uint8_t mask);
+static void boardPublish(void);
 static const CPU_INT08S touchInput();
 
 /*
@@ -107,12 +123,11 @@ int main(void)
 {
     OS_ERR err;
 
+    CPU_Init(); //Timestamp timer of OS_TS_GET(), before the kernel uses it
+
     OSInit(&err);
 
-    //mutex is actually not needed in this App at all. Because each Task run on their own turn by Task Control Block, there is no cocurrency. But I decided to leave the original code for case study 
-    OSMutexCreate((OS_MUTEX *)&mutex,
-                  (CPU_CHAR *)"Resource Mutex",
-                  (OS_ERR *)&err);
+    OSSeqLockCreate(&seqlock_board, (CPU_CHAR *)"Snapshot of the board", &board_buf[0], &board_buf[1], sizeof(board_t), &err);
 
     OSTaskCreate((OS_TCB *)&AppTaskStartTCB,
                  (CPU_CHAR *)"App Task Start",
@@ -144,21 +159,24 @@ static void AppTaskStart(void *p_arg)
     HAL_Init();
 
     SystemClock_Config();
+    CPU_TS_TmrInit(); //Timestamps count at the new core clock
 
     BSP_LED_Init(LED3);
     BSP_LED_Init(LED4);
 
     LCD_Init();
+    BlitInit(&err); // Before the first transfer, see 'blit.h'
+    DispInit(COMPOSITOR_PRIO, &err); // The only task drawing on the LCD from now on
 
     uint8_t status = 0;
     status = BSP_TS_Init(BSP_LCD_GetXSize(), BSP_LCD_GetYSize());
 
     if (status != TS_OK)
     {
-        BSP_LCD_SetBackColor(LCD_COLOR_WHITE);
-        BSP_LCD_SetTextColor(LCD_COLOR_RED);
-        BSP_LCD_DisplayStringAt(0, BSP_LCD_GetYSize() - 95, (uint8_t *)"ERROR", CENTER_MODE);
-        BSP_LCD_DisplayStringAt(0, BSP_LCD_GetYSize() - 80, (uint8_t *)"Touchscreen cannot be initialized", CENTER_MODE);
+        disp_batch_t *batch = DispBatchGet(0u, &err);
+        DispText(batch, 0, BSP_LCD_GetYSize() - 95, (CPU_CHAR *)"ERROR", CENTER_MODE, &Font24, LCD_COLOR_RED, LCD_COLOR_WHITE);
+        DispText(batch, 0, BSP_LCD_GetYSize() - 80, (CPU_CHAR *)"Touchscreen cannot be initialized", CENTER_MODE, &Font24, LCD_COLOR_RED, LCD_COLOR_WHITE);
+        DispBatchPost(batch, &err);
     }
     else
     {
@@ -204,6 +222,8 @@ static void AppTaskStart(void *p_arg)
                      (void *)0,
                      (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
                      (OS_ERR *)&err);
+        TouchSubscribe(&HumanPlayerTCB, TOUCH_EVT_TAP, &err);
+        TouchInit(TOUCH_PRIO, &err);
 
         OSTaskCreate((OS_TCB *)&AnalysisTCB,
                      (CPU_CHAR *)"Analysis Task",
@@ -235,14 +255,18 @@ static void DrawBoard(void *p_arg)
 {
     OS_ERR err;
     CPU_TS ts;
-
-    BSP_LCD_Clear(LCD_COLOR_BLACK);
-    BSP_LCD_SetTextColor(LCD_COLOR_WHITE);
-    BSP_LCD_DrawHLine(0, BSP_LCD_GetYSize() - 240, 240);
-    BSP_LCD_DrawHLine(0, BSP_LCD_GetYSize() - 160, 240);
-    BSP_LCD_DrawHLine(0, BSP_LCD_GetYSize() - 80, 240);
-    BSP_LCD_DrawVLine(BSP_LCD_GetXSize() - 160, 80, 240);
-    BSP_LCD_DrawVLine(BSP_LCD_GetXSize() - 80, 80, 240);
+    disp_batch_t *batch;
+    board_t shown;
+
+    // The lines of the grid, 1 pixel fills like BSP_LCD_DrawHLine() & BSP_LCD_DrawVLine()
+    batch = DispBatchGet(0u, &err);
+    DispClear(batch, LCD_COLOR_BLACK);
+    DispFillRect(batch, 0, BSP_LCD_GetYSize() - 240, 240, 1, LCD_COLOR_WHITE);
+    DispFillRect(batch, 0, BSP_LCD_GetYSize() - 160, 240, 1, LCD_COLOR_WHITE);
+    DispFillRect(batch, 0, BSP_LCD_GetYSize() - 80, 240, 1, LCD_COLOR_WHITE);
+    DispFillRect(batch, BSP_LCD_GetXSize() - 160, 80, 1, 240, LCD_COLOR_WHITE);
+    DispFillRect(batch, BSP_LCD_GetXSize() - 80, 80, 1, 240, LCD_COLOR_WHITE);
+    DispBatchPost(batch, &err);
 
     while (DEF_TRUE)
     {
@@ -251,15 +275,10 @@ static void DrawBoard(void *p_arg)
                       (CPU_TS *)&ts,
                       (OS_ERR *)&err);
 
-        OSMutexPend((OS_MUTEX *)&mutex, // drawMark() is non-reentrance function access
-                    (OS_TICK)0,
-                    (OS_OPT)OS_OPT_PEND_BLOCKING,
-                    (CPU_TS *)&ts,
-                    (OS_ERR *)&err);
-        drawMark();
-        OSMutexPost((OS_MUTEX *)&mutex,
-                    (OS_OPT)OS_OPT_POST_NONE,
-                    (OS_ERR *)&err);
+        batch = DispBatchGet(0u, &err);
+        (void)OSSeqLockRead(&seqlock_board, &shown, &err); // Copy of the board, no lock
+        drawMark(batch, &shown);
+        DispBatchPost(batch, &err);
         OSTaskSemPost((OS_TCB *)&AnalysisTCB,
                       (OS_OPT)OS_OPT_POST_NONE,
                       (OS_ERR *)&err);
@@ -279,14 +298,6 @@ static void BotPlayer(void *p_arg)
                       (CPU_TS *)&ts,
                       (OS_ERR *)&err);
 
-        OSMutexPend((OS_MUTEX *)&mutex,
-                    (OS_TICK)0,
-                    (OS_OPT)OS_OPT_PEND_BLOCKING,
-                    (CPU_TS *)&ts,
-                    (OS_ERR *)&err);
-
-        BSP_LCD_SetTextColor(LCD_COLOR_GREEN);
-
         srand(OSTickCtr);
         move = rand() % 9;
 
@@ -331,10 +342,7 @@ static void BotPlayer(void *p_arg)
 
         board[move] = 1;
         moves++;
-
-        OSMutexPost((OS_MUTEX *)&mutex,
-                    (OS_OPT)OS_OPT_POST_NONE,
-                    (OS_ERR *)&err);
+        boardPublish();
 
         OSTaskSemPost((OS_TCB *)&DrawBoardTCB,
                       (OS_OPT)OS_OPT_POST_NONE,
@@ -355,6 +363,7 @@ static void HumanPlayer(void *p_arg)
     CPU_TS ts;
     CPU_INT08S index;
     CPU_INT08U input_state = 0;
+    const touch_evt_t *evt;
 
     while (DEF_TRUE)
     {
@@ -362,13 +371,8 @@ static void HumanPlayer(void *p_arg)
                       (OS_OPT)OS_OPT_PEND_BLOCKING,
                       (CPU_TS *)&ts,
                       (OS_ERR *)&err);
+        (void)OSTaskQFlush((OS_TCB *)&HumanPlayerTCB, (OS_ERR *)&err); // Taps of the other turns
 
-        OSMutexPend((OS_MUTEX *)&mutex,
-                    (OS_TICK)0,
-                    (OS_OPT)OS_OPT_PEND_BLOCKING,
-                    (CPU_TS *)&ts,
-                    (OS_ERR *)&err);
-        BSP_LCD_SetTextColor(LCD_COLOR_RED);
         //------------------------------------------------------------------------------
         //! new user input mapping algorithm
         //! original: best case = 8 comparisms, worst scenario = 8 * 9 = 72 comparisms
@@ -377,7 +381,14 @@ static void HumanPlayer(void *p_arg)
         //------------------------------------------------------------------------------
         while (input_state != 1)
         {
-            BSP_TS_GetState(&TS_State);
+            evt = TouchPend(0u, &err); // Sleeps until a tap, see 'touch.h'
+            if (evt == NULL)
+            {
+                continue;
+            }
+            TS_State.TouchDetected = 1u;
+            TS_State.X = evt->x;
+            TS_State.Y = evt->y;
             index = touchInput();
 #if LOG_EN > 0
             logger(LOG_TOUCH_SCREEN);
@@ -389,9 +400,7 @@ static void HumanPlayer(void *p_arg)
                     board[index] = 2;
                     moves++;
                     input_state = 1;
-                    OSMutexPost((OS_MUTEX *)&mutex,
-                                (OS_OPT)OS_OPT_POST_NONE,
-                                (OS_ERR *)&err);
+                    boardPublish();
                     OSTaskSemPost((OS_TCB *)&DrawBoardTCB,
                                   (OS_OPT)OS_OPT_POST_NONE,
                                   (OS_ERR *)&err);
@@ -514,6 +523,7 @@ static void Analysis(void *p_arg)
     CPU_TS ts;
     uint8_t turn = 1;
     CPU_INT08U check_row, check_column, check_diagnol_1, check_diagnol_2;
+    board_t view;
 
     while (DEF_TRUE)
     {
@@ -522,11 +532,7 @@ static void Analysis(void *p_arg)
                       (CPU_TS *)&ts,
                       (OS_ERR *)&err);
 
-        OSMutexPend((OS_MUTEX *)&mutex,
-                    (OS_TICK)0,
-                    (OS_OPT)OS_OPT_PEND_BLOCKING,
-                    (CPU_TS *)&ts,
-                    (OS_ERR *)&err);
+        (void)OSSeqLockRead(&seqlock_board, &view, &err); // Copy of the board, no lock
 
         //------------------------------------------------------------------------------
         //! New game analysis implementation for easy scaling and maybe more efficient 
@@ -547,7 +553,7 @@ static void Analysis(void *p_arg)
             check_row = 0xff;
             for (uint8_t c = 0; c < BOARD_SIDE_SIZE; c++)
             {
-                check_row &= board[r * BOARD_SIDE_SIZE + c]; // bitwise AND the whole row, for a result
+                check_row &= view.cells[r * BOARD_SIDE_SIZE + c]; // bitwise AND the whole row, for a result
             }
             switch (check_row)
             { // value 1 or 2 would give a result, otherwise continue
@@ -568,7 +574,7 @@ static void Analysis(void *p_arg)
             check_column = 0xff;
             for (uint8_t r = 0; r < BOARD_SIDE_SIZE; r++)
             {
-                check_column &= board[r * BOARD_SIDE_SIZE + c];
+                check_column &= view.cells[r * BOARD_SIDE_SIZE + c];
             }
             switch (check_column)
             {
@@ -591,8 +597,8 @@ static void Analysis(void *p_arg)
         {
             c1 = r;
             c2 = BOARD_SIDE_SIZE - r;
-            check_diagnol_1 &= board[r * BOARD_SIDE_SIZE + c1];
-            check_diagnol_2 &= board[r * BOARD_SIDE_SIZE + c2];
+            check_diagnol_1 &= view.cells[r * BOARD_SIDE_SIZE + c1];
+            check_diagnol_2 &= view.cells[r * BOARD_SIDE_SIZE + c2];
         }
 
         switch (check_diagnol_1)
@@ -620,7 +626,7 @@ static void Analysis(void *p_arg)
         }
 
         // Finally, check the total moves
-        if (moves >= 9)
+        if (view.moves >= 9)
         {
             PrintResult(0);
         }
@@ -695,10 +701,6 @@ static void Analysis(void *p_arg)
         //     PrintResult(0);
         // }
 
-        OSMutexPost((OS_MUTEX *)&mutex,
-                    (OS_OPT)OS_OPT_POST_NONE,
-                    (OS_ERR *)&err);
-
         switch (turn)
         {
         case 1:
@@ -738,35 +740,46 @@ static void Analysis(void *p_arg)
 */
 //------------------------------------------------------------------------
 //! Draw mark on the game board, reentrant function/thread safe
+//! \param [IN] batch - of the compositor, the lines are added to it
 //! \param [IN] x - x-coordinate of the cross center
 //! \param [IN] y - y-coordinate of the cross center
 //! \param [IN] size - half-width of the cross in pixels
 //! \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
 //------------------------------------------------------------------------
-static void drawCross(const uint16_t x, const uint16_t y, const uint16_t size)
+static void drawCross(disp_batch_t *const batch, const uint16_t x, const uint16_t y, const uint16_t size)
 {
-    BSP_LCD_DrawLine(x - size, y - size, x + size, y + size); // '\' of the cross
-    BSP_LCD_DrawLine(x + size, y - size, x - size, y + size); // '/' of the cross
+    DispDrawLine(batch, x - size, y - size, x + size, y + size, HUMAN_COLOUR); // '\' of the cross
+    DispDrawLine(batch, x + size, y - size, x - size, y + size, HUMAN_COLOUR); // '/' of the cross
 }
 
 //-------------------------------------------------------------------------
-//! Draw mark on the game board, non-reentrant function/not thread safe
+//! Draw the marks added since the last call, non-reentrant function/not thread safe
+//! \param [IN] batch - of the compositor, the marks are added to it
+//! \param [IN] shown - copy of the board to draw
 //! \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
 //-------------------------------------------------------------------------
-static void drawMark()
+static void drawMark(disp_batch_t *const batch, const board_t *const shown)
 {
+    static CPU_INT08U drawn[BOARD_SIZE]; // the marks already on the screen
+
     for (uint8_t i = 0; i < BOARD_SIZE; i++)
     {
-        switch (board[i])
+        if (shown->cells[i] == drawn[i])
+        {
+            continue;
+        }
+        drawn[i] = shown->cells[i];
+
+        switch (shown->cells[i])
         {
         case 0:
             // Do Nothing
             break;
         case 1:
-            BSP_LCD_DrawCircle(gridCenterCoordinates[i].X, gridCenterCoordinates[i].Y, CIRCLE_RADIUS);
+            DispDrawCircle(batch, gridCenterCoordinates[i].X, gridCenterCoordinates[i].Y, CIRCLE_RADIUS, BOT_COLOUR);
             break;
         case 2:
-            drawCross(gridCenterCoordinates[i].X, gridCenterCoordinates[i].Y, CROSS_SIZE);
+            drawCross(batch, gridCenterCoordinates[i].X, gridCenterCoordinates[i].Y, CROSS_SIZE);
             break;
         default:
             logger(LOG_BOARD_DATA_CORRUPT);
@@ -776,6 +789,19 @@ static void drawMark()
     }
 }
 
+//-------------------------------------------------------------------------
+//! Publish the board after a move, called by the player of the turn only
+//-------------------------------------------------------------------------
+static void boardPublish(void)
+{
+    OS_ERR err;
+    board_t *next = (board_t *)OSSeqLockWrBegin(&seqlock_board, OS_OPT_SEQLOCK_NONE, &err);
+
+    memcpy(next->cells, board, sizeof(next->cells));
+    next->moves = moves;
+    OSSeqLockWrEnd(&seqlock_board, &err);
+}
+
 //----------------------------------------------------------
 //! Converts user touch input to index for the board
 //! \return [OUT] touch2Index 0 - 9 if valid, -1 if invalid
@@ -841,29 +867,28 @@ static const CPU_INT08S touchInput()
 //----------------------------------------------------------
 static void logger(const uint8_t mask)
 {
-    BSP_LCD_SetTextColor(LCD_COLOR_GREEN);
-    BSP_LCD_SetFont(&Font16);
+    OS_ERR err;
+    disp_batch_t *batch = DispBatchGet(0u, &err);
     uint8_t log[64];
     if (mask & LOG_TOUCH_SCREEN)
     {
         if (TS_State.TouchDetected)
         {
             sprintf((char *)log, "x:%u, y:%u, z:%u", TS_State.X, TS_State.Y, TS_State.Z);
-            BSP_LCD_DisplayStringAt(0, 10, log, LEFT_MODE);
+            DispText(batch, 0, 10, (CPU_CHAR *)log, LEFT_MODE, &Font16, LCD_COLOR_GREEN, LCD_COLOR_WHITE);
         }
     }
 
     if (mask & LOG_BOARD_DATA_CORRUPT)
     {
-        sprintf((char *)log, "Error! GameBoard data corruption!");
-        BSP_LCD_DisplayStringAt(0, 15, log, LEFT_MODE);
+        DispText(batch, 0, 15, (CPU_CHAR *)"Error! GameBoard data corruption!", LEFT_MODE, &Font16, LCD_COLOR_GREEN, LCD_COLOR_WHITE);
     }
 
     if(mask & LOG_ERR_ANALYS)
     {
-        sprintf((char *)log, "Error! Analysis turn data corruption!");
-        BSP_LCD_DisplayStringAt(0, 20, log, LEFT_MODE);
+        DispText(batch, 0, 20, (CPU_CHAR *)"Error! Analysis turn data corruption!", LEFT_MODE, &Font16, LCD_COLOR_GREEN, LCD_COLOR_WHITE);
     }
+    DispBatchPost(batch, &err);
     // TO-DO Extra logs
     //  if (mask & LOG_CPU_STATUS)
     //  {
@@ -889,24 +914,26 @@ void HAL_Delay(uint32_t Delay)
 
 static void PrintResult(uint8_t who)
 {
-    BSP_LCD_SetTextColor(LCD_COLOR_RED);
-    BSP_LCD_SetFont(&Font24);
+    OS_ERR err;
+    disp_batch_t *batch = DispBatchGet(0u, &err);
 
     switch (who)
     {
     case 0:
-        BSP_LCD_DisplayStringAt(0, BSP_LCD_GetYSize() - 280, (uint8_t *)"Tie!", CENTER_MODE);
+        DispText(batch, 0, BSP_LCD_GetYSize() - 280, (CPU_CHAR *)"Tie!", CENTER_MODE, &Font24, LCD_COLOR_RED, LCD_COLOR_WHITE);
         break;
 
     case 1:
-        BSP_LCD_DisplayStringAt(0, BSP_LCD_GetYSize() - 280, (uint8_t *)"Bot Won!", CENTER_MODE);
+        DispText(batch, 0, BSP_LCD_GetYSize() - 280, (CPU_CHAR *)"Bot Won!", CENTER_MODE, &Font24, LCD_COLOR_RED, LCD_COLOR_WHITE);
         break;
 
     case 2:
-        BSP_LCD_DisplayStringAt(0, BSP_LCD_GetYSize() - 280, (uint8_t *)"Human Won!", CENTER_MODE);
+        DispText(batch, 0, BSP_LCD_GetYSize() - 280, (CPU_CHAR *)"Human Won!", CENTER_MODE, &Font24, LCD_COLOR_RED, LCD_COLOR_WHITE);
         break;
     }
 
+    DispBatchPost(batch, &err);
+
     GameOver();
 }
 
@@ -937,7 +964,15 @@ static void LCD_Init(void)
 {
     BSP_LCD_Init();
     BSP_LCD_LayerDefaultInit(LCD_BACKGROUND_LAYER, LCD_FRAME_BUFFER);
+#if (DISP_DBL_BUF_EN > 0u)
+    // Back buffer of the compositor, shown through the background layer only, see Note #6 of disp.h
+    BSP_LCD_LayerDefaultInit(LCD_FOREGROUND_LAYER, DISP_BUF_ADDR(LCD_FOREGROUND_LAYER));
+    BSP_LCD_SetLayerVisible(LCD_FOREGROUND_LAYER, DISABLE);
+    BSP_LCD_SelectLayer(LCD_BACKGROUND_LAYER);
+    BSP_LCD_Clear(LCD_COLOR_WHITE);
+#else
     BSP_LCD_LayerDefaultInit(LCD_FOREGROUND_LAYER, LCD_FRAME_BUFFER);
+#endif
     BSP_LCD_SelectLayer(LCD_FOREGROUND_LAYER);
     BSP_LCD_DisplayOn();
     BSP_LCD_Clear(LCD_COLOR_WHITE);
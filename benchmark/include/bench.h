@@ -0,0 +1,60 @@
+/*
+*********************************************************************************************************
+*                                          KERNEL BENCHMARKS
+*
+* Note(s) : (1) Every result is printed on USART1 (stdout on the host) as one line of 'key=value' fields,
+*               the first field naming the suite, so the output of several runs can be concatenated and
+*               filtered with standard tools:
+*
+*                   prio prio_max=1024 tbl=2lvl op=get_highest_idle n=100000 ns=1.52
+*
+*           (2) Time is read from the DWT cycle counter on the board and from CLOCK_MONOTONIC on the
+*               host.  Bench_TsToNs() converts a difference of two Bench_TsGet() to nanoseconds.
+*********************************************************************************************************
+*/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "os.h"
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#if defined(__linux__)
+#define BENCH_HOST 1u
+#else
+#define BENCH_HOST 0u
+#endif
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void Bench_Init(void);
+CPU_INT32U Bench_TsGet(void);
+CPU_INT64U Bench_TsToNs(CPU_INT64U ts);
+void Bench_Print(const CPU_CHAR *fmt, ...);
+void Bench_PrintNs(const CPU_CHAR *prefix, CPU_INT32U n, CPU_INT64U ts_total);
+void Bench_PrintNsMax(const CPU_CHAR *prefix, CPU_INT32U n, CPU_INT64U ts_total, CPU_INT32U ts_max);
+void Bench_PrintPct(const CPU_CHAR *prefix, CPU_INT32U *p_ts, CPU_INT32U n);
+CPU_INT32U Bench_Rand(void);
+void Bench_Exit(void);
+
+void BenchPrio_Run(void);
+void BenchTick_Run(void);
+void BenchTmr_Run(void);
+void BenchDynTick_Run(void);
+void BenchPend_Run(void);
+void BenchBcast_Run(void);
+void BenchFlag_Run(void);
+void BenchMutex_Run(void);
+void BenchRwLock_Run(void);
+void BenchRhealstone_Run(void);
+
+#endif
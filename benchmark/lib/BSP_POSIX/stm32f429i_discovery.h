@@ -0,0 +1,52 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery.h
+  * @brief   Host (POSIX) stand-in for the STM32F429I-Discovery LEDs & IO lines.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F429I_DISCOVERY_H
+#define __STM32F429I_DISCOVERY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  LED3 = 0,
+  LED4 = 1
+} Led_TypeDef;
+
+#define LEDn                             2
+
+/* Interrupt line of the STMPE811 touch screen controller, as on the board */
+#define STMPE811_INT_PIN                 GPIO_PIN_15
+#define STMPE811_INT_GPIO_PORT           GPIOA
+#define STMPE811_INT_EXTI                EXTI15_10_IRQn
+#define STMPE811_INT_EXTIHandler         EXTI15_10_IRQHandler
+
+/**
+ * Print every LED change on stderr, the only visible output of some applications.
+ */
+#ifndef BSP_POSIX_LED_TRACE_EN
+#define BSP_POSIX_LED_TRACE_EN           0
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+void     BSP_LED_Init(Led_TypeDef Led);
+void     BSP_LED_On(Led_TypeDef Led);
+void     BSP_LED_Off(Led_TypeDef Led);
+void     BSP_LED_Toggle(Led_TypeDef Led);
+uint8_t  BSP_LED_GetState(Led_TypeDef Led);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F429I_DISCOVERY_H */
@@ -0,0 +1,15 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery_gyroscope.h
+  * @brief   Host (POSIX) stand-in, only included by the applications.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F429I_DISCOVERY_GYROSCOPE_H
+#define __STM32F429I_DISCOVERY_GYROSCOPE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f429i_discovery.h"
+
+#endif /* __STM32F429I_DISCOVERY_GYROSCOPE_H */
@@ -0,0 +1,851 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            TICK MANAGEMENT
+*
+* File    : os_tick.c
+* Version : V3.08.00
+*********************************************************************************************************
+* Note(s) : (1) Tasks delayed or pending with a timeout are kept in one of two structures, selected by
+*               OS_CFG_TICK_WHEEL_EN:
+*
+*               (a) A delta list (the default).  Each entry stores the number of ticks remaining after
+*                   the previous entry expires, so a tick only decrements the head, but an insertion walks
+*                   the list & costs O(n) with interrupts disabled.
+*
+*               (b) A hierarchical timing wheel.  OS_TICK_WHEEL_LVLS levels of OS_TICK_WHEEL_SLOTS slots
+*                   each hold unsorted lists of TCBs, level 'l' resolving the 'l'th group of
+*                   OS_TICK_WHEEL_SLOT_BITS bits of the expiry tick.  Insert & remove are O(1).  A tick
+*                   expires the level 0 slot of the new OSTickCtr and, whenever the lower bits of OSTickCtr
+*                   wrap to zero, first redistributes ('cascades') the matching slot of each higher level
+*                   into the levels below.  A TCB cascades at most OS_TICK_WHEEL_LVLS - 1 times, so the
+*                   tick processing is amortized O(1) per delayed task.
+*
+*                                   OSTickCtr = ........ 000001 000000     (lower 6 bits just wrapped)
+*                                                          |
+*                   Level 1  [0][1][2] ... [63]    <-------+  slot 1 is cascaded into level 0 ...
+*                   Level 0  [0][1][2] ... [63]    <---- ... then slot 0 of level 0 expires
+*
+*               The timing wheel processes every tick, so it cannot be used with the dynamic tick.
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_tick__c = "$Id: $";
+#endif
+
+#if (OS_CFG_TICK_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                 FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_TickListUpdate (OS_TICK  ticks);
+
+static  void  OS_TickListExpire (OS_TCB  *p_tcb);
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+static  void  OS_TickWheelInsert (OS_TCB   *p_tcb,
+                                  OS_TICK   now);
+
+static  void  OS_TickWheelCascade(OS_TCB  **p_slot,
+                                  OS_TICK   now);
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                      TICK INIT
+*
+* Description: This function initializes the variables related to the tick handler.
+*              The function is internal to uC/OS-III.
+*
+* Arguments  : p_err          is a pointer to a variable that will contain an error code returned by this function.
+*              -----
+*                                 OS_ERR_NONE           the tick variables were initialized successfully
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_TickInit (OS_ERR  *p_err)
+{
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    CPU_INT08U  lvl;
+    CPU_INT08U  ix;
+
+
+#endif
+    *p_err                = OS_ERR_NONE;
+
+    OSTickCtr             = 0u;                               /* Clear the tick counter                               */
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OSTickCtrStep         = 0u;
+#endif
+
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+    OSTickTS              = 0u;
+#endif
+
+    OSTickList.TCB_Ptr    = (OS_TCB *)0;
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    for (lvl = 0u; lvl < OS_TICK_WHEEL_LVLS; lvl++) {           /* Empty every slot of the timing wheel                 */
+        for (ix = 0u; ix < OS_TICK_WHEEL_SLOTS; ix++) {
+            OSTickWheel[lvl][ix] = (OS_TCB *)0;
+        }
+    }
+#endif
+
+#if (OS_CFG_DBG_EN > 0u)
+    OSTickList.NbrEntries = 0u;
+    OSTickList.NbrUpdated = 0u;
+#endif
+}
+
+/*
+************************************************************************************************************************
+*                                                      TICK UPDATE
+*
+* Description: This function updates the list of task either delayed pending with timeout.
+*              The function is internal to uC/OS-III.
+*
+* Arguments  : ticks          the number of ticks which have elapsed
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_TickUpdate (OS_TICK  ticks)
+{
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS  ts_start;
+#endif
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+
+    OSTickCtr += ticks;                                         /* Keep track of the number of ticks                    */
+
+    OS_TRACE_TICK_INCREMENT(OSTickCtr);
+
+#if (OS_CFG_TS_EN > 0u)
+    ts_start   = OS_TS_GET();
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+    OSTickTS   = ts_start;                                      /* Time of the releases of the periodic tasks           */
+#endif
+    OS_TickListUpdate(ticks);
+    OSTickTime = OS_TS_GET() - ts_start;
+    if (OSTickTimeMax < OSTickTime) {
+        OSTickTimeMax = OSTickTime;
+    }
+#else
+    OS_TickListUpdate(ticks);
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    if (OSTickList.TCB_Ptr != (OS_TCB *)0) {
+        OSTickCtrStep = OSTickList.TCB_Ptr->TickRemain;
+    } else {
+        OSTickCtrStep = 0u;
+    }
+
+    OS_DynTickSet(OSTickCtrStep);
+#endif
+    CPU_CRITICAL_EXIT();
+}
+
+/*
+************************************************************************************************************************
+*                                                      INSERT
+*
+* Description: This task is internal to uC/OS-III and allows the insertion of a task in a tick list.
+*
+* Arguments  : p_tcb       is a pointer to the TCB to insert in the list
+*
+*              elapsed     is the number of elapsed ticks since the last tick interrupt
+*
+*              tick_base   is value of OSTickCtr from which time is offset
+*
+*              time        is the amount of time remaining (in ticks) for the task to become ready
+*
+* Returns    : OS_TRUE     if time is valid for the given tick base
+*
+*              OS_FALSE    if time is invalid (i.e. zero delay)
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) This function supports both Periodic Tick Mode (PTM) and Dynamic Tick Mode (DTM).
+*
+*              3) PTM should always call this function with elapsed == 0u.
+*
+*              4) With the timing wheel (see 'os_tick.c  Note #1b') the insertion is O(1) and 'TickRemain' holds the
+*                 delay at the time of the insertion only.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_TickListInsert (OS_TCB   *p_tcb,
+                                OS_TICK   elapsed,
+                                OS_TICK   tick_base,
+                                OS_TICK   time)
+{
+#if (OS_CFG_TICK_WHEEL_EN == 0u)
+    OS_TCB        *p_tcb1;
+    OS_TCB        *p_tcb2;
+    OS_TICK_LIST  *p_list;
+    OS_TICK        remain;
+#endif
+    OS_TICK        delta;
+
+
+    delta = (time + tick_base) - (OSTickCtr + elapsed);         /* How many ticks until our delay expires?              */
+
+    if (delta == 0u) {
+        p_tcb->TickRemain = 0u;
+        return (OS_FALSE);
+    }
+
+    OS_TRACE_TASK_DLY(delta);
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    p_tcb->TickRemain = delta;
+    p_tcb->TickMatch  = time + tick_base;                       /* Absolute tick at which the delay expires             */
+    OS_TickWheelInsert(p_tcb, OSTickCtr);
+#if (OS_CFG_DBG_EN > 0u)
+    OSTickList.NbrEntries++;
+#endif
+
+    return (OS_TRUE);
+#else
+    p_list = &OSTickList;
+    if (p_list->TCB_Ptr == (OS_TCB *)0) {                       /* Is the list empty?                                   */
+        p_tcb->TickRemain   = delta;                            /* Yes, Store time in TCB                               */
+        p_tcb->TickNextPtr  = (OS_TCB *)0;
+        p_tcb->TickPrevPtr  = (OS_TCB *)0;
+        p_list->TCB_Ptr     = p_tcb;                            /* Point to TCB of task to place in the list            */
+#if (OS_CFG_DYN_TICK_EN > 0u)
+        if (elapsed != 0u) {
+            OSTickCtr      += elapsed;                          /* Update OSTickCtr before we set a new tick step.      */
+            OS_TRACE_TICK_INCREMENT(OSTickCtr);
+        }
+
+        OSTickCtrStep       = delta;
+        OS_DynTickSet(OSTickCtrStep);
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+        p_list->NbrEntries  = 1u;                               /* List contains 1 entry                                */
+#endif
+        return (OS_TRUE);
+    }
+
+
+#if (OS_CFG_DBG_EN > 0u)
+    p_list->NbrEntries++;                                       /* Update debug counter to reflect the new entry.       */
+#endif
+
+    p_tcb2 = p_list->TCB_Ptr;
+    remain = p_tcb2->TickRemain - elapsed;                      /* How many ticks until the head's delay expires?       */
+
+    if ((delta               <   remain) &&                     /* If our entry is the new head of the tick list    ... */
+        (p_tcb2->TickPrevPtr == (OS_TCB *)0)) {
+        p_tcb->TickRemain    =  delta;                          /* ... the delta is equivalent to the full delay    ... */
+        p_tcb2->TickRemain   =  remain - delta;                 /* ... the previous head's delta is now relative to it. */
+
+        p_tcb->TickPrevPtr   = (OS_TCB *)0;
+        p_tcb->TickNextPtr   =  p_tcb2;
+        p_tcb2->TickPrevPtr  =  p_tcb;
+        p_list->TCB_Ptr      =  p_tcb;
+#if (OS_CFG_DYN_TICK_EN > 0u)
+        if (elapsed != 0u) {
+            OSTickCtr       +=  elapsed;                        /* Update OSTickCtr before we set a new tick step.      */
+            OS_TRACE_TICK_INCREMENT(OSTickCtr);
+        }
+                                                                /* In DTM, a new list head must update the tick     ... */
+        OSTickCtrStep        =  delta;                          /* ... timer to interrupt at the new delay value.       */
+        OS_DynTickSet(OSTickCtrStep);
+#endif
+
+        return (OS_TRUE);
+    }
+
+                                                                /* Our entry comes after the current list head.         */
+    delta  -= remain;                                           /* Make delta relative to the head.                     */
+    p_tcb1  = p_tcb2;
+    p_tcb2  = p_tcb1->TickNextPtr;
+
+    while ((p_tcb2 !=        (OS_TCB *)0) &&                    /* Find the appropriate position in the delta list.     */
+           (delta  >= p_tcb2->TickRemain)) {
+        delta  -= p_tcb2->TickRemain;
+        p_tcb1  = p_tcb2;
+        p_tcb2  = p_tcb2->TickNextPtr;
+    }
+
+    if (p_tcb2 != (OS_TCB *)0) {                                /* Our entry is not the last element in the list.       */
+        p_tcb1               = p_tcb2->TickPrevPtr;
+        p_tcb->TickRemain    = delta;                           /* Store remaining time                                 */
+        p_tcb->TickPrevPtr   = p_tcb1;
+        p_tcb->TickNextPtr   = p_tcb2;
+        p_tcb2->TickRemain  -= delta;                           /* Reduce time of next entry in the list                */
+        p_tcb2->TickPrevPtr  = p_tcb;
+        p_tcb1->TickNextPtr  = p_tcb;
+
+    } else {                                                    /* Our entry belongs at the end of the list.            */
+        p_tcb->TickRemain    = delta;
+        p_tcb->TickPrevPtr   = p_tcb1;
+        p_tcb->TickNextPtr   = (OS_TCB *)0;
+        p_tcb1->TickNextPtr  = p_tcb;
+    }
+
+    return (OS_TRUE);
+#endif
+}
+
+/*
+************************************************************************************************************************
+*                                            ADD DELAYED TASK TO TICK LIST
+*
+* Description: This function is called to place a task in a list of task waiting for time to expire
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB of the task to add to the tick list
+*              -----
+*
+*              time           represents either the 'match' value of OSTickCtr or a relative time from the current
+*                             system time as specified by the 'opt' argument..
+*
+*                             relative when 'opt' is set to OS_OPT_TIME_DLY
+*                             relative when 'opt' is set to OS_OPT_TIME_TIMEOUT
+*                             match    when 'opt' is set to OS_OPT_TIME_MATCH
+*                             periodic when 'opt' is set to OS_OPT_TIME_PERIODIC
+*
+*              opt            is an option specifying how to calculate time.  The valid values are:
+*              ---
+*                                 OS_OPT_TIME_DLY
+*                                 OS_OPT_TIME_TIMEOUT
+*                                 OS_OPT_TIME_PERIODIC
+*                                 OS_OPT_TIME_MATCH
+*
+*              p_err          is a pointer to a variable that will contain an error code returned by this function.
+*              -----
+*                                 OS_ERR_NONE           the call was successful and the time delay was scheduled.
+*                                 OS_ERR_TIME_ZERO_DLY  if the effective delay is zero
+*
+* Returns    : None
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OS_TickListInsertDly (OS_TCB   *p_tcb,
+                            OS_TICK   time,
+                            OS_OPT    opt,
+                            OS_ERR   *p_err)
+{
+    OS_TICK      elapsed;
+    OS_TICK      tick_base;
+    OS_TICK      base_offset;
+    CPU_BOOLEAN  valid_dly;
+
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    elapsed  = OS_DynTickGet();
+#else
+    elapsed  = 0u;
+#endif
+
+    if (opt == OS_OPT_TIME_MATCH) {                             /* MATCH to absolute tick ctr value mode                */
+        tick_base = 0u;                                         /* tick_base + time == time                             */
+
+    } else if (opt == OS_OPT_TIME_PERIODIC) {                   /* PERIODIC mode.                                       */
+        if (time == 0u) {
+           *p_err = OS_ERR_TIME_ZERO_DLY;                       /* Infinite frequency is invalid.                       */
+            return;
+        }
+
+        tick_base = p_tcb->TickCtrPrev;
+
+#if (OS_CFG_DYN_TICK_EN > 0u)                                   /* How far is our tick-base from the system time?       */
+        base_offset = OSTickCtr + elapsed - tick_base;
+#else
+        base_offset = OSTickCtr - tick_base;
+#endif
+
+        if (base_offset >= time) {                              /* If our task missed the last period, move         ... */
+            tick_base += time * (base_offset / time);           /* ... tick_base up to the last one passed, so the  ... */
+                                                                /* ... task is released at the first one to come.       */
+            p_tcb->TickCtrPrev = tick_base;                     /* Adjust the periodic tick base                        */
+        }
+
+        p_tcb->TickCtrPrev += time;                             /* Update for the next time we perform a periodic dly.  */
+
+    } else {                                                    /* RELATIVE time delay mode                             */
+#if (OS_CFG_DYN_TICK_EN > 0u)                                   /* Our base is always the current system time.          */
+        tick_base = OSTickCtr + elapsed;
+#else
+        tick_base = OSTickCtr;
+#endif
+    }
+
+    valid_dly = OS_TickListInsert(p_tcb, elapsed, tick_base, time);
+
+    if (valid_dly == OS_TRUE) {
+        p_tcb->TaskState = OS_TASK_STATE_DLY;
+       *p_err            = OS_ERR_NONE;
+    } else {
+       *p_err = OS_ERR_TIME_ZERO_DLY;
+    }
+}
+
+/*
+************************************************************************************************************************
+*                                         REMOVE A TASK FROM THE TICK LIST
+*
+* Description: This function is called to remove a task from the tick list
+*
+* Arguments  : p_tcb          Is a pointer to the OS_TCB to remove.
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OS_TickListRemove (OS_TCB  *p_tcb)
+{
+    OS_TCB        *p_tcb1;
+    OS_TCB        *p_tcb2;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OS_TCB       **p_slot;
+#else
+    OS_TICK_LIST  *p_list;
+#endif
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK        elapsed;
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    elapsed = OS_DynTickGet();
+#endif
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    p_slot = p_tcb->TickSlotPtr;
+    if (p_slot == (OS_TCB **)0) {                               /* Not in the timing wheel                              */
+        return;
+    }
+
+    p_tcb1 = p_tcb->TickPrevPtr;
+    p_tcb2 = p_tcb->TickNextPtr;
+    if (p_tcb1 == (OS_TCB *)0) {                                /* Unlink from the slot's list                          */
+       *p_slot              = p_tcb2;
+    } else {
+        p_tcb1->TickNextPtr = p_tcb2;
+    }
+    if (p_tcb2 != (OS_TCB *)0) {
+        p_tcb2->TickPrevPtr = p_tcb1;
+    }
+
+    p_tcb->TickPrevPtr      = (OS_TCB  *)0;
+    p_tcb->TickNextPtr      = (OS_TCB  *)0;
+    p_tcb->TickSlotPtr      = (OS_TCB **)0;
+    p_tcb->TickRemain       =            0u;
+#if (OS_CFG_DBG_EN > 0u)
+    OSTickList.NbrEntries--;
+#endif
+#else
+
+    p_tcb1 = p_tcb->TickPrevPtr;
+    p_tcb2 = p_tcb->TickNextPtr;
+    p_list = &OSTickList;
+    if (p_tcb1 == (OS_TCB *)0) {
+        if (p_tcb2 == (OS_TCB *)0) {                            /* Remove the ONLY entry in the list?                   */
+            p_list->TCB_Ptr      = (OS_TCB *)0;
+#if (OS_CFG_DBG_EN > 0u)
+            p_list->NbrEntries   =           0u;
+#endif
+            p_tcb->TickRemain    =           0u;
+#if (OS_CFG_DYN_TICK_EN > 0u)
+            if (elapsed != 0u) {
+                OSTickCtr       += elapsed;                     /* Keep track of time.                                  */
+                OS_TRACE_TICK_INCREMENT(OSTickCtr);
+            }
+            OSTickCtrStep        =           0u;
+            OS_DynTickSet(OSTickCtrStep);
+#endif
+        } else {
+            p_tcb2->TickPrevPtr  = (OS_TCB *)0;
+            p_tcb2->TickRemain  += p_tcb->TickRemain;           /* Add back the ticks to the delta                      */
+            p_list->TCB_Ptr      = p_tcb2;
+#if (OS_CFG_DBG_EN > 0u)
+            p_list->NbrEntries--;
+#endif
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+            if (p_tcb2->TickRemain != p_tcb->TickRemain) {      /* Only set a new tick if tcb2 had a longer delay.      */
+                if (elapsed != 0u) {
+                    OSTickCtr          += elapsed;              /* Keep track of time.                                  */
+                    OS_TRACE_TICK_INCREMENT(OSTickCtr);
+                    p_tcb2->TickRemain -= elapsed;              /* We must account for any time which has passed.       */
+                }
+                OSTickCtrStep           = p_tcb2->TickRemain;
+                OS_DynTickSet(OSTickCtrStep);
+            }
+#endif
+            p_tcb->TickNextPtr          = (OS_TCB *)0;
+            p_tcb->TickRemain           =           0u;
+        }
+    } else {
+        p_tcb1->TickNextPtr = p_tcb2;
+        if (p_tcb2 != (OS_TCB *)0) {
+            p_tcb2->TickPrevPtr  = p_tcb1;
+            p_tcb2->TickRemain  += p_tcb->TickRemain;            /* Add back the ticks to the delta list                 */
+        }
+        p_tcb->TickPrevPtr       = (OS_TCB *)0;
+#if (OS_CFG_DBG_EN > 0u)
+        p_list->NbrEntries--;
+#endif
+        p_tcb->TickNextPtr       = (OS_TCB *)0;
+        p_tcb->TickRemain        =           0u;
+    }
+#endif
+}
+
+/*
+************************************************************************************************************************
+*                                 UPDATE THE LIST OF TASKS DELAYED OR PENDING WITH TIMEOUT
+*
+* Description: This function updates the delta list which contains tasks that are delayed or pending with a timeout.
+*
+* Arguments  : ticks          the number of ticks which have elapsed.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With the timing wheel, every elapsed tick is processed in turn: the slots of the higher levels which
+*                 come due are cascaded from the highest level down, so a TCB whose delay expires on this very tick
+*                 lands in the level 0 slot which is expired next (see 'os_tick.c  Note #1b').
+************************************************************************************************************************
+*/
+
+static  void  OS_TickListUpdate (OS_TICK  ticks)
+{
+    OS_TCB        *p_tcb;
+    OS_TICK_LIST  *p_list;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OS_TCB       **p_slot;
+    OS_TICK        now;
+    CPU_INT08U     lvl;
+    CPU_INT08U     shift;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    OS_OBJ_QTY     nbr_updated;
+#endif
+
+
+
+#if (OS_CFG_DBG_EN > 0u)
+    nbr_updated = 0u;
+#endif
+    p_list      = &OSTickList;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    now         = OSTickCtr - ticks;                                     /* Value of OSTickCtr at the previous update            */
+    while (ticks > 0u) {
+        now++;
+        ticks--;
+                                                                         /* Find the highest level whose slot comes due ...      */
+        lvl   = 1u;
+        shift = OS_TICK_WHEEL_SLOT_BITS;
+        while ((lvl < OS_TICK_WHEEL_LVLS) &&
+               ((now & (((OS_TICK)1u << shift) - 1u)) == 0u)) {
+            lvl++;
+            shift += OS_TICK_WHEEL_SLOT_BITS;
+        }
+        while (lvl > 1u) {                                               /* ... and cascade from there down (see Note #2).       */
+            lvl--;
+            shift -= OS_TICK_WHEEL_SLOT_BITS;
+            OS_TickWheelCascade(&OSTickWheel[lvl][(now >> shift) & OS_TICK_WHEEL_SLOT_MSK], now);
+        }
+
+        p_slot = &OSTickWheel[0u][now & OS_TICK_WHEEL_SLOT_MSK];         /* Every TCB in this slot expires on this tick          */
+        p_tcb  = *p_slot;
+        while (p_tcb != (OS_TCB *)0) {
+           *p_slot = p_tcb->TickNextPtr;                                 /* Unlink the head before it changes state              */
+            if (*p_slot != (OS_TCB *)0) {
+                (*p_slot)->TickPrevPtr = (OS_TCB *)0;
+            }
+            p_tcb->TickNextPtr = (OS_TCB  *)0;
+            p_tcb->TickSlotPtr = (OS_TCB **)0;
+            p_tcb->TickRemain  =            0u;
+#if (OS_CFG_DBG_EN > 0u)
+            p_list->NbrEntries--;
+            nbr_updated++;
+#endif
+            OS_TickListExpire(p_tcb);
+            p_tcb = *p_slot;
+        }
+    }
+#else
+    p_tcb       = p_list->TCB_Ptr;
+    if (p_tcb != (OS_TCB *)0) {
+        if (p_tcb->TickRemain <= ticks) {
+            ticks              = ticks - p_tcb->TickRemain;
+            p_tcb->TickRemain  = 0u;
+        } else {
+            p_tcb->TickRemain -= ticks;
+        }
+
+        while (p_tcb->TickRemain == 0u) {
+#if (OS_CFG_DBG_EN > 0u)
+            nbr_updated++;
+#endif
+
+            OS_TickListExpire(p_tcb);
+
+            p_list->TCB_Ptr = p_tcb->TickNextPtr;
+            p_tcb           = p_list->TCB_Ptr;                           /* Get 'p_tcb' again for loop                           */
+            if (p_tcb == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                p_list->NbrEntries = 0u;
+#endif
+                break;
+            } else {
+#if (OS_CFG_DBG_EN > 0u)
+                p_list->NbrEntries--;
+#endif
+                p_tcb->TickPrevPtr = (OS_TCB *)0;
+                if (p_tcb->TickRemain <= ticks) {
+                    ticks              = ticks - p_tcb->TickRemain;
+                    p_tcb->TickRemain  = 0u;
+                } else {
+                    p_tcb->TickRemain -= ticks;
+                }
+            }
+        }
+    }
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_list->NbrUpdated = nbr_updated;
+#else
+    (void)p_list;
+#endif
+}
+
+/*
+************************************************************************************************************************
+*                                         READY A TASK WHOSE DELAY OR TIMEOUT EXPIRED
+*
+* Description: This function makes a task ready (or suspended) when its delay or pend timeout expires.  The task has
+*              already been unlinked from the tick list by the caller.
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB of the task whose time expired.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickListExpire (OS_TCB  *p_tcb)
+{
+#if (OS_CFG_MUTEX_EN > 0u)
+    OS_TCB        *p_tcb_owner;
+    OS_PRIO        prio_new;
+#endif
+#if (OS_CFG_RWLOCK_EN > 0u)
+    OS_RWLOCK     *p_lock;
+#endif
+
+
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_DLY:
+             p_tcb->TaskState = OS_TASK_STATE_RDY;
+             OS_RdyListInsert(p_tcb);                                    /* Insert the task in the ready list                    */
+             break;
+
+        case OS_TASK_STATE_DLY_SUSPENDED:
+             p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
+             break;
+
+        default:
+#if (OS_CFG_MUTEX_EN > 0u)
+             p_tcb_owner = (OS_TCB *)0;
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_MUTEX) {
+                 p_tcb_owner = (OS_TCB *)((OS_MUTEX *)((void *)p_tcb->PendObjPtr))->OwnerTCBPtr;
+             }
+#endif
+#if (OS_CFG_RWLOCK_EN > 0u)
+             p_lock = (OS_RWLOCK *)0;
+             if (p_tcb->PendOn == OS_TASK_PEND_ON_RWLOCK) {
+                 p_lock = (OS_RWLOCK *)((void *)p_tcb->PendObjPtr);
+             }
+#endif
+
+#if (OS_MSG_EN > 0u)
+             p_tcb->MsgPtr  = (void *)0;
+             p_tcb->MsgSize = 0u;
+#endif
+#if (OS_CFG_TS_EN > 0u)
+             p_tcb->TS      = OS_TS_GET();
+#endif
+             OS_PendListRemove(p_tcb);                                   /* Remove task from pend list                           */
+
+             switch (p_tcb->TaskState) {
+                 case OS_TASK_STATE_PEND_TIMEOUT:
+                      OS_RdyListInsert(p_tcb);                           /* Insert the task in the ready list                    */
+                      p_tcb->TaskState  = OS_TASK_STATE_RDY;
+                      break;
+
+                 case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+                      p_tcb->TaskState  = OS_TASK_STATE_SUSPENDED;
+                      break;
+
+                 default:
+                      break;
+             }
+             p_tcb->PendStatus = OS_STATUS_PEND_TIMEOUT;                 /* Indicate pend timed out                              */
+             p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;                /* Indicate no longer pending                           */
+
+#if (OS_CFG_MUTEX_EN > 0u)
+             if (p_tcb_owner != (OS_TCB *)0) {
+                 if ((p_tcb_owner->Prio != p_tcb_owner->BasePrio) &&
+                     (p_tcb_owner->Prio == p_tcb->Prio)) {               /* Has the owner inherited a priority?                  */
+                     prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
+                     prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
+                     if (prio_new != p_tcb_owner->Prio) {
+                         OS_TaskChangePrio(p_tcb_owner, prio_new);
+                         OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
+                     }
+                 }
+             }
+#endif
+#if (OS_CFG_RWLOCK_EN > 0u)
+             if (p_lock != (OS_RWLOCK *)0) {                             /* Readers may get the lock, holders lose priority      */
+                 OS_RwLockPendChg(p_lock, p_tcb);
+             }
+#endif
+             break;
+    }
+}
+
+/*
+************************************************************************************************************************
+*                                          PLACE A TASK IN THE TIMING WHEEL
+*
+* Description: This function links a TCB in the timing wheel slot matching its 'TickMatch', relative to 'now'.
+*
+* Arguments  : p_tcb          is a pointer to the OS_TCB to place.  'TickMatch' must be set.
+*
+*              now            is the value of OSTickCtr the wheel has been processed up to.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The level is the highest group of OS_TICK_WHEEL_SLOT_BITS bits in which 'TickMatch' and 'now' differ.
+*                 The slot of that level is reached before any of the lower bits of 'now' wrap again, except when
+*                 the delay wraps around the 32-bit tick counter (the digit of 'TickMatch' is below the one of
+*                 'now').  Such a TCB goes to the highest level, whose slot only comes due after the wrap.
+*
+*              3) 'TickMatch' == 'now' selects the level 0 slot of 'now'.  This only happens while cascading, right
+*                 before that slot is expired.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+static  void  OS_TickWheelInsert (OS_TCB  *p_tcb,
+                                  OS_TICK  now)
+{
+    OS_TCB      **p_slot;
+    OS_TICK       diff;
+    CPU_INT08U    lvl;
+    CPU_INT08U    shift;
+
+
+    diff = p_tcb->TickMatch ^ now;
+    if (diff == 0u) {                                           /* See Note #3.                                         */
+        lvl = 0u;
+    } else {                                                    /* See Note #2.                                         */
+        lvl = (CPU_INT08U)((31u - CPU_CntLeadZeros32((CPU_INT32U)diff)) / OS_TICK_WHEEL_SLOT_BITS);
+    }
+    shift = (CPU_INT08U)(lvl * OS_TICK_WHEEL_SLOT_BITS);
+    if (((p_tcb->TickMatch >> shift) & OS_TICK_WHEEL_SLOT_MSK) <
+        ((now              >> shift) & OS_TICK_WHEEL_SLOT_MSK)) {
+        shift = (CPU_INT08U)((OS_TICK_WHEEL_LVLS - 1u) * OS_TICK_WHEEL_SLOT_BITS);
+        lvl   = OS_TICK_WHEEL_LVLS - 1u;                        /* Wraps around the tick counter                        */
+    }
+
+    p_slot             = &OSTickWheel[lvl][(p_tcb->TickMatch >> shift) & OS_TICK_WHEEL_SLOT_MSK];
+    p_tcb->TickPrevPtr = (OS_TCB *)0;                           /* Link at the head of the slot                         */
+    p_tcb->TickNextPtr = *p_slot;
+    if (*p_slot != (OS_TCB *)0) {
+        (*p_slot)->TickPrevPtr = p_tcb;
+    }
+   *p_slot             = p_tcb;
+    p_tcb->TickSlotPtr = p_slot;
+}
+
+/*
+************************************************************************************************************************
+*                                         CASCADE A SLOT OF THE TIMING WHEEL
+*
+* Description: This function moves every TCB of a higher level slot which came due into the lower levels.
+*
+* Arguments  : p_slot         is a pointer to the slot to empty.
+*
+*              now            is the value of OSTickCtr being processed.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TickWheelCascade (OS_TCB  **p_slot,
+                                   OS_TICK   now)
+{
+    OS_TCB  *p_tcb;
+    OS_TCB  *p_tcb_next;
+
+
+    p_tcb  = *p_slot;
+   *p_slot = (OS_TCB *)0;
+    while (p_tcb != (OS_TCB *)0) {
+        p_tcb_next = p_tcb->TickNextPtr;
+        OS_TickWheelInsert(p_tcb, now);                         /* Lower bits of now are 0: lands in a lower level      */
+        p_tcb      = p_tcb_next;
+    }
+}
+#endif
+
+#endif                                                                   /* #if OS_CFG_TICK_EN                                   */
+
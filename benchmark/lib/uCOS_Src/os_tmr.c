@@ -0,0 +1,2046 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           TIMER MANAGEMENT
+*
+* File    : os_tmr.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_tmr__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_TMR_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                     LOCAL DEFINES
+*
+* Note(s) : 1) Each timer task keeps its running timers in a binary min-heap ordered by the absolute tick at which they
+*              expire ('Match').  Starting, stopping and expiring a timer costs O(log n) and the earliest timer is always
+*              at the root, so the timer task simply sleeps until that tick.  Ticks are compared modulo 2^32, which
+*              limits timer delays and periods to less than 2^31 ticks.  The heap is a tree linked through the timers
+*              themselves (parent, left & right pointers in OS_TMR), so it holds any number of running timers without
+*              a table to size.
+*
+*           2) Timers are bound to the kernel's timer task (OSTmrTaskDflt) when created.  OSTmrTaskCreate() adds timer
+*              tasks at other priorities and OSTmrTaskSet() moves a stopped timer to one of them, so that a high rate
+*              timer is not held up by the callbacks of many other timers.  Each timer task has its own mutex and
+*              callbacks run with it held: a callback must only operate on the timers of its own timer task.
+************************************************************************************************************************
+*/
+
+#define  OS_TMR_MATCH_BEFORE(a, b)              ((CPU_INT32S)((OS_TICK)((a) - (b))) < 0)
+
+
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void     OS_TmrLock      (OS_TMR_TASK  *p_tmr_task);
+static  void     OS_TmrUnlock    (OS_TMR_TASK  *p_tmr_task);
+
+static  void     OS_TmrCondCreate(OS_TMR_TASK  *p_tmr_task);
+static  void     OS_TmrCondSignal(OS_TMR_TASK  *p_tmr_task);
+static  void     OS_TmrCondWait  (OS_TMR_TASK  *p_tmr_task,
+                                  OS_TICK       timeout);
+
+static  void     OS_TmrTaskInit  (OS_TMR_TASK  *p_tmr_task,
+                                  OS_TCB       *p_tcb,
+                                  CPU_CHAR     *p_name,
+                                  OS_PRIO       prio,
+                                  CPU_STK      *p_stk_base,
+                                  CPU_STK_SIZE  stk_limit,
+                                  CPU_STK_SIZE  stk_size,
+                                  OS_ERR       *p_err);
+
+static  OS_TICK  OS_TmrTickGet   (void);
+
+static  OS_TMR  *OS_TmrHeapAt    (OS_TMR_TASK  *p_tmr_task,
+                                  CPU_INT32U    pos);
+static  void     OS_TmrHeapUp    (OS_TMR_TASK  *p_tmr_task,
+                                  OS_TMR       *p_tmr);
+static  void     OS_TmrHeapDown  (OS_TMR_TASK  *p_tmr_task,
+                                  OS_TMR       *p_tmr);
+static  void     OS_TmrHeapSwap  (OS_TMR_TASK  *p_tmr_task,
+                                  OS_TMR       *p_parent,
+                                  OS_TMR       *p_child);
+
+
+/*
+************************************************************************************************************************
+*                                                   CREATE A TIMER
+*
+* Description: This function is called by your application code to create a timer.
+*
+* Arguments  : p_tmr           Is a pointer to a timer control block
+*
+*              p_name          Is a pointer to an ASCII string that is used to name the timer.  Names are useful for
+*                              debugging.
+*
+*              dly             Initial delay.
+*                              If the timer is configured for ONE-SHOT mode, this is the timeout used
+*                              If the timer is configured for PERIODIC mode, this is the first timeout to wait for
+*                              before the timer starts entering periodic mode
+*
+*              period          The 'period' being repeated for the timer.
+*                              If you specified 'OS_OPT_TMR_PERIODIC' as an option, when the timer expires, it will
+*                              automatically restart with the same period.
+*
+*              opt             Specifies either:
+*
+*                                  OS_OPT_TMR_ONE_SHOT       The timer counts down only once
+*                                  OS_OPT_TMR_PERIODIC       The timer counts down and then reloads itself
+*
+*              p_callback      Is a pointer to a callback function that will be called when the timer expires.  The
+*                              callback function must be declared as follows:
+*
+*                                  void  MyCallback (OS_TMR *p_tmr, void *p_arg);
+*
+*              p_callback_arg  Is an argument (a pointer) that is passed to the callback function when it is called.
+*
+*              p_err           Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                                 OS_ERR_NONE                    The call succeeded
+*                                 OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the timer after you called
+*                                                                  OSSafetyCriticalStart()
+*                                 OS_ERR_OBJ_PTR_NULL            Is 'p_tmr' is a NULL pointer
+*                                 OS_ERR_OPT_INVALID             You specified an invalid option
+*                                 OS_ERR_TMR_INVALID_CALLBACK    You specified an invalid callback for a periodic timer
+*                                 OS_ERR_TMR_INVALID_DLY         You specified an invalid delay
+*                                 OS_ERR_TMR_INVALID_PERIOD      You specified an invalid period
+*                                 OS_ERR_TMR_ISR                 If the call was made from an ISR
+*                                 OS_ERR_OBJ_CREATED             If the timer was already created
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function only creates the timer.  In other words, the timer is not started when created.  To
+*                 start the timer, call OSTmrStart().
+*
+*              2) The timer is serviced by the kernel's timer task, see OSTmrTaskSet() to change it.
+************************************************************************************************************************
+*/
+
+void  OSTmrCreate (OS_TMR               *p_tmr,
+                   CPU_CHAR             *p_name,
+                   OS_TICK               dly,
+                   OS_TICK               period,
+                   OS_OPT                opt,
+                   OS_TMR_CALLBACK_PTR   p_callback,
+                   void                 *p_callback_arg,
+                   OS_ERR               *p_err)
+{
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {                                 /* Validate 'p_tmr'                                     */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+
+    switch (opt) {
+        case OS_OPT_TMR_PERIODIC:
+             if (period == 0u) {
+                *p_err = OS_ERR_TMR_INVALID_PERIOD;
+                 return;
+             }
+
+             if (p_callback == (OS_TMR_CALLBACK_PTR)0) {        /* No point in a periodic timer without a callback      */
+                *p_err = OS_ERR_TMR_INVALID_CALLBACK;
+                 return;
+             }
+             break;
+
+        case OS_OPT_TMR_ONE_SHOT:
+             if (dly == 0u) {
+                *p_err = OS_ERR_TMR_INVALID_DLY;
+                 return;
+             }
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {                     /* Only lock when the kernel is running                 */
+        OS_TmrLock(&OSTmrTaskDflt);
+    }
+
+    p_tmr->State          = OS_TMR_STATE_STOPPED;               /* Initialize the timer fields                          */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    if (p_tmr->Type == OS_OBJ_TYPE_TMR) {
+        if (OSRunning == OS_STATE_OS_RUNNING) {
+            OS_TmrUnlock(&OSTmrTaskDflt);
+        }
+        *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+    p_tmr->Type           = OS_OBJ_TYPE_TMR;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_tmr->NamePtr        = p_name;
+#else
+    (void)p_name;
+#endif
+    p_tmr->Dly            =  dly    * OSTmrToTicksMult;         /* Convert to Timer Start Delay to ticks                */
+    p_tmr->Remain         =  0u;
+    p_tmr->Period         =  period * OSTmrToTicksMult;         /* Convert to Timer Period      to ticks                */
+    p_tmr->Opt            =  opt;
+    p_tmr->CallbackPtr    =  p_callback;
+    p_tmr->CallbackPtrArg =  p_callback_arg;
+    p_tmr->TaskPtr        = &OSTmrTaskDflt;                     /* See Note #2                                          */
+    p_tmr->HeapParentPtr  = (OS_TMR *)0;
+    p_tmr->HeapLeftPtr    = (OS_TMR *)0;
+    p_tmr->HeapRightPtr   = (OS_TMR *)0;
+    p_tmr->Match          =  0u;
+
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CRITICAL_ENTER();                                       /* Shared by the timers of all timer tasks              */
+    OS_TmrDbgListAdd(p_tmr);
+    OSTmrQty++;                                                 /* Keep track of the number of timers created           */
+    CPU_CRITICAL_EXIT();
+#endif
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {
+        OS_TmrUnlock(&OSTmrTaskDflt);
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   DELETE A TIMER
+*
+* Description: This function is called by your application code to delete a timer.
+*
+* Arguments  : p_tmr          Is a pointer to the timer to stop and delete.
+*
+*              p_err          Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                                 OS_ERR_NONE                    The call succeeded
+*                                 OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the timer after you called
+*                                                                  OSStart()
+*                                 OS_ERR_OBJ_TYPE                If 'p_tmr' is not pointing to a timer
+*                                 OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                 OS_ERR_TMR_INACTIVE            If the timer was not created
+*                                 OS_ERR_TMR_INVALID             If 'p_tmr' is a NULL pointer
+*                                 OS_ERR_TMR_INVALID_STATE       The timer is in an invalid state
+*                                 OS_ERR_TMR_ISR                 If the function was called from an ISR
+*
+* Returns    : OS_TRUE   if the timer was deleted
+*              OS_FALSE  if not or upon an error
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TMR_DEL_EN > 0u)
+CPU_BOOLEAN  OSTmrDel (OS_TMR  *p_tmr,
+                       OS_ERR  *p_err)
+{
+    OS_TMR_TASK  *p_tmr_task;
+    CPU_BOOLEAN   success;
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_SR_ALLOC();
+#endif
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_FALSE);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err  = OS_ERR_TMR_ISR;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {
+       *p_err = OS_ERR_TMR_INVALID;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (OS_FALSE);
+    }
+#endif
+
+    p_tmr_task = p_tmr->TaskPtr;                                /* OS_TmrClr() rebinds the timer                        */
+    OS_TmrLock(p_tmr_task);
+
+    switch (p_tmr->State) {
+        case OS_TMR_STATE_RUNNING:
+        case OS_TMR_STATE_TIMEOUT:
+             OS_TmrUnlink(p_tmr);                               /* Remove from the heap                                 */
+#if (OS_CFG_DBG_EN > 0u)
+             CPU_CRITICAL_ENTER();
+             OS_TmrDbgListRemove(p_tmr);
+             OSTmrQty--;                                        /* One less timer                                       */
+             CPU_CRITICAL_EXIT();
+#endif
+             OS_TmrClr(p_tmr);
+            *p_err   = OS_ERR_NONE;
+             success = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_STOPPED:                              /* Timer has not started or ...                         */
+        case OS_TMR_STATE_COMPLETED:                            /* ... timer has completed the ONE-SHOT time            */
+#if (OS_CFG_DBG_EN > 0u)
+             CPU_CRITICAL_ENTER();
+             OS_TmrDbgListRemove(p_tmr);
+             OSTmrQty--;                                        /* One less timer                                       */
+             CPU_CRITICAL_EXIT();
+#endif
+             OS_TmrClr(p_tmr);                                  /* Clear timer fields                                   */
+            *p_err   = OS_ERR_NONE;
+             success = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_UNUSED:                               /* Already deleted                                      */
+            *p_err   = OS_ERR_TMR_INACTIVE;
+             success = OS_FALSE;
+             break;
+
+        default:
+            *p_err   = OS_ERR_TMR_INVALID_STATE;
+             success = OS_FALSE;
+             break;
+    }
+
+    OS_TmrUnlock(p_tmr_task);
+
+    return (success);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                    GET HOW MUCH TIME IS LEFT BEFORE A TIMER EXPIRES
+*
+* Description: This function is called to get the number of timer increments before a timer times out.
+*
+* Arguments  : p_tmr    Is a pointer to the timer to obtain the remaining time from.
+*
+*              p_err    Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                           OS_ERR_NONE               The call succeeded
+*                           OS_ERR_OBJ_TYPE           If 'p_tmr' is not pointing to a timer
+*                           OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                           OS_ERR_TMR_INACTIVE       If 'p_tmr' points to a timer that is not active
+*                           OS_ERR_TMR_INVALID        If 'p_tmr' is a NULL pointer
+*                           OS_ERR_TMR_INVALID_STATE  The timer is in an invalid state
+*                           OS_ERR_TMR_ISR            If the call was made from an ISR
+*
+* Returns    : The time remaining for the timer to expire.  The time represents 'timer' increments (typically 1/10 sec).
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
+                         OS_ERR  *p_err)
+{
+    OS_TMR_TASK  *p_tmr_task;
+    OS_TICK       remain;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {
+       *p_err = OS_ERR_TMR_INVALID;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    p_tmr_task = p_tmr->TaskPtr;
+    OS_TmrLock(p_tmr_task);
+
+    switch (p_tmr->State) {
+        case OS_TMR_STATE_RUNNING:
+             if (OSTCBCurPtr == p_tmr_task->TCBPtr) {           /* Callbacks operate on the Tmr Task's tick base.       */
+                 remain = p_tmr->Match - p_tmr_task->TickBase;
+             } else {
+                 remain = p_tmr->Match - OS_TmrTickGet();
+             }
+             if ((CPU_INT32S)remain < 0) {                      /* Already due, the timer task did not run yet          */
+                 remain = 0u;
+             }
+             remain /= OSTmrToTicksMult;
+            *p_err   = OS_ERR_NONE;
+             break;
+
+        case OS_TMR_STATE_STOPPED:                              /* It's assumed that the timer has not started yet      */
+             if (p_tmr->Opt == OS_OPT_TMR_PERIODIC) {
+                 if (p_tmr->Dly == 0u) {
+                     remain = p_tmr->Period / OSTmrToTicksMult;
+                 } else {
+                     remain = p_tmr->Dly / OSTmrToTicksMult;
+                 }
+             } else {
+                 remain = p_tmr->Dly / OSTmrToTicksMult;
+             }
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_TMR_STATE_TIMEOUT:                              /* Within a callback, timers are in the TIMEOUT state   */
+        case OS_TMR_STATE_COMPLETED:                            /* Only ONE-SHOT timers can be in the COMPLETED state   */
+            *p_err  = OS_ERR_NONE;
+             remain = 0u;
+             break;
+
+        case OS_TMR_STATE_UNUSED:
+            *p_err  = OS_ERR_TMR_INACTIVE;
+             remain = 0u;
+             break;
+
+        default:
+            *p_err = OS_ERR_TMR_INVALID_STATE;
+             remain = 0u;
+             break;
+    }
+
+    OS_TmrUnlock(p_tmr_task);
+
+    return (remain);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    SET A TIMER
+*
+* Description: This function is called by your application code to set a timer.
+*
+* Arguments  : p_tmr           Is a pointer to a timer control block
+*
+*              dly             Initial delay.
+*                              If the timer is configured for ONE-SHOT mode, this is the timeout used
+*                              If the timer is configured for PERIODIC mode, this is the first timeout to wait for
+*                              before the timer starts entering periodic mode
+*
+*              period          The 'period' being repeated for the timer.
+*                              If you specified 'OS_OPT_TMR_PERIODIC' as an option, when the timer expires, it will
+*                              automatically restart with the same period.
+*
+*              p_callback      Is a pointer to a callback function that will be called when the timer expires.  The
+*                              callback function must be declared as follows:
+*
+*                                  void  MyCallback (OS_TMR *p_tmr, void *p_arg);
+*
+*              p_callback_arg  Is an argument (a pointer) that is passed to the callback function when it is called.
+*
+*              p_err           Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                                 OS_ERR_NONE                    The timer was configured as expected
+*                                 OS_ERR_OBJ_TYPE                If the object type is invalid
+*                                 OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                 OS_ERR_TMR_INVALID             If 'p_tmr' is a NULL pointer or invalid option
+*                                 OS_ERR_TMR_INVALID_CALLBACK    you specified an invalid callback for a periodic timer
+*                                 OS_ERR_TMR_INVALID_DLY         You specified an invalid delay
+*                                 OS_ERR_TMR_INVALID_PERIOD      You specified an invalid period
+*                                 OS_ERR_TMR_ISR                 If the call was made from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function can be called on a running timer. The change to the delay and period will only
+*                 take effect after the current period or delay has passed. Change to the callback will take
+*                 effect immediately.
+************************************************************************************************************************
+*/
+
+void  OSTmrSet (OS_TMR               *p_tmr,
+                OS_TICK               dly,
+                OS_TICK               period,
+                OS_TMR_CALLBACK_PTR   p_callback,
+                void                 *p_callback_arg,
+                OS_ERR               *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {                                 /* Validate 'p_tmr'                                     */
+       *p_err = OS_ERR_TMR_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    switch (p_tmr->Opt) {
+        case OS_OPT_TMR_PERIODIC:
+             if (period == 0u) {
+                *p_err = OS_ERR_TMR_INVALID_PERIOD;
+                 return;
+             }
+
+             if (p_callback == (OS_TMR_CALLBACK_PTR)0) {        /* No point in a periodic timer without a callback      */
+                *p_err = OS_ERR_TMR_INVALID_CALLBACK;
+                 return;
+             }
+             break;
+
+        case OS_OPT_TMR_ONE_SHOT:
+             if (dly == 0u) {
+                *p_err = OS_ERR_TMR_INVALID_DLY;
+                 return;
+             }
+             break;
+
+        default:
+            *p_err = OS_ERR_TMR_INVALID;
+             return;
+    }
+#endif
+
+    OS_TmrLock(p_tmr->TaskPtr);
+
+    p_tmr->Dly            = dly    * OSTmrToTicksMult;             /* Convert Timer Delay  to ticks                     */
+    p_tmr->Period         = period * OSTmrToTicksMult;             /* Convert Timer Period to ticks                     */
+    p_tmr->CallbackPtr    = p_callback;
+    p_tmr->CallbackPtrArg = p_callback_arg;
+
+   *p_err                 = OS_ERR_NONE;
+
+    OS_TmrUnlock(p_tmr->TaskPtr);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   START A TIMER
+*
+* Description: This function is called by your application code to start a timer.
+*
+* Arguments  : p_tmr    Is a pointer to an OS_TMR
+*
+*              p_err    Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                           OS_ERR_NONE                The timer was started
+*                           OS_ERR_OBJ_TYPE            If 'p_tmr' is not pointing to a timer
+*                           OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
+*                           OS_ERR_TMR_INACTIVE        If the timer was not created
+*                           OS_ERR_TMR_INVALID         If 'p_tmr' is a NULL pointer
+*                           OS_ERR_TMR_INVALID_STATE   The timer is in an invalid state
+*                           OS_ERR_TMR_ISR             If the call was made from an ISR
+*
+* Returns    : OS_TRUE   is the timer was started
+*              OS_FALSE  if not or upon an error
+*
+* Note(s)    : 1) When starting/restarting a timer, regardless if it is in PERIODIC or ONE-SHOT mode, the timer is
+*                 linked to the heap of its timer task 'Dly' (or 'Period' if 'Dly' is 0) ticks from now.  For timers
+*                 in PERIODIC mode, subsequent expiration times are handled by the OS_TmrTask().
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OSTmrStart (OS_TMR  *p_tmr,
+                         OS_ERR  *p_err)
+{
+    OS_TMR_TASK  *p_tmr_task;
+    CPU_BOOLEAN   success;
+    OS_TICK       time;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {
+       *p_err = OS_ERR_TMR_INVALID;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (OS_FALSE);
+    }
+#endif
+
+    p_tmr_task = p_tmr->TaskPtr;
+    OS_TmrLock(p_tmr_task);
+
+    if (OSTCBCurPtr == p_tmr_task->TCBPtr) {                    /* Callbacks operate on the Tmr Task's tick base.       */
+        time = p_tmr_task->TickBase;
+    } else {
+        time = OS_TmrTickGet();
+    }
+
+    switch (p_tmr->State) {
+        case OS_TMR_STATE_RUNNING:                              /* Restart the timer                                    */
+        case OS_TMR_STATE_TIMEOUT:
+             p_tmr->State = OS_TMR_STATE_RUNNING;
+             OS_TmrUnlink(p_tmr);                               /* Remove from current position in the heap             */
+             if (p_tmr->Dly == 0u) {
+                 p_tmr->Remain = p_tmr->Period;
+             } else {
+                 p_tmr->Remain = p_tmr->Dly;
+             }
+             OS_TmrLink(p_tmr, time);                           /* Add timer back                                       */
+            *p_err   = OS_ERR_NONE;
+             success = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_STOPPED:                              /* Start the timer                                      */
+        case OS_TMR_STATE_COMPLETED:
+             if (p_tmr->Dly == 0u) {
+                 p_tmr->Remain = p_tmr->Period;
+             } else {
+                 p_tmr->Remain = p_tmr->Dly;
+             }
+             OS_TmrLink(p_tmr, time);                           /* Add timer to the heap                                */
+             p_tmr->State = OS_TMR_STATE_RUNNING;
+            *p_err   = OS_ERR_NONE;
+             success = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_UNUSED:                               /* Timer not created                                    */
+            *p_err   = OS_ERR_TMR_INACTIVE;
+             success = OS_FALSE;
+             break;
+
+        default:
+            *p_err   = OS_ERR_TMR_INVALID_STATE;
+             success = OS_FALSE;
+             break;
+    }
+
+    OS_TmrUnlock(p_tmr_task);
+
+    return (success);
+}
+
+
+/*
+************************************************************************************************************************
+*                                           FIND OUT WHAT STATE A TIMER IS IN
+*
+* Description: This function is called to determine what state the timer is in:
+*
+*                  OS_TMR_STATE_UNUSED     the timer has not been created
+*                  OS_TMR_STATE_STOPPED    the timer has been created but has not been started or has been stopped
+*                  OS_TMR_STATE_COMPLETED  the timer is in ONE-SHOT mode and has completed it's timeout
+*                  OS_TMR_SATE_RUNNING     the timer is currently running
+*
+* Arguments  : p_tmr    Is a pointer to the desired timer
+*
+*              p_err    Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                           OS_ERR_NONE               The return value reflects the state of the timer
+*                           OS_ERR_OBJ_TYPE           If 'p_tmr' is not pointing to a timer
+*                           OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                           OS_ERR_TMR_INVALID        If 'p_tmr' is a NULL pointer
+*                           OS_ERR_TMR_INVALID_STATE  If the timer is not in a valid state
+*                           OS_ERR_TMR_ISR            If the call was made from an ISR
+*
+* Returns    : The current state of the timer (see description).
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+OS_STATE  OSTmrStateGet (OS_TMR  *p_tmr,
+                         OS_ERR  *p_err)
+{
+    OS_STATE  state;
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_TMR_STATE_UNUSED);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return (OS_TMR_STATE_UNUSED);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (OS_TMR_STATE_UNUSED);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {
+       *p_err = OS_ERR_TMR_INVALID;
+        return (OS_TMR_STATE_UNUSED);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (OS_TMR_STATE_UNUSED);
+    }
+#endif
+
+    OS_TmrLock(p_tmr->TaskPtr);
+
+    state = p_tmr->State;
+    switch (state) {
+        case OS_TMR_STATE_UNUSED:
+        case OS_TMR_STATE_STOPPED:
+        case OS_TMR_STATE_COMPLETED:
+        case OS_TMR_STATE_RUNNING:
+        case OS_TMR_STATE_TIMEOUT:
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+            *p_err = OS_ERR_TMR_INVALID_STATE;
+             break;
+    }
+
+    OS_TmrUnlock(p_tmr->TaskPtr);
+
+    return (state);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    STOP A TIMER
+*
+* Description: This function is called by your application code to stop a timer.
+*
+* Arguments  : p_tmr          Is a pointer to the timer to stop.
+*
+*              opt            Allows you to specify an option to this functions which can be:
+*
+*                               OS_OPT_TMR_NONE            Do nothing special but stop the timer
+*                               OS_OPT_TMR_CALLBACK        Execute the callback function, pass it the callback argument
+*                                                          specified when the timer was created.
+*                               OS_OPT_TMR_CALLBACK_ARG    Execute the callback function, pass it the callback argument
+*                                                          specified in THIS function call
+*
+*              callback_arg   Is a pointer to a 'new' callback argument that can be passed to the callback function
+*                               instead of the timer's callback argument.  In other words, use 'callback_arg' passed in
+*                               THIS function INSTEAD of p_tmr->OSTmrCallbackArg
+*
+*              p_err          Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                               OS_ERR_NONE                The timer has stopped
+*                               OS_ERR_OBJ_TYPE            If 'p_tmr' is not pointing to a timer
+*                               OS_ERR_OPT_INVALID         If you specified an invalid option for 'opt'
+*                               OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
+*                               OS_ERR_TMR_INACTIVE        If the timer was not created
+*                               OS_ERR_TMR_INVALID         If 'p_tmr' is a NULL pointer
+*                               OS_ERR_TMR_INVALID_STATE   The timer is in an invalid state
+*                               OS_ERR_TMR_ISR             If the function was called from an ISR
+*                               OS_ERR_TMR_NO_CALLBACK     If the timer does not have a callback function defined
+*                               OS_ERR_TMR_STOPPED         If the timer was already stopped
+*
+* Returns    : OS_TRUE   If we stopped the timer (if the timer is already stopped, we also return OS_TRUE)
+*              OS_FALSE  If not
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OSTmrStop (OS_TMR  *p_tmr,
+                        OS_OPT   opt,
+                        void    *p_callback_arg,
+                        OS_ERR  *p_err)
+{
+    OS_TMR_CALLBACK_PTR  p_fnct;
+    OS_TMR_TASK         *p_tmr_task;
+    CPU_BOOLEAN          success;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {
+       *p_err = OS_ERR_TMR_INVALID;
+        return (OS_FALSE);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (OS_FALSE);
+    }
+#endif
+
+    p_tmr_task = p_tmr->TaskPtr;
+    OS_TmrLock(p_tmr_task);
+
+    switch (p_tmr->State) {
+        case OS_TMR_STATE_RUNNING:
+        case OS_TMR_STATE_TIMEOUT:
+             p_tmr->State = OS_TMR_STATE_STOPPED;               /* Ensure that any callbacks see the stop state         */
+             switch (opt) {
+                 case OS_OPT_TMR_CALLBACK:
+                      OS_TmrUnlink(p_tmr);                      /* Remove from the heap                                 */
+                      p_fnct = p_tmr->CallbackPtr;              /* Execute callback function ...                        */
+                      if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {   /* ... if available                                     */
+                        (*p_fnct)(p_tmr, p_tmr->CallbackPtrArg);/* Use callback arg when timer was created              */
+                      } else {
+                         *p_err = OS_ERR_TMR_NO_CALLBACK;
+                      }
+                      break;
+
+                 case OS_OPT_TMR_CALLBACK_ARG:
+                      OS_TmrUnlink(p_tmr);                      /* Remove from the heap                                 */
+                      p_fnct = p_tmr->CallbackPtr;              /* Execute callback function if available ...           */
+                      if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {
+                        (*p_fnct)(p_tmr, p_callback_arg);       /* .. using the 'callback_arg' provided in call         */
+                      } else {
+                         *p_err = OS_ERR_TMR_NO_CALLBACK;
+                      }
+                      break;
+
+                 case OS_OPT_TMR_NONE:
+                      OS_TmrUnlink(p_tmr);                      /* Remove from the heap                                 */
+                      break;
+
+                 default:
+                      OS_TmrUnlock(p_tmr_task);
+                     *p_err = OS_ERR_OPT_INVALID;
+                      return (OS_FALSE);
+             }
+            *p_err        = OS_ERR_NONE;
+             success      = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_COMPLETED:                            /* Timer has already completed the ONE-SHOT or          */
+        case OS_TMR_STATE_STOPPED:                              /* ... timer has not started yet.                       */
+             p_tmr->State = OS_TMR_STATE_STOPPED;
+            *p_err        = OS_ERR_TMR_STOPPED;
+             success      = OS_TRUE;
+             break;
+
+        case OS_TMR_STATE_UNUSED:                               /* Timer was not created                                */
+            *p_err        = OS_ERR_TMR_INACTIVE;
+             success      = OS_FALSE;
+             break;
+
+        default:
+            *p_err        = OS_ERR_TMR_INVALID_STATE;
+             success      = OS_FALSE;
+             break;
+    }
+
+    OS_TmrUnlock(p_tmr_task);
+
+    return (success);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                CREATE A TIMER TASK
+*
+* Description: This function is called by your application code to create an additional timer task.  Timers bound to
+*              it (see OSTmrTaskSet()) have their callbacks executed at the priority of this task instead of the one of
+*              the kernel's timer task.
+*
+* Arguments  : p_tmr_task     Is a pointer to the timer task control block
+*
+*              p_tcb          Is a pointer to the task's TCB
+*
+*              p_name         Is a pointer to an ASCII string to name the task
+*
+*              prio           Is the priority of the task.  Callbacks run at this priority.
+*
+*              p_stk_base     Is a pointer to the base address of the task's stack
+*
+*              stk_limit      Is the number of stack elements to set as 'watermark' limit for the stack
+*
+*              stk_size       Is the size of the stack in number of elements
+*
+*              p_err          Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                                 OS_ERR_NONE                    The call succeeded
+*                                 OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the task after you called
+*                                                                  OSSafetyCriticalStart()
+*                                 OS_ERR_OBJ_PTR_NULL            If 'p_tmr_task' or 'p_tcb' is a NULL pointer
+*                                 OS_ERR_TMR_ISR                 If the call was made from an ISR
+*                                 OS_ERR_TMR_PRIO_INVALID        If you specified the same priority as the idle task
+*                                 OS_ERR_TMR_STK_INVALID         If 'p_stk_base' is a NULL pointer
+*                                 OS_ERR_TMR_STK_SIZE_INVALID    If 'stk_size' is below the minimum stack size
+*                                 OS_ERR_xxx                     Any error code returned by OSTaskCreate()
+*
+* Returns    : none
+*
+* Note(s)    : 1) A timer task without running timers pends forever and does not use any CPU time.
+************************************************************************************************************************
+*/
+
+void  OSTmrTaskCreate (OS_TMR_TASK   *p_tmr_task,
+                       OS_TCB        *p_tcb,
+                       CPU_CHAR      *p_name,
+                       OS_PRIO        prio,
+                       CPU_STK       *p_stk_base,
+                       CPU_STK_SIZE   stk_limit,
+                       CPU_STK_SIZE   stk_size,
+                       OS_ERR        *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if ((p_tmr_task == (OS_TMR_TASK *)0) ||
+        (p_tcb      == (OS_TCB      *)0)) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    OS_TmrTaskInit(p_tmr_task,
+                   p_tcb,
+                   p_name,
+                   prio,
+                   p_stk_base,
+                   stk_limit,
+                   stk_size,
+                   p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          SET THE TIMER TASK OF A TIMER
+*
+* Description: This function is called by your application code to change the timer task which services a timer.
+*
+* Arguments  : p_tmr          Is a pointer to the timer
+*
+*              p_tmr_task     Is a pointer to the timer task, created by OSTmrTaskCreate() or &OSTmrTaskDflt
+*
+*              p_err          Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                                 OS_ERR_NONE                    The call succeeded
+*                                 OS_ERR_OBJ_PTR_NULL            If 'p_tmr_task' is a NULL pointer
+*                                 OS_ERR_OBJ_TYPE                If 'p_tmr' is not pointing to a timer
+*                                 OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                 OS_ERR_TMR_INACTIVE            If the timer was not created
+*                                 OS_ERR_TMR_INVALID             If 'p_tmr' is a NULL pointer
+*                                 OS_ERR_TMR_INVALID_STATE       If the timer is running
+*                                 OS_ERR_TMR_ISR                 If the call was made from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The timer must be stopped (or completed) and no other task may use it during the call.
+************************************************************************************************************************
+*/
+
+void  OSTmrTaskSet (OS_TMR       *p_tmr,
+                    OS_TMR_TASK  *p_tmr_task,
+                    OS_ERR       *p_err)
+{
+    OS_TMR_TASK  *p_tmr_task_old;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {
+       *p_err = OS_ERR_TMR_INVALID;
+        return;
+    }
+
+    if (p_tmr_task == (OS_TMR_TASK *)0) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_tmr->Type != OS_OBJ_TYPE_TMR) {                       /* Make sure timer was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    p_tmr_task_old = p_tmr->TaskPtr;
+    OS_TmrLock(p_tmr_task_old);
+
+    switch (p_tmr->State) {
+        case OS_TMR_STATE_STOPPED:                              /* Not in any heap, free to move                        */
+        case OS_TMR_STATE_COMPLETED:
+             p_tmr->TaskPtr = p_tmr_task;
+            *p_err          = OS_ERR_NONE;
+             break;
+
+        case OS_TMR_STATE_UNUSED:
+            *p_err          = OS_ERR_TMR_INACTIVE;
+             break;
+
+        case OS_TMR_STATE_RUNNING:
+        case OS_TMR_STATE_TIMEOUT:
+        default:
+            *p_err          = OS_ERR_TMR_INVALID_STATE;
+             break;
+    }
+
+    OS_TmrUnlock(p_tmr_task_old);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 CLEAR TIMER FIELDS
+*
+* Description: This function is called to clear all timer fields.
+*
+* Argument(s): p_tmr    Is a pointer to the timer to clear
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_TmrClr (OS_TMR  *p_tmr)
+{
+    p_tmr->State          = OS_TMR_STATE_UNUSED;                /* Clear timer fields                                   */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_tmr->Type           = OS_OBJ_TYPE_NONE;
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_tmr->NamePtr        = (CPU_CHAR *)((void *)"?TMR");
+#endif
+    p_tmr->Dly            =                      0u;
+    p_tmr->Remain         =                      0u;
+    p_tmr->Period         =                      0u;
+    p_tmr->Opt            =                      0u;
+    p_tmr->CallbackPtr    = (OS_TMR_CALLBACK_PTR)0;
+    p_tmr->CallbackPtrArg = (void              *)0;
+    p_tmr->TaskPtr        = &OSTmrTaskDflt;                     /* Later calls must still find a mutex to lock          */
+    p_tmr->HeapParentPtr  = (OS_TMR              *)0;
+    p_tmr->HeapLeftPtr    = (OS_TMR              *)0;
+    p_tmr->HeapRightPtr   = (OS_TMR              *)0;
+    p_tmr->Match          =                      0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                         ADD/REMOVE TIMER TO/FROM DEBUG TABLE
+*
+* Description: These functions are called by uC/OS-III to add or remove a timer to/from a timer debug table.
+*
+* Arguments  : p_tmr     is a pointer to the timer to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_TmrDbgListAdd (OS_TMR  *p_tmr)
+{
+    p_tmr->DbgPrevPtr               = (OS_TMR *)0;
+    if (OSTmrDbgListPtr == (OS_TMR *)0) {
+        p_tmr->DbgNextPtr           = (OS_TMR *)0;
+    } else {
+        p_tmr->DbgNextPtr           =  OSTmrDbgListPtr;
+        OSTmrDbgListPtr->DbgPrevPtr =  p_tmr;
+    }
+    OSTmrDbgListPtr                 =  p_tmr;
+}
+
+
+
+void  OS_TmrDbgListRemove (OS_TMR  *p_tmr)
+{
+    OS_TMR  *p_tmr_next;
+    OS_TMR  *p_tmr_prev;
+
+
+    p_tmr_prev = p_tmr->DbgPrevPtr;
+    p_tmr_next = p_tmr->DbgNextPtr;
+
+    if (p_tmr_prev == (OS_TMR *)0) {
+        OSTmrDbgListPtr = p_tmr_next;
+        if (p_tmr_next != (OS_TMR *)0) {
+            p_tmr_next->DbgPrevPtr = (OS_TMR *)0;
+        }
+        p_tmr->DbgNextPtr = (OS_TMR *)0;
+
+    } else if (p_tmr_next == (OS_TMR *)0) {
+        p_tmr_prev->DbgNextPtr = (OS_TMR *)0;
+        p_tmr->DbgPrevPtr      = (OS_TMR *)0;
+
+    } else {
+        p_tmr_prev->DbgNextPtr =  p_tmr_next;
+        p_tmr_next->DbgPrevPtr =  p_tmr_prev;
+        p_tmr->DbgNextPtr      = (OS_TMR *)0;
+        p_tmr->DbgPrevPtr      = (OS_TMR *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             INITIALIZE THE TIMER MANAGER
+*
+* Description: This function is called by OSInit() to initialize the timer manager module.
+*
+* Argument(s): p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                           OS_ERR_NONE
+*                           OS_ERR_TMR_STK_INVALID       if you didn't specify a stack for the timer task
+*                           OS_ERR_TMR_STK_SIZE_INVALID  if you didn't allocate enough space for the timer stack
+*                           OS_ERR_PRIO_INVALID          if you specified the same priority as the idle task
+*                           OS_ERR_xxx                   any error code returned by OSTaskCreate()
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_TmrInit (OS_ERR  *p_err)
+{
+#if (OS_CFG_DBG_EN > 0u)
+    OSTmrQty             =           0u;                        /* Keep track of the number of timers created           */
+    OSTmrDbgListPtr      = (OS_TMR *)0;
+#endif
+                                                                /* Calculate Timer to Ticks multiplier                  */
+    OSTmrToTicksMult = OSCfg_TickRate_Hz / OSCfg_TmrTaskRate_Hz;
+
+    OS_TmrTaskInit(&OSTmrTaskDflt,                              /* -------------- CREATE THE TIMER TASK --------------- */
+                   &OSTmrTaskTCB,
+#if  (OS_CFG_DBG_EN == 0u)
+                   (CPU_CHAR *)0,
+#else
+                   (CPU_CHAR *)"uC/OS-III Timer Task",
+#endif
+                    OSCfg_TmrTaskPrio,
+                    OSCfg_TmrTaskStkBasePtr,
+                    OSCfg_TmrTaskStkLimit,
+                    OSCfg_TmrTaskStkSize,
+                    p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                              INITIALIZE A TIMER TASK
+*
+* Description: This function initializes a timer task control block and creates its task.
+*
+* Arguments  : p_tmr_task     is a pointer to the timer task control block.
+*
+*              p_tcb ...      see OSTmrTaskCreate().
+*
+*              p_err          is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                 OS_ERR_NONE
+*                                 OS_ERR_TMR_STK_INVALID       if you didn't specify a stack for the timer task
+*                                 OS_ERR_TMR_STK_SIZE_INVALID  if you didn't allocate enough space for the timer stack
+*                                 OS_ERR_TMR_PRIO_INVALID      if you specified the same priority as the idle task
+*                                 OS_ERR_xxx                   any error code returned by OSMutexCreate() or
+*                                                              OSTaskCreate()
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrTaskInit (OS_TMR_TASK   *p_tmr_task,
+                              OS_TCB        *p_tcb,
+                              CPU_CHAR      *p_name,
+                              OS_PRIO        prio,
+                              CPU_STK       *p_stk_base,
+                              CPU_STK_SIZE   stk_limit,
+                              CPU_STK_SIZE   stk_size,
+                              OS_ERR        *p_err)
+{
+    if (p_stk_base == (CPU_STK *)0) {
+       *p_err = OS_ERR_TMR_STK_INVALID;
+        return;
+    }
+
+    if (stk_size < OSCfg_StkSizeMin) {
+       *p_err = OS_ERR_TMR_STK_SIZE_INVALID;
+        return;
+    }
+
+    if (prio >= (OS_CFG_PRIO_MAX - 1u)) {
+       *p_err = OS_ERR_TMR_PRIO_INVALID;
+        return;
+    }
+
+    p_tmr_task->TCBPtr      = p_tcb;
+    p_tmr_task->HeapRootPtr = (OS_TMR *)0;                      /* Create an empty heap                                 */
+    p_tmr_task->HeapQty     = 0u;
+    p_tmr_task->TickBase    = OS_TmrTickGet();
+#if (OS_CFG_TS_EN > 0u)
+    p_tmr_task->Time        = 0u;
+    p_tmr_task->TimeMax     = 0u;
+#endif
+
+    OSMutexCreate(&p_tmr_task->Mutex,                           /* Use a mutex to protect the timers                    */
+#if  (OS_CFG_DBG_EN == 0u)
+                  (CPU_CHAR *)0,
+#else
+                  (CPU_CHAR *)"OS Tmr Mutex",
+#endif
+                  p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    OS_TmrCondCreate(p_tmr_task);
+
+    OSTaskCreate(p_tcb,
+                 p_name,
+                 OS_TmrTask,
+                 (void     *)p_tmr_task,
+                 prio,
+                 p_stk_base,
+                 stk_limit,
+                 stk_size,
+                 0u,
+                 0u,
+                 (void     *)0,
+                 (OS_OPT_TASK_STK_CHK | (OS_OPT)(OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS)),
+                 p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                         ADD A TIMER TO THE HEAP OF ITS TIMER TASK
+*
+* Description: This function is called to add a timer to the heap of running timers of its timer task.
+*
+* Arguments  : p_tmr          Is a pointer to the timer to add.  'Remain' holds the delay to expire after.
+*
+*              time           Is the system time when this timer was linked.
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The heap is linked through the timers themselves (see Note #1 at the top of this file), so adding a
+*                 timer never fails, whatever the number of running timers.
+************************************************************************************************************************
+*/
+
+void  OS_TmrLink (OS_TMR   *p_tmr,
+                  OS_TICK   time)
+{
+    OS_TMR_TASK  *p_tmr_task;
+    OS_TMR       *p_parent;
+    CPU_INT32U    pos;
+
+
+    p_tmr_task          = p_tmr->TaskPtr;
+    p_tmr->Match        = time + p_tmr->Remain;
+    p_tmr->HeapLeftPtr  = (OS_TMR *)0;
+    p_tmr->HeapRightPtr = (OS_TMR *)0;
+
+    p_tmr_task->HeapQty++;                                      /* Append as the last leaf ...                          */
+    pos = (CPU_INT32U)p_tmr_task->HeapQty;
+    if (pos == 1u) {
+        p_tmr->HeapParentPtr    = (OS_TMR *)0;
+        p_tmr_task->HeapRootPtr = p_tmr;
+    } else {
+        p_parent             = OS_TmrHeapAt(p_tmr_task, pos / 2u);
+        p_tmr->HeapParentPtr = p_parent;
+        if ((pos & 1u) == 0u) {
+            p_parent->HeapLeftPtr  = p_tmr;
+        } else {
+            p_parent->HeapRightPtr = p_tmr;
+        }
+    }
+    OS_TmrHeapUp(p_tmr_task, p_tmr);                            /* ... and move it up to its place                      */
+
+    if (p_tmr_task->HeapRootPtr == p_tmr) {                     /* New earliest timer, the timer task must reload ...   */
+        OS_TmrCondSignal(p_tmr_task);                           /* ... its timeout                                      */
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                      REMOVE A TIMER FROM THE HEAP OF ITS TIMER TASK
+*
+* Description: This function is called to remove the timer from the heap of running timers of its timer task.
+*
+* Arguments  : p_tmr          Is a pointer to the timer to remove.
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The timer task is not signaled when the earliest timer is removed.  It wakes up at the old
+*                 timeout, finds nothing to expire and goes back to sleep until the new earliest timer.
+************************************************************************************************************************
+*/
+
+void  OS_TmrUnlink (OS_TMR  *p_tmr)
+{
+    OS_TMR_TASK  *p_tmr_task;
+    OS_TMR       *p_tmr_last;
+    OS_TMR       *p_parent;
+
+
+    p_tmr_task = p_tmr->TaskPtr;
+    p_tmr_last = OS_TmrHeapAt(p_tmr_task, (CPU_INT32U)p_tmr_task->HeapQty);
+    p_parent   = p_tmr_last->HeapParentPtr;                     /* Detach the last leaf                                 */
+    if (p_parent == (OS_TMR *)0) {
+        p_tmr_task->HeapRootPtr = (OS_TMR *)0;
+    } else if (p_parent->HeapLeftPtr == p_tmr_last) {
+        p_parent->HeapLeftPtr   = (OS_TMR *)0;
+    } else {
+        p_parent->HeapRightPtr  = (OS_TMR *)0;
+    }
+    p_tmr_task->HeapQty--;
+
+    if (p_tmr_last != p_tmr) {                                  /* Put the last leaf in the place of the timer ...      */
+        p_parent                    = p_tmr->HeapParentPtr;
+        p_tmr_last->HeapParentPtr   = p_parent;
+        p_tmr_last->HeapLeftPtr     = p_tmr->HeapLeftPtr;
+        p_tmr_last->HeapRightPtr    = p_tmr->HeapRightPtr;
+        if (p_tmr_last->HeapLeftPtr != (OS_TMR *)0) {
+            p_tmr_last->HeapLeftPtr->HeapParentPtr  = p_tmr_last;
+        }
+        if (p_tmr_last->HeapRightPtr != (OS_TMR *)0) {
+            p_tmr_last->HeapRightPtr->HeapParentPtr = p_tmr_last;
+        }
+        if (p_parent == (OS_TMR *)0) {
+            p_tmr_task->HeapRootPtr = p_tmr_last;
+        } else if (p_parent->HeapLeftPtr == p_tmr) {
+            p_parent->HeapLeftPtr   = p_tmr_last;
+        } else {
+            p_parent->HeapRightPtr  = p_tmr_last;
+        }
+        if ((p_parent != (OS_TMR *)0) &&                        /* ... and move it up or down to its place              */
+            (OS_TMR_MATCH_BEFORE(p_tmr_last->Match, p_parent->Match))) {
+            OS_TmrHeapUp(p_tmr_task, p_tmr_last);
+        } else {
+            OS_TmrHeapDown(p_tmr_task, p_tmr_last);
+        }
+    }
+
+    p_tmr->HeapParentPtr = (OS_TMR *)0;
+    p_tmr->HeapLeftPtr   = (OS_TMR *)0;
+    p_tmr->HeapRightPtr  = (OS_TMR *)0;
+    p_tmr->Remain        = 0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                           FIND A TIMER BY ITS HEAP POSITION
+*
+* Description: This function returns the timer at position 'pos' of the heap, counting from 1 at the root in breadth
+*              first order, so that the children of position 'pos' are at '2 * pos' and '2 * pos + 1'.
+*
+* Arguments  : p_tmr_task     Is a pointer to the timer task owning the heap.
+*
+*              pos            Is the position, from 1 to the number of running timers.
+*
+* Returns    : A pointer to the timer
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The bits of 'pos' below its most significant one, from the highest, are the path from the root: 0
+*                 for the left child and 1 for the right one.
+************************************************************************************************************************
+*/
+
+static  OS_TMR  *OS_TmrHeapAt (OS_TMR_TASK  *p_tmr_task,
+                               CPU_INT32U    pos)
+{
+    OS_TMR      *p_tmr;
+    CPU_INT32U   bit;
+
+
+    bit = 1u;
+    while ((pos / bit) > 1u) {                                  /* Find the most significant bit of 'pos'               */
+        bit <<= 1u;
+    }
+
+    p_tmr = p_tmr_task->HeapRootPtr;
+    for (bit >>= 1u; bit > 0u; bit >>= 1u) {                    /* See Note #2                                          */
+        if ((pos & bit) == 0u) {
+            p_tmr = p_tmr->HeapLeftPtr;
+        } else {
+            p_tmr = p_tmr->HeapRightPtr;
+        }
+    }
+
+    return (p_tmr);
+}
+
+
+/*
+************************************************************************************************************************
+*                                             RESTORE THE HEAP ORDER
+*
+* Description: These functions move the timer 'p_tmr' of the heap up (towards the root) or down until the timers
+*              before it expire no later, and the ones after it no earlier than it does.
+*
+* Arguments  : p_tmr_task     Is a pointer to the timer task owning the heap.
+*
+*              p_tmr          Is a pointer to the timer to move.
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrHeapUp (OS_TMR_TASK  *p_tmr_task,
+                            OS_TMR       *p_tmr)
+{
+    OS_TMR  *p_parent;
+
+
+    for (;;) {
+        p_parent = p_tmr->HeapParentPtr;
+        if (p_parent == (OS_TMR *)0) {
+            break;
+        }
+        if (OS_TMR_MATCH_BEFORE(p_tmr->Match, p_parent->Match) == 0) {
+            break;
+        }
+        OS_TmrHeapSwap(p_tmr_task, p_parent, p_tmr);            /* Parent expires later, move it down                   */
+    }
+}
+
+
+static  void  OS_TmrHeapDown (OS_TMR_TASK  *p_tmr_task,
+                              OS_TMR       *p_tmr)
+{
+    OS_TMR  *p_child;
+
+
+    for (;;) {
+        p_child = p_tmr->HeapLeftPtr;
+        if (p_child == (OS_TMR *)0) {
+            break;
+        }
+        if ((p_tmr->HeapRightPtr != (OS_TMR *)0) &&             /* Pick the child expiring first                        */
+            (OS_TMR_MATCH_BEFORE(p_tmr->HeapRightPtr->Match, p_child->Match))) {
+            p_child = p_tmr->HeapRightPtr;
+        }
+        if (OS_TMR_MATCH_BEFORE(p_child->Match, p_tmr->Match) == 0) {
+            break;
+        }
+        OS_TmrHeapSwap(p_tmr_task, p_tmr, p_child);             /* Child expires earlier, move it up                    */
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                        SWAP A TIMER WITH ITS PARENT IN THE HEAP
+*
+* Description: This function exchanges the places of a timer and of its parent in the heap by relinking them.
+*
+* Arguments  : p_tmr_task     Is a pointer to the timer task owning the heap.
+*
+*              p_parent       Is a pointer to the parent timer, which becomes the child.
+*
+*              p_child        Is a pointer to the child timer, which becomes the parent.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrHeapSwap (OS_TMR_TASK  *p_tmr_task,
+                              OS_TMR       *p_parent,
+                              OS_TMR       *p_child)
+{
+    OS_TMR  *p_grand;
+    OS_TMR  *p_sibling;
+    OS_TMR  *p_left;
+    OS_TMR  *p_right;
+
+
+    p_grand = p_parent->HeapParentPtr;
+    p_left  = p_child->HeapLeftPtr;                             /* Children of the child go to the parent               */
+    p_right = p_child->HeapRightPtr;
+
+    if (p_parent->HeapLeftPtr == p_child) {                     /* The parent takes the place of the child              */
+        p_sibling              = p_parent->HeapRightPtr;
+        p_child->HeapLeftPtr   = p_parent;
+        p_child->HeapRightPtr  = p_sibling;
+    } else {
+        p_sibling              = p_parent->HeapLeftPtr;
+        p_child->HeapLeftPtr   = p_sibling;
+        p_child->HeapRightPtr  = p_parent;
+    }
+    if (p_sibling != (OS_TMR *)0) {
+        p_sibling->HeapParentPtr = p_child;
+    }
+
+    p_parent->HeapLeftPtr  = p_left;
+    p_parent->HeapRightPtr = p_right;
+    if (p_left != (OS_TMR *)0) {
+        p_left->HeapParentPtr  = p_parent;
+    }
+    if (p_right != (OS_TMR *)0) {
+        p_right->HeapParentPtr = p_parent;
+    }
+
+    p_parent->HeapParentPtr = p_child;                          /* The child takes the place of the parent              */
+    p_child->HeapParentPtr  = p_grand;
+    if (p_grand == (OS_TMR *)0) {
+        p_tmr_task->HeapRootPtr = p_child;
+    } else if (p_grand->HeapLeftPtr == p_parent) {
+        p_grand->HeapLeftPtr    = p_child;
+    } else {
+        p_grand->HeapRightPtr   = p_child;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 TIMER MANAGEMENT TASK
+*
+* Description: This task is created by OS_TmrInit() and OSTmrTaskCreate().
+*
+* Arguments  : p_arg     is a pointer to the timer task control block of this task.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The task sleeps until the earliest timer of its heap expires, then expires every timer at the root
+*                 of the heap which is due.  Timer callbacks are allowed to make calls to the Timer APIs.
+*
+*              3) A periodic timer is relinked relative to its previous expiry and not to when it was processed, so
+*                 that the time the task was held up does not accumulate.  If whole periods were missed, it is
+*                 relinked to the next period still ahead.
+************************************************************************************************************************
+*/
+
+void  OS_TmrTask (void  *p_arg)
+{
+    OS_TMR_TASK          *p_tmr_task;
+    OS_TMR_CALLBACK_PTR   p_fnct;
+    OS_TMR               *p_tmr;
+    OS_TICK               timeout;
+    OS_TICK               time;
+    OS_TICK               late;
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS                ts_start;
+#endif
+
+
+    p_tmr_task = (OS_TMR_TASK *)p_arg;
+
+    OS_TmrLock(p_tmr_task);
+
+    for (;;) {
+        if (p_tmr_task->HeapQty == 0u) {
+            OS_TmrCondWait(p_tmr_task, 0u);                     /* Suspend the timer task until a timer is started,  ...*/
+                                                                /* ... releasing the mutex so that application tasks ...*/
+                                                                /* ... can add/remove timers.                           */
+        } else {
+            timeout = p_tmr_task->HeapRootPtr->Match - OS_TmrTickGet();
+            if ((CPU_INT32S)timeout > 0) {                      /* ... or until the earliest timer expires              */
+                OS_TmrCondWait(p_tmr_task, timeout);
+            }
+        }
+
+        if (p_tmr_task->HeapQty == 0u) {
+            continue;
+        }
+
+#if (OS_CFG_TS_EN > 0u)
+        ts_start = OS_TS_GET();
+#endif
+
+        time                 = OS_TmrTickGet();
+        p_tmr_task->TickBase = time;
+                                                                /* Process timers that have expired.                    */
+        while ((p_tmr_task->HeapQty > 0u) &&
+               ((CPU_INT32S)(p_tmr_task->HeapRootPtr->Match - time) <= 0)) {
+            p_tmr        = p_tmr_task->HeapRootPtr;
+            p_tmr->State = OS_TMR_STATE_TIMEOUT;
+                                                                /* Execute callback function if available               */
+            p_fnct       = p_tmr->CallbackPtr;
+            if (p_fnct != (OS_TMR_CALLBACK_PTR)0u) {
+                (*p_fnct)(p_tmr, p_tmr->CallbackPtrArg);
+            }
+
+            if (p_tmr->State == OS_TMR_STATE_TIMEOUT) {
+                OS_TmrUnlink(p_tmr);
+
+                if (p_tmr->Opt == OS_OPT_TMR_PERIODIC) {        /* See Note #3.                                         */
+                    late          = time - p_tmr->Match;
+                    p_tmr->Remain = p_tmr->Period - (late % p_tmr->Period);
+                    p_tmr->State  = OS_TMR_STATE_RUNNING;
+                    OS_TmrLink(p_tmr, time);
+                } else {
+                    p_tmr->State  = OS_TMR_STATE_COMPLETED;
+                }
+            }
+        }
+
+#if (OS_CFG_TS_EN > 0u)
+        p_tmr_task->Time = OS_TS_GET() - ts_start;              /* Measure execution time of timer task                 */
+        if (p_tmr_task->TimeMax < p_tmr_task->Time) {
+            p_tmr_task->TimeMax = p_tmr_task->Time;
+        }
+#endif
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                             READ THE CURRENT TICK
+*
+* Description: This function returns the current value of the tick counter, including the ticks elapsed since the last
+*              tick interrupt with the dynamic tick.
+*
+* Arguments  : none
+*
+* Returns    : The current tick
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  OS_TICK  OS_TmrTickGet (void)
+{
+    OS_TICK  time;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    time = OSTickCtr + OS_DynTickGet();
+#else
+    time = OSTickCtr;
+#endif
+    CPU_CRITICAL_EXIT();
+
+    return (time);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          TIMER MANAGEMENT LOCKING MECHANISM
+*
+* Description: These functions are used to handle timer critical sections.  The method uses a mutex per timer task
+*              to protect access to its timers.
+*
+* Arguments  : p_tmr_task     is a pointer to the timer task owning the mutex.
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrLock (OS_TMR_TASK  *p_tmr_task)
+{
+    OS_ERR  err;
+
+
+    OSMutexPend(&p_tmr_task->Mutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+}
+
+
+static  void  OS_TmrUnlock (OS_TMR_TASK  *p_tmr_task)
+{
+    OS_ERR  err;
+
+
+    OSMutexPost(&p_tmr_task->Mutex, OS_OPT_POST_NONE, &err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                         CREATE TIMER TASK CONDITION VARIABLE
+*
+* Description: Initializes a condition variable for INTERNAL use ONLY.
+*
+* Arguments  : p_tmr_task     is a pointer to the timer task owning the condition variable.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrCondCreate (OS_TMR_TASK  *p_tmr_task)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_tmr_task->Cond.Type  = OS_OBJ_TYPE_COND;                  /* Mark the data structure as a condition variable.     */
+#endif
+    p_tmr_task->Cond.Mutex = &p_tmr_task->Mutex;                /* Bind the timer mutex to the condition variable.      */
+    OS_PendListInit(&p_tmr_task->Cond.PendList);                /* Initialize the waiting list                          */
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                         WAIT ON TIMER TASK CONDITION VARIABLE
+*
+* Description: Allows the timer task to release its mutex and pend atomically. This ensures that timers are only
+*              added/removed after the timer task has processed its heap and pended for the next timeout. The timer
+*              task will always acquire the mutex before returning from this function.
+*
+* Arguments  : p_tmr_task                The timer task calling this function.
+*
+*              timeout                   The number of ticks before the timer task will wake up.
+*                                        A value of zero signifies an indefinite pend.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrCondWait (OS_TMR_TASK  *p_tmr_task,
+                              OS_TICK       timeout)
+{
+    OS_TCB        *p_tcb;
+    OS_TCB        *p_tcb_tmr;
+    OS_MUTEX      *p_mutex;
+    OS_PEND_LIST  *p_pend_list;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+    p_tcb_tmr = p_tmr_task->TCBPtr;
+    p_mutex   = &p_tmr_task->Mutex;
+
+    CPU_CRITICAL_ENTER();
+#if (OS_CFG_TS_EN > 0u)
+    ts          = OS_TS_GET();                                  /* Get timestamp                                        */
+    p_mutex->TS = ts;
+#else
+    ts          = 0u;
+#endif
+                                                                /* Release mutex to other tasks.                        */
+    OS_MutexGrpRemove(p_tcb_tmr, p_mutex);
+    p_pend_list                 = &p_mutex->PendList;
+
+    if (p_tcb_tmr->Prio != p_tcb_tmr->BasePrio) {               /* Restore our original prio.                           */
+        OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_tmr, p_tcb_tmr->Prio);
+        p_tcb_tmr->Prio         = p_tcb_tmr->BasePrio;
+        OSPrioCur               = p_tcb_tmr->BasePrio;
+    }
+
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on mutex?                           */
+        p_mutex->OwnerTCBPtr     = (OS_TCB *)0;                 /* No                                                   */
+        p_mutex->OwnerNestingCtr =           0u;
+    } else {
+        p_tcb                    = p_pend_list->HeadPtr;        /* Yes, give mutex to new owner                         */
+        p_mutex->OwnerTCBPtr     = p_tcb;
+        p_mutex->OwnerNestingCtr =           1u;
+        OS_MutexGrpAdd(p_tcb, p_mutex);
+                                                                /* Post to mutex                                        */
+        OS_Post((OS_PEND_OBJ *)((void *)p_mutex),
+                                         p_tcb,
+                                (void *) 0,
+                                         0u,
+                                         ts);
+    }
+
+    OS_Pend((OS_PEND_OBJ *)((void *)&p_tmr_task->Cond),         /* Pend on the condition variable.                      */
+                                    p_tcb_tmr,
+                                    OS_TASK_PEND_ON_COND,
+                                    timeout);
+    CPU_CRITICAL_EXIT();
+
+    OSSched();
+
+    CPU_CRITICAL_ENTER();                                       /* Either we timed out, or were signaled.               */
+
+    if (p_mutex->OwnerTCBPtr == (OS_TCB *)0) {                  /* Can we grab the mutex?                               */
+        OS_MutexGrpAdd(p_tcb_tmr, p_mutex);                     /* Yes, no-one else pending.                            */
+        p_mutex->OwnerTCBPtr     = p_tcb_tmr;
+        p_mutex->OwnerNestingCtr = 1u;
+        CPU_CRITICAL_EXIT();
+    } else {
+        p_tcb = p_mutex->OwnerTCBPtr;                           /* No, we need to wait for it.                          */
+        if (p_tcb->Prio > p_tcb_tmr->Prio) {                    /* See if mutex owner has a lower priority than TmrTask.*/
+            OS_TaskChangePrio(p_tcb, p_tcb_tmr->Prio);
+        }
+
+        OS_Pend((OS_PEND_OBJ *)((void *)p_mutex),               /* Block TmrTask until it gets the Mutex.               */
+                                        p_tcb_tmr,
+                                        OS_TASK_PEND_ON_MUTEX,
+                                        0u);
+        CPU_CRITICAL_EXIT();
+
+        OSSched();
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                       SIGNAL THE TIMER TASK CONDITION VARIABLE
+*
+* Description: Used to signal the timer task when a timer is added which requires the task to reload its timeout.
+*              We ensure that this function is always called with the timer mutex locked.
+*
+* Arguments  : p_tmr_task     is a pointer to the timer task to signal.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_TmrCondSignal (OS_TMR_TASK  *p_tmr_task)
+{
+    OS_PEND_LIST  *p_pend_list;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+#if (OS_CFG_TS_EN > 0u)
+    ts                     = OS_TS_GET();                       /* Get timestamp                                        */
+    p_tmr_task->Mutex.TS   = ts;
+#else
+    ts                     = 0u;
+#endif
+
+    p_pend_list            = &p_tmr_task->Cond.PendList;
+
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Timer task waiting on cond?                          */
+        CPU_CRITICAL_EXIT();
+        return;                                                 /* No, nothing to signal.                               */
+    } else {
+                                                                /* Yes, signal the timer task.                          */
+        OS_Post((OS_PEND_OBJ *)((void *)&p_tmr_task->Cond),
+                                        p_tmr_task->TCBPtr,
+                                (void *) 0,
+                                         0u,
+                                         ts);
+    }
+
+    CPU_CRITICAL_EXIT();
+}
+#endif
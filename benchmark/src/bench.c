@@ -0,0 +1,246 @@
+/*
+*********************************************************************************************************
+*                                           LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "stm32f4xx_hal.h"
+#include "bench.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if (BENCH_HOST > 0u)
+#include <time.h>
+#endif
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define BENCH_PRINT_BUF_SIZE 160u
+
+/*
+*********************************************************************************************************
+*                                       	GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+UART_HandleTypeDef huart1;
+
+static CPU_INT32U BenchRandState = 0x2545F491u;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void MX_USART1_UART_Init(void);
+static int Bench_TsCmp(const void *p_a, const void *p_b);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+void Bench_Init(void)
+{
+    MX_USART1_UART_Init();
+
+#if (BENCH_HOST == 0u)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;     //Start the cycle counter
+    DWT->CYCCNT = 0u;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+CPU_INT32U Bench_TsGet(void)
+{
+#if (BENCH_HOST > 0u)
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (CPU_INT32U)((CPU_INT64U)now.tv_sec * 1000000000u + (CPU_INT64U)now.tv_nsec);
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+CPU_INT64U Bench_TsToNs(CPU_INT64U ts)
+{
+#if (BENCH_HOST > 0u)
+    return ts;      //Already in nanoseconds
+#else
+    return (ts * 1000u) / (SystemCoreClock / 1000000u);
+#endif
+}
+
+void Bench_Print(const CPU_CHAR *fmt, ...)
+{
+    CPU_CHAR buf[BENCH_PRINT_BUF_SIZE];
+    va_list args;
+    int len;
+#if (BENCH_HOST > 0u)
+    CPU_SR_ALLOC();
+#endif
+
+    va_start(args, fmt);
+#if (BENCH_HOST > 0u)
+    CPU_CRITICAL_ENTER();       //The host C library is not preemption safe, see 'os_cpu.h  Note #3'
+#endif
+    len = vsnprintf(buf, sizeof(buf), fmt, args);
+#if (BENCH_HOST > 0u)
+    CPU_CRITICAL_EXIT();
+#endif
+    va_end(args);
+
+    if (len > 0)
+    {
+        if (len >= (int)sizeof(buf))
+        {
+            len = sizeof(buf) - 1;
+        }
+        HAL_UART_Transmit(&huart1, (uint8_t *)buf, (uint16_t)len, HAL_MAX_DELAY);
+    }
+}
+
+/**
+ * \brief Print 'prefix n=<n> ns=<average>' with two decimals, without floating point printf support
+ */
+void Bench_PrintNs(const CPU_CHAR *prefix, CPU_INT32U n, CPU_INT64U ts_total)
+{
+    CPU_INT64U ns100;
+
+    ns100 = (Bench_TsToNs(ts_total) * 100u) / n;
+    Bench_Print("%s n=%lu ns=%lu.%02lu\r\n",
+                prefix,
+                (unsigned long)n,
+                (unsigned long)(ns100 / 100u),
+                (unsigned long)(ns100 % 100u));
+}
+
+/**
+ * \brief Bench_PrintNs() followed by ' max_ns=<slowest single operation>'
+ */
+void Bench_PrintNsMax(const CPU_CHAR *prefix, CPU_INT32U n, CPU_INT64U ts_total, CPU_INT32U ts_max)
+{
+    CPU_INT64U ns100;
+
+    ns100 = (Bench_TsToNs(ts_total) * 100u) / n;
+    Bench_Print("%s n=%lu ns=%lu.%02lu max_ns=%lu\r\n",
+                prefix,
+                (unsigned long)n,
+                (unsigned long)(ns100 / 100u),
+                (unsigned long)(ns100 % 100u),
+                (unsigned long)Bench_TsToNs(ts_max));
+}
+
+/**
+ * \brief Print 'prefix n=<n> p50_ns= p90_ns= p99_ns= max_ns=', the percentiles of 'n' samples
+ * \param [IN/OUT] p_ts, samples in Bench_TsGet() counts, sorted in place
+ */
+void Bench_PrintPct(const CPU_CHAR *prefix, CPU_INT32U *p_ts, CPU_INT32U n)
+{
+#if (BENCH_HOST > 0u)
+    CPU_SR_ALLOC();
+#endif
+
+    if (n == 0u)
+    {
+        Bench_Print("%s n=0\r\n", prefix);
+        return;
+    }
+
+#if (BENCH_HOST > 0u)
+    CPU_CRITICAL_ENTER();       //qsort() may allocate its buffer, see 'os_cpu.h  Note #3'
+#endif
+    qsort(p_ts, n, sizeof(p_ts[0]), Bench_TsCmp);
+#if (BENCH_HOST > 0u)
+    CPU_CRITICAL_EXIT();
+#endif
+    Bench_Print("%s n=%lu p50_ns=%lu p90_ns=%lu p99_ns=%lu max_ns=%lu\r\n",
+                prefix,
+                (unsigned long)n,
+                (unsigned long)Bench_TsToNs(p_ts[(n * 50u) / 100u]),
+                (unsigned long)Bench_TsToNs(p_ts[(n * 90u) / 100u]),
+                (unsigned long)Bench_TsToNs(p_ts[(n * 99u) / 100u]),
+                (unsigned long)Bench_TsToNs(p_ts[n - 1u]));
+}
+
+/**
+ * \brief xorshift32, the same sequence on every run and every target
+ */
+CPU_INT32U Bench_Rand(void)
+{
+    BenchRandState ^= BenchRandState << 13;
+    BenchRandState ^= BenchRandState >> 17;
+    BenchRandState ^= BenchRandState << 5;
+    return BenchRandState;
+}
+
+void Bench_Exit(void)
+{
+    Bench_Print("done\r\n");
+#if (BENCH_HOST > 0u)
+    exit(0);
+#else
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        OSTimeDly((OS_TICK)1000u, (OS_OPT)OS_OPT_TIME_DLY, (OS_ERR *)&err);
+    }
+#endif
+}
+
+static int Bench_TsCmp(const void *p_a, const void *p_b)
+{
+    CPU_INT32U a = *(const CPU_INT32U *)p_a;
+    CPU_INT32U b = *(const CPU_INT32U *)p_b;
+
+    return (a > b) - (a < b);
+}
+
+static void MX_USART1_UART_Init(void)
+{
+    huart1.Instance = USART1;
+    huart1.Init.BaudRate = 115200;
+    huart1.Init.WordLength = UART_WORDLENGTH_8B;
+    huart1.Init.StopBits = UART_STOPBITS_1;
+    huart1.Init.Parity = UART_PARITY_NONE;
+    huart1.Init.Mode = UART_MODE_TX_RX;
+    huart1.Init.HwFlowCtl = UART_HWCONTROL_NONE;
+    huart1.Init.OverSampling = UART_OVERSAMPLING_16;
+    HAL_UART_Init(&huart1);
+}
+
+/** 
+ * This UART Callback function configures the hardware resources for UART Initialization 
+**/
+void HAL_UART_MspInit(UART_HandleTypeDef *huart)
+{
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+    if (huart->Instance == USART1)
+    {
+        /* Peripheral clock enable */
+        __HAL_RCC_USART1_CLK_ENABLE();
+
+        __HAL_RCC_GPIOA_CLK_ENABLE();
+        /**USART1 GPIO Configuration    
+    PA9     ------> USART1_TX
+    PA10     ------> USART1_RX 
+    */
+        GPIO_InitStruct.Pin = GPIO_PIN_10 | GPIO_PIN_9;
+        GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+        GPIO_InitStruct.Pull = GPIO_NOPULL;
+        GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+        GPIO_InitStruct.Alternate = GPIO_AF7_USART1;
+        HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+    }
+}
@@ -0,0 +1,199 @@
+/*
+*********************************************************************************************************
+*                                      BROADCAST WAKEUP BENCHMARK
+*
+* Note(s) : (1) Times OSSemPost() with OS_OPT_POST_ALL to 8, 32 and 63 tasks pending on a semaphore, spread
+*               over BENCH_BC_PRIOS priorities above a posting task.  Every result takes BENCH_BC_SAMPLES
+*               samples after BENCH_BC_WARMUP discarded ones, and prints their distribution:
+*
+*                   bcast waiters=32 op=post n=1000 p50_ns=2950 p90_ns=3100 p99_ns=4800 max_ns=9100
+*
+*               op=post              OSSemPost() with OS_OPT_POST_NO_SCHED, readying all the waiters with
+*                                    interrupts disabled.
+*               op=wake_all          From the same OSSemPost() until the last waiter ran, the posting
+*                                    task scheduling them when it pends for the next sample.
+*
+*           (2) The waiters take BENCH_BC_WAITERS_MAX stacks of BENCH_BC_TASK_STK_SIZE, 32 KiB on the board.
+*
+*           (3) 'tools/bench_compare.py' compares these lines with the output of a baseline run.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "bench.h"
+
+#include <stdio.h>
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define BENCH_BC_SAMPLES 1000u          //Samples per result
+#define BENCH_BC_WARMUP 16u             //Samples discarded before them
+#define BENCH_BC_TIMEOUT_S 10u          //Longest wait for the samples of one waiter count
+
+#define BENCH_BC_WAITERS_MAX 63u
+#define BENCH_BC_TASK_STK_SIZE 128u     //See Note #2
+
+#define BENCH_BC_PRIO_WAIT 10u          //Waiters, below the benchmark task
+#define BENCH_BC_PRIOS 8u               //Priorities of the waiters, from BENCH_BC_PRIO_WAIT
+#define BENCH_BC_PRIO_POST (BENCH_BC_PRIO_WAIT + BENCH_BC_PRIOS)
+
+/*
+*********************************************************************************************************
+*                                       	GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static const CPU_INT32U BenchBcWaiters[] = {8u, 32u, 63u};
+
+static OS_TCB BenchBcTCB[BENCH_BC_WAITERS_MAX + 1u];            //The waiters and the posting task
+static CPU_STK BenchBcStk[BENCH_BC_WAITERS_MAX + 1u][BENCH_BC_TASK_STK_SIZE];
+
+static OS_SEM BenchBcDone;              //Posted when the samples of a waiter count are complete
+static OS_SEM BenchBcSem;               //Broadcast to the waiters
+static OS_SEM BenchBcAll;               //Posted by the last waiter which ran
+
+static volatile CPU_INT32U BenchBcTs;   //Start of the sample in progress
+static CPU_INT32U BenchBcNbr;           //Waiters of the samples in progress
+static CPU_INT32U BenchBcRan;           //Waiters which ran since the post
+static CPU_INT32U BenchBcPostSamples[BENCH_BC_SAMPLES];
+static CPU_INT32U BenchBcWakeSamples[BENCH_BC_SAMPLES];
+static CPU_INT32U BenchBcWakeTs;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void BenchBc_Waiters(CPU_INT32U waiters);
+static void BenchBc_WaitTask(void *p_arg);
+static void BenchBc_PostTask(void *p_arg);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+void BenchBcast_Run(void)
+{
+    CPU_INT32U i;
+    OS_ERR err;
+
+    OSSemCreate(&BenchBcDone, (CPU_CHAR *)"Bench Bc Done", 0u, &err);
+    OSSemCreate(&BenchBcSem, (CPU_CHAR *)"Bench Bc Sem", 0u, &err);
+    OSSemCreate(&BenchBcAll, (CPU_CHAR *)"Bench Bc All", 0u, &err);
+
+    for (i = 0u; i < sizeof(BenchBcWaiters) / sizeof(BenchBcWaiters[0]); i++)
+    {
+        BenchBc_Waiters(BenchBcWaiters[i]);
+    }
+
+    OSSemDel(&BenchBcAll, OS_OPT_DEL_ALWAYS, &err);
+    OSSemDel(&BenchBcSem, OS_OPT_DEL_ALWAYS, &err);
+    OSSemDel(&BenchBcDone, OS_OPT_DEL_ALWAYS, &err);
+}
+
+/**
+ * \brief Run 'waiters' tasks pending on the semaphore and the posting task until the samples are complete, then
+ *        print them
+ * \param [IN] waiters, number of tasks pending on the semaphore
+ */
+static void BenchBc_Waiters(CPU_INT32U waiters)
+{
+    CPU_CHAR prefix[48];
+    CPU_INT32U i;
+    OS_ERR err;
+    OS_ERR err_del;
+
+    BenchBcNbr = waiters;
+
+    for (i = 0u; i <= waiters; i++)             //The posting task last, once all the waiters pend
+    {
+        OSTaskCreate(&BenchBcTCB[i], (CPU_CHAR *)"Bench Bc",
+                     (i < waiters) ? BenchBc_WaitTask : BenchBc_PostTask, (void *)0,
+                     (i < waiters) ? (OS_PRIO)(BENCH_BC_PRIO_WAIT + (i % BENCH_BC_PRIOS)) : (OS_PRIO)BENCH_BC_PRIO_POST,
+                     &BenchBcStk[i][0], BENCH_BC_TASK_STK_SIZE / 10u, BENCH_BC_TASK_STK_SIZE,
+                     0u, 0u, (void *)0, OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR, &err);
+    }
+
+    OSSemPend(&BenchBcDone, BENCH_BC_TIMEOUT_S * OSCfg_TickRate_Hz, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+
+    for (i = 0u; i <= waiters; i++)             //Wherever they are, they run below this task
+    {
+        OSTaskDel(&BenchBcTCB[i], &err_del);
+    }
+    OSSemSet(&BenchBcSem, 0u, &err_del);
+    OSSemSet(&BenchBcAll, 0u, &err_del);
+
+    if (err != OS_ERR_NONE)
+    {
+        Bench_Print("bcast waiters=%lu error=timeout\r\n", (unsigned long)waiters);
+        return;
+    }
+
+    snprintf(prefix, sizeof(prefix), "bcast waiters=%lu op=post", (unsigned long)waiters);
+    Bench_PrintPct(prefix, BenchBcPostSamples, BENCH_BC_SAMPLES);
+    snprintf(prefix, sizeof(prefix), "bcast waiters=%lu op=wake_all", (unsigned long)waiters);
+    Bench_PrintPct(prefix, BenchBcWakeSamples, BENCH_BC_SAMPLES);
+}
+
+/*
+*********************************************************************************************************
+*                                             HELPER TASKS
+*********************************************************************************************************
+*/
+
+static void BenchBc_WaitTask(void *p_arg)
+{
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        OSSemPend(&BenchBcSem, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchBcRan++;
+        if (BenchBcRan == BenchBcNbr)
+        {
+            BenchBcWakeTs = Bench_TsGet() - BenchBcTs;
+            OSSemPost(&BenchBcAll, OS_OPT_POST_1, &err);
+        }
+    }
+}
+
+static void BenchBc_PostTask(void *p_arg)
+{
+    CPU_INT32U ts_post;
+    CPU_INT32U n;
+    OS_ERR err;
+
+    (void)p_arg;
+    for (n = 0u; n < BENCH_BC_WARMUP + BENCH_BC_SAMPLES; n++)
+    {
+        BenchBcRan = 0u;
+        BenchBcTs = Bench_TsGet();
+        OSSemPost(&BenchBcSem, OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED, &err);
+        ts_post = Bench_TsGet() - BenchBcTs;
+        OSSemPend(&BenchBcAll, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        if (n >= BENCH_BC_WARMUP)
+        {
+            BenchBcPostSamples[n - BENCH_BC_WARMUP] = ts_post;
+            BenchBcWakeSamples[n - BENCH_BC_WARMUP] = BenchBcWakeTs;
+        }
+    }
+
+    OSSemPost(&BenchBcDone, OS_OPT_POST_1, &err);
+    while (DEF_TRUE)                            //Deleted by the benchmark task
+    {
+        OSTaskSuspend((OS_TCB *)0, &err);
+    }
+}
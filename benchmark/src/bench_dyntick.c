@@ -0,0 +1,129 @@
+/*
+*********************************************************************************************************
+*                                       DYNAMIC TICK BENCHMARK
+*
+* Note(s) : (1) Compares the periodic tick with the dynamic (tickless) one selected by OS_CFG_DYN_TICK_EN
+*               (see the native_tick_delta & native_tick_dyn environments).  The benchmark task sleeps
+*               with OSTimeDly() for 1, 10, 100 and 500 ticks, BENCH_DYNTICK_TICKS ticks per result:
+*
+*                   dyntick tick=dynamic dly=100 n=10 irqs=59 err_us=31 max_err_us=103
+*
+*               'irqs' is the number of tick interrupts taken during the 'n' sleeps, counted by the time
+*               tick hook.  The periodic tick takes one per tick, the dynamic tick one per expiry of the
+*               tick list.  Besides the benchmark task, the statistic task wakes up every 20 ticks while
+*               it waits for OSStatTaskCPUUsageInit(), which the benchmark does not call.
+*
+*           (2) 'err_us' is the average and 'max_err_us' the largest difference between a sleep measured
+*               with Bench_TsGet() and 'dly' ticks of 1 / OS_CFG_TICK_RATE_HZ.  Every result starts with
+*               a 1 tick sleep, so the sleeps start right after a tick in both modes.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "bench.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define BENCH_DYNTICK_TICKS 1000u       //Ticks slept per result
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+#define BENCH_DYNTICK_MODE "dynamic"
+#else
+#define BENCH_DYNTICK_MODE "periodic"
+#endif
+
+/*
+*********************************************************************************************************
+*                                       	GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static const OS_TICK BenchDynTickDly[] = {1u, 10u, 100u, 500u};
+
+static volatile CPU_INT32U BenchDynTickIrqCtr;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void BenchDynTick_Hook(void);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+void BenchDynTick_Run(void)
+{
+    OS_APP_HOOK_VOID hook_save;
+    CPU_INT64U period_ns;
+    CPU_INT64U ns;
+    CPU_INT64U err_ns;
+    CPU_INT64U err_total;
+    CPU_INT64U err_max;
+    CPU_INT32U irqs;
+    CPU_INT32U ts_start;
+    CPU_INT32U n;
+    CPU_INT32U i;
+    CPU_INT32U r;
+    OS_TICK dly;
+    OS_ERR err;
+    CPU_SR_ALLOC();
+
+    period_ns = 1000000000u / OSCfg_TickRate_Hz;
+
+    CPU_CRITICAL_ENTER();
+    hook_save = OS_AppTimeTickHookPtr;
+    OS_AppTimeTickHookPtr = BenchDynTick_Hook;
+    CPU_CRITICAL_EXIT();
+
+    for (i = 0u; i < sizeof(BenchDynTickDly) / sizeof(BenchDynTickDly[0]); i++)
+    {
+        dly = BenchDynTickDly[i];
+        n = BENCH_DYNTICK_TICKS / dly;
+        err_total = 0u;
+        err_max = 0u;
+
+        OSTimeDly(1u, OS_OPT_TIME_DLY, &err);       //Start right after a tick, see Note #2
+        irqs = BenchDynTickIrqCtr;
+        for (r = 0u; r < n; r++)
+        {
+            ts_start = Bench_TsGet();
+            OSTimeDly(dly, OS_OPT_TIME_DLY, &err);
+            ns = Bench_TsToNs(Bench_TsGet() - ts_start);
+
+            err_ns = (ns > dly * period_ns) ? (ns - dly * period_ns) : (dly * period_ns - ns);
+            err_total += err_ns;
+            err_max = (err_ns > err_max) ? err_ns : err_max;
+        }
+        irqs = BenchDynTickIrqCtr - irqs;
+
+        Bench_Print("dyntick tick=%s dly=%lu n=%lu irqs=%lu err_us=%lu max_err_us=%lu\r\n",
+                    BENCH_DYNTICK_MODE, (unsigned long)dly, (unsigned long)n, (unsigned long)irqs,
+                    (unsigned long)(err_total / n / 1000u), (unsigned long)(err_max / 1000u));
+    }
+
+    CPU_CRITICAL_ENTER();
+    OS_AppTimeTickHookPtr = hook_save;
+    CPU_CRITICAL_EXIT();
+}
+
+/**
+ * \brief Time tick hook, called once per tick interrupt in both modes, see Note #1
+ */
+static void BenchDynTick_Hook(void)
+{
+    BenchDynTickIrqCtr++;
+}
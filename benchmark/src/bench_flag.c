@@ -0,0 +1,252 @@
+/*
+*********************************************************************************************************
+*                                       EVENT FLAG POST BENCHMARK
+*
+* Note(s) : (1) Times OSFlagPost() setting one random flag of a group with 1 to 64 tasks waiting on it,
+*               each for any of 1, 4 or 16 random flags of the 32, for the post selected by
+*               OS_CFG_FLAG_INDEX_EN (see the native_flag_* environments):
+*
+*                   flag list=index waiters=32 bits=1 op=post n=4096 p50_ns=180 p90_ns=260 p99_ns=410 max_ns=900
+*
+*               'list=walk' checks every task waiting, 'list=index' only the tasks waiting on the flag set.
+*               The index holds OS_FLAG_SLOTS tasks per group, so with 64 waiters it falls back to the walk.
+*
+*           (2) Every post readies the waiters of its flag.  After the post, the flag is cleared and the
+*               tasks readied wait again, untimed, and an error line is printed if the tasks readied were
+*               not exactly the waiters of the flag or, with the index, a slot was left in the group or out
+*               of date.
+*
+*           (3) The waiters are dummy TCBs in OS_TASK_STATE_PEND_SUSPENDED, so readying them only makes
+*               them suspended: they are on no other list & the posts use OS_OPT_POST_NO_SCHED.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "bench.h"
+
+#include <stdio.h>
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define BENCH_FLAG_WAITERS_MAX 64u      //Largest number of waiting tasks
+#define BENCH_FLAG_SAMPLES 4096u        //Posts per result
+#define BENCH_FLAG_ROUND_POSTS 64u      //Posts per round, between two draws of the waiters
+#define BENCH_FLAG_BITS 32u             //Flags drawn from
+
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+#define BENCH_FLAG_LIST "index"
+#else
+#define BENCH_FLAG_LIST "walk"
+#endif
+
+/*
+*********************************************************************************************************
+*                                       	GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static const CPU_INT32U BenchFlagWaiters[] = {1u, 4u, 16u, 32u, 64u};
+static const CPU_INT32U BenchFlagBits[] = {1u, 4u, 16u};
+
+static OS_FLAG_GRP BenchFlagGrp;
+static OS_TCB BenchFlagTCB[BENCH_FLAG_WAITERS_MAX];
+static CPU_INT32U BenchFlagSamples[BENCH_FLAG_SAMPLES];
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static CPU_BOOLEAN BenchFlag_Round(CPU_INT32U waiters, CPU_INT32U bits, CPU_INT32U *p_samples);
+static void BenchFlag_Wait(OS_TCB *p_tcb);
+static OS_FLAGS BenchFlag_Draw(CPU_INT32U bits);
+static CPU_BOOLEAN BenchFlag_Empty(void);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+void BenchFlag_Run(void)
+{
+    CPU_CHAR prefix[64];
+    CPU_INT32U waiters;
+    CPU_INT32U bits;
+    CPU_INT32U i;
+    CPU_INT32U j;
+    CPU_INT32U n;
+    CPU_BOOLEAN ok;
+    OS_ERR err;
+
+    OSFlagCreate(&BenchFlagGrp, (CPU_CHAR *)"Bench Flag", 0u, &err);
+
+    for (i = 0u; i < sizeof(BenchFlagWaiters) / sizeof(BenchFlagWaiters[0]); i++)
+    {
+        for (j = 0u; j < sizeof(BenchFlagBits) / sizeof(BenchFlagBits[0]); j++)
+        {
+            waiters = BenchFlagWaiters[i];
+            bits = BenchFlagBits[j];
+            ok = DEF_YES;
+            for (n = 0u; n < BENCH_FLAG_SAMPLES; n += BENCH_FLAG_ROUND_POSTS)
+            {
+                ok = (BenchFlag_Round(waiters, bits, &BenchFlagSamples[n]) == DEF_YES) ? ok : DEF_NO;
+            }
+
+            if (ok != DEF_YES)
+            {
+                Bench_Print("flag list=%s waiters=%lu bits=%lu error=rdy\r\n",
+                            BENCH_FLAG_LIST, (unsigned long)waiters, (unsigned long)bits);
+            }
+            snprintf(prefix, sizeof(prefix), "flag list=%s waiters=%lu bits=%lu op=post",
+                     BENCH_FLAG_LIST, (unsigned long)waiters, (unsigned long)bits);
+            Bench_PrintPct(prefix, BenchFlagSamples, BENCH_FLAG_SAMPLES);
+        }
+    }
+
+    OSFlagDel(&BenchFlagGrp, OS_OPT_DEL_ALWAYS, &err);
+}
+
+/**
+ * \brief Make 'waiters' dummy TCBs wait on the group, then time BENCH_FLAG_ROUND_POSTS posts, see Note #1
+ * \param [IN] waiters, number of tasks waiting
+ * \param [IN] bits, number of flags each task waits for
+ * \param [OUT] p_samples, BENCH_FLAG_ROUND_POSTS post times
+ * \return DEF_YES if every post readied exactly the waiters of its flag, see Note #2
+ */
+static CPU_BOOLEAN BenchFlag_Round(CPU_INT32U waiters, CPU_INT32U bits, CPU_INT32U *p_samples)
+{
+    OS_TCB *p_tcb;
+    OS_FLAGS flag;
+    CPU_INT32U ts_start;
+    CPU_INT32U i;
+    CPU_INT32U n;
+    CPU_BOOLEAN ok;
+    OS_ERR err;
+    CPU_SR_ALLOC();
+
+    for (i = 0u; i < waiters; i++)
+    {
+        p_tcb = &BenchFlagTCB[i];
+        OS_TaskInitTCB(p_tcb);
+        p_tcb->Prio = (OS_PRIO)(1u + (Bench_Rand() % (OS_CFG_PRIO_MAX - 2u)));
+        p_tcb->FlagsOpt = OS_OPT_PEND_FLAG_SET_ANY;
+        p_tcb->FlagsPend = BenchFlag_Draw(bits);
+        BenchFlag_Wait(p_tcb);
+    }
+
+    ok = DEF_YES;
+    for (n = 0u; n < BENCH_FLAG_ROUND_POSTS; n++)
+    {
+        flag = (OS_FLAGS)1u << (Bench_Rand() % BENCH_FLAG_BITS);
+
+        ts_start = Bench_TsGet();
+        OSFlagPost(&BenchFlagGrp, flag, OS_OPT_POST_FLAG_SET | OS_OPT_POST_NO_SCHED, &err);
+        p_samples[n] = Bench_TsGet() - ts_start;
+
+        OSFlagPost(&BenchFlagGrp, flag, OS_OPT_POST_FLAG_CLR | OS_OPT_POST_NO_SCHED, &err);
+        for (i = 0u; i < waiters; i++)
+        {
+            p_tcb = &BenchFlagTCB[i];
+            if ((p_tcb->TaskState == OS_TASK_STATE_SUSPENDED) != ((p_tcb->FlagsPend & flag) != 0u))
+            {
+                ok = DEF_NO;
+            }
+            if (p_tcb->TaskState == OS_TASK_STATE_SUSPENDED)
+            {
+                BenchFlag_Wait(p_tcb);
+            }
+        }
+    }
+
+    CPU_CRITICAL_ENTER();
+    while (BenchFlagGrp.PendList.HeadPtr != (OS_TCB *)0)
+    {
+        OS_PendListRemove(BenchFlagGrp.PendList.HeadPtr);
+    }
+    ok = (BenchFlag_Empty() == DEF_YES) ? ok : DEF_NO;
+    CPU_CRITICAL_EXIT();
+
+    return ok;
+}
+
+/**
+ * \brief Make a dummy TCB wait on the group, as OS_FlagBlock() does, see Note #3
+ * \param [IN] p_tcb, TCB with its priority & flags set
+ */
+static void BenchFlag_Wait(OS_TCB *p_tcb)
+{
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    p_tcb->TaskState = OS_TASK_STATE_PEND_SUSPENDED;
+    p_tcb->PendOn = OS_TASK_PEND_ON_FLAG;
+    p_tcb->PendStatus = OS_STATUS_PEND_OK;
+    p_tcb->PendObjPtr = (OS_PEND_OBJ *)((void *)&BenchFlagGrp);
+    OS_PendListInsertPrio(&BenchFlagGrp.PendList, p_tcb);
+    CPU_CRITICAL_EXIT();
+}
+
+/**
+ * \brief Random set of flags
+ * \param [IN] bits, number of flags set, up to BENCH_FLAG_BITS
+ * \return The flags
+ */
+static OS_FLAGS BenchFlag_Draw(CPU_INT32U bits)
+{
+    OS_FLAGS flags;
+    OS_FLAGS flag;
+    CPU_INT32U n;
+
+    flags = 0u;
+    n = 0u;
+    while (n < bits)
+    {
+        flag = (OS_FLAGS)1u << (Bench_Rand() % BENCH_FLAG_BITS);
+        if ((flags & flag) == 0u)
+        {
+            flags |= flag;
+            n++;
+        }
+    }
+    return flags;
+}
+
+/**
+ * \brief Check that the group was left with no task waiting, see Note #2
+ * \return DEF_YES if no task & with the index no slot is left, the table matching the flags of the last task in each
+ *         slot
+ */
+static CPU_BOOLEAN BenchFlag_Empty(void)
+{
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+    CPU_INT32U bit;
+    CPU_INT32U slot;
+
+    if ((BenchFlagGrp.SlotUsed != 0u) || (BenchFlagGrp.SlotFullCtr != 0u))
+    {
+        return DEF_NO;
+    }
+    for (bit = 0u; bit < OS_FLAG_BITS; bit++)
+    {
+        for (slot = 0u; slot < OS_FLAG_SLOTS; slot++)
+        {
+            if (((BenchFlagGrp.SlotTbl[bit] >> slot) & 1u) != ((BenchFlagGrp.SlotFlags[slot] >> bit) & 1u))
+            {
+                return DEF_NO;
+            }
+        }
+    }
+#endif
+    return (BenchFlagGrp.PendList.HeadPtr == (OS_TCB *)0) ? DEF_YES : DEF_NO;
+}
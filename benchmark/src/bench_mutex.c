@@ -0,0 +1,286 @@
+/*
+*********************************************************************************************************
+*                                    PRIORITY INVERSION BENCHMARK
+*
+* Note(s) : (1) Runs the priority inversion scenario of the priorInversion_* apps with three tasks: a low
+*               priority task takes the lock, releases a high and a medium priority task, works a little
+*               more and releases the lock, then the high priority task takes the lock and the medium
+*               one works ten times longer.  The lock is, in turn:
+*
+*               proto=none           A semaphore, the medium task preempts the low one holding the lock.
+*               proto=inherit        A mutex, the low task inherits the priority of the high one when it
+*                                    pends on the mutex.
+*               proto=ceiling        A mutex created by OSMutexCreateCeil() with the priority of the high
+*                                    task as ceiling, the low task runs at it as soon as it has the mutex.
+*
+*           (2) Every protocol takes BENCH_MX_SAMPLES rounds after BENCH_MX_WARMUP discarded ones, and
+*               prints two lines:
+*
+*                   mutex proto=ceiling op=block n=1000 p50_ns=1200 p90_ns=1300 p99_ns=2100 max_ns=9000
+*                   mutex proto=ceiling op=round n=1000 ctx_sw=3.00 ctx_sw_max=4 blocked=0
+*
+*               op=block             From the release of the high task until it has the lock.
+*               op=round             Context switches per round, and the rounds in which the high task
+*                                    found the lock taken and blocked on it.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "bench.h"
+
+#include <stdio.h>
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define BENCH_MX_SAMPLES 1000u          //Samples per result
+#define BENCH_MX_WARMUP 16u             //Samples discarded before them
+#define BENCH_MX_TIMEOUT_S 10u          //Longest wait for the samples of one protocol
+
+#define BENCH_MX_SPIN_LOW 1000u         //Work of the low task after releasing the others, in loops
+#define BENCH_MX_SPIN_MEDIUM 10000u     //Work of the medium task
+
+#define BENCH_MX_TASK_STK_SIZE 256u
+
+#define BENCH_MX_PRIO_HIGH 10u          //Helper tasks, below the benchmark task
+#define BENCH_MX_PRIO_MEDIUM 11u
+#define BENCH_MX_PRIO_LOW 12u
+
+#define BENCH_MX_PROTO_NONE 0u
+#define BENCH_MX_PROTO_INHERIT 1u
+#define BENCH_MX_PROTO_CEILING 2u
+
+/*
+*********************************************************************************************************
+*                                       	GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static OS_TCB BenchMxTCB[3];            //High, medium & low priority tasks
+static CPU_STK BenchMxStk[3][BENCH_MX_TASK_STK_SIZE];
+
+static OS_SEM BenchMxDone;              //Posted when the samples of a protocol are complete
+static OS_SEM BenchMxSem;               //The lock of proto=none
+static OS_MUTEX BenchMxMutex;           //The lock of proto=inherit & proto=ceiling
+
+static CPU_INT08U BenchMxProto;
+static volatile CPU_INT32U BenchMxSpinCtr;
+static CPU_INT32U BenchMxTs;            //Release of the high task
+static CPU_INT32U BenchMxBlockTs;       //op=block of the round in progress
+static CPU_BOOLEAN BenchMxBlocked;      //The high task found the lock taken in the round in progress
+static CPU_INT32U BenchMxSamples[BENCH_MX_SAMPLES];
+static CPU_INT32U BenchMxCtxSw;
+static CPU_INT32U BenchMxCtxSwMax;
+static CPU_INT32U BenchMxBlockedCtr;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void BenchMx_Proto(CPU_INT08U proto, const CPU_CHAR *name);
+static void BenchMx_Lock(void);
+static void BenchMx_Unlock(void);
+static void BenchMx_Spin(CPU_INT32U loops);
+static void BenchMx_HighTask(void *p_arg);
+static void BenchMx_MediumTask(void *p_arg);
+static void BenchMx_LowTask(void *p_arg);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+void BenchMutex_Run(void)
+{
+    OS_ERR err;
+
+    OSSemCreate(&BenchMxDone, (CPU_CHAR *)"Bench Mx Done", 0u, &err);
+
+    OSSemCreate(&BenchMxSem, (CPU_CHAR *)"Bench Mx Sem", 1u, &err);
+    BenchMx_Proto(BENCH_MX_PROTO_NONE, "none");
+    OSSemDel(&BenchMxSem, OS_OPT_DEL_ALWAYS, &err);
+
+    OSMutexCreate(&BenchMxMutex, (CPU_CHAR *)"Bench Mx Mutex", &err);
+    BenchMx_Proto(BENCH_MX_PROTO_INHERIT, "inherit");
+    OSMutexDel(&BenchMxMutex, OS_OPT_DEL_ALWAYS, &err);
+
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+    OSMutexCreateCeil(&BenchMxMutex, (CPU_CHAR *)"Bench Mx Ceil", BENCH_MX_PRIO_HIGH, &err);
+    BenchMx_Proto(BENCH_MX_PROTO_CEILING, "ceiling");
+    OSMutexDel(&BenchMxMutex, OS_OPT_DEL_ALWAYS, &err);
+#endif
+
+    OSSemDel(&BenchMxDone, OS_OPT_DEL_ALWAYS, &err);
+}
+
+/**
+ * \brief Run the three tasks with the lock of 'proto' until the samples are complete, then print them
+ * \param [IN] proto, BENCH_MX_PROTO_...
+ * \param [IN] name, name of the protocol in the output
+ */
+static void BenchMx_Proto(CPU_INT08U proto, const CPU_CHAR *name)
+{
+    static const OS_TASK_PTR tasks[3] = {BenchMx_HighTask, BenchMx_MediumTask, BenchMx_LowTask};
+    static const OS_PRIO prios[3] = {BENCH_MX_PRIO_HIGH, BENCH_MX_PRIO_MEDIUM, BENCH_MX_PRIO_LOW};
+    CPU_CHAR prefix[48];
+    CPU_INT64U ctx_sw100;
+    CPU_INT32U i;
+    OS_ERR err;
+    OS_ERR err_del;
+
+    BenchMxProto = proto;
+    BenchMxCtxSw = 0u;
+    BenchMxCtxSwMax = 0u;
+    BenchMxBlockedCtr = 0u;
+
+    for (i = 0u; i < 3u; i++)                   //The low task last, once the others pend
+    {
+        OSTaskCreate(&BenchMxTCB[i], (CPU_CHAR *)"Bench Mx", tasks[i], (void *)0, prios[i],
+                     &BenchMxStk[i][0], BENCH_MX_TASK_STK_SIZE / 10u, BENCH_MX_TASK_STK_SIZE,
+                     0u, 0u, (void *)0, OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR, &err);
+    }
+
+    OSSemPend(&BenchMxDone, BENCH_MX_TIMEOUT_S * OSCfg_TickRate_Hz, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+
+    for (i = 0u; i < 3u; i++)                   //Wherever they are, they run below this task
+    {
+        OSTaskDel(&BenchMxTCB[i], &err_del);
+    }
+
+    if (err != OS_ERR_NONE)
+    {
+        Bench_Print("mutex proto=%s error=timeout\r\n", name);
+        return;
+    }
+
+    snprintf(prefix, sizeof(prefix), "mutex proto=%s op=block", name);
+    Bench_PrintPct(prefix, BenchMxSamples, BENCH_MX_SAMPLES);
+    ctx_sw100 = ((CPU_INT64U)BenchMxCtxSw * 100u) / BENCH_MX_SAMPLES;
+    Bench_Print("mutex proto=%s op=round n=%lu ctx_sw=%lu.%02lu ctx_sw_max=%lu blocked=%lu\r\n",
+                name,
+                (unsigned long)BENCH_MX_SAMPLES,
+                (unsigned long)(ctx_sw100 / 100u),
+                (unsigned long)(ctx_sw100 % 100u),
+                (unsigned long)BenchMxCtxSwMax,
+                (unsigned long)BenchMxBlockedCtr);
+}
+
+static void BenchMx_Lock(void)
+{
+    OS_ERR err;
+
+    if (BenchMxProto == BENCH_MX_PROTO_NONE)
+    {
+        OSSemPend(&BenchMxSem, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+    else
+    {
+        OSMutexPend(&BenchMxMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+}
+
+static void BenchMx_Unlock(void)
+{
+    OS_ERR err;
+
+    if (BenchMxProto == BENCH_MX_PROTO_NONE)
+    {
+        OSSemPost(&BenchMxSem, OS_OPT_POST_1, &err);
+    }
+    else
+    {
+        OSMutexPost(&BenchMxMutex, OS_OPT_POST_NONE, &err);
+    }
+}
+
+static void BenchMx_Spin(CPU_INT32U loops)
+{
+    CPU_INT32U i;
+
+    for (i = 0u; i < loops; i++)
+    {
+        BenchMxSpinCtr++;
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                             HELPER TASKS
+*********************************************************************************************************
+*/
+
+static void BenchMx_HighTask(void *p_arg)
+{
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchMxBlocked = (BenchMxProto == BENCH_MX_PROTO_NONE) ? (BenchMxSem.Ctr == 0u)
+                                                                : (BenchMxMutex.OwnerTCBPtr != (OS_TCB *)0);
+        BenchMx_Lock();
+        BenchMxBlockTs = Bench_TsGet() - BenchMxTs;
+        BenchMx_Unlock();
+    }
+}
+
+static void BenchMx_MediumTask(void *p_arg)
+{
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchMx_Spin(BENCH_MX_SPIN_MEDIUM);
+    }
+}
+
+/**
+ * \brief Run the rounds of Note #1, the high & medium tasks finish theirs before this task runs again
+ */
+static void BenchMx_LowTask(void *p_arg)
+{
+    OS_CTX_SW_CTR ctx_sw;
+    CPU_INT32U n;
+    OS_ERR err;
+
+    (void)p_arg;
+    for (n = 0u; n < BENCH_MX_WARMUP + BENCH_MX_SAMPLES; n++)
+    {
+        ctx_sw = OSTaskCtxSwCtr;
+        BenchMx_Lock();
+        BenchMxTs = Bench_TsGet();
+        OSTaskSemPost(&BenchMxTCB[0], OS_OPT_POST_NONE, &err);
+        OSTaskSemPost(&BenchMxTCB[1], OS_OPT_POST_NONE, &err);
+        BenchMx_Spin(BENCH_MX_SPIN_LOW);
+        BenchMx_Unlock();
+        ctx_sw = OSTaskCtxSwCtr - ctx_sw;
+
+        if (n >= BENCH_MX_WARMUP)
+        {
+            BenchMxSamples[n - BENCH_MX_WARMUP] = BenchMxBlockTs;
+            BenchMxCtxSw += ctx_sw;
+            BenchMxCtxSwMax = (ctx_sw > BenchMxCtxSwMax) ? ctx_sw : BenchMxCtxSwMax;
+            BenchMxBlockedCtr += (BenchMxBlocked == DEF_YES) ? 1u : 0u;
+        }
+    }
+
+    OSSemPost(&BenchMxDone, OS_OPT_POST_1, &err);
+    while (DEF_TRUE)                            //Deleted by the benchmark task
+    {
+        OSTaskSuspend((OS_TCB *)0, &err);
+    }
+}
@@ -0,0 +1,279 @@
+/*
+*********************************************************************************************************
+*                                        PEND LIST BENCHMARK
+*
+* Note(s) : (1) Measures the pend list of a semaphore with 1 to 64 tasks waiting on it, for the pend list
+*               selected by OS_CFG_PEND_LIST_BITMAP_EN (see the native_pend_* environments):
+*
+*                   pend list=bitmap waiters=64 op=insert_remove n=16384 ns=28.24 max_ns=120
+*
+*               'op=insert_remove' is OS_PendListInsertPrio() of one more task with a random priority then
+*               OS_PendListRemove() of that task, as a task pending then woken up or timing out, and
+*               'op=change_prio' is OS_PendListChangePrio() of a waiting task given a new random priority.
+*               The highest waiter is 'HeadPtr' with both pend lists, so it is not measured.  Every other
+*               round times each call on its own to find 'max_ns', the others time the whole batch for
+*               the average.
+*
+*           (2) The priorities are drawn from the whole range, so with more waiters several of them share
+*               a priority & the FIFO order within a priority is exercised.  After each round the list is
+*               checked (priorities in order, FIFO within a priority) and emptied, and an error line is
+*               printed if it was out of order or, with the bitmap, a priority was left in the bitmap.
+*
+*           (3) The semaphore is never created nor posted & the waiters are dummy TCBs which are on no
+*               other list, so no kernel state is touched.  The rounds still run with interrupts
+*               disabled, as the pend list operations do in the kernel.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "bench.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define BENCH_PEND_WAITERS_MAX 64u      //Largest number of waiting tasks
+#define BENCH_PEND_OPS 16384u           //Operations per result
+#define BENCH_PEND_ROUND_OPS 64u        //Operations of each kind per round
+
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+#define BENCH_PEND_LIST "bitmap"
+#else
+#define BENCH_PEND_LIST "sorted"
+#endif
+
+/*
+*********************************************************************************************************
+*                                       	GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+typedef struct
+{
+    CPU_INT64U ts_total;
+    CPU_INT32U ts_max;
+    CPU_INT32U n;
+} bench_pend_result_t;
+
+static const CPU_INT32U BenchPendWaiters[] = {1u, 2u, 4u, 8u, 16u, 32u, 64u};
+
+static OS_SEM BenchPendSem;
+static OS_TCB BenchPendTCB[BENCH_PEND_WAITERS_MAX + 1u];        //The waiters and the task inserted
+static CPU_INT32U BenchPendSeq[BENCH_PEND_WAITERS_MAX + 1u];    //Order of insertion, see Note #2
+static CPU_INT32U BenchPendSeqCtr;
+static OS_PRIO BenchPendRandPrio[BENCH_PEND_ROUND_OPS];
+static OS_TCB *BenchPendRandTCB[BENCH_PEND_ROUND_OPS];
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void BenchPend_Round(CPU_INT32U waiters, CPU_BOOLEAN each, bench_pend_result_t *p_insert, bench_pend_result_t *p_change);
+static void BenchPend_Insert(OS_TCB *p_tcb);
+static OS_PRIO BenchPend_Prio(void);
+static CPU_BOOLEAN BenchPend_Check(void);
+static void BenchPend_Print(const CPU_CHAR *op, CPU_INT32U waiters, const bench_pend_result_t *p_result);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+void BenchPend_Run(void)
+{
+    bench_pend_result_t insert;
+    bench_pend_result_t change;
+    CPU_INT32U waiters;
+    CPU_INT32U rounds;
+    CPU_INT32U i;
+    CPU_INT32U r;
+
+    for (i = 0u; i < sizeof(BenchPendWaiters) / sizeof(BenchPendWaiters[0]); i++)
+    {
+        waiters = BenchPendWaiters[i];
+        rounds = BENCH_PEND_OPS / BENCH_PEND_ROUND_OPS;
+        memset(&insert, 0, sizeof(insert));
+        memset(&change, 0, sizeof(change));
+
+        for (r = 0u; r < 2u * rounds; r++)
+        {
+            BenchPend_Round(waiters, (CPU_BOOLEAN)(r & 1u), &insert, &change);
+        }
+
+        BenchPend_Print("insert_remove", waiters, &insert);
+        BenchPend_Print("change_prio", waiters, &change);
+    }
+}
+
+/**
+ * \brief Make 'waiters' dummy TCBs wait on the semaphore, then insert & remove and move tasks, see Note #1
+ * \param [IN] waiters, number of tasks waiting
+ * \param [IN] each, DEF_YES to time every call for the maximum, DEF_NO to time the batch for the average
+ * \param [IN/OUT] p_insert, p_change, accumulated results
+ */
+static void BenchPend_Round(CPU_INT32U waiters, CPU_BOOLEAN each, bench_pend_result_t *p_insert, bench_pend_result_t *p_change)
+{
+    OS_TCB *p_tcb;
+    OS_TCB *p_extra;
+    CPU_INT32U ts_start;
+    CPU_INT32U ts;
+    CPU_INT32U i;
+    CPU_BOOLEAN ok;
+    CPU_SR_ALLOC();
+
+    for (i = 0u; i <= waiters; i++)
+    {
+        p_tcb = &BenchPendTCB[i];
+        OS_TaskInitTCB(p_tcb);
+        p_tcb->TaskState = OS_TASK_STATE_PEND;
+        p_tcb->PendOn = OS_TASK_PEND_ON_SEM;
+        p_tcb->Prio = BenchPend_Prio();
+    }
+    p_extra = &BenchPendTCB[waiters];
+    for (i = 0u; i < BENCH_PEND_ROUND_OPS; i++) //Drawn before, so Bench_Rand() is not timed
+    {
+        BenchPendRandPrio[i] = BenchPend_Prio();
+        BenchPendRandTCB[i] = &BenchPendTCB[Bench_Rand() % waiters];
+    }
+
+    CPU_CRITICAL_ENTER();
+    OS_PendListInit(&BenchPendSem.PendList);
+    BenchPendSeqCtr = 0u;
+    for (i = 0u; i < waiters; i++)
+    {
+        BenchPend_Insert(&BenchPendTCB[i]);
+    }
+
+    ts_start = Bench_TsGet();
+    for (i = 0u; i < BENCH_PEND_ROUND_OPS; i++) //One more task comes and goes
+    {
+        p_extra->Prio = BenchPendRandPrio[i];
+        if (each == DEF_YES)
+        {
+            ts_start = Bench_TsGet();
+            BenchPend_Insert(p_extra);
+            OS_PendListRemove(p_extra);
+            ts = Bench_TsGet() - ts_start;
+            p_insert->ts_max = (ts > p_insert->ts_max) ? ts : p_insert->ts_max;
+        }
+        else
+        {
+            BenchPend_Insert(p_extra);
+            OS_PendListRemove(p_extra);
+        }
+    }
+    if (each == DEF_NO)
+    {
+        p_insert->ts_total += Bench_TsGet() - ts_start;
+        p_insert->n += BENCH_PEND_ROUND_OPS;
+    }
+
+    ts_start = Bench_TsGet();
+    for (i = 0u; i < BENCH_PEND_ROUND_OPS; i++) //A waiting task gets a new priority
+    {
+        p_tcb = BenchPendRandTCB[i];
+        p_tcb->Prio = BenchPendRandPrio[BENCH_PEND_ROUND_OPS - 1u - i];
+        BenchPendSeq[p_tcb - BenchPendTCB] = BenchPendSeqCtr++;
+        if (each == DEF_YES)
+        {
+            ts_start = Bench_TsGet();
+            OS_PendListChangePrio(p_tcb);
+            ts = Bench_TsGet() - ts_start;
+            p_change->ts_max = (ts > p_change->ts_max) ? ts : p_change->ts_max;
+        }
+        else
+        {
+            OS_PendListChangePrio(p_tcb);
+        }
+    }
+    if (each == DEF_NO)
+    {
+        p_change->ts_total += Bench_TsGet() - ts_start;
+        p_change->n += BENCH_PEND_ROUND_OPS;
+    }
+
+    ok = BenchPend_Check();
+    while (BenchPendSem.PendList.HeadPtr != (OS_TCB *)0)
+    {
+        OS_PendListRemove(BenchPendSem.PendList.HeadPtr);
+    }
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++)
+    {
+        ok = (BenchPendSem.PendList.PrioTbl[i] == 0u) ? ok : DEF_NO;
+    }
+#endif
+    CPU_CRITICAL_EXIT();
+
+    if (ok != DEF_YES)
+    {
+        Bench_Print("pend list=%s waiters=%lu error=order\r\n", BENCH_PEND_LIST, (unsigned long)waiters);
+    }
+}
+
+/**
+ * \brief Make a dummy TCB wait on the semaphore, as OS_Pend() does
+ * \param [IN] p_tcb, TCB with its priority set
+ */
+static void BenchPend_Insert(OS_TCB *p_tcb)
+{
+    BenchPendSeq[p_tcb - BenchPendTCB] = BenchPendSeqCtr++;
+    p_tcb->PendObjPtr = (OS_PEND_OBJ *)((void *)&BenchPendSem);
+    OS_PendListInsertPrio(&BenchPendSem.PendList, p_tcb);
+}
+
+/**
+ * \brief Random task priority, see Note #2
+ * \return A priority between 1 and OS_CFG_PRIO_MAX - 2
+ */
+static OS_PRIO BenchPend_Prio(void)
+{
+    return (OS_PRIO)(1u + (Bench_Rand() % (OS_CFG_PRIO_MAX - 2u)));
+}
+
+/**
+ * \brief Check the order of the pend list, see Note #2
+ * \return DEF_YES if the priorities go down from the head and the tasks of a priority are in FIFO order
+ */
+static CPU_BOOLEAN BenchPend_Check(void)
+{
+    OS_TCB *p_tcb;
+    OS_TCB *p_prev;
+
+    p_prev = (OS_TCB *)0;
+    for (p_tcb = BenchPendSem.PendList.HeadPtr; p_tcb != (OS_TCB *)0; p_tcb = p_tcb->PendNextPtr)
+    {
+        if ((p_tcb->PendPrevPtr != p_prev) ||
+            ((p_prev != (OS_TCB *)0) &&
+             ((p_prev->Prio > p_tcb->Prio) ||
+              ((p_prev->Prio == p_tcb->Prio) &&
+               (BenchPendSeq[p_prev - BenchPendTCB] > BenchPendSeq[p_tcb - BenchPendTCB])))))
+        {
+            return DEF_NO;
+        }
+        p_prev = p_tcb;
+    }
+    return (BenchPendSem.PendList.TailPtr == p_prev) ? DEF_YES : DEF_NO;
+}
+
+static void BenchPend_Print(const CPU_CHAR *op, CPU_INT32U waiters, const bench_pend_result_t *p_result)
+{
+    CPU_CHAR prefix[64];
+
+    snprintf(prefix, sizeof(prefix), "pend list=%s waiters=%lu op=%s",
+             BENCH_PEND_LIST, (unsigned long)waiters, op);
+    Bench_PrintNsMax(prefix, p_result->n, p_result->ts_total, p_result->ts_max);
+}
@@ -0,0 +1,178 @@
+/*
+*********************************************************************************************************
+*                                     PRIORITY BITMAP BENCHMARK
+*
+* Note(s) : (1) Measures OS_PrioGetHighest(), OS_PrioInsert() and OS_PrioRemove() at the OS_CFG_PRIO_MAX
+*               and OS_CFG_PRIO_TBL_2LVL_EN of the build (see the native_prio* environments).
+*
+*           (2) The ready bitmap is live kernel state, so every chunk runs in a critical section on a
+*               scratch content and restores the real bitmap before interrupts are enabled again.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "bench.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define BENCH_PRIO_N 200000u            //Operations per result
+#define BENCH_PRIO_CHUNK 1000u          //Operations per critical section
+#define BENCH_PRIO_RAND_SIZE 256u       //Random priorities, power of 2
+
+#define BENCH_PRIO_IDLE ((OS_PRIO)(OS_CFG_PRIO_MAX - 1u))
+
+#if (OS_PRIO_TBL_2LVL > 0u)
+#define BENCH_PRIO_TBL "2lvl"
+#else
+#define BENCH_PRIO_TBL "scan"
+#endif
+
+/*
+*********************************************************************************************************
+*                                       	GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+typedef enum
+{
+    BENCH_PRIO_OP_GET_HIGHEST_IDLE,     //Only the idle task ready, worst case of the scan
+    BENCH_PRIO_OP_GET_HIGHEST_RAND,     //Idle + one random priority ready
+    BENCH_PRIO_OP_INSERT_REMOVE,        //Ready then block a random priority
+    BENCH_PRIO_OP_SCHED,                //Insert, lookup, remove: one task waking up and blocking again
+    BENCH_PRIO_OP_NBR
+} bench_prio_op_t;
+
+static const CPU_CHAR *const BenchPrioOpName[BENCH_PRIO_OP_NBR] = {
+    "get_highest_idle",
+    "get_highest_rand",
+    "insert_remove",
+    "sched",
+};
+
+static OS_PRIO BenchPrioRand[BENCH_PRIO_RAND_SIZE];
+static volatile OS_PRIO BenchPrioSink;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static CPU_INT32U BenchPrio_Chunk(bench_prio_op_t op, CPU_INT32U first);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+void BenchPrio_Run(void)
+{
+    bench_prio_op_t op;
+    CPU_INT32U i;
+    CPU_INT64U ts_total;
+    CPU_CHAR prefix[64];
+
+    for (i = 0u; i < BENCH_PRIO_RAND_SIZE; i++)
+    {
+        BenchPrioRand[i] = (OS_PRIO)(Bench_Rand() % (OS_CFG_PRIO_MAX - 1u));
+    }
+
+    for (op = (bench_prio_op_t)0; op < BENCH_PRIO_OP_NBR; op++)
+    {
+        ts_total = 0u;
+        for (i = 0u; i < BENCH_PRIO_N; i += BENCH_PRIO_CHUNK)
+        {
+            ts_total += BenchPrio_Chunk(op, i);
+        }
+
+        snprintf(prefix, sizeof(prefix), "prio prio_max=%u tbl=%s op=%s",
+                 (unsigned)OS_CFG_PRIO_MAX, BENCH_PRIO_TBL, BenchPrioOpName[op]);
+        Bench_PrintNs(prefix, BENCH_PRIO_N, ts_total);
+    }
+}
+
+/**
+ * \brief Time BENCH_PRIO_CHUNK operations on a scratch bitmap, see Note #2
+ * \param [IN] op
+ * \param [IN] first, index of the first random priority
+ * \return elapsed Bench_TsGet() counts
+ */
+static CPU_INT32U BenchPrio_Chunk(bench_prio_op_t op, CPU_INT32U first)
+{
+    CPU_DATA tbl[OS_PRIO_TBL_SIZE];
+#if (OS_PRIO_TBL_2LVL > 0u)
+    CPU_DATA grp;
+#endif
+    CPU_INT32U ts_start;
+    CPU_INT32U ts_end;
+    CPU_INT32U i;
+    OS_PRIO prio;
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    memcpy(tbl, OSPrioTbl, sizeof(tbl));
+#if (OS_PRIO_TBL_2LVL > 0u)
+    grp = OSPrioTblGrp;
+#endif
+
+    OS_PrioInit();
+    OS_PrioInsert(BENCH_PRIO_IDLE);
+    if (op == BENCH_PRIO_OP_GET_HIGHEST_RAND)
+    {
+        OS_PrioInsert(BenchPrioRand[first & (BENCH_PRIO_RAND_SIZE - 1u)]);
+    }
+
+    ts_start = Bench_TsGet();
+    switch (op)
+    {
+    case BENCH_PRIO_OP_GET_HIGHEST_IDLE:
+    case BENCH_PRIO_OP_GET_HIGHEST_RAND:
+        for (i = 0u; i < BENCH_PRIO_CHUNK; i++)
+        {
+            BenchPrioSink = OS_PrioGetHighest();
+        }
+        break;
+
+    case BENCH_PRIO_OP_INSERT_REMOVE:
+        for (i = first; i < first + BENCH_PRIO_CHUNK; i++)
+        {
+            prio = BenchPrioRand[i & (BENCH_PRIO_RAND_SIZE - 1u)];
+            OS_PrioInsert(prio);
+            OS_PrioRemove(prio);
+        }
+        break;
+
+    case BENCH_PRIO_OP_SCHED:
+    default:
+        for (i = first; i < first + BENCH_PRIO_CHUNK; i++)
+        {
+            prio = BenchPrioRand[i & (BENCH_PRIO_RAND_SIZE - 1u)];
+            OS_PrioInsert(prio);
+            BenchPrioSink = OS_PrioGetHighest();
+            OS_PrioRemove(prio);
+        }
+        break;
+    }
+    ts_end = Bench_TsGet();
+
+    memcpy(OSPrioTbl, tbl, sizeof(tbl));
+#if (OS_PRIO_TBL_2LVL > 0u)
+    OSPrioTblGrp = grp;
+#endif
+    CPU_CRITICAL_EXIT();
+
+    return ts_end - ts_start;
+}
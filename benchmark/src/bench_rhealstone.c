@@ -0,0 +1,537 @@
+/*
+*********************************************************************************************************
+*                                  RHEALSTONE-STYLE KERNEL BENCHMARK
+*
+* Note(s) : (1) Times the kernel services an application pays for on every event, each with helper tasks
+*               below the benchmark task.  Every operation takes BENCH_RH_SAMPLES samples after
+*               BENCH_RH_WARMUP discarded ones, and prints their distribution:
+*
+*                   rhealstone op=preempt n=1000 p50_ns=412 p90_ns=460 p99_ns=1210 max_ns=5300
+*
+*               op=task_switch       Two tasks of the same priority alternate with OSSchedRoundRobinYield(),
+*                                    only with OS_CFG_SCHED_ROUND_ROBIN_EN.
+*               op=preempt           A task posts the task semaphore of a higher priority task, until
+*                                    that task runs.
+*               op=sem_shuffle       Two tasks of the same priority hand two semaphores back and forth,
+*                                    a sample is the round trip (2 posts, 2 pends & 2 switches).
+*               op=q_latency         OSQPost() until the higher priority task returns from OSQPend().
+*               op=taskq_throughput  A task posts BENCH_RH_BATCH messages to the task queue of a lower
+*                                    priority task which takes them all, a sample is the time per message.
+*               op=flag_fanout       OSFlagPost() until the last of BENCH_RH_FLAG_WAITERS higher priority
+*                                    tasks pending on the flag ran.
+*               op=mutex_pi          A task which inherited the priority of a higher priority task
+*                                    pending on its mutex posts it, until that task returns from
+*                                    OSMutexPend().
+*               op=int_latency       A task raises an interrupt whose ISR posts the task semaphore of a
+*                                    higher priority task, until that task runs.
+*
+*           (2) The interrupt is EXTI0, pended by software through the NVIC on the board, and emulated
+*               interrupt source BENCH_RH_INT_SRC of the POSIX port on the host.
+*
+*           (3) 'tools/bench_compare.py' compares these lines, and those of the other suites, with the
+*               output of a baseline run.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "stm32f4xx_hal.h"
+#include "bench.h"
+
+#include <stdio.h>
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define BENCH_RH_SAMPLES 1000u          //Samples per result
+#define BENCH_RH_WARMUP 16u             //Samples discarded before them
+#define BENCH_RH_BATCH 16u              //Messages per sample of op=taskq_throughput, within OS_CFG_MSG_POOL_SIZE
+#define BENCH_RH_FLAG_WAITERS 8u        //Tasks pending on the flag of op=flag_fanout
+#define BENCH_RH_TIMEOUT_S 10u          //Longest wait for the samples of one result
+
+#define BENCH_RH_TASKS_MAX (BENCH_RH_FLAG_WAITERS + 1u)
+#define BENCH_RH_TASK_STK_SIZE 256u
+
+#define BENCH_RH_PRIO_HIGH 10u          //Helper tasks, below the benchmark task
+#define BENCH_RH_PRIO_LOW 11u
+#define BENCH_RH_PRIO_FLAG_POST (BENCH_RH_PRIO_HIGH + BENCH_RH_FLAG_WAITERS)
+
+#define BENCH_RH_INT_SRC 1u             //See Note #2, source 0 is USART1
+
+#define BENCH_RH_FLAG ((OS_FLAGS)0x01u)
+
+/*
+*********************************************************************************************************
+*                                       	GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+typedef struct
+{
+    OS_TASK_PTR task;
+    OS_PRIO prio;
+} bench_rh_task_t;
+
+static OS_TCB BenchRhTCB[BENCH_RH_TASKS_MAX];
+static CPU_STK BenchRhStk[BENCH_RH_TASKS_MAX][BENCH_RH_TASK_STK_SIZE];
+
+static OS_SEM BenchRhDone;              //Posted when the samples of a result are complete
+static OS_SEM BenchRhSemA;
+static OS_SEM BenchRhSemB;
+static OS_Q BenchRhQ;
+static OS_FLAG_GRP BenchRhFlag;
+static OS_MUTEX BenchRhMutex;
+
+static volatile CPU_INT32U BenchRhTs;   //Start of the sample in progress
+static CPU_INT32U BenchRhSamples[BENCH_RH_SAMPLES];
+static CPU_INT32U BenchRhN;
+static CPU_INT32U BenchRhWarmup;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void BenchRh_Op(const CPU_CHAR *op, const bench_rh_task_t *p_tasks, CPU_INT32U nbr);
+static void BenchRh_Sample(CPU_INT32U ts);
+static void BenchRh_Isr(void);
+static void BenchRh_IntRaise(void);
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
+static void BenchRh_SwitchTask(void *p_arg);
+#endif
+static void BenchRh_PreemptHighTask(void *p_arg);
+static void BenchRh_PreemptLowTask(void *p_arg);
+static void BenchRh_ShuffleATask(void *p_arg);
+static void BenchRh_ShuffleBTask(void *p_arg);
+static void BenchRh_QHighTask(void *p_arg);
+static void BenchRh_QLowTask(void *p_arg);
+static void BenchRh_TaskQSendTask(void *p_arg);
+static void BenchRh_TaskQRecvTask(void *p_arg);
+static void BenchRh_FlagWaitTask(void *p_arg);
+static void BenchRh_FlagPostTask(void *p_arg);
+static void BenchRh_MutexHighTask(void *p_arg);
+static void BenchRh_MutexLowTask(void *p_arg);
+static void BenchRh_IntHighTask(void *p_arg);
+static void BenchRh_IntLowTask(void *p_arg);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+void BenchRhealstone_Run(void)
+{
+    bench_rh_task_t tasks[BENCH_RH_TASKS_MAX];
+    CPU_INT32U i;
+    OS_ERR err;
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
+    CPU_BOOLEAN rr_save;
+#endif
+
+    OSSemCreate(&BenchRhDone, (CPU_CHAR *)"Bench Rh Done", 0u, &err);
+    OSSemCreate(&BenchRhSemA, (CPU_CHAR *)"Bench Rh A", 0u, &err);
+    OSSemCreate(&BenchRhSemB, (CPU_CHAR *)"Bench Rh B", 0u, &err);
+    OSQCreate(&BenchRhQ, (CPU_CHAR *)"Bench Rh Q", 1u, &err);
+    OSFlagCreate(&BenchRhFlag, (CPU_CHAR *)"Bench Rh Flag", 0u, &err);
+    OSMutexCreate(&BenchRhMutex, (CPU_CHAR *)"Bench Rh Mutex", &err);
+
+#if (BENCH_HOST > 0u)
+    OS_CPU_IntSrcHandlerSet(BENCH_RH_INT_SRC, BenchRh_Isr);
+#else
+    HAL_NVIC_SetPriority(EXTI0_IRQn, CPU_CFG_KA_IPL_BOUNDARY, 0u);  //Kernel aware, may post
+    HAL_NVIC_EnableIRQ(EXTI0_IRQn);
+#endif
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
+    rr_save = OSSchedRoundRobinEn;
+    OSSchedRoundRobinCfg(DEF_ENABLED, 0u, &err);
+    tasks[0].task = BenchRh_SwitchTask;
+    tasks[0].prio = BENCH_RH_PRIO_LOW;
+    tasks[1] = tasks[0];
+    BenchRh_Op("task_switch", tasks, 2u);
+    OSSchedRoundRobinCfg(rr_save, 0u, &err);
+#endif
+
+    tasks[0].task = BenchRh_PreemptHighTask;
+    tasks[0].prio = BENCH_RH_PRIO_HIGH;
+    tasks[1].task = BenchRh_PreemptLowTask;
+    tasks[1].prio = BENCH_RH_PRIO_LOW;
+    BenchRh_Op("preempt", tasks, 2u);
+
+    tasks[0].task = BenchRh_ShuffleATask;
+    tasks[0].prio = BENCH_RH_PRIO_LOW;
+    tasks[1].task = BenchRh_ShuffleBTask;
+    tasks[1].prio = BENCH_RH_PRIO_LOW;
+    BenchRh_Op("sem_shuffle", tasks, 2u);
+
+    tasks[0].task = BenchRh_QHighTask;
+    tasks[0].prio = BENCH_RH_PRIO_HIGH;
+    tasks[1].task = BenchRh_QLowTask;
+    tasks[1].prio = BENCH_RH_PRIO_LOW;
+    BenchRh_Op("q_latency", tasks, 2u);
+
+    tasks[0].task = BenchRh_TaskQSendTask;
+    tasks[0].prio = BENCH_RH_PRIO_HIGH;
+    tasks[1].task = BenchRh_TaskQRecvTask;
+    tasks[1].prio = BENCH_RH_PRIO_LOW;
+    BenchRh_Op("taskq_throughput", tasks, 2u);
+
+    for (i = 0u; i < BENCH_RH_FLAG_WAITERS; i++)
+    {
+        tasks[i].task = BenchRh_FlagWaitTask;
+        tasks[i].prio = (OS_PRIO)(BENCH_RH_PRIO_HIGH + i);
+    }
+    tasks[i].task = BenchRh_FlagPostTask;
+    tasks[i].prio = BENCH_RH_PRIO_FLAG_POST;
+    BenchRh_Op("flag_fanout", tasks, BENCH_RH_FLAG_WAITERS + 1u);
+
+    tasks[0].task = BenchRh_MutexHighTask;
+    tasks[0].prio = BENCH_RH_PRIO_HIGH;
+    tasks[1].task = BenchRh_MutexLowTask;
+    tasks[1].prio = BENCH_RH_PRIO_LOW;
+    BenchRh_Op("mutex_pi", tasks, 2u);
+
+    tasks[0].task = BenchRh_IntHighTask;
+    tasks[0].prio = BENCH_RH_PRIO_HIGH;
+    tasks[1].task = BenchRh_IntLowTask;
+    tasks[1].prio = BENCH_RH_PRIO_LOW;
+    BenchRh_Op("int_latency", tasks, 2u);
+
+#if (BENCH_HOST > 0u)
+    OS_CPU_IntSrcHandlerSet(BENCH_RH_INT_SRC, (CPU_FNCT_VOID)0);
+#else
+    HAL_NVIC_DisableIRQ(EXTI0_IRQn);
+#endif
+
+    OSMutexDel(&BenchRhMutex, OS_OPT_DEL_ALWAYS, &err);
+    OSFlagDel(&BenchRhFlag, OS_OPT_DEL_ALWAYS, &err);
+    OSQDel(&BenchRhQ, OS_OPT_DEL_ALWAYS, &err);
+    OSSemDel(&BenchRhSemB, OS_OPT_DEL_ALWAYS, &err);
+    OSSemDel(&BenchRhSemA, OS_OPT_DEL_ALWAYS, &err);
+    OSSemDel(&BenchRhDone, OS_OPT_DEL_ALWAYS, &err);
+}
+
+/**
+ * \brief Run the helper tasks of one operation until BenchRh_Sample() collected its samples, then print them
+ * \param [IN] op, name of the operation
+ * \param [IN] p_tasks, nbr, helper tasks, the index of each one is its argument
+ */
+static void BenchRh_Op(const CPU_CHAR *op, const bench_rh_task_t *p_tasks, CPU_INT32U nbr)
+{
+    CPU_CHAR prefix[48];
+    CPU_INT32U i;
+    OS_ERR err;
+    OS_ERR err_del;
+
+    BenchRhN = 0u;
+    BenchRhWarmup = BENCH_RH_WARMUP;
+
+    for (i = 0u; i < nbr; i++)
+    {
+        OSTaskCreate(&BenchRhTCB[i], (CPU_CHAR *)"Bench Rh", p_tasks[i].task, (void *)(CPU_ADDR)i, p_tasks[i].prio,
+                     &BenchRhStk[i][0], BENCH_RH_TASK_STK_SIZE / 10u, BENCH_RH_TASK_STK_SIZE,
+                     BENCH_RH_BATCH, 0u, (void *)0, OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR, &err);
+    }
+
+    OSSemPend(&BenchRhDone, BENCH_RH_TIMEOUT_S * OSCfg_TickRate_Hz, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+
+    for (i = 0u; i < nbr; i++)                  //Wherever they are, they run below this task
+    {
+        OSTaskDel(&BenchRhTCB[i], &err_del);
+    }
+
+    if (err != OS_ERR_NONE)
+    {
+        Bench_Print("rhealstone op=%s error=timeout n=%lu\r\n", op, (unsigned long)BenchRhN);
+        return;
+    }
+
+    snprintf(prefix, sizeof(prefix), "rhealstone op=%s", op);
+    Bench_PrintPct(prefix, BenchRhSamples, BenchRhN);
+}
+
+/**
+ * \brief Record one sample in timestamp counts, skipping the warm-up ones, and wake the benchmark task after the last
+ */
+static void BenchRh_Sample(CPU_INT32U ts)
+{
+    OS_ERR err;
+
+    if (BenchRhWarmup > 0u)
+    {
+        BenchRhWarmup--;
+    }
+    else if (BenchRhN < BENCH_RH_SAMPLES)
+    {
+        BenchRhSamples[BenchRhN++] = ts;
+        if (BenchRhN == BENCH_RH_SAMPLES)
+        {
+            OSSemPost(&BenchRhDone, OS_OPT_POST_1, &err);
+        }
+    }
+}
+
+/**
+ * \brief Interrupt of op=int_latency, see Note #2
+ */
+static void BenchRh_Isr(void)
+{
+    OS_ERR err;
+
+    OSTaskSemPost(&BenchRhTCB[0], OS_OPT_POST_NONE, &err);
+}
+
+static void BenchRh_IntRaise(void)
+{
+#if (BENCH_HOST > 0u)
+    OS_CPU_IntSrcRaise(BENCH_RH_INT_SRC);
+#else
+    NVIC_SetPendingIRQ(EXTI0_IRQn);
+#endif
+}
+
+#if (BENCH_HOST == 0u)
+void EXTI0_IRQHandler(void)
+{
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();
+    CPU_CRITICAL_EXIT();
+
+    BenchRh_Isr();
+
+    OSIntExit();
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                             HELPER TASKS
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
+/**
+ * \brief op=task_switch, both tasks run this at the same priority
+ */
+static void BenchRh_SwitchTask(void *p_arg)
+{
+    OS_ERR err;
+
+    if ((CPU_ADDR)p_arg == 1u)                  //The first switch has no start
+    {
+        BenchRh_Sample(Bench_TsGet() - BenchRhTs);
+    }
+    while (DEF_TRUE)
+    {
+        BenchRhTs = Bench_TsGet();
+        OSSchedRoundRobinYield(&err);
+        BenchRh_Sample(Bench_TsGet() - BenchRhTs);
+    }
+}
+#endif
+
+static void BenchRh_PreemptHighTask(void *p_arg)
+{
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchRh_Sample(Bench_TsGet() - BenchRhTs);
+    }
+}
+
+static void BenchRh_PreemptLowTask(void *p_arg)
+{
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        BenchRhTs = Bench_TsGet();
+        OSTaskSemPost(&BenchRhTCB[0], OS_OPT_POST_NONE, &err);
+    }
+}
+
+static void BenchRh_ShuffleATask(void *p_arg)
+{
+    CPU_INT32U ts_start;
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        ts_start = Bench_TsGet();
+        OSSemPost(&BenchRhSemB, OS_OPT_POST_1, &err);
+        OSSemPend(&BenchRhSemA, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchRh_Sample(Bench_TsGet() - ts_start);
+    }
+}
+
+static void BenchRh_ShuffleBTask(void *p_arg)
+{
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        OSSemPend(&BenchRhSemB, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSSemPost(&BenchRhSemA, OS_OPT_POST_1, &err);
+    }
+}
+
+static void BenchRh_QHighTask(void *p_arg)
+{
+    OS_MSG_SIZE size;
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        (void)OSQPend(&BenchRhQ, 0u, OS_OPT_PEND_BLOCKING, &size, (CPU_TS *)0, &err);
+        BenchRh_Sample(Bench_TsGet() - BenchRhTs);
+    }
+}
+
+static void BenchRh_QLowTask(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        BenchRhTs = Bench_TsGet();
+        OSQPost(&BenchRhQ, p_arg, 0u, OS_OPT_POST_FIFO, &err);
+    }
+}
+
+static void BenchRh_TaskQSendTask(void *p_arg)
+{
+    CPU_INT32U ts_start;
+    CPU_INT32U i;
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        ts_start = Bench_TsGet();
+        for (i = 0u; i < BENCH_RH_BATCH; i++)   //The receiver runs below, it takes them all at once
+        {
+            OSTaskQPost(&BenchRhTCB[1], (void *)(CPU_ADDR)i, 0u, OS_OPT_POST_FIFO, &err);
+        }
+        OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchRh_Sample((Bench_TsGet() - ts_start) / BENCH_RH_BATCH);
+    }
+}
+
+static void BenchRh_TaskQRecvTask(void *p_arg)
+{
+    OS_MSG_SIZE size;
+    CPU_INT32U i;
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        for (i = 0u; i < BENCH_RH_BATCH; i++)
+        {
+            (void)OSTaskQPend(0u, OS_OPT_PEND_BLOCKING, &size, (CPU_TS *)0, &err);
+        }
+        OSTaskSemPost(&BenchRhTCB[0], OS_OPT_POST_NONE, &err);
+    }
+}
+
+/**
+ * \brief op=flag_fanout, every waiter consumes the flag on its own, the last one takes the sample
+ */
+static void BenchRh_FlagWaitTask(void *p_arg)
+{
+    OS_ERR err;
+
+    while (DEF_TRUE)
+    {
+        (void)OSFlagPend(&BenchRhFlag, BENCH_RH_FLAG, 0u,
+                         OS_OPT_PEND_FLAG_SET_ANY | OS_OPT_PEND_FLAG_CONSUME | OS_OPT_PEND_BLOCKING,
+                         (CPU_TS *)0, &err);
+        if ((CPU_ADDR)p_arg == BENCH_RH_FLAG_WAITERS - 1u)
+        {
+            BenchRh_Sample(Bench_TsGet() - BenchRhTs);
+        }
+    }
+}
+
+static void BenchRh_FlagPostTask(void *p_arg)
+{
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)                            //Runs once all the waiters pend again
+    {
+        BenchRhTs = Bench_TsGet();
+        (void)OSFlagPost(&BenchRhFlag, BENCH_RH_FLAG, OS_OPT_POST_FLAG_SET, &err);
+    }
+}
+
+static void BenchRh_MutexHighTask(void *p_arg)
+{
+    CPU_INT32U ts;
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSMutexPend(&BenchRhMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);   //The owner inherits
+        ts = Bench_TsGet() - BenchRhTs;
+        OSMutexPost(&BenchRhMutex, OS_OPT_POST_NONE, &err);
+        BenchRh_Sample(ts);
+    }
+}
+
+static void BenchRh_MutexLowTask(void *p_arg)
+{
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        OSMutexPend(&BenchRhMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSTaskSemPost(&BenchRhTCB[0], OS_OPT_POST_NONE, &err);  //Back here at the high priority
+        BenchRhTs = Bench_TsGet();
+        OSMutexPost(&BenchRhMutex, OS_OPT_POST_NONE, &err);
+    }
+}
+
+static void BenchRh_IntHighTask(void *p_arg)
+{
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchRh_Sample(Bench_TsGet() - BenchRhTs);
+    }
+}
+
+static void BenchRh_IntLowTask(void *p_arg)
+{
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        BenchRhTs = Bench_TsGet();
+        BenchRh_IntRaise();
+    }
+}
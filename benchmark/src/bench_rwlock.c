@@ -0,0 +1,668 @@
+/*
+*********************************************************************************************************
+*                                     READER-WRITER LOCK BENCHMARK
+*
+* Note(s) : (1) Compares a reader-writer lock with the mutex it replaces, 'proto=mutex' or 'proto=rwlock',
+*               in two scenarios:
+*
+*               op=rd                BENCH_RW_READERS readers each hold the lock across a one tick delay,
+*                                    standing for a slow read such as a transfer to the display.  The
+*                                    round lasts from their release until the last one is done: the mutex
+*                                    makes them read in turn, the reader-writer lock lets them overlap.
+*
+*               op=wr                The priority inversion scenario of bench_mutex.c with a low priority
+*                                    reader holding the lock: it releases a high priority writer, a low
+*                                    priority reader and a medium priority task, works a little more and
+*                                    releases the lock.  The time is from the release of the writer until
+*                                    it has the lock.
+*
+*           (2) Each protocol prints three lines:
+*
+*                   rwlock proto=rwlock op=rd n=100 p50_ns=1000000 p90_ns=1000000 p99_ns=1100000 max_ns=1200000
+*                   rwlock proto=rwlock op=wr n=1000 p50_ns=1200 p90_ns=1300 p99_ns=2100 max_ns=9000
+*                   rwlock proto=rwlock op=round n=1000 ctx_sw=5.00 ctx_sw_max=6 held_max=4 inverted=0 overtaken=0
+*
+*               held_max             Most readers holding the lock at once in op=rd.
+*               ctx_sw               Context switches per round of op=wr.
+*               inverted             Rounds of op=wr in which the medium task ran before the writer had the
+*                                    lock, the holder not having inherited the priority of the writer.
+*               overtaken            Rounds of op=wr in which the reader released after the writer had the
+*                                    lock first, see 'os.h  READER-WRITER LOCKS  Note #3'.
+*
+*           (3) op=exit checks, with the reader-writer lock only, that a task leaving the lock otherwise than
+*               by a post gives it to the tasks it kept waiting.  A low priority reader holds the lock, a high
+*               priority writer waits for it & two readers wait behind the writer, then the round ends by:
+*
+*               case=abort           OSRwLockPendAbort() of the writer.
+*               case=timeout         The timeout of the writer.
+*               case=writer_del      OSTaskDel() of the writer.
+*               case=holder_del      OSTaskDel() of the reader holding the lock, the writer gets it first.
+*               case=del             OSRwLockDel() with OS_OPT_DEL_ALWAYS, the waiters get OS_ERR_OBJ_DEL.
+*
+*               A round is an error if the holder did not inherit the priority of the writer, if the waiters
+*               did not return what the case expects (the readers get the lock but with case=del), if a task
+*               is not back at its own priority once the round is over, or if the lock is left taken:
+*
+*                   rwlock proto=rwlock op=exit case=holder_del n=50 errors=0
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "bench.h"
+
+#include <stdio.h>
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define BENCH_RW_RD_SAMPLES 100u        //Rounds of op=rd per result
+#define BENCH_RW_WR_SAMPLES 1000u       //Rounds of op=wr per result
+#define BENCH_RW_WARMUP 4u              //Rounds discarded before them
+#define BENCH_RW_TIMEOUT_S 10u          //Longest wait for the rounds of one scenario
+
+#define BENCH_RW_READERS 4u             //Readers of op=rd, up to OS_CFG_RWLOCK_RD_MAX
+#define BENCH_RW_SPIN_LOW 1000u         //Work of the low task of op=wr after releasing the others, in loops
+#define BENCH_RW_SPIN_MEDIUM 10000u     //Work of the medium task
+
+#define BENCH_RW_TASK_STK_SIZE 256u
+
+#define BENCH_RW_PRIO_FIRST 10u         //Helper tasks, below the benchmark task
+#define BENCH_RW_TASKS (BENCH_RW_READERS + 1u)
+
+#define BENCH_RW_PROTO_MUTEX 0u
+#define BENCH_RW_PROTO_RWLOCK 1u
+
+#define BENCH_RW_EXIT_ROUNDS 50u        //Rounds of each case of op=exit
+#define BENCH_RW_EXIT_TIMEOUT 2u        //Timeout of the writer of case=timeout, in ticks
+
+#define BENCH_RW_EXIT_ABORT 0u          //Cases of op=exit, see Note #3
+#define BENCH_RW_EXIT_TIMEOUT_CASE 1u
+#define BENCH_RW_EXIT_WRITER_DEL 2u
+#define BENCH_RW_EXIT_HOLDER_DEL 3u
+#define BENCH_RW_EXIT_DEL 4u
+#define BENCH_RW_EXIT_CASES 5u
+
+#define BENCH_RW_EXIT_WR 0u             //Tasks of op=exit in BenchRwTCB[], in decreasing priority
+#define BENCH_RW_EXIT_HOLDER 3u
+#define BENCH_RW_EXIT_DRIVER 4u
+
+#if (BENCH_RW_READERS > OS_CFG_RWLOCK_RD_MAX)
+#error "BENCH_RW_READERS must not exceed OS_CFG_RWLOCK_RD_MAX"
+#endif
+
+/*
+*********************************************************************************************************
+*                                       	GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static OS_TCB BenchRwTCB[BENCH_RW_TASKS];   //op=rd: the readers then the driver, op=wr: high, medium, reader, low
+static CPU_STK BenchRwStk[BENCH_RW_TASKS][BENCH_RW_TASK_STK_SIZE];
+
+static OS_SEM BenchRwDone;              //Posted when the rounds of a scenario are complete
+static OS_MUTEX BenchRwMutex;           //The lock of proto=mutex
+static OS_RWLOCK BenchRwLock;           //The lock of proto=rwlock
+
+static CPU_INT08U BenchRwProto;
+static volatile CPU_INT32U BenchRwSpinCtr;
+static CPU_INT32U BenchRwSamples[BENCH_RW_WR_SAMPLES];
+static CPU_INT32U BenchRwHeld;          //Readers of op=rd holding the lock
+static CPU_INT32U BenchRwHeldMax;
+static CPU_INT32U BenchRwTs;            //Release of the writer
+static CPU_INT32U BenchRwBlockTs;       //op=wr of the round in progress
+static CPU_BOOLEAN BenchRwMediumRan;    //The medium task ran in the round in progress
+static CPU_BOOLEAN BenchRwWrDone;       //The writer had the lock in the round in progress
+static CPU_INT32U BenchRwCtxSw;
+static CPU_INT32U BenchRwCtxSwMax;
+static CPU_INT32U BenchRwInvertedCtr;
+static CPU_INT32U BenchRwOvertakenCtr;
+
+static const CPU_CHAR *const BenchRwExitNames[BENCH_RW_EXIT_CASES] = {"abort", "timeout", "writer_del",
+                                                                      "holder_del", "del"};
+static const OS_ERR BenchRwExitWrErr[BENCH_RW_EXIT_CASES] = {OS_ERR_PEND_ABORT, OS_ERR_TIMEOUT,
+                                                             OS_ERR_STATUS_INVALID, // Deleted, never returns
+                                                             OS_ERR_NONE, OS_ERR_OBJ_DEL};
+static CPU_INT08U BenchRwExitCase;
+static OS_ERR BenchRwExitErr[3];        //Pend of the writer & of the two readers in the round in progress
+static CPU_INT32U BenchRwExitErrors[BENCH_RW_EXIT_CASES];
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void BenchRw_Proto(CPU_INT08U proto, const CPU_CHAR *name);
+static CPU_BOOLEAN BenchRw_Scenario(const OS_TASK_PTR *tasks, CPU_INT32U n);
+static void BenchRw_Lock(CPU_BOOLEAN wr);
+static void BenchRw_Unlock(void);
+static void BenchRw_Spin(CPU_INT32U loops);
+static void BenchRw_RdTask(void *p_arg);
+static void BenchRw_RdDriverTask(void *p_arg);
+static void BenchRw_WrHighTask(void *p_arg);
+static void BenchRw_WrMediumTask(void *p_arg);
+static void BenchRw_WrReaderTask(void *p_arg);
+static void BenchRw_WrLowTask(void *p_arg);
+static void BenchRw_Exit(void);
+static CPU_BOOLEAN BenchRw_ExitRound(void);
+static void BenchRw_ExitTaskCreate(CPU_INT32U i);
+static void BenchRw_ExitWaiterTask(void *p_arg);
+static void BenchRw_ExitHolderTask(void *p_arg);
+static void BenchRw_ExitDriverTask(void *p_arg);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+void BenchRwLock_Run(void)
+{
+    OS_ERR err;
+
+    OSSemCreate(&BenchRwDone, (CPU_CHAR *)"Bench Rw Done", 0u, &err);
+
+    OSMutexCreate(&BenchRwMutex, (CPU_CHAR *)"Bench Rw Mutex", &err);
+    BenchRw_Proto(BENCH_RW_PROTO_MUTEX, "mutex");
+    OSMutexDel(&BenchRwMutex, OS_OPT_DEL_ALWAYS, &err);
+
+    OSRwLockCreate(&BenchRwLock, (CPU_CHAR *)"Bench Rw Lock", &err);
+    BenchRw_Proto(BENCH_RW_PROTO_RWLOCK, "rwlock");
+    BenchRw_Exit();
+    OSRwLockDel(&BenchRwLock, OS_OPT_DEL_ALWAYS, &err);
+
+    OSSemDel(&BenchRwDone, OS_OPT_DEL_ALWAYS, &err);
+}
+
+/**
+ * \brief Run both scenarios of Note #1 with the lock of 'proto', then print them
+ * \param [IN] proto, BENCH_RW_PROTO_...
+ * \param [IN] name, name of the protocol in the output
+ */
+static void BenchRw_Proto(CPU_INT08U proto, const CPU_CHAR *name)
+{
+    static const OS_TASK_PTR rd_tasks[BENCH_RW_TASKS] = {BenchRw_RdTask, BenchRw_RdTask, BenchRw_RdTask,
+                                                         BenchRw_RdTask, BenchRw_RdDriverTask};
+    static const OS_TASK_PTR wr_tasks[4] = {BenchRw_WrHighTask, BenchRw_WrMediumTask, BenchRw_WrReaderTask,
+                                            BenchRw_WrLowTask};
+    CPU_CHAR prefix[48];
+    CPU_INT64U ctx_sw100;
+
+    BenchRwProto = proto;
+    BenchRwHeld = 0u;
+    BenchRwHeldMax = 0u;
+    BenchRwCtxSw = 0u;
+    BenchRwCtxSwMax = 0u;
+    BenchRwInvertedCtr = 0u;
+    BenchRwOvertakenCtr = 0u;
+
+    if (BenchRw_Scenario(rd_tasks, BENCH_RW_TASKS) != DEF_YES)
+    {
+        Bench_Print("rwlock proto=%s op=rd error=timeout\r\n", name);
+        return;
+    }
+    snprintf(prefix, sizeof(prefix), "rwlock proto=%s op=rd", name);
+    Bench_PrintPct(prefix, BenchRwSamples, BENCH_RW_RD_SAMPLES);
+
+    if (BenchRw_Scenario(wr_tasks, 4u) != DEF_YES)
+    {
+        Bench_Print("rwlock proto=%s op=wr error=timeout\r\n", name);
+        return;
+    }
+    snprintf(prefix, sizeof(prefix), "rwlock proto=%s op=wr", name);
+    Bench_PrintPct(prefix, BenchRwSamples, BENCH_RW_WR_SAMPLES);
+
+    ctx_sw100 = ((CPU_INT64U)BenchRwCtxSw * 100u) / BENCH_RW_WR_SAMPLES;
+    Bench_Print("rwlock proto=%s op=round n=%lu ctx_sw=%lu.%02lu ctx_sw_max=%lu held_max=%lu inverted=%lu overtaken=%lu\r\n",
+                name,
+                (unsigned long)BENCH_RW_WR_SAMPLES,
+                (unsigned long)(ctx_sw100 / 100u),
+                (unsigned long)(ctx_sw100 % 100u),
+                (unsigned long)BenchRwCtxSwMax,
+                (unsigned long)BenchRwHeldMax,
+                (unsigned long)BenchRwInvertedCtr,
+                (unsigned long)BenchRwOvertakenCtr);
+}
+
+/**
+ * \brief Create the tasks of a scenario at BENCH_RW_PRIO_FIRST and below, wait for their rounds & delete them
+ * \param [IN] tasks, task functions, in decreasing priority: the last one drives the rounds
+ * \param [IN] n, number of tasks
+ * \return DEF_YES if the rounds completed in time
+ */
+static CPU_BOOLEAN BenchRw_Scenario(const OS_TASK_PTR *tasks, CPU_INT32U n)
+{
+    CPU_INT32U i;
+    OS_ERR err;
+    OS_ERR err_del;
+
+    for (i = 0u; i < n; i++)                    //The driver last, once the others pend
+    {
+        OSTaskCreate(&BenchRwTCB[i], (CPU_CHAR *)"Bench Rw", tasks[i], (void *)0, (OS_PRIO)(BENCH_RW_PRIO_FIRST + i),
+                     &BenchRwStk[i][0], BENCH_RW_TASK_STK_SIZE / 10u, BENCH_RW_TASK_STK_SIZE,
+                     0u, 0u, (void *)0, OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR, &err);
+    }
+
+    OSSemPend(&BenchRwDone, BENCH_RW_TIMEOUT_S * OSCfg_TickRate_Hz, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+
+    for (i = 0u; i < n; i++)                    //Wherever they are, they run below this task
+    {
+        OSTaskDel(&BenchRwTCB[i], &err_del);
+    }
+    return (err == OS_ERR_NONE) ? DEF_YES : DEF_NO;
+}
+
+/**
+ * \brief Run the rounds of op=exit, see Note #3, then print them
+ */
+static void BenchRw_Exit(void)
+{
+    static const OS_TASK_PTR tasks[BENCH_RW_TASKS] = {BenchRw_ExitWaiterTask, BenchRw_ExitWaiterTask,
+                                                      BenchRw_ExitWaiterTask, BenchRw_ExitHolderTask,
+                                                      BenchRw_ExitDriverTask};
+    CPU_INT32U i;
+
+    for (i = 0u; i < BENCH_RW_EXIT_CASES; i++)
+    {
+        BenchRwExitErrors[i] = 0u;
+    }
+
+    if (BenchRw_Scenario(tasks, BENCH_RW_TASKS) != DEF_YES)
+    {
+        Bench_Print("rwlock proto=rwlock op=exit error=timeout\r\n");
+        return;
+    }
+    for (i = 0u; i < BENCH_RW_EXIT_CASES; i++)
+    {
+        Bench_Print("rwlock proto=rwlock op=exit case=%s n=%lu errors=%lu\r\n",
+                    BenchRwExitNames[i],
+                    (unsigned long)BENCH_RW_EXIT_ROUNDS,
+                    (unsigned long)BenchRwExitErrors[i]);
+    }
+}
+
+static void BenchRw_Lock(CPU_BOOLEAN wr)
+{
+    OS_ERR err;
+
+    if (BenchRwProto == BENCH_RW_PROTO_MUTEX)
+    {
+        OSMutexPend(&BenchRwMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+    else if (wr == DEF_YES)
+    {
+        OSRwLockWrPend(&BenchRwLock, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+    else
+    {
+        OSRwLockRdPend(&BenchRwLock, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+    }
+}
+
+static void BenchRw_Unlock(void)
+{
+    OS_ERR err;
+
+    if (BenchRwProto == BENCH_RW_PROTO_MUTEX)
+    {
+        OSMutexPost(&BenchRwMutex, OS_OPT_POST_NONE, &err);
+    }
+    else
+    {
+        OSRwLockPost(&BenchRwLock, OS_OPT_POST_NONE, &err);
+    }
+}
+
+static void BenchRw_Spin(CPU_INT32U loops)
+{
+    CPU_INT32U i;
+
+    for (i = 0u; i < loops; i++)
+    {
+        BenchRwSpinCtr++;
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                          HELPER TASKS, OP=RD
+*********************************************************************************************************
+*/
+
+static void BenchRw_RdTask(void *p_arg)
+{
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchRw_Lock(DEF_NO);
+        BenchRwHeld++;
+        BenchRwHeldMax = (BenchRwHeld > BenchRwHeldMax) ? BenchRwHeld : BenchRwHeldMax;
+        OSTimeDly(1u, OS_OPT_TIME_DLY, &err);   //The slow read
+        BenchRwHeld--;
+        BenchRw_Unlock();
+        OSTaskSemPost(&BenchRwTCB[BENCH_RW_READERS], OS_OPT_POST_NONE, &err);
+    }
+}
+
+/**
+ * \brief Release the readers and time the rounds of op=rd, see Note #1
+ */
+static void BenchRw_RdDriverTask(void *p_arg)
+{
+    CPU_INT32U ts_start;
+    CPU_INT32U n;
+    CPU_INT32U i;
+    OS_ERR err;
+
+    (void)p_arg;
+    for (n = 0u; n < BENCH_RW_WARMUP + BENCH_RW_RD_SAMPLES; n++)
+    {
+        OSTimeDly(1u, OS_OPT_TIME_DLY, &err);   //Start on a tick
+        ts_start = Bench_TsGet();
+        for (i = 0u; i < BENCH_RW_READERS; i++)
+        {
+            OSTaskSemPost(&BenchRwTCB[i], OS_OPT_POST_NONE, &err);
+        }
+        for (i = 0u; i < BENCH_RW_READERS; i++)
+        {
+            OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        }
+
+        if (n >= BENCH_RW_WARMUP)
+        {
+            BenchRwSamples[n - BENCH_RW_WARMUP] = Bench_TsGet() - ts_start;
+        }
+    }
+
+    OSSemPost(&BenchRwDone, OS_OPT_POST_1, &err);
+    while (DEF_TRUE)                            //Deleted by the benchmark task
+    {
+        OSTaskSuspend((OS_TCB *)0, &err);
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                          HELPER TASKS, OP=WR
+*********************************************************************************************************
+*/
+
+static void BenchRw_WrHighTask(void *p_arg)
+{
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchRw_Lock(DEF_YES);
+        BenchRwBlockTs = Bench_TsGet() - BenchRwTs;
+        BenchRwInvertedCtr += (BenchRwMediumRan == DEF_YES) ? 1u : 0u;
+        BenchRwWrDone = DEF_YES;
+        BenchRw_Unlock();
+    }
+}
+
+static void BenchRw_WrMediumTask(void *p_arg)
+{
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchRwMediumRan = DEF_YES;
+        BenchRw_Spin(BENCH_RW_SPIN_MEDIUM);
+    }
+}
+
+static void BenchRw_WrReaderTask(void *p_arg)
+{
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        BenchRw_Lock(DEF_NO);
+        BenchRwOvertakenCtr += (BenchRwWrDone == DEF_NO) ? 1u : 0u;
+        BenchRw_Unlock();
+    }
+}
+
+/**
+ * \brief Run the rounds of op=wr, the other tasks finish theirs before this task runs again
+ */
+static void BenchRw_WrLowTask(void *p_arg)
+{
+    OS_CTX_SW_CTR ctx_sw;
+    CPU_INT32U inverted;
+    CPU_INT32U overtaken;
+    CPU_INT32U n;
+    OS_ERR err;
+
+    (void)p_arg;
+    for (n = 0u; n < BENCH_RW_WARMUP + BENCH_RW_WR_SAMPLES; n++)
+    {
+        inverted = BenchRwInvertedCtr;
+        overtaken = BenchRwOvertakenCtr;
+        BenchRwMediumRan = DEF_NO;
+        BenchRwWrDone = DEF_NO;
+        ctx_sw = OSTaskCtxSwCtr;
+        BenchRw_Lock(DEF_NO);
+        BenchRwTs = Bench_TsGet();
+        OSTaskSemPost(&BenchRwTCB[0], OS_OPT_POST_NONE, &err);
+        OSTaskSemPost(&BenchRwTCB[2], OS_OPT_POST_NONE, &err);
+        OSTaskSemPost(&BenchRwTCB[1], OS_OPT_POST_NONE, &err);
+        BenchRw_Spin(BENCH_RW_SPIN_LOW);
+        BenchRw_Unlock();
+        ctx_sw = OSTaskCtxSwCtr - ctx_sw;
+
+        if (n >= BENCH_RW_WARMUP)
+        {
+            BenchRwSamples[n - BENCH_RW_WARMUP] = BenchRwBlockTs;
+            BenchRwCtxSw += ctx_sw;
+            BenchRwCtxSwMax = (ctx_sw > BenchRwCtxSwMax) ? ctx_sw : BenchRwCtxSwMax;
+        }
+        else
+        {
+            BenchRwInvertedCtr = inverted;
+            BenchRwOvertakenCtr = overtaken;
+        }
+    }
+
+    OSSemPost(&BenchRwDone, OS_OPT_POST_1, &err);
+    while (DEF_TRUE)                            //Deleted by the benchmark task
+    {
+        OSTaskSuspend((OS_TCB *)0, &err);
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                          HELPER TASKS, OP=EXIT
+*********************************************************************************************************
+*/
+
+/**
+ * \brief Recreate a task of op=exit deleted by its round
+ * \param [IN] i, BENCH_RW_EXIT_WR or BENCH_RW_EXIT_HOLDER
+ */
+static void BenchRw_ExitTaskCreate(CPU_INT32U i)
+{
+    OS_ERR err;
+
+    OSTaskCreate(&BenchRwTCB[i], (CPU_CHAR *)"Bench Rw",
+                 (i == BENCH_RW_EXIT_HOLDER) ? BenchRw_ExitHolderTask : BenchRw_ExitWaiterTask,
+                 (void *)0, (OS_PRIO)(BENCH_RW_PRIO_FIRST + i),
+                 &BenchRwStk[i][0], BENCH_RW_TASK_STK_SIZE / 10u, BENCH_RW_TASK_STK_SIZE,
+                 0u, 0u, (void *)0, OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR, &err);
+}
+
+/**
+ * \brief The writer (BENCH_RW_EXIT_WR) or one of the two readers after it: wait for the lock once per round
+ */
+static void BenchRw_ExitWaiterTask(void *p_arg)
+{
+    CPU_INT32U i;
+    OS_ERR err;
+
+    (void)p_arg;
+    i = (CPU_INT32U)(OSTCBCurPtr - &BenchRwTCB[0]);
+    while (DEF_TRUE)
+    {
+        OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        if (i == BENCH_RW_EXIT_WR)
+        {
+            OSRwLockWrPend(&BenchRwLock,
+                           (BenchRwExitCase == BENCH_RW_EXIT_TIMEOUT_CASE) ? BENCH_RW_EXIT_TIMEOUT : 0u,
+                           OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &BenchRwExitErr[i]);
+        }
+        else
+        {
+            OSRwLockRdPend(&BenchRwLock, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &BenchRwExitErr[i]);
+        }
+        if (BenchRwExitErr[i] == OS_ERR_NONE)
+        {
+            OSRwLockPost(&BenchRwLock, OS_OPT_POST_NONE, &err);
+        }
+    }
+}
+
+/**
+ * \brief Hold the lock to read from one post of the driver to the next
+ */
+static void BenchRw_ExitHolderTask(void *p_arg)
+{
+    OS_ERR err;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSRwLockRdPend(&BenchRwLock, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        if (BenchRwExitCase != BENCH_RW_EXIT_DEL)   //Else the lock it held was deleted
+        {
+            OSRwLockPost(&BenchRwLock, OS_OPT_POST_NONE, &err);
+        }
+    }
+}
+
+/**
+ * \brief One round of BenchRwExitCase, see Note #3; the other tasks run above this one, so each call
+ * below returns once they wait again
+ * \return DEF_YES if the round went as the case expects
+ */
+static CPU_BOOLEAN BenchRw_ExitRound(void)
+{
+    CPU_BOOLEAN ok;
+    CPU_INT32U i;
+    OS_ERR err;
+
+    for (i = 0u; i < 3u; i++)
+    {
+        BenchRwExitErr[i] = OS_ERR_STATUS_INVALID;
+    }
+
+    OSTaskSemPost(&BenchRwTCB[BENCH_RW_EXIT_HOLDER], OS_OPT_POST_NONE, &err); //The holder takes the lock
+    for (i = 0u; i < 3u; i++)                                                  //The writer, then the readers wait
+    {
+        OSTaskSemPost(&BenchRwTCB[i], OS_OPT_POST_NONE, &err);
+    }
+    ok = (BenchRwTCB[BENCH_RW_EXIT_HOLDER].Prio == BenchRwTCB[BENCH_RW_EXIT_WR].Prio) ? DEF_YES : DEF_NO;
+
+    switch (BenchRwExitCase)
+    {
+    case BENCH_RW_EXIT_ABORT:
+        (void)OSRwLockPendAbort(&BenchRwLock, OS_OPT_PEND_ABORT_1, &err); //The writer, first in the pend list
+        break;
+    case BENCH_RW_EXIT_TIMEOUT_CASE:
+        OSTimeDly(BENCH_RW_EXIT_TIMEOUT + 1u, OS_OPT_TIME_DLY, &err);
+        break;
+    case BENCH_RW_EXIT_WRITER_DEL:
+        OSTaskDel(&BenchRwTCB[BENCH_RW_EXIT_WR], &err);
+        break;
+    case BENCH_RW_EXIT_HOLDER_DEL:
+        OSTaskDel(&BenchRwTCB[BENCH_RW_EXIT_HOLDER], &err);
+        break;
+    default:
+        (void)OSRwLockDel(&BenchRwLock, OS_OPT_DEL_ALWAYS, &err);
+        break;
+    }
+
+    ok = (BenchRwExitErr[BENCH_RW_EXIT_WR] == BenchRwExitWrErr[BenchRwExitCase]) ? ok : DEF_NO;
+    for (i = 1u; i < 3u; i++)
+    {
+        ok = (BenchRwExitErr[i] == ((BenchRwExitCase == BENCH_RW_EXIT_DEL) ? OS_ERR_OBJ_DEL : OS_ERR_NONE)) ? ok : DEF_NO;
+    }
+
+    switch (BenchRwExitCase)                        //Put the round back as it started
+    {
+    case BENCH_RW_EXIT_WRITER_DEL:
+        BenchRw_ExitTaskCreate(BENCH_RW_EXIT_WR);
+        break;
+    case BENCH_RW_EXIT_HOLDER_DEL:
+        BenchRw_ExitTaskCreate(BENCH_RW_EXIT_HOLDER);
+        break;
+    case BENCH_RW_EXIT_DEL:
+        OSRwLockCreate(&BenchRwLock, (CPU_CHAR *)"Bench Rw Lock", &err);
+        break;
+    default:
+        break;
+    }
+    if (BenchRwExitCase != BENCH_RW_EXIT_HOLDER_DEL)
+    {
+        OSTaskSemPost(&BenchRwTCB[BENCH_RW_EXIT_HOLDER], OS_OPT_POST_NONE, &err); //The holder releases the lock
+    }
+
+    for (i = 0u; i < BENCH_RW_EXIT_DRIVER; i++)
+    {
+        ok = (BenchRwTCB[i].Prio == BenchRwTCB[i].BasePrio) ? ok : DEF_NO;
+    }
+    OSRwLockWrPend(&BenchRwLock, 0u, OS_OPT_PEND_NON_BLOCKING, (CPU_TS *)0, &err);
+    if (err == OS_ERR_NONE)
+    {
+        OSRwLockPost(&BenchRwLock, OS_OPT_POST_NONE, &err);
+    }
+    else
+    {
+        ok = DEF_NO;
+    }
+    return ok;
+}
+
+/**
+ * \brief Run BENCH_RW_EXIT_ROUNDS rounds of each case of op=exit
+ */
+static void BenchRw_ExitDriverTask(void *p_arg)
+{
+    CPU_INT32U n;
+    OS_ERR err;
+
+    (void)p_arg;
+    for (BenchRwExitCase = 0u; BenchRwExitCase < BENCH_RW_EXIT_CASES; BenchRwExitCase++)
+    {
+        for (n = 0u; n < BENCH_RW_EXIT_ROUNDS; n++)
+        {
+            BenchRwExitErrors[BenchRwExitCase] += (BenchRw_ExitRound() == DEF_YES) ? 0u : 1u;
+        }
+    }
+
+    OSSemPost(&BenchRwDone, OS_OPT_POST_1, &err);
+    while (DEF_TRUE)                            //Deleted by the benchmark task
+    {
+        OSTaskSuspend((OS_TCB *)0, &err);
+    }
+}
@@ -0,0 +1,238 @@
+/*
+*********************************************************************************************************
+*                                        TICK LIST BENCHMARK
+*
+* Note(s) : (1) Measures OS_TickListInsert() and OS_TickUpdate() with 10, 100 and 1000 delayed tasks, for
+*               the tick list selected by OS_CFG_TICK_WHEEL_EN (see the native_tick_* environments).
+*               Each round inserts the tasks with random delays, then ticks until all of them expired:
+*
+*                   tick list=wheel tasks=100 op=insert n=2000 ns=41.50 max_ns=120
+*                   tick list=wheel tasks=100 op=tick n=100000 ns=88.10 max_ns=410
+*
+*               'op=insert' is the average OS_TickListInsert() and 'op=tick' the average OS_TickUpdate() of
+*               one tick, while the tasks expire one after the other.  Both run with interrupts disabled,
+*               so 'max_ns' (the slowest single OS_TickListInsert() or OS_TickUpdate()) is the worst-case
+*               interrupt disable time.  Every other round times each call on its own to find 'max_ns',
+*               the others time the whole batch for the average.
+*
+*           (2) The tick list is live kernel state, so every round runs in a critical section on an
+*               emptied list and puts the real list & OSTickCtr back before interrupts are enabled again.
+*               The benchmark tasks are dummy TCBs delayed in the suspended state, so expiring them does
+*               not touch the ready list.
+*
+*           (3) BenchTickTCB[] takes BENCH_TICK_TASKS_MAX * sizeof(OS_TCB) of RAM, about 150 KiB on the
+*               board.
+*
+*           (4) With the dynamic tick, OS_TickUpdate() reprograms the tick timer for the dummy tick list, so
+*               the suite only runs with the periodic tick.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "bench.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define BENCH_TICK_TASKS_MAX 1000u      //Largest number of delayed tasks, see Note #3
+#define BENCH_TICK_OPS 2000u            //Insertions per result
+#define BENCH_TICK_DLY_MAX 5000u        //Delays are 1..5000 ticks, reaching level 2 of the wheel
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+#define BENCH_TICK_LIST "wheel"
+#else
+#define BENCH_TICK_LIST "delta"
+#endif
+
+/*
+*********************************************************************************************************
+*                                       	GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+typedef struct
+{
+    CPU_INT64U ts_total;
+    CPU_INT32U ts_max;
+    CPU_INT32U n;
+} bench_tick_result_t;
+
+static const CPU_INT32U BenchTickTasks[] = {10u, 100u, 1000u};
+
+static OS_TCB BenchTickTCB[BENCH_TICK_TASKS_MAX];
+
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+static OS_TCB *BenchTickWheelSave[OS_TICK_WHEEL_LVLS][OS_TICK_WHEEL_SLOTS];
+#endif
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void BenchTick_Round(CPU_INT32U tasks, CPU_BOOLEAN each, bench_tick_result_t *p_insert, bench_tick_result_t *p_tick);
+static void BenchTick_Print(const CPU_CHAR *op, CPU_INT32U tasks, const bench_tick_result_t *p_result);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+void BenchTick_Run(void)
+{
+    bench_tick_result_t insert;
+    bench_tick_result_t tick;
+    CPU_INT32U tasks;
+    CPU_INT32U rounds;
+    CPU_INT32U i;
+    CPU_INT32U r;
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    return;                                     //See Note #4
+#endif
+
+    for (i = 0u; i < sizeof(BenchTickTasks) / sizeof(BenchTickTasks[0]); i++)
+    {
+        tasks = BenchTickTasks[i];
+        rounds = BENCH_TICK_OPS / tasks;
+        memset(&insert, 0, sizeof(insert));
+        memset(&tick, 0, sizeof(tick));
+
+        for (r = 0u; r < 2u * rounds; r++)
+        {
+            BenchTick_Round(tasks, (CPU_BOOLEAN)(r & 1u), &insert, &tick);
+        }
+
+        BenchTick_Print("insert", tasks, &insert);
+        BenchTick_Print("tick", tasks, &tick);
+    }
+}
+
+/**
+ * \brief Delay 'tasks' dummy TCBs and tick until all of them expired, see Note #1 and #2
+ * \param [IN] tasks, number of delayed tasks
+ * \param [IN] each, DEF_YES to time every call for the maximum, DEF_NO to time the batch for the average
+ * \param [IN/OUT] p_insert, p_tick, accumulated results
+ */
+static void BenchTick_Round(CPU_INT32U tasks, CPU_BOOLEAN each, bench_tick_result_t *p_insert, bench_tick_result_t *p_tick)
+{
+    OS_TICK_LIST list_save;
+    OS_TICK ctr_save;
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS time_max_save;
+#endif
+    OS_TICK n;
+    OS_TCB *p_tcb;
+    CPU_INT32U ts_start;
+    CPU_INT32U ts;
+    CPU_INT32U i;
+    CPU_SR_ALLOC();
+
+    for (i = 0u; i < tasks; i++)
+    {
+        p_tcb = &BenchTickTCB[i];
+        OS_TaskInitTCB(p_tcb);
+        p_tcb->TaskState = OS_TASK_STATE_DLY_SUSPENDED;
+        p_tcb->TickRemain = 1u + (Bench_Rand() % BENCH_TICK_DLY_MAX);   //Delay to insert with
+    }
+
+    CPU_CRITICAL_ENTER();
+    list_save = OSTickList;
+    ctr_save = OSTickCtr;
+#if (OS_CFG_TS_EN > 0u)
+    time_max_save = OSTickTimeMax;
+#endif
+    OSTickList.TCB_Ptr = (OS_TCB *)0;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    memcpy(BenchTickWheelSave, OSTickWheel, sizeof(OSTickWheel));
+    memset(OSTickWheel, 0, sizeof(OSTickWheel));
+#endif
+
+    ts_start = Bench_TsGet();
+    for (i = 0u; i < tasks; i++)
+    {
+        p_tcb = &BenchTickTCB[i];
+        if (each == DEF_YES)
+        {
+            ts_start = Bench_TsGet();
+            (void)OS_TickListInsert(p_tcb, 0u, OSTickCtr, p_tcb->TickRemain);
+            ts = Bench_TsGet() - ts_start;
+            p_insert->ts_max = (ts > p_insert->ts_max) ? ts : p_insert->ts_max;
+        }
+        else
+        {
+            (void)OS_TickListInsert(p_tcb, 0u, OSTickCtr, p_tcb->TickRemain);
+        }
+    }
+    if (each == DEF_NO)
+    {
+        p_insert->ts_total += Bench_TsGet() - ts_start;
+        p_insert->n += tasks;
+    }
+
+    ts_start = Bench_TsGet();
+    for (n = 0u; n < BENCH_TICK_DLY_MAX; n++)
+    {
+        if (each == DEF_YES)
+        {
+            ts_start = Bench_TsGet();
+            OS_TickUpdate(1u);
+            ts = Bench_TsGet() - ts_start;
+            p_tick->ts_max = (ts > p_tick->ts_max) ? ts : p_tick->ts_max;
+        }
+        else
+        {
+            OS_TickUpdate(1u);
+        }
+    }
+    if (each == DEF_NO)
+    {
+        p_tick->ts_total += Bench_TsGet() - ts_start;
+        p_tick->n += BENCH_TICK_DLY_MAX;
+    }
+
+    for (i = 0u; i < tasks; i++)                //Every task must have expired exactly once
+    {
+        if (BenchTickTCB[i].TaskState != OS_TASK_STATE_SUSPENDED)
+        {
+            break;
+        }
+    }
+
+    OSTickList = list_save;
+    OSTickCtr = ctr_save;
+#if (OS_CFG_TS_EN > 0u)
+    OSTickTimeMax = time_max_save;
+#endif
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    memcpy(OSTickWheel, BenchTickWheelSave, sizeof(OSTickWheel));
+#endif
+    CPU_CRITICAL_EXIT();
+
+    if (i != tasks)
+    {
+        Bench_Print("tick list=%s tasks=%lu error=not_expired\r\n", BENCH_TICK_LIST, (unsigned long)tasks);
+    }
+}
+
+static void BenchTick_Print(const CPU_CHAR *op, CPU_INT32U tasks, const bench_tick_result_t *p_result)
+{
+    CPU_CHAR prefix[64];
+
+    snprintf(prefix, sizeof(prefix), "tick list=%s tasks=%lu op=%s",
+             BENCH_TICK_LIST, (unsigned long)tasks, op);
+    Bench_PrintNsMax(prefix, p_result->n, p_result->ts_total, p_result->ts_max);
+}
@@ -0,0 +1,297 @@
+/*
+*********************************************************************************************************
+*                                      SOFTWARE TIMER BENCHMARK
+*
+* Note(s) : (1) 'op=start' and 'op=stop' measure OSTmrStart() and OSTmrStop() with 10, 100 and
+*               BENCH_TMR_SLOW_NBR running timers in the heap of one timer task:
+*
+*                   tmr timers=256 op=start n=2560 ns=1210.40 max_ns=5300
+*
+*           (2) 'op=late' runs one fast periodic timer next to BENCH_TMR_SLOW_NBR slow periodic timers
+*               whose callbacks take BENCH_TMR_SLOW_US each, plus one hog whose callback takes
+*               BENCH_TMR_HOG_MS.  With 'tasks=1' all of them share the low priority timer task,
+*               with 'tasks=2' the fast timer is bound to the high priority one.  The result is how
+*               many ticks the fast callback ran after its expiry tick:
+*
+*                   tmr tasks=2 timers=258 op=late n=30 avg_ticks=0.00 max_ticks=0
+*
+*           (3) Timer periods are in units of 1/OS_CFG_TMR_TASK_RATE_HZ, 100 ms by default, so
+*               'op=late' takes 2 * BENCH_TMR_FAST_NBR of those periods.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                           LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "bench.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define BENCH_TMR_SLOW_NBR 256u         //Slow timers, a few KiB of RAM on the board
+#define BENCH_TMR_SLOW_PERIOD 10u       //Slow timer period, in timer units
+#define BENCH_TMR_SLOW_US 80u           //Duration of a slow callback
+#define BENCH_TMR_HOG_MS 20u            //Duration of the hog callback
+#define BENCH_TMR_FAST_NBR 30u          //Fast timer expiries per result, period of 1 timer unit
+#define BENCH_TMR_ROUNDS 10u            //Start/stop rounds per result
+
+#define BENCH_TMR_TASK_HIGH_PRIO 3u
+#define BENCH_TMR_TASK_LOW_PRIO 10u
+#define BENCH_TMR_TASK_STK_SIZE 256u
+
+/*
+*********************************************************************************************************
+*                                       	GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+typedef struct
+{
+    CPU_INT64U ts_total;
+    CPU_INT32U ts_max;
+    CPU_INT32U n;
+} bench_tmr_result_t;
+
+static const CPU_INT32U BenchTmrTimers[] = {10u, 100u, BENCH_TMR_SLOW_NBR};
+
+static OS_TMR_TASK BenchTmrTaskHigh;
+static OS_TMR_TASK BenchTmrTaskLow;
+static OS_TCB BenchTmrTaskHighTCB;
+static OS_TCB BenchTmrTaskLowTCB;
+static CPU_STK BenchTmrTaskHighStk[BENCH_TMR_TASK_STK_SIZE];
+static CPU_STK BenchTmrTaskLowStk[BENCH_TMR_TASK_STK_SIZE];
+
+static OS_TMR BenchTmrSlow[BENCH_TMR_SLOW_NBR];
+static OS_TMR BenchTmrHog;
+static OS_TMR BenchTmrFast;
+
+static OS_TICK BenchTmrFastExpected;        //Tick at which the fast timer expires next
+static CPU_INT32U BenchTmrFastN;
+static CPU_INT32U BenchTmrFastLateTotal;
+static CPU_INT32U BenchTmrFastLateMax;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void BenchTmr_Ops(void);
+static void BenchTmr_Late(CPU_INT32U tasks);
+static void BenchTmr_Spin(CPU_INT32U us);
+static void BenchTmr_SlowCallback(void *p_tmr, void *p_arg);
+static void BenchTmr_FastCallback(void *p_tmr, void *p_arg);
+static void BenchTmr_Print(const CPU_CHAR *op, CPU_INT32U timers, const bench_tmr_result_t *p_result);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+void BenchTmr_Run(void)
+{
+    OS_ERR err;
+
+    OSTmrTaskCreate(&BenchTmrTaskHigh, &BenchTmrTaskHighTCB, (CPU_CHAR *)"Bench Tmr High",
+                    BENCH_TMR_TASK_HIGH_PRIO, &BenchTmrTaskHighStk[0],
+                    BENCH_TMR_TASK_STK_SIZE / 10u, BENCH_TMR_TASK_STK_SIZE, &err);
+    if (err == OS_ERR_NONE)
+    {
+        OSTmrTaskCreate(&BenchTmrTaskLow, &BenchTmrTaskLowTCB, (CPU_CHAR *)"Bench Tmr Low",
+                        BENCH_TMR_TASK_LOW_PRIO, &BenchTmrTaskLowStk[0],
+                        BENCH_TMR_TASK_STK_SIZE / 10u, BENCH_TMR_TASK_STK_SIZE, &err);
+    }
+    if (err != OS_ERR_NONE)
+    {
+        Bench_Print("tmr error=task_create err=%lu\r\n", (unsigned long)err);
+        return;
+    }
+
+    BenchTmr_Ops();
+    BenchTmr_Late(1u);
+    BenchTmr_Late(2u);
+}
+
+/**
+ * \brief Start and stop 10, 100 and BENCH_TMR_SLOW_NBR timers on the low timer task, see Note #1
+ */
+static void BenchTmr_Ops(void)
+{
+    bench_tmr_result_t start;
+    bench_tmr_result_t stop;
+    OS_TMR *p_tmr;
+    CPU_INT32U timers;
+    CPU_INT32U ts_start;
+    CPU_INT32U ts;
+    CPU_INT32U i;
+    CPU_INT32U j;
+    CPU_INT32U r;
+    OS_ERR err;
+
+    for (i = 0u; i < BENCH_TMR_SLOW_NBR; i++)       //Long one-shot delays, they never expire here
+    {
+        OSTmrCreate(&BenchTmrSlow[i], (CPU_CHAR *)"Bench Tmr", 100u, 0u, OS_OPT_TMR_ONE_SHOT,
+                    (OS_TMR_CALLBACK_PTR)0, (void *)0, &err);
+        OSTmrTaskSet(&BenchTmrSlow[i], &BenchTmrTaskLow, &err);
+    }
+
+    for (i = 0u; i < sizeof(BenchTmrTimers) / sizeof(BenchTmrTimers[0]); i++)
+    {
+        timers = BenchTmrTimers[i];
+        memset(&start, 0, sizeof(start));
+        memset(&stop, 0, sizeof(stop));
+
+        for (r = 0u; r < BENCH_TMR_ROUNDS; r++)
+        {
+            for (j = 0u; j < timers; j++)
+            {
+                OSTmrSet(&BenchTmrSlow[j], 100u + (Bench_Rand() % 900u), 0u, (OS_TMR_CALLBACK_PTR)0, (void *)0, &err);
+                ts_start = Bench_TsGet();
+                (void)OSTmrStart(&BenchTmrSlow[j], &err);
+                ts = Bench_TsGet() - ts_start;
+                start.ts_total += ts;
+                start.ts_max = (ts > start.ts_max) ? ts : start.ts_max;
+                if (err != OS_ERR_NONE)
+                {
+                    Bench_Print("tmr error=start err=%lu\r\n", (unsigned long)err);
+                }
+            }
+            for (j = 0u; j < timers; j++)           //Random order, not always the root of the heap
+            {
+                p_tmr = &BenchTmrSlow[(j * 7u + r) % timers];
+                ts_start = Bench_TsGet();
+                (void)OSTmrStop(p_tmr, OS_OPT_TMR_NONE, (void *)0, &err);
+                ts = Bench_TsGet() - ts_start;
+                stop.ts_total += ts;
+                stop.ts_max = (ts > stop.ts_max) ? ts : stop.ts_max;
+            }
+            start.n += timers;
+            stop.n += timers;
+        }
+
+        BenchTmr_Print("start", timers, &start);
+        BenchTmr_Print("stop", timers, &stop);
+    }
+
+    for (i = 0u; i < BENCH_TMR_SLOW_NBR; i++)
+    {
+        (void)OSTmrDel(&BenchTmrSlow[i], &err);
+    }
+}
+
+/**
+ * \brief Measure how late the fast timer expires among the slow ones, see Note #2
+ * \param [IN] tasks, 1 for the fast timer on the low timer task, 2 for the high one
+ */
+static void BenchTmr_Late(CPU_INT32U tasks)
+{
+    CPU_INT64U avg100;
+    CPU_INT32U i;
+    OS_ERR err;
+
+    for (i = 0u; i < BENCH_TMR_SLOW_NBR; i++)       //Slow timers spread over the phases of their period
+    {
+        OSTmrCreate(&BenchTmrSlow[i], (CPU_CHAR *)"Bench Tmr Slow", 1u + (i % BENCH_TMR_SLOW_PERIOD),
+                    BENCH_TMR_SLOW_PERIOD, OS_OPT_TMR_PERIODIC,
+                    (OS_TMR_CALLBACK_PTR)BenchTmr_SlowCallback, (void *)BENCH_TMR_SLOW_US, &err);
+        OSTmrTaskSet(&BenchTmrSlow[i], &BenchTmrTaskLow, &err);
+    }
+    OSTmrCreate(&BenchTmrHog, (CPU_CHAR *)"Bench Tmr Hog", BENCH_TMR_SLOW_PERIOD / 2u,
+                BENCH_TMR_SLOW_PERIOD, OS_OPT_TMR_PERIODIC,
+                (OS_TMR_CALLBACK_PTR)BenchTmr_SlowCallback, (void *)(BENCH_TMR_HOG_MS * 1000u), &err);
+    OSTmrTaskSet(&BenchTmrHog, &BenchTmrTaskLow, &err);
+    OSTmrCreate(&BenchTmrFast, (CPU_CHAR *)"Bench Tmr Fast", 1u, 1u, OS_OPT_TMR_PERIODIC,
+                (OS_TMR_CALLBACK_PTR)BenchTmr_FastCallback, (void *)0, &err);
+    OSTmrTaskSet(&BenchTmrFast, (tasks == 1u) ? &BenchTmrTaskLow : &BenchTmrTaskHigh, &err);
+
+    BenchTmrFastN = 0u;
+    BenchTmrFastLateTotal = 0u;
+    BenchTmrFastLateMax = 0u;
+
+    OSTimeDly(1u, OS_OPT_TIME_DLY, &err);           //Start all of them on the same tick
+    for (i = 0u; i < BENCH_TMR_SLOW_NBR; i++)
+    {
+        (void)OSTmrStart(&BenchTmrSlow[i], &err);
+    }
+    (void)OSTmrStart(&BenchTmrHog, &err);
+    BenchTmrFastExpected = OSTimeGet(&err) + OSTmrToTicksMult;
+    (void)OSTmrStart(&BenchTmrFast, &err);
+
+    while (BenchTmrFastN < BENCH_TMR_FAST_NBR)
+    {
+        OSTimeDly(OSTmrToTicksMult, OS_OPT_TIME_DLY, &err);
+    }
+
+    (void)OSTmrDel(&BenchTmrFast, &err);
+    (void)OSTmrDel(&BenchTmrHog, &err);
+    for (i = 0u; i < BENCH_TMR_SLOW_NBR; i++)
+    {
+        (void)OSTmrDel(&BenchTmrSlow[i], &err);
+    }
+
+    avg100 = ((CPU_INT64U)BenchTmrFastLateTotal * 100u) / BenchTmrFastN;
+    Bench_Print("tmr tasks=%lu timers=%lu op=late n=%lu avg_ticks=%lu.%02lu max_ticks=%lu\r\n",
+                (unsigned long)tasks,
+                (unsigned long)(BENCH_TMR_SLOW_NBR + 2u),
+                (unsigned long)BenchTmrFastN,
+                (unsigned long)(avg100 / 100u),
+                (unsigned long)(avg100 % 100u),
+                (unsigned long)BenchTmrFastLateMax);
+}
+
+/**
+ * \brief Busy wait, standing for the work of a callback
+ * \param [IN] us, duration in microseconds
+ */
+static void BenchTmr_Spin(CPU_INT32U us)
+{
+    CPU_INT32U ts_start;
+
+    ts_start = Bench_TsGet();
+    while (Bench_TsToNs(Bench_TsGet() - ts_start) < (CPU_INT64U)us * 1000u)
+    {
+    }
+}
+
+static void BenchTmr_SlowCallback(void *p_tmr, void *p_arg)
+{
+    (void)p_tmr;
+    BenchTmr_Spin((CPU_INT32U)(CPU_ADDR)p_arg);
+}
+
+static void BenchTmr_FastCallback(void *p_tmr, void *p_arg)
+{
+    CPU_INT32U late;
+    OS_ERR err;
+
+    (void)p_tmr;
+    (void)p_arg;
+
+    if (BenchTmrFastN >= BENCH_TMR_FAST_NBR)
+    {
+        return;
+    }
+    late = (CPU_INT32U)(OSTimeGet(&err) - BenchTmrFastExpected);
+    BenchTmrFastExpected += OSTmrToTicksMult;
+    BenchTmrFastLateTotal += late;
+    BenchTmrFastLateMax = (late > BenchTmrFastLateMax) ? late : BenchTmrFastLateMax;
+    BenchTmrFastN++;
+}
+
+static void BenchTmr_Print(const CPU_CHAR *op, CPU_INT32U timers, const bench_tmr_result_t *p_result)
+{
+    CPU_CHAR prefix[64];
+
+    snprintf(prefix, sizeof(prefix), "tmr timers=%lu op=%s", (unsigned long)timers, op);
+    Bench_PrintNsMax(prefix, p_result->n, p_result->ts_total, p_result->ts_max);
+}
@@ -0,0 +1,99 @@
+/*
+*********************************************************************************************************
+*                                           LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "stm32f4xx_hal.h"
+#include "stm32f429i_discovery.h"
+#include "os.h"
+#include "bench.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define APP_TASK_START_STK_SIZE 512u
+
+#define APP_TASK_START_PRIO 2u
+
+/*
+*********************************************************************************************************
+*                                       	GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static OS_TCB AppTaskStartTCB;
+
+static CPU_STK AppTaskStartStk[APP_TASK_START_STK_SIZE];
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void AppTaskStart(void *p_arg);
+
+/*
+*********************************************************************************************************
+*                                                MAIN
+*********************************************************************************************************
+*/
+
+int main(void)
+{
+    OS_ERR err;
+
+    CPU_Init(); //Timestamp timer of OS_TS_GET(), before the kernel uses it
+
+    OSInit(&err);
+
+    OSTaskCreate((OS_TCB *)&AppTaskStartTCB,
+                 (CPU_CHAR *)"App Task Start",
+                 (OS_TASK_PTR)AppTaskStart,
+                 (void *)0,
+                 (OS_PRIO)APP_TASK_START_PRIO,
+                 (CPU_STK *)&AppTaskStartStk[0],
+                 (CPU_STK_SIZE)APP_TASK_START_STK_SIZE / 10,
+                 (CPU_STK_SIZE)APP_TASK_START_STK_SIZE,
+                 (OS_MSG_QTY)5u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+
+    OSStart(&err);
+}
+
+/*
+*********************************************************************************************************
+*                                              STARTUP TASK
+*********************************************************************************************************
+*/
+
+static void AppTaskStart(void *p_arg)
+{
+    HAL_Init();
+    BSP_LED_Init(LED3);
+    Bench_Init();
+#if (OS_CFG_DYN_TICK_EN > 0u) && (BENCH_HOST == 0u)
+    OS_CPU_SysTickInitFreq(SystemCoreClock);    //Take the SysTick over from the HAL for the dynamic tick
+#endif
+
+    BenchPrio_Run();
+    BenchTick_Run();
+    BenchTmr_Run();
+    BenchDynTick_Run();
+    BenchPend_Run();
+    BenchBcast_Run();
+    BenchFlag_Run();
+    BenchMutex_Run();
+    BenchRwLock_Run();
+    BenchRhealstone_Run();
+
+    BSP_LED_On(LED3);       //Indicate all benchmarks completed
+    Bench_Exit();
+}
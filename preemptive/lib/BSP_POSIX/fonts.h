@@ -0,0 +1,39 @@
+/**
+  ******************************************************************************
+  * @file    fonts.h
+  * @brief   Host (POSIX) stand-in for the STM32 Utilities fonts.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __FONTS_H
+#define __FONTS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct _tFont
+{
+  const uint8_t *table;       /* Glyph bitmaps, NULL on the host: only the cells are drawn */
+  uint16_t Width;
+  uint16_t Height;
+} sFONT;
+
+extern sFONT Font24;
+extern sFONT Font20;
+extern sFONT Font16;
+extern sFONT Font12;
+extern sFONT Font8;
+
+#define LINE(x) ((x) * (((sFONT *)BSP_LCD_GetFont())->Height))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FONTS_H */
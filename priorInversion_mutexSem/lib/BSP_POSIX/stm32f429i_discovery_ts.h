@@ -0,0 +1,64 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery_ts.h
+  * @brief   Host (POSIX) stand-in for the STM32F429I-Discovery touch screen.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F429I_DISCOVERY_TS_H
+#define __STM32F429I_DISCOVERY_TS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f429i_discovery.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint16_t TouchDetected;
+  uint16_t X;
+  uint16_t Y;
+  uint16_t Z;
+} TS_StateTypeDef;
+
+typedef enum
+{
+  TS_OK       = 0x00,
+  TS_ERROR    = 0x01,
+  TS_TIMEOUT  = 0x02
+} TS_StatusTypeDef;
+
+/**
+ * One sample of a recorded touch trace: the state of the screen from Ms after the start of the replay
+ * until the next sample.
+ */
+typedef struct
+{
+  uint32_t Ms;
+  uint16_t TouchDetected;
+  uint16_t X;
+  uint16_t Y;
+} BSP_POSIX_TS_SampleTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define BSP_POSIX_TS_TRACE_ENV      "BSP_POSIX_TS_TRACE"  /* File of a trace replayed from BSP_TS_Init() */
+#define BSP_POSIX_TS_TRACE_MAX      4096u                 /* Samples of a trace file */
+
+/* Exported functions --------------------------------------------------------*/
+uint8_t BSP_TS_Init(uint16_t XSize, uint16_t YSize);
+void    BSP_TS_GetState(TS_StateTypeDef *TsState);
+uint8_t BSP_TS_ITConfig(void);
+uint8_t BSP_TS_ITGetStatus(void);
+void    BSP_TS_ITClear(void);
+
+uint8_t BSP_POSIX_TS_Replay(const BSP_POSIX_TS_SampleTypeDef *Trace, uint32_t Count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F429I_DISCOVERY_TS_H */
@@ -30,6 +30,17 @@
 const  CPU_CHAR  *os_time__c = "$Id: $";
 #endif
 
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+static  void  OS_TimePeriodicRelease (OS_TCB   *p_tcb,
+                                      OS_TICK   tick);
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                  DELAY TASK 'n' TICKS
@@ -488,6 +499,268 @@ OS_TICK  OSTimeGet (OS_ERR  *p_err)
     return (ticks);
 }
 
+/*
+************************************************************************************************************************
+*                                              SET THE PERIOD OF A TASK
+*
+* Description: This function makes the current task periodic (see 'os.h  PERIODIC TASKS'): its first job is released
+*              at once, the next ones every 'period' ticks by OSTimePeriodicWait().
+*
+* Arguments  : period    is the number of ticks between two releases.  0 makes the task aperiodic again.
+*
+*              deadline  is the number of ticks from a release to the end of its job, at most 'period'.  0 specifies a
+*                        deadline of 'period' ticks.
+*
+*              p_err     is a pointer to a variable that will contain an error code from this call.
+*
+*                            OS_ERR_NONE                   The call was successful
+*                            OS_ERR_OS_NOT_RUNNING         If uC/OS-III is not running yet
+*                            OS_ERR_TIME_DEADLINE_INVALID  If 'deadline' is longer than 'period'
+*                            OS_ERR_TIME_DLY_ISR           If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : (1) The statistics of the jobs are cleared when the task becomes periodic.  A task already periodic keeps
+*                  them and its next release is 'period' ticks after its current one, so a task may change its period
+*                  from job to job.
+*
+*              (2) The first job is released by the call, with no jitter, and the next releases are counted from the
+*                  current tick.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+void  OSTimePeriodicSet (OS_TICK   period,
+                         OS_TICK   deadline,
+                         OS_ERR   *p_err)
+{
+    OS_TCB   *p_tcb;
+    CPU_ERR   cpu_err;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TIME_DLY_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+    if (deadline == 0u) {                                       /* Implicit deadline                                    */
+        deadline = period;
+    }
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (deadline > period) {
+       *p_err = OS_ERR_TIME_DEADLINE_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTCBCurPtr;
+    if ((p_tcb->Periodic.Period == 0u) &&                       /* Becoming periodic?                                   */
+        (period                 >  0u)) {
+        p_tcb->PeriodicTickTs         = CPU_TS_TmrFreqGet(&cpu_err) / OSCfg_TickRate_Hz;
+        p_tcb->PeriodicReleaseTs      = OS_TS_GET();            /* The first job is released by the call, see Note #2   */
+        p_tcb->TickCtrPrev            = OSTickCtr;
+        p_tcb->Periodic.ReleaseCtr    = 1u;                     /* Clear the statistics, see Note #1                    */
+        p_tcb->Periodic.DoneCtr       = 0u;
+        p_tcb->Periodic.MissCtr       = 0u;
+        p_tcb->Periodic.SkipCtr       = 0u;
+        p_tcb->Periodic.JitterMax     = 0u;
+        p_tcb->Periodic.JitterTotal   = 0u;
+        p_tcb->Periodic.RespMax       = 0u;
+        p_tcb->Periodic.RespTotal     = 0u;
+    }
+    p_tcb->Periodic.Period   = period;
+    p_tcb->Periodic.Deadline = deadline;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          GET THE STATISTICS OF A PERIODIC TASK
+*
+* Description: This function returns the period, the deadline and the statistics of the jobs of a task (see 'os.h
+*              PERIODIC TASKS').
+*
+* Arguments  : p_tcb     is a pointer to the TCB of the task.  A NULL pointer specifies the current task.
+*
+*              p_stat    is a pointer to the structure receiving a copy of the statistics.
+*
+*              p_err     is a pointer to a variable that will contain an error code from this call.
+*
+*                            OS_ERR_NONE               Upon success
+*                            OS_ERR_PTR_INVALID        If 'p_stat' is a NULL pointer
+*                            OS_ERR_TASK_NOT_EXIST     If the task is not created or was deleted
+*
+* Returns    : none
+*
+* Note(s)    : (1) The job in progress is not counted in 'DoneCtr', nor in the response times.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+void  OSTimePeriodicStatGet (OS_TCB            *p_tcb,
+                             OS_PERIODIC_STAT  *p_stat,
+                             OS_ERR            *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_stat == (OS_PERIODIC_STAT *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Get the statistics of the current task?              */
+        p_tcb = OSTCBCurPtr;
+    }
+
+    if ((p_tcb->StkPtr    == (CPU_STK *)0) ||                   /* Make sure task exist                                 */
+        (p_tcb->TaskState == OS_TASK_STATE_DEL)) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_NOT_EXIST;
+        return;
+    }
+
+   *p_stat = p_tcb->Periodic;
+    CPU_CRITICAL_EXIT();
+   *p_err  = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          END THE JOB OF A PERIODIC TASK
+*
+* Description: This function ends the current job of a periodic task and delays the task until its next release, a
+*              whole number of periods after its first one (see OSTimePeriodicSet()), whatever the time the job took.
+*
+* Arguments  : p_err     is a pointer to a variable that will contain an error code from this call.
+*
+*                            OS_ERR_NONE               The next job is released
+*                            OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                            OS_ERR_SCHED_LOCKED       Can't delay when the scheduler is locked
+*                            OS_ERR_TIME_DLY_ISR       If you called this function from an ISR
+*                            OS_ERR_TIME_NOT_PERIODIC  If the task is not periodic
+*
+* Returns    : none
+*
+* Note(s)    : (1) The response time of the job is recorded and checked against the deadline before the task is
+*                  delayed, the release jitter when it runs again (see 'os.h  PERIODIC TASKS').
+*
+*              (2) OS_TickListInsertDly() moves the release of a late task up to the first period to come, the periods
+*                  in between are skipped.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+void  OSTimePeriodicWait (OS_ERR  *p_err)
+{
+    OS_TCB   *p_tcb;
+    OS_TICK   release;
+    CPU_TS    resp;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TIME_DLY_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't delay when the scheduler is locked             */
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTCBCurPtr;
+    if (p_tcb->Periodic.Period == 0u) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TIME_NOT_PERIODIC;
+        return;
+    }
+
+    resp = OS_TS_GET() - p_tcb->PeriodicReleaseTs;              /* End of the job, see Note #1                          */
+    p_tcb->Periodic.DoneCtr++;
+    p_tcb->Periodic.RespTotal += resp;
+    if (p_tcb->Periodic.RespMax < resp) {
+        p_tcb->Periodic.RespMax = resp;
+    }
+    if (resp > (CPU_TS)(p_tcb->Periodic.Deadline * p_tcb->PeriodicTickTs)) {
+        p_tcb->Periodic.MissCtr++;
+    }
+
+    release = p_tcb->TickCtrPrev + p_tcb->Periodic.Period;      /* The next release if the task is not late             */
+    OS_TickListInsertDly(p_tcb,
+                         p_tcb->Periodic.Period,
+                         OS_OPT_TIME_PERIODIC,
+                         p_err);
+                                                                /* See Note #2                                          */
+    p_tcb->Periodic.SkipCtr += (p_tcb->TickCtrPrev - release) / p_tcb->Periodic.Period;
+    if (*p_err != OS_ERR_NONE) {                                /* Released on the current tick                         */
+        OS_TimePeriodicRelease(p_tcb, p_tcb->TickCtrPrev);
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    OS_RdyListRemove(p_tcb);                                    /* Remove current task from ready list                  */
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find next task to run!                               */
+
+    CPU_CRITICAL_ENTER();
+    OS_TimePeriodicRelease(p_tcb, p_tcb->TickCtrPrev);          /* Running again, see Note #1                           */
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                   SET SYSTEM CLOCK
@@ -598,3 +871,52 @@ void  OSTimeDynTick (OS_TICK  ticks)
     OS_TickUpdate(ticks);                                       /* Update from the ISR                                  */
 }
 #endif
+
+
+/*
+************************************************************************************************************************
+*                                             RELEASE A JOB OF A PERIODIC TASK
+*
+* Description: This function records the release of a job of a periodic task, running again, and its jitter.
+*
+* Arguments  : p_tcb     is a pointer to the TCB of the task
+*
+*              tick      is the value of OSTickCtr at which the job is released
+*
+* Returns    : none
+*
+* Note(s)    : (1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              (2) This function is assumed to be called with interrupts disabled.
+*
+*              (3) The tick of the release was 'OSTickCtr - tick' ticks before the last one, at OSTickTS.  A task resumed
+*                  before its release by OSTimeDlyResume() is released at once.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+static  void  OS_TimePeriodicRelease (OS_TCB   *p_tcb,
+                                      OS_TICK   tick)
+{
+    OS_TICK  late;
+    CPU_TS   ts;
+    CPU_TS   jitter;
+
+
+    ts   = OS_TS_GET();
+    late = OSTickCtr - tick;
+    if ((late != 0u) &&                                         /* Resumed before the release?                          */
+        ((OS_TICK)(tick - OSTickCtr) <= p_tcb->Periodic.Period)) {
+        p_tcb->PeriodicReleaseTs = ts;
+    } else {                                                    /* See Note #3                                          */
+        p_tcb->PeriodicReleaseTs = OSTickTS - (CPU_TS)(late * p_tcb->PeriodicTickTs);
+    }
+
+    jitter = ts - p_tcb->PeriodicReleaseTs;
+    p_tcb->Periodic.ReleaseCtr++;
+    p_tcb->Periodic.JitterTotal += jitter;
+    if (p_tcb->Periodic.JitterMax < jitter) {
+        p_tcb->Periodic.JitterMax = jitter;
+    }
+}
+#endif
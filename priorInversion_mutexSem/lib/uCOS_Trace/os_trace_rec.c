@@ -0,0 +1,435 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                    RAM Ring Buffer Trace Recorder
+*
+* File      : os_trace_rec.c
+* Version   : V3.08.00
+*********************************************************************************************************
+* Note(s)   : (1) Each slot of the ring buffer carries a sequence number.  A writer takes the next slot
+*                 index 'ix' with an atomic increment of OS_TraceRecHead, marks the slot busy with the odd
+*                 sequence '2 * ix + 1', fills it, then publishes it with the even sequence '2 * ix + 2'.
+*                 The reader only copies a slot whose sequence is the one it expects, before & after the
+*                 copy, so a record being written or overwritten by a newer one is never sent half done.
+*
+*             (2) An ISR may interrupt a writer between its increment & its publish.  The reader then stops
+*                 at that slot & resumes on its next call, the records behind it are kept.
+*
+*             (3) Timestamps are read with CPU_TS_TmrRd(), the DWT cycle counter on the Cortex-M & nanoseconds
+*                 on the host, so CPU_Init() is called before OS_TRACE_INIT().  They wrap on 32 bits, the
+*                 decoder unwraps them as long as an event is recorded at least once per wrap (the tick takes
+*                 care of that).
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include  <os.h>
+
+#if (OS_CFG_TRACE_EN > 0u)
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#if ((OS_TRACE_REC_BUF_SIZE & (OS_TRACE_REC_BUF_SIZE - 1u)) != 0u)
+#error  "OS_TRACE_REC_BUF_SIZE                 illegal setting, MUST be a power of 2"
+#endif
+
+#define  OS_TRACE_REC_BUF_MASK               (OS_TRACE_REC_BUF_SIZE - 1u)
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  os_trace_rec {
+    CPU_INT32U           Seq;                                   /* Sequence of the slot, see Note #1.                   */
+    CPU_INT32U           TS;
+    CPU_INT32U           Arg;
+    CPU_INT08U           Evt;
+    CPU_INT08U           Pad;
+    CPU_INT16U           Val;
+} OS_TRACE_REC;
+
+
+/*
+*********************************************************************************************************
+*                                           LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TRACE_REC         OS_TraceRecBuf[OS_TRACE_REC_BUF_SIZE];
+
+static  CPU_INT32U           OS_TraceRecHead;                   /* Index of the next record written (atomic)            */
+static  CPU_INT32U           OS_TraceRecTail;                   /* Index of the next record read (reader only)          */
+static  CPU_BOOLEAN          OS_TraceRecRunning;
+static  CPU_BOOLEAN          OS_TraceRecEvtEn[OS_TRACE_EVT_QTY];/* Events recorded, see Note #3 of the defines          */
+
+static  CPU_INT16U           OS_TraceRecTaskIDCtr;              /* Last IDs assigned (atomic)                           */
+static  CPU_INT16U           OS_TraceRecObjIDCtr;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void        OS_TraceRecPut     (CPU_INT08U     evt,
+                                        CPU_INT16U     val,
+                                        CPU_INT32U     arg);
+
+static  void        OS_TraceRecName    (CPU_INT08U     evt,
+                                        CPU_INT16U     id,
+                                        CPU_CHAR      *p_name);
+
+static  void        OS_TraceRecEncode  (CPU_INT08U    *p_dst,
+                                        OS_TRACE_REC  *p_rec);
+
+
+/*
+*********************************************************************************************************
+*                                        INITIALIZE THE RECORDER
+*
+* Description: Empty the ring buffer.  Called by OS_TRACE_INIT().
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : (1) Called before OSInit(), the recorder does not use any kernel service.
+*********************************************************************************************************
+*/
+
+void  OS_TraceRecInit (void)
+{
+    CPU_INT32U  i;
+
+
+    OS_TraceRecRunning   = DEF_NO;
+    OS_TraceRecHead      = 0u;
+    OS_TraceRecTail      = 0u;
+    OS_TraceRecTaskIDCtr = 0u;
+    OS_TraceRecObjIDCtr  = 0u;
+    for (i = 0u; i < OS_TRACE_REC_BUF_SIZE; i++) {
+        OS_TraceRecBuf[i].Seq = 0u;
+    }
+    for (i = 0u; i < OS_TRACE_EVT_QTY; i++) {
+        OS_TraceRecEvtEn[i] = DEF_YES;
+    }
+#if (OS_TRACE_REC_EVT_FILTER_DFLT_EN > 0u)
+    OS_TraceRecEvtEn[OS_TRACE_EVT_TICK]      = DEF_NO;
+    OS_TraceRecEvtEn[OS_TRACE_EVT_ISR_ENTER] = DEF_NO;
+    OS_TraceRecEvtEn[OS_TRACE_EVT_ISR_EXIT]  = DEF_NO;
+    OS_TraceRecEvtEn[OS_TRACE_EVT_API_ENTER] = DEF_NO;
+    OS_TraceRecEvtEn[OS_TRACE_EVT_API_EXIT]  = DEF_NO;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                     START, STOP & CLEAR THE RECORDING
+*
+* Description: OS_TraceRecStart() records the timestamp frequency & starts recording.  OS_TraceRecStop()
+*              stops recording, the records in the buffer can still be read.  OS_TraceRecClr() drops the
+*              records not read yet.
+*
+* Arguments  : none
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+void  OS_TraceRecStart (void)
+{
+    CPU_TS_TMR_FREQ  freq;
+    CPU_ERR          err;
+
+
+    freq = CPU_TS_TmrFreqGet(&err);
+    __atomic_store_n(&OS_TraceRecRunning, DEF_YES, __ATOMIC_RELEASE);
+    OS_TraceRecPut(OS_TRACE_EVT_CLOCK, 0u, (CPU_INT32U)freq);
+}
+
+
+void  OS_TraceRecStop (void)
+{
+    __atomic_store_n(&OS_TraceRecRunning, DEF_NO, __ATOMIC_RELEASE);
+}
+
+
+void  OS_TraceRecClr (void)
+{
+    OS_TraceRecTail = __atomic_load_n(&OS_TraceRecHead, __ATOMIC_ACQUIRE);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           RECORD AN EVENT
+*
+* Description: Record one event, see 'os_trace_rec.h' for the meaning of 'val' & 'arg'.
+*
+* Arguments  : evt      is the event, OS_TRACE_EVT_xxx.
+*
+*              val      is a 16-bit value, usually the ID of the task or object.
+*
+*              arg      is a 32-bit argument.
+*
+* Returns    : none
+*
+* Note(s)    : (1) Called by the OS_TRACE_xxx() hooks from tasks & ISRs, with or without interrupts
+*                  disabled.
+*********************************************************************************************************
+*/
+
+void  OS_TraceRecEvt (CPU_INT08U  evt,
+                      CPU_INT16U  val,
+                      CPU_INT32U  arg)
+{
+    if (__atomic_load_n(&OS_TraceRecRunning, __ATOMIC_RELAXED) == DEF_NO) {
+        return;
+    }
+    if ((evt < OS_TRACE_EVT_QTY) &&
+        (__atomic_load_n(&OS_TraceRecEvtEn[evt], __ATOMIC_RELAXED) == DEF_NO)) {
+        return;
+    }
+    OS_TraceRecPut(evt, val, arg);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       ENABLE OR DISABLE AN EVENT
+*
+* Description: Choose whether an event is recorded, see Note #3 of the defines of 'os_trace_rec.h' for
+*              the events disabled by OS_TraceRecInit().
+*
+* Arguments  : evt      is the event, OS_TRACE_EVT_xxx.
+*
+*              en       is DEF_YES to record the event, DEF_NO to drop it.
+*
+* Returns    : none
+*
+* Note(s)    : (1) The records of the recorder itself, OS_TRACE_EVT_CLOCK, OS_TRACE_EVT_LOST & the names,
+*                  are always recorded.
+*********************************************************************************************************
+*/
+
+void  OS_TraceRecEvtEnSet (CPU_INT08U   evt,
+                           CPU_BOOLEAN  en)
+{
+    if ((evt <  OS_TRACE_EVT_ISR_ENTER) ||                      /* See Note #1.                                         */
+        (evt >= OS_TRACE_EVT_QTY)) {
+        return;
+    }
+    __atomic_store_n(&OS_TraceRecEvtEn[evt], en, __ATOMIC_RELAXED);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    RECORD A TASK OR OBJECT CREATION
+*
+* Description: Assign the next ID to the task or kernel object & record its creation, followed by its
+*              name.  Called by OS_TRACE_TASK_CREATE() & the OS_TRACE_xxx_CREATE() hooks.
+*
+* Arguments  : p_tcb    is the TCB of the task created.
+*
+*              p_id     is the ID member of the object created.
+*
+*              type     is the type of the object, OS_OBJ_TYPE_xxx or OS_TRACE_OBJ_TYPE_xxx.
+*
+*              p_name   is the name of the object, may be NULL.
+*
+* Returns    : none
+*
+* Note(s)    : (1) IDs are assigned even when not recording, so the records of a later OS_TRACE_START()
+*                  refer to the right tasks & objects.  Their names are only recorded here though.
+*********************************************************************************************************
+*/
+
+void  OS_TraceRecTaskCreate (OS_TCB  *p_tcb)
+{
+    if (p_tcb == (OS_TCB *)0) {
+        return;
+    }
+    p_tcb->TaskID = __atomic_add_fetch(&OS_TraceRecTaskIDCtr, 1u, __ATOMIC_RELAXED);
+    OS_TraceRecEvt(OS_TRACE_EVT_TASK_CREATE, p_tcb->TaskID, (CPU_INT32U)p_tcb->Prio);
+    OS_TraceRecName(OS_TRACE_EVT_TASK_NAME, p_tcb->TaskID, p_tcb->NamePtr);
+}
+
+
+void  OS_TraceRecObjCreate (CPU_INT16U   *p_id,
+                            OS_OBJ_TYPE   type,
+                            CPU_CHAR     *p_name)
+{
+    *p_id = __atomic_add_fetch(&OS_TraceRecObjIDCtr, 1u, __ATOMIC_RELAXED);
+    OS_TraceRecEvt(OS_TRACE_EVT_OBJ_CREATE, *p_id, (CPU_INT32U)type);
+    OS_TraceRecName(OS_TRACE_EVT_OBJ_NAME, *p_id, p_name);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          READ THE RECORDS
+*
+* Description: Encode the records not read yet in the wire format of 'os_trace_rec.h', oldest first.
+*
+* Arguments  : p_buf     is where the records are encoded.
+*
+*              buf_size  is the size of 'p_buf', at least 2 * OS_TRACE_REC_WIRE_SIZE bytes.
+*
+* Returns    : The number of bytes encoded, 0 when there is no new record.
+*
+* Note(s)    : (1) Only one task may read the records.
+*
+*              (2) When writers lapped the reader, the records overwritten are reported by an
+*                  OS_TRACE_EVT_LOST record, & reading resumes at the oldest record still in the buffer.
+*                  Room for that record is kept at the end of 'p_buf'.
+*********************************************************************************************************
+*/
+
+CPU_SIZE_T  OS_TraceRecRead (CPU_INT08U  *p_buf,
+                             CPU_SIZE_T   buf_size)
+{
+    OS_TRACE_REC   rec;
+    OS_TRACE_REC  *p_slot;
+    CPU_INT32U     head;
+    CPU_INT32U     seq;
+    CPU_INT32U     lost;
+    CPU_SIZE_T     len;
+
+
+    len  = 0u;
+    head = __atomic_load_n(&OS_TraceRecHead, __ATOMIC_ACQUIRE);
+    while ((OS_TraceRecTail != head) &&
+           (len + 2u * OS_TRACE_REC_WIRE_SIZE <= buf_size)) {   /* See Note #2.                                         */
+        if ((head - OS_TraceRecTail) > OS_TRACE_REC_BUF_SIZE) {
+            lost            = head - OS_TraceRecTail - OS_TRACE_REC_BUF_SIZE;
+            OS_TraceRecTail = head - OS_TRACE_REC_BUF_SIZE;
+            rec.TS          = (CPU_INT32U)CPU_TS_TmrRd();
+            rec.Evt         = OS_TRACE_EVT_LOST;
+            rec.Val         = 0u;
+            rec.Arg         = lost;
+            OS_TraceRecEncode(&p_buf[len], &rec);
+            len += OS_TRACE_REC_WIRE_SIZE;
+        }
+
+        p_slot = &OS_TraceRecBuf[OS_TraceRecTail & OS_TRACE_REC_BUF_MASK];
+        seq    = __atomic_load_n(&p_slot->Seq, __ATOMIC_ACQUIRE);
+        if (seq != OS_TraceRecTail * 2u + 2u) {
+            if ((CPU_INT32S)(seq - (OS_TraceRecTail * 2u + 2u)) > 0) {
+                head = __atomic_load_n(&OS_TraceRecHead, __ATOMIC_ACQUIRE);
+                continue;                                       /* Overwritten by a newer record, see Note #2.          */
+            }
+            break;                                              /* Not published yet, see Note #2 of the file.          */
+        }
+
+        rec.TS  = p_slot->TS;
+        rec.Arg = p_slot->Arg;
+        rec.Evt = p_slot->Evt;
+        rec.Val = p_slot->Val;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&p_slot->Seq, __ATOMIC_RELAXED) != seq) {
+            head = __atomic_load_n(&OS_TraceRecHead, __ATOMIC_ACQUIRE);
+            continue;                                           /* Overwritten while copied                             */
+        }
+
+        OS_TraceRecEncode(&p_buf[len], &rec);
+        len += OS_TRACE_REC_WIRE_SIZE;
+        OS_TraceRecTail++;
+    }
+
+    return (len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  OS_TraceRecPut (CPU_INT08U  evt,                  /* See Note #1.                                         */
+                              CPU_INT16U  val,
+                              CPU_INT32U  arg)
+{
+    OS_TRACE_REC  *p_slot;
+    CPU_INT32U     ix;
+
+
+    ix     = __atomic_fetch_add(&OS_TraceRecHead, 1u, __ATOMIC_RELAXED);
+    p_slot = &OS_TraceRecBuf[ix & OS_TRACE_REC_BUF_MASK];
+
+    __atomic_store_n(&p_slot->Seq, ix * 2u + 1u, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    p_slot->TS  = (CPU_INT32U)CPU_TS_TmrRd();                   /* See Note #3.                                         */
+    p_slot->Arg = arg;
+    p_slot->Evt = evt;
+    p_slot->Val = val;
+    __atomic_store_n(&p_slot->Seq, ix * 2u + 2u, __ATOMIC_RELEASE);
+}
+
+
+static  void  OS_TraceRecName (CPU_INT08U   evt,                /* Name in records of 4 characters, see Note #1 above   */
+                               CPU_INT16U   id,
+                               CPU_CHAR    *p_name)
+{
+    CPU_INT32U  chunk;
+    CPU_INT32U  len;
+    CPU_INT08U  i;
+
+
+    if (p_name == (CPU_CHAR *)0) {
+        return;
+    }
+    for (len = 0u; len < OS_TRACE_REC_NAME_LEN_MAX; len += 4u) {
+        chunk = 0u;
+        for (i = 0u; (i < 4u) && (p_name[len + i] != '\0'); i++) {
+            chunk |= (CPU_INT32U)(CPU_INT08U)p_name[len + i] << (8u * i);
+        }
+        OS_TraceRecEvt(evt, id, chunk);
+        if (i < 4u) {                                           /* Record with a NUL ends the name                      */
+            break;
+        }
+    }
+}
+
+
+static  void  OS_TraceRecEncode (CPU_INT08U    *p_dst,
+                                 OS_TRACE_REC  *p_rec)
+{
+    CPU_INT08U  chk;
+    CPU_INT08U  i;
+
+
+    p_dst[0]  = OS_TRACE_REC_SYNC;
+    p_dst[1]  = p_rec->Evt;
+    p_dst[2]  = (CPU_INT08U)(p_rec->Val);
+    p_dst[3]  = (CPU_INT08U)(p_rec->Val >>  8u);
+    p_dst[4]  = (CPU_INT08U)(p_rec->TS);
+    p_dst[5]  = (CPU_INT08U)(p_rec->TS  >>  8u);
+    p_dst[6]  = (CPU_INT08U)(p_rec->TS  >> 16u);
+    p_dst[7]  = (CPU_INT08U)(p_rec->TS  >> 24u);
+    p_dst[8]  = (CPU_INT08U)(p_rec->Arg);
+    p_dst[9]  = (CPU_INT08U)(p_rec->Arg >>  8u);
+    p_dst[10] = (CPU_INT08U)(p_rec->Arg >> 16u);
+    p_dst[11] = (CPU_INT08U)(p_rec->Arg >> 24u);
+
+    chk = 0u;
+    for (i = 1u; i < 12u; i++) {
+        chk ^= p_dst[i];
+    }
+    p_dst[12] = chk;
+}
+
+#endif
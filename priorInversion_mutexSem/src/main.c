@@ -23,6 +23,17 @@
 #define MEDIUM_PRIO_TASK_PRIO 12u
 #define LOW_PRIO_TASK_PRIO 22u
 
+#define TEST_MUTEX_CEIL_EN 0u           //1: testMutex has HIGH_PRIO_TASK_PRIO as priority ceiling
+
+#if (OS_CFG_TRACE_EN > 0u)
+#define TRACE_TASK_PRIO 30u             //Lowest, the trace is sent while the CPU is otherwise idle
+#define TRACE_BUF_SIZE (20u * OS_TRACE_REC_WIRE_SIZE) //2.8 ms of UART at UART_BAUD_RATE, see TraceTask()
+#define TRACE_TX_TIMEOUT 10u            //ms, longer than a TRACE_BUF_SIZE chunk
+#define UART_BAUD_RATE 921600u          //The trace takes most of the bandwidth, see OS_TRACE_REC_EVT_FILTER_DFLT_EN
+#else
+#define UART_BAUD_RATE 115200u
+#endif
+
 UART_HandleTypeDef huart1;
 
 /*
@@ -41,6 +52,12 @@ static CPU_STK HighPrioTaskStk[TASK_STK_SIZE];
 static CPU_STK MediumPrioTaskStk[TASK_STK_SIZE];
 static CPU_STK LowPrioTaskStk[TASK_STK_SIZE];
 
+#if (OS_CFG_TRACE_EN > 0u)
+static OS_TCB TraceTaskTCB;
+static CPU_STK TraceTaskStk[TASK_STK_SIZE];
+static CPU_INT08U TraceBuf[TRACE_BUF_SIZE];
+#endif
+
 OS_MUTEX testMutex; //Used to protect share resource
 
 CPU_INT32U sharedInt;
@@ -55,6 +72,9 @@ static void AppTaskStart(void *p_arg);
 static void HighPrioTask(void *p_arg);
 static void MediumPrioTask(void *p_arg);
 static void LowPrioTask(void *p_arg);
+#if (OS_CFG_TRACE_EN > 0u)
+static void TraceTask(void *p_arg);
+#endif
 
 static void MX_USART1_UART_Init(void);
 
@@ -68,11 +88,23 @@ int main(void)
 {
     OS_ERR err;
 
+    CPU_Init(); //Timestamp timer of OS_TS_GET(), before the kernel uses it
+
+    OS_TRACE_INIT(); //Record from OSInit() on, see TraceTask()
+    OS_TRACE_START();
+
     OSInit(&err);
 
+#if (TEST_MUTEX_CEIL_EN > 0u) && (OS_CFG_MUTEX_CEIL_EN > 0u)
+    OSMutexCreateCeil((OS_MUTEX *)&testMutex,
+                      (CPU_CHAR *)"TestMutexSemaphore",
+                      (OS_PRIO)HIGH_PRIO_TASK_PRIO,
+                      (OS_ERR *)&err);
+#else
     OSMutexCreate((OS_MUTEX *)&testMutex,
                   (CPU_CHAR *)"TestMutexSemaphore",
                   (OS_ERR *)&err);
+#endif
 
     OSTaskCreate((OS_TCB *)&AppTaskStartTCB,
                  (CPU_CHAR *)"App Task Start",
@@ -147,6 +179,22 @@ static void AppTaskStart(void *p_arg)
                  (void *)0,
                  (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
                  (OS_ERR *)&err);
+
+#if (OS_CFG_TRACE_EN > 0u)
+    OSTaskCreate((OS_TCB *)&TraceTaskTCB,
+                 (CPU_CHAR *)"Trace Task",
+                 (OS_TASK_PTR)TraceTask,
+                 (void *)0,
+                 (OS_PRIO)TRACE_TASK_PRIO,
+                 (CPU_STK *)&TraceTaskStk[0],
+                 (CPU_STK_SIZE)TASK_STK_SIZE / 10,
+                 (CPU_STK_SIZE)TASK_STK_SIZE,
+                 (OS_MSG_QTY)0u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)&err);
+#endif
 }
 
 /*
@@ -250,6 +298,36 @@ static void LowPrioTask(void *p_arg)
     }
 }
 
+#if (OS_CFG_TRACE_EN > 0u)
+/**
+ * \brief Send the kernel trace on USART1, see tools/os_trace_decode.py to decode it
+ *        The text of the other tasks goes on the same UART, the decoder skips it
+ *        As the lowest priority task, it only runs when no task is in HAL_UART_Transmit(), and it
+ *        keeps the others out with the scheduler locked for one chunk at a time: a mutex would add
+ *        its own pend/post records to every chunk, & a task preempting the chunk would get HAL_BUSY
+ */
+static void TraceTask(void *p_arg)
+{
+    OS_ERR err;
+    CPU_SIZE_T len;
+
+    while (DEF_TRUE)
+    {
+        len = OS_TraceRecRead(TraceBuf, sizeof(TraceBuf));
+        if (len > 0u)
+        {
+            OSSchedLock(&err);
+            HAL_UART_Transmit(&huart1, (uint8_t *)TraceBuf, (uint16_t)len, TRACE_TX_TIMEOUT);
+            OSSchedUnlock(&err);
+        }
+        else
+        {
+            OSTimeDly((OS_TICK)10u, (OS_OPT)OS_OPT_TIME_DLY, (OS_ERR *)&err);
+        }
+    }
+}
+#endif
+
 /*
 *********************************************************************************************************
 *                                      NON-TASK FUNCTIONS
@@ -259,7 +337,7 @@ static void LowPrioTask(void *p_arg)
 static void MX_USART1_UART_Init(void)
 {
     huart1.Instance = USART1;
-    huart1.Init.BaudRate = 115200;
+    huart1.Init.BaudRate = UART_BAUD_RATE;
     huart1.Init.WordLength = UART_WORDLENGTH_8B;
     huart1.Init.StopBits = UART_STOPBITS_1;
     huart1.Init.Parity = UART_PARITY_NONE;
@@ -30,6 +30,23 @@
 const  CPU_CHAR  *os_core__c = "$Id: $";
 #endif
 
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+static  void     OS_PendListPrioInsert (OS_PEND_LIST  *p_pend_list,
+                                        OS_PRIO        prio);
+
+static  OS_PRIO  OS_PendListPrioPrev   (OS_PEND_LIST  *p_pend_list,
+                                        OS_PRIO        prio);
+
+static  void     OS_PendListPrioRemove (OS_PEND_LIST  *p_pend_list,
+                                        OS_PRIO        prio);
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                    INITIALIZATION
@@ -167,6 +184,14 @@ void  OSInit (OS_ERR  *p_err)
 #endif
 
 
+#if (OS_CFG_RWLOCK_EN > 0u)                                     /* Initialize the Reader-Writer Lock Manager module     */
+#if (OS_CFG_DBG_EN > 0u)
+    OSRwLockDbgListPtr = (OS_RWLOCK *)0;
+    OSRwLockQty        =              0u;
+#endif
+#endif
+
+
 #if (OS_CFG_SEM_EN > 0u)                                        /* Initialize the Semaphore Manager module              */
 #if (OS_CFG_DBG_EN > 0u)
     OSSemDbgListPtr = (OS_SEM *)0;
@@ -991,6 +1016,7 @@ void  OS_IdleTaskInit (OS_ERR  *p_err)
 *                                 OS_TASK_PEND_ON_MUTEX
 *                                 OS_TASK_PEND_ON_COND
 *                                 OS_TASK_PEND_ON_Q
+*                                 OS_TASK_PEND_ON_RWLOCK
 *                                 OS_TASK_PEND_ON_SEM
 *                                 OS_TASK_PEND_ON_TASK_SEM   <- No object (pending on a signal sent to the task)
 *
@@ -1202,6 +1228,9 @@ void  OS_PendDbgNameRemove (OS_PEND_OBJ  *p_obj,
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
 *
 *              2) It's assumed that the TCB contains the NEW priority in its .Prio field.
+*
+*              3) With OS_CFG_PEND_LIST_BITMAP_EN, the task is moved even when it is the only one waiting, so that it
+*                 is in the bucket of its new priority when other tasks are inserted.
 ************************************************************************************************************************
 */
 
@@ -1213,7 +1242,12 @@ void  OS_PendListChangePrio (OS_TCB  *p_tcb)
     p_obj       =  p_tcb->PendObjPtr;                           /* Get pointer to pend list                             */
     p_pend_list = &p_obj->PendList;
 
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+    if ((p_pend_list->HeadPtr->PendNextPtr != (OS_TCB *)0) ||   /* Move if multiple entries in the list ...             */
+        (p_tcb->PendPrio != p_tcb->Prio)) {                     /* ... or to the bucket of its new prio, see Note #3    */
+#else
     if (p_pend_list->HeadPtr->PendNextPtr != (OS_TCB *)0) {     /* Only move if multiple entries in the list            */
+#endif
             OS_PendListRemove(p_tcb);                           /* Remove entry from current position                   */
             p_tcb->PendObjPtr = p_obj;
             OS_PendListInsertPrio(p_pend_list,                  /* INSERT it back in the list                           */
@@ -1239,11 +1273,24 @@ void  OS_PendListChangePrio (OS_TCB  *p_tcb)
 
 void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
 {
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+    CPU_DATA  i;
+#endif
+
+
     p_pend_list->HeadPtr    = (OS_TCB *)0;
     p_pend_list->TailPtr    = (OS_TCB *)0;
 #if (OS_CFG_DBG_EN > 0u)
     p_pend_list->NbrEntries =           0u;
 #endif
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)                           /* No priority waiting, .PrioTailPtr[] is not read      */
+    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
+        p_pend_list->PrioTbl[i] = 0u;
+    }
+#if (OS_PRIO_TBL_2LVL > 0u)
+    p_pend_list->PrioTblGrp = 0u;
+#endif
+#endif
 }
 
 
@@ -1307,6 +1354,12 @@ void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_PEND_LIST_BITMAP_EN, the place of the OS_TCB is found in the bitmap of the pend list
+*                 instead of walking the list (see 'os.h  PEND LIST').
+*
+*              3) With OS_CFG_FLAG_INDEX_EN, a task waiting on an event flag group is also added to the index of the
+*                 group (see 'os.h  EVENT FLAGS'), and OS_PendListRemove() takes it out.
 ************************************************************************************************************************
 */
 
@@ -1315,10 +1368,50 @@ void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
 {
     OS_PRIO   prio;
     OS_TCB   *p_tcb_next;
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+    OS_TCB   *p_tcb_prev;
+    OS_PRIO   prio_prev;
+#endif
 
 
     prio  = p_tcb->Prio;                                        /* Obtain the priority of the task to insert            */
 
+#if (OS_CFG_FLAG_EN > 0u) && (OS_CFG_FLAG_INDEX_EN > 0u)
+    if (p_tcb->PendOn == OS_TASK_PEND_ON_FLAG) {                /* Index the flags it waits on, see Note #3             */
+        OS_FlagSlotInsert(p_tcb);
+    }
+#endif
+
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)                           /* See Note #2                                          */
+    p_tcb_prev = (OS_TCB *)0;
+    prio_prev  = OS_PendListPrioPrev(p_pend_list, prio);        /* Lowest priority waiting at or above the task's       */
+    if (prio_prev != OS_PRIO_INIT) {
+        p_tcb_prev = p_pend_list->PrioTailPtr[prio_prev];       /* Insert after its last task                           */
+    }
+    if (prio_prev != prio) {
+        OS_PendListPrioInsert(p_pend_list, prio);               /* First task waiting at this priority                  */
+    }
+    p_pend_list->PrioTailPtr[prio] = p_tcb;
+    p_tcb->PendPrio                = prio;
+
+    if (p_tcb_prev == (OS_TCB *)0) {                            /* Highest priority task waiting?                       */
+        p_tcb_next           = p_pend_list->HeadPtr;            /* Yes, insert as new Head of list                      */
+        p_pend_list->HeadPtr = p_tcb;
+    } else {
+        p_tcb_next              = p_tcb_prev->PendNextPtr;      /* No,  insert after 'p_tcb_prev'                       */
+        p_tcb_prev->PendNextPtr = p_tcb;
+    }
+    p_tcb->PendPrevPtr = p_tcb_prev;
+    p_tcb->PendNextPtr = p_tcb_next;
+    if (p_tcb_next == (OS_TCB *)0) {                            /* Lowest priority task waiting?                        */
+        p_pend_list->TailPtr    = p_tcb;                        /* Yes, new Tail of list                                */
+    } else {
+        p_tcb_next->PendPrevPtr = p_tcb;
+    }
+#if (OS_CFG_DBG_EN > 0u)
+    p_pend_list->NbrEntries++;                                  /* One more OS_TCBs in the list                         */
+#endif
+#else
     if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* CASE 0: Insert when there are no entries             */
 #if (OS_CFG_DBG_EN > 0u)
         p_pend_list->NbrEntries = 1u;                           /* This is the first entry                              */
@@ -1358,6 +1451,7 @@ void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
             }
         }
     }
+#endif
 }
 
 
@@ -1414,11 +1508,31 @@ void  OS_PendListRemove (OS_TCB  *p_tcb)
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_next;
     OS_TCB        *p_prev;
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+    OS_PRIO        prio;
+#endif
 
 
     if (p_tcb->PendObjPtr != (OS_PEND_OBJ *)0) {                /* Only remove if object has a pend list.               */
         p_pend_list = &p_tcb->PendObjPtr->PendList;             /* Get pointer to pend list                             */
 
+#if (OS_CFG_FLAG_EN > 0u) && (OS_CFG_FLAG_INDEX_EN > 0u)
+        if (p_tcb->FlagsSlot != OS_FLAG_SLOT_NONE) {            /* Indexed by an event flag group?                      */
+            OS_FlagSlotRemove(p_tcb);
+        }
+#endif
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+        prio = p_tcb->PendPrio;                                 /* Priority it was inserted with, see 'os.h  PEND LIST' */
+        if (p_pend_list->PrioTailPtr[prio] == p_tcb) {          /* Last task waiting at its priority?                   */
+            p_prev = p_tcb->PendPrevPtr;
+            if ((p_prev           != (OS_TCB *)0) &&
+                (p_prev->PendPrio == prio)) {
+                p_pend_list->PrioTailPtr[prio] = p_prev;        /* No,  the one before it is the last now               */
+            } else {
+                OS_PendListPrioRemove(p_pend_list, prio);       /* Yes, no more tasks waiting at this priority          */
+            }
+        }
+#endif
                                                                 /* Remove TCB from the pend list.                       */
         if (p_pend_list->HeadPtr->PendNextPtr == (OS_TCB *)0) {
             p_pend_list->HeadPtr = (OS_TCB *)0;                 /* Only one entry in the pend list                      */
@@ -1555,6 +1669,65 @@ void  OS_Post (OS_PEND_OBJ  *p_obj,
 }
 
 
+/*
+************************************************************************************************************************
+*                                          POST TO ALL THE TASKS WAITING ON AN OBJECT
+*
+* Description: This function is called to post to all the tasks waiting on an object (OS_OPT_POST_ALL).  The whole pend
+*              list is detached in one step, then every task is readied in priority order, as OS_Post() would do one
+*              after the other.
+*
+* Arguments  : p_obj          Is a pointer to the object being posted to
+*              -----
+*
+*              p_void         If we are posting a message to the tasks, this is the message that they will receive
+*
+*              msg_size       If we are posting a message to the tasks, this is the size of the message
+*
+*              ts             The timestamp as to when the post occurred
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) This function is called with interrupts disabled and the caller runs the scheduler once after it,
+*                 whatever the number of tasks readied.
+*
+*              3) The pend list is emptied with OS_PendListInit() instead of removing the tasks one by one, so none of
+*                 them is unlinked from its neighbors nor, with OS_CFG_PEND_LIST_BITMAP_EN, taken out of the bitmap.
+************************************************************************************************************************
+*/
+
+void  OS_PostAll (OS_PEND_OBJ  *p_obj,
+                  void         *p_void,
+                  OS_MSG_SIZE   msg_size,
+                  CPU_TS        ts)
+{
+    OS_TCB  *p_tcb;
+    OS_TCB  *p_tcb_next;
+
+
+    p_tcb = p_obj->PendList.HeadPtr;
+    OS_PendListInit(&p_obj->PendList);                          /* Detach all the tasks waiting, see Note #3            */
+#if (OS_CFG_DBG_EN > 0u)
+    p_obj->DbgNamePtr = (CPU_CHAR *)((void *)" ");              /* No other task is pending on object                   */
+#endif
+
+    while (p_tcb != (OS_TCB *)0) {
+        p_tcb_next         = p_tcb->PendNextPtr;
+        p_tcb->PendNextPtr = (OS_TCB      *)0;
+        p_tcb->PendPrevPtr = (OS_TCB      *)0;
+        p_tcb->PendObjPtr  = (OS_PEND_OBJ *)0;
+        OS_Post((OS_PEND_OBJ *)0,                               /* Ready the task, no pend list to remove it from       */
+                p_tcb,
+                p_void,
+                msg_size,
+                ts);
+        p_tcb = p_tcb_next;
+    }
+}
+
+
 /*
 ************************************************************************************************************************
 *                                                    INITIALIZATION
@@ -1642,6 +1815,10 @@ void  OS_RdyListInsert (OS_TCB  *p_tcb)
         OS_RdyListInsertHead(p_tcb);                            /* No,  insert readied task at the beginning of the list*/
     }
 
+#if (OS_CFG_TASK_PROFILE_HIST_EN > 0u)
+    OS_TaskProfileRdy(p_tcb);                                   /* Start an activation of the task                      */
+#endif
+
     OS_TRACE_TASK_READY(p_tcb);
 }
 
@@ -2161,3 +2338,137 @@ void  OS_TaskBlock (OS_TCB   *p_tcb,
 #endif
     OS_RdyListRemove(p_tcb);
 }
+
+
+/*
+************************************************************************************************************************
+*                                      INSERT A PRIORITY IN THE BITMAP OF A PEND LIST
+*
+* Description: This function sets the bit of a priority in the bitmap of a pend list (see 'os.h  PEND LIST').
+*
+* Arguments  : p_pend_list   is a pointer to the pend list
+*
+*              prio          is the priority to insert
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+static  void  OS_PendListPrioInsert (OS_PEND_LIST  *p_pend_list,
+                                     OS_PRIO        prio)
+{
+    CPU_DATA  bit_nbr;
+    CPU_DATA  ix;
+
+
+    ix                        = (CPU_DATA)prio / (CPU_CFG_DATA_SIZE * 8u);
+    bit_nbr                   = (CPU_DATA)prio & ((CPU_CFG_DATA_SIZE * 8u) - 1u);
+    p_pend_list->PrioTbl[ix] |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr);
+#if (OS_PRIO_TBL_2LVL > 0u)
+    p_pend_list->PrioTblGrp  |= (CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - ix);
+#endif
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                   FIND THE PLACE OF A PRIORITY IN THE BITMAP OF A PEND LIST
+*
+* Description: This function returns the lowest priority waiting at or above a priority, the priority whose last task
+*              comes right before the tasks of a lower priority in the pend list (see 'os.h  PEND LIST').
+*
+* Arguments  : p_pend_list   is a pointer to the pend list
+*
+*              prio          is the priority
+*
+* Returns    : The largest priority number at most 'prio' in the bitmap, OS_PRIO_INIT if there is none.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The bit of priority 'n' is bit 'n' from the MSB, so the priorities at or above 'prio' in a word are its
+*                 bits from the MSB down to the bit of 'prio', and the largest of them is the lowest bit set, found by
+*                 counting trailing zeros.  The words before are searched the same way, through the summary word with
+*                 the two-level bitmap and one after the other otherwise.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+static  OS_PRIO  OS_PendListPrioPrev (OS_PEND_LIST  *p_pend_list,
+                                      OS_PRIO        prio)
+{
+    CPU_DATA  bit_nbr;
+    CPU_DATA  bits;
+    CPU_DATA  ix;
+
+
+    ix      = (CPU_DATA)prio / (CPU_CFG_DATA_SIZE * 8u);
+    bit_nbr = (CPU_DATA)prio & ((CPU_CFG_DATA_SIZE * 8u) - 1u);
+    bits    = p_pend_list->PrioTbl[ix] &                        /* Bits from the MSB to the bit of 'prio'               */
+              ~(((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr)) - 1u);
+
+    if (bits == 0u) {                                           /* None in this word, search the words before           */
+#if (OS_PRIO_TBL_2LVL > 0u)
+        if (ix == 0u) {
+            return (OS_PRIO_INIT);
+        }
+        bits = p_pend_list->PrioTblGrp &                        /* Words before 'ix' in the summary word                */
+               ~(((CPU_DATA)1u << ((CPU_CFG_DATA_SIZE * 8u) - ix)) - 1u);
+        if (bits == 0u) {
+            return (OS_PRIO_INIT);
+        }
+        ix   = ((CPU_CFG_DATA_SIZE * 8u) - 1u) - CPU_CntTrailZeros(bits);
+        bits = p_pend_list->PrioTbl[ix];
+#else
+        do {
+            if (ix == 0u) {
+                return (OS_PRIO_INIT);
+            }
+            ix--;
+            bits = p_pend_list->PrioTbl[ix];
+        } while (bits == 0u);
+#endif
+    }
+
+    return ((OS_PRIO)((ix * (CPU_CFG_DATA_SIZE * 8u)) + (((CPU_CFG_DATA_SIZE * 8u) - 1u) - CPU_CntTrailZeros(bits))));
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                     REMOVE A PRIORITY FROM THE BITMAP OF A PEND LIST
+*
+* Description: This function clears the bit of a priority in the bitmap of a pend list (see 'os.h  PEND LIST').
+*
+* Arguments  : p_pend_list   is a pointer to the pend list
+*
+*              prio          is the priority to remove
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+static  void  OS_PendListPrioRemove (OS_PEND_LIST  *p_pend_list,
+                                     OS_PRIO        prio)
+{
+    CPU_DATA  bit_nbr;
+    CPU_DATA  ix;
+
+
+    ix                        =   (CPU_DATA)prio / (CPU_CFG_DATA_SIZE * 8u);
+    bit_nbr                   =   (CPU_DATA)prio & ((CPU_CFG_DATA_SIZE * 8u) - 1u);
+    p_pend_list->PrioTbl[ix] &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - bit_nbr));
+#if (OS_PRIO_TBL_2LVL > 0u)
+    if (p_pend_list->PrioTbl[ix] == 0u) {                       /* Last priority of this word, clear its summary bit    */
+        p_pend_list->PrioTblGrp &= ~((CPU_DATA)1u << (((CPU_CFG_DATA_SIZE * 8u) - 1u) - ix));
+    }
+#endif
+}
+#endif
@@ -91,6 +91,10 @@ extern  "C" {
 *********************************************************************************************************
 */
 
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+extern  CPU_INT32U  SystemCoreClock;                            /* Core clock, from the CMSIS system file               */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -767,6 +771,57 @@ CPU_INT16S  CPU_IntSrcPrioGet (CPU_INT08U  pos)
     return (prio);
 }
 
+/*
+*********************************************************************************************************
+*                                          CPU_TS_TmrInit()
+*
+* Description : Initialize & start the CPU timestamp timer, the free running DWT cycle counter.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Called by CPU_Init(), see 'cpu_core.h  FUNCTION PROTOTYPES  CPU_TS_TmrInit()'.
+*
+*               (2) The timestamp frequency is the core clock when CPU_Init() is called.  An application
+*                   that changes the core clock afterwards calls CPU_TS_TmrInit() again, the counter is
+*                   not reset.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+void  CPU_TS_TmrInit (void)
+{
+    CPU_REG_DEMCR    |= CPU_REG_DEMCR_TRCENA;                   /* Enable the DWT ...                                   */
+    CPU_REG_DWT_CTRL |= CPU_REG_DWT_CTRL_CYCCNTENA;             /* ... & its cycle counter, see Note #2.                */
+
+    CPU_TS_TmrFreqSet((CPU_TS_TMR_FREQ)SystemCoreClock);        /* See Note #2.                                         */
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           CPU_TS_TmrRd()
+*
+* Description : Get current CPU timestamp timer count value.
+*
+* Argument(s) : none.
+*
+* Return(s)   : The DWT cycle counter, an 'up' counter wrapping on 32 bits.
+*
+* Note(s)     : (1) Called by OS_TS_GET(), see 'cpu_core.h  FUNCTION PROTOTYPES  CPU_TS_TmrRd()'.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+CPU_TS_TMR  CPU_TS_TmrRd (void)
+{
+    return ((CPU_TS_TMR)CPU_REG_DWT_CYCCNT);
+}
+#endif
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -33,6 +33,21 @@ const  CPU_CHAR  *os_flag__c = "$Id: $";
 
 #if (OS_CFG_FLAG_EN > 0u)
 
+/*
+************************************************************************************************************************
+*                                               LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_FlagTaskChk  (OS_FLAG_GRP  *p_grp,
+                                      OS_TCB       *p_tcb,
+                                      CPU_TS        ts);
+
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+static  void         OS_FlagSlotInit (OS_FLAG_GRP  *p_grp);
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                 CREATE AN EVENT FLAG
@@ -113,6 +128,9 @@ void  OSFlagCreate (OS_FLAG_GRP  *p_grp,
     p_grp->TS      = 0u;
 #endif
     OS_PendListInit(&p_grp->PendList);
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+    OS_FlagSlotInit(p_grp);
+#endif
 
 #if (OS_CFG_DBG_EN > 0u)
     OS_FlagDbgListAdd(p_grp);
@@ -457,6 +475,9 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
              if (flags_rdy == flags) {                          /* Must match ALL the bits that we want                 */
                  if (consume == OS_TRUE) {                      /* See if we need to consume the flags                  */
                      p_grp->Flags &= ~flags_rdy;                /* Clear ONLY the flags that we wanted                  */
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+                     p_grp->FlagsChg |= flags_rdy;              /* Check the waiters of these bits at the next post     */
+#endif
                  }
                  OSTCBCurPtr->FlagsRdy = flags_rdy;             /* Save flags that were ready                           */
 #if (OS_CFG_TS_EN > 0u)
@@ -499,6 +520,9 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
              if (flags_rdy != 0u) {                             /* See if any flag set                                  */
                  if (consume == OS_TRUE) {                      /* See if we need to consume the flags                  */
                      p_grp->Flags &= ~flags_rdy;                /* Clear ONLY the flags that we got                     */
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+                     p_grp->FlagsChg |= flags_rdy;              /* Check the waiters of these bits at the next post     */
+#endif
                  }
                  OSTCBCurPtr->FlagsRdy = flags_rdy;             /* Save flags that were ready                           */
 #if (OS_CFG_TS_EN > 0u)
@@ -540,6 +564,9 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
              if (flags_rdy == flags) {                          /* Must match ALL the bits that we want                 */
                  if (consume == OS_TRUE) {                      /* See if we need to consume the flags                  */
                      p_grp->Flags |= flags_rdy;                 /* Set ONLY the flags that we wanted                    */
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+                     p_grp->FlagsChg |= flags_rdy;              /* Check the waiters of these bits at the next post     */
+#endif
                  }
                  OSTCBCurPtr->FlagsRdy = flags_rdy;             /* Save flags that were ready                           */
 #if (OS_CFG_TS_EN > 0u)
@@ -580,6 +607,9 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
              if (flags_rdy != 0u) {                             /* See if any flag cleared                              */
                  if (consume == OS_TRUE) {                      /* See if we need to consume the flags                  */
                      p_grp->Flags |= flags_rdy;                 /* Set ONLY the flags that we got                       */
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+                     p_grp->FlagsChg |= flags_rdy;              /* Check the waiters of these bits at the next post     */
+#endif
                  }
                  OSTCBCurPtr->FlagsRdy = flags_rdy;             /* Save flags that were ready                           */
 #if (OS_CFG_TS_EN > 0u)
@@ -688,12 +718,18 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
             case OS_OPT_PEND_FLAG_SET_ALL:
             case OS_OPT_PEND_FLAG_SET_ANY:                      /* Clear ONLY the flags we got                          */
                  p_grp->Flags &= ~flags_rdy;
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+                 p_grp->FlagsChg |= flags_rdy;
+#endif
                  break;
 
 #if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
             case OS_OPT_PEND_FLAG_CLR_ALL:
             case OS_OPT_PEND_FLAG_CLR_ANY:                      /* Set   ONLY the flags we got                          */
                  p_grp->Flags |=  flags_rdy;
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+                 p_grp->FlagsChg |= flags_rdy;
+#endif
                  break;
 #endif
             default:
@@ -934,6 +970,11 @@ OS_FLAGS  OSFlagPendGetFlagsRdy (OS_ERR  *p_err)
 * Returns    : the new value of the event flags bits that are still set.
 *
 * Note(s)    : 1) The execution time of this function depends on the number of tasks waiting on the event flag group.
+*
+*              2) With OS_CFG_FLAG_INDEX_EN, only the tasks waiting on a flag which changed, by this post or consumed
+*                 since the previous one, are checked (see 'os.h  EVENT FLAGS').  The other tasks waiting cannot be
+*                 ready since they were last checked.  The tasks made ready are inserted in the ready list in the
+*                 order of their slots, which only matters to tasks of the same priority.
 ************************************************************************************************************************
 */
 
@@ -944,11 +985,15 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
 {
 
     OS_FLAGS       flags_cur;
-    OS_FLAGS       flags_rdy;
-    OS_OPT         mode;
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
     OS_TCB        *p_tcb_next;
+    CPU_BOOLEAN    valid;
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+    OS_FLAGS       flags_chg;
+    CPU_DATA       slots;
+    CPU_DATA       bit;
+#endif
     CPU_TS         ts;
     CPU_SR_ALLOC();
 
@@ -1000,12 +1045,18 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
         case OS_OPT_POST_FLAG_SET:
         case OS_OPT_POST_FLAG_SET | OS_OPT_POST_NO_SCHED:
              CPU_CRITICAL_ENTER();
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+             flags_chg     =  flags & ~p_grp->Flags;            /* Flags which change                                   */
+#endif
              p_grp->Flags |=  flags;                            /* Set   the flags specified in the group               */
              break;
 
         case OS_OPT_POST_FLAG_CLR:
         case OS_OPT_POST_FLAG_CLR | OS_OPT_POST_NO_SCHED:
              CPU_CRITICAL_ENTER();
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+             flags_chg     =  flags &  p_grp->Flags;            /* Flags which change                                   */
+#endif
              p_grp->Flags &= ~flags;                            /* Clear the flags specified in the group               */
              break;
 
@@ -1016,6 +1067,10 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
     }
 #if (OS_CFG_TS_EN > 0u)
     p_grp->TS   = ts;
+#endif
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+    flags_chg      |= p_grp->FlagsChg;                          /* With the flags consumed since the last post          */
+    p_grp->FlagsChg = 0u;
 #endif
     p_pend_list = &p_grp->PendList;
     if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on event flag group?                */
@@ -1025,56 +1080,39 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
         return (p_grp->Flags);
     }
 
+    valid = OS_TRUE;
     p_tcb = p_pend_list->HeadPtr;
-    while (p_tcb != (OS_TCB *)0) {                              /* Go through all tasks waiting on event flag(s)        */
-        p_tcb_next = p_tcb->PendNextPtr;
-        mode       = p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK;
-        switch (mode) {
-            case OS_OPT_PEND_FLAG_SET_ALL:                      /* See if all req. flags are set for current node       */
-                 flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy == p_tcb->FlagsPend) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
-
-            case OS_OPT_PEND_FLAG_SET_ANY:                      /* See if any flag set                                  */
-                 flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy != 0u) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
-
-#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
-            case OS_OPT_PEND_FLAG_CLR_ALL:                      /* See if all req. flags are set for current node       */
-                 flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy == p_tcb->FlagsPend) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
-
-            case OS_OPT_PEND_FLAG_CLR_ANY:                      /* See if any flag set                                  */
-                 flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy != 0u) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+    if (p_grp->SlotFullCtr == 0u) {                             /* All the tasks waiting in the index?                  */
+        slots = 0u;                                             /* Yes, see Note #2                                     */
+        while (flags_chg != 0u) {                               /* Slots of the tasks waiting on the flags changed      */
+            bit        = CPU_CntTrailZeros((CPU_DATA)flags_chg);
+            flags_chg &= flags_chg - 1u;
+            slots     |= p_grp->SlotTbl[bit];
+        }
+        slots &= p_grp->SlotUsed;                               /* Only the slots in use, see 'os.h  EVENT FLAGS'       */
+        while ((slots != 0u) && (valid == OS_TRUE)) {           /* Check only these tasks                               */
+            bit    = CPU_CntTrailZeros(slots);
+            slots &= slots - 1u;
+            valid  = OS_FlagTaskChk(p_grp,
+                                    p_grp->SlotTCBPtr[bit],
                                     ts);
-                 }
-                 break;
-#endif
-            default:
-                 CPU_CRITICAL_EXIT();
-                *p_err = OS_ERR_FLAG_PEND_OPT;
-                 OS_TRACE_FLAG_POST_EXIT(*p_err);
-                 return (0u);
         }
-                                                                /* Point to next task waiting for event flag(s)         */
-        p_tcb = p_tcb_next;
+        p_tcb = (OS_TCB *)0;                                    /* ... instead of walking the pend list                 */
+    }
+#endif
+    while ((p_tcb != (OS_TCB *)0) && (valid == OS_TRUE)) {      /* Go through all tasks waiting on event flag(s)        */
+        p_tcb_next = p_tcb->PendNextPtr;
+        valid      = OS_FlagTaskChk(p_grp,
+                                    p_tcb,
+                                    ts);
+        p_tcb      = p_tcb_next;                                /* Point to next task waiting for event flag(s)         */
+    }
+    if (valid == OS_FALSE) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_FLAG_PEND_OPT;
+        OS_TRACE_FLAG_POST_EXIT(*p_err);
+        return (0u);
     }
     CPU_CRITICAL_EXIT();
 
@@ -1171,6 +1209,9 @@ void  OS_FlagClr (OS_FLAG_GRP  *p_grp)
     p_grp->Flags            =  0u;
     p_pend_list             = &p_grp->PendList;
     OS_PendListInit(p_pend_list);
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+    OS_FlagSlotInit(p_grp);
+#endif
 }
 
 
@@ -1295,4 +1336,198 @@ void   OS_FlagTaskRdy (OS_TCB    *p_tcb,
     }
     OS_PendListRemove(p_tcb);
 }
+
+/*
+************************************************************************************************************************
+*                                     CHECK IF A TASK WAITING ON AN EVENT FLAG GROUP IS READY
+*
+* Description: This function is called by OSFlagPost() to make a task waiting on the group ready-to-run if the flags it
+*              waits for are now set (or cleared).
+*
+* Arguments  : p_grp         is a pointer to the event flag group
+*
+*              p_tcb         is a pointer to the OS_TCB of the task waiting on the group
+*
+*              ts            is a timestamp associated with the post
+*
+* Returns    : OS_TRUE       if the task waits with a valid option, readied or not
+*              OS_FALSE      otherwise
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) This function assumes that interrupts are disabled.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_FlagTaskChk (OS_FLAG_GRP  *p_grp,
+                                     OS_TCB       *p_tcb,
+                                     CPU_TS        ts)
+{
+    OS_FLAGS  flags_rdy;
+    OS_OPT    mode;
+
+
+    mode = p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK;
+    switch (mode) {
+        case OS_OPT_PEND_FLAG_SET_ALL:                          /* See if all req. flags are set for current node       */
+             flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
+             if (flags_rdy == p_tcb->FlagsPend) {
+                 OS_FlagTaskRdy(p_tcb,                          /* Make task RTR, event(s) Rx'd                         */
+                                flags_rdy,
+                                ts);
+             }
+             break;
+
+        case OS_OPT_PEND_FLAG_SET_ANY:                          /* See if any flag set                                  */
+             flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
+             if (flags_rdy != 0u) {
+                 OS_FlagTaskRdy(p_tcb,                          /* Make task RTR, event(s) Rx'd                         */
+                                flags_rdy,
+                                ts);
+             }
+             break;
+
+#if (OS_CFG_FLAG_MODE_CLR_EN > 0u)
+        case OS_OPT_PEND_FLAG_CLR_ALL:                          /* See if all req. flags are set for current node       */
+             flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
+             if (flags_rdy == p_tcb->FlagsPend) {
+                 OS_FlagTaskRdy(p_tcb,                          /* Make task RTR, event(s) Rx'd                         */
+                                flags_rdy,
+                                ts);
+             }
+             break;
+
+        case OS_OPT_PEND_FLAG_CLR_ANY:                          /* See if any flag set                                  */
+             flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
+             if (flags_rdy != 0u) {
+                 OS_FlagTaskRdy(p_tcb,                          /* Make task RTR, event(s) Rx'd                         */
+                                flags_rdy,
+                                ts);
+             }
+             break;
+#endif
+        default:
+             return (OS_FALSE);
+    }
+    return (OS_TRUE);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          INITIALIZE THE WAITER INDEX OF A GROUP
+*
+* Description: This function is called by OSFlagCreate() and OS_FlagClr() to empty the index of the tasks waiting on
+*              each flag of the group (see 'os.h  EVENT FLAGS' Note #2).
+*
+* Arguments  : p_grp         is a pointer to the event flag group
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+static  void  OS_FlagSlotInit (OS_FLAG_GRP  *p_grp)
+{
+    CPU_DATA  bit;
+    CPU_DATA  slot;
+
+
+    p_grp->FlagsChg    = 0u;
+    p_grp->SlotUsed    = 0u;
+    p_grp->SlotFullCtr = 0u;
+    for (bit = 0u; bit < OS_FLAG_BITS; bit++) {
+        p_grp->SlotTbl[bit] = 0u;
+    }
+    for (slot = 0u; slot < OS_FLAG_SLOTS; slot++) {
+        p_grp->SlotFlags[slot] = 0u;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                        ADD A TASK TO THE WAITER INDEX OF A GROUP
+*
+* Description: This function is called by OS_PendListInsertPrio() when a task starts waiting on an event flag group.  It
+*              gives the task a free slot of the group and records the slot for each flag the task waits on.
+*
+* Arguments  : p_tcb         is a pointer to the OS_TCB of the task, with 'PendObjPtr' and 'FlagsPend' set
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) When all the slots are taken, the task is only counted in 'SlotFullCtr' and OSFlagPost() walks the
+*                 pend list until it leaves.
+*
+*              3) Only the bits of the flags which differ from those of the previous task in the slot are updated in
+*                 'SlotTbl[]' (see OS_FlagSlotRemove()).
+************************************************************************************************************************
+*/
+
+void  OS_FlagSlotInsert (OS_TCB  *p_tcb)
+{
+    OS_FLAG_GRP  *p_grp;
+    OS_FLAGS      flags;
+    CPU_DATA      slot_free;
+    CPU_DATA      slot;
+    CPU_DATA      bit;
+
+
+    p_grp     = (OS_FLAG_GRP *)((void *)p_tcb->PendObjPtr);
+    slot_free = ~p_grp->SlotUsed;
+    if (slot_free == 0u) {                                      /* See Note #2                                          */
+        p_tcb->FlagsSlot = OS_FLAG_SLOT_FULL;
+        p_grp->SlotFullCtr++;
+        return;
+    }
+    slot                     = CPU_CntTrailZeros(slot_free);
+    p_grp->SlotUsed         |= (CPU_DATA)1u << slot;
+    p_grp->SlotTCBPtr[slot]  = p_tcb;
+    flags                    = p_grp->SlotFlags[slot] ^ p_tcb->FlagsPend;
+    while (flags != 0u) {                                       /* Update the flags which differ from the previous task */
+        bit                  = CPU_CntTrailZeros((CPU_DATA)flags);
+        flags               &= flags - 1u;
+        p_grp->SlotTbl[bit] ^= (CPU_DATA)1u << slot;
+    }
+    p_grp->SlotFlags[slot]   = p_tcb->FlagsPend;
+    p_tcb->FlagsSlot = (CPU_INT08U)slot;
+}
+
+
+/*
+************************************************************************************************************************
+*                                     REMOVE A TASK FROM THE WAITER INDEX OF A GROUP
+*
+* Description: This function is called by OS_PendListRemove() when a task stops waiting on an event flag group, readied,
+*              timed out, aborted or deleted.  It frees the slot of the task.
+*
+* Arguments  : p_tcb         is a pointer to the OS_TCB of the task, with 'PendObjPtr' still set
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) The bits of the slot in 'SlotTbl[]' are masked by 'SlotUsed' until OS_FlagSlotInsert() gives the
+*                 slot to another task, so readying a task takes the same time whatever the flags it waits on.
+************************************************************************************************************************
+*/
+
+void  OS_FlagSlotRemove (OS_TCB  *p_tcb)
+{
+    OS_FLAG_GRP  *p_grp;
+
+
+    p_grp = (OS_FLAG_GRP *)((void *)p_tcb->PendObjPtr);
+    if (p_tcb->FlagsSlot == OS_FLAG_SLOT_FULL) {
+        p_grp->SlotFullCtr--;
+    } else {                                                    /* 'SlotTbl[]' is left to the next task, see Note #2    */
+        p_grp->SlotUsed &= ~((CPU_DATA)1u << p_tcb->FlagsSlot);
+    }
+    p_tcb->FlagsSlot = OS_FLAG_SLOT_NONE;
+}
+#endif
 #endif
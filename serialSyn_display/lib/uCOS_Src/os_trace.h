@@ -209,6 +209,42 @@
 #define  OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb, prio)
 #endif
 
+#ifndef  OS_TRACE_RWLOCK_CREATE
+#define  OS_TRACE_RWLOCK_CREATE(p_lock, p_name)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_DEL
+#define  OS_TRACE_RWLOCK_DEL(p_lock)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_POST
+#define  OS_TRACE_RWLOCK_POST(p_lock)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_POST_FAILED
+#define  OS_TRACE_RWLOCK_POST_FAILED(p_lock)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_PEND
+#define  OS_TRACE_RWLOCK_PEND(p_lock)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_PEND_FAILED
+#define  OS_TRACE_RWLOCK_PEND_FAILED(p_lock)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_PEND_BLOCK
+#define  OS_TRACE_RWLOCK_PEND_BLOCK(p_lock)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_TASK_PRIO_INHERIT
+#define  OS_TRACE_RWLOCK_TASK_PRIO_INHERIT(p_tcb, prio)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_TASK_PRIO_DISINHERIT
+#define  OS_TRACE_RWLOCK_TASK_PRIO_DISINHERIT(p_tcb, prio)
+#endif
+
 #ifndef  OS_TRACE_SEM_CREATE
 #define  OS_TRACE_SEM_CREATE(p_sem, p_name)
 #endif
@@ -349,6 +385,22 @@
 #define  OS_TRACE_TASK_SUSPEND_ENTER(p_tcb)
 #endif
 
+#ifndef  OS_TRACE_RWLOCK_DEL_ENTER
+#define  OS_TRACE_RWLOCK_DEL_ENTER(p_lock, opt)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_POST_ENTER
+#define  OS_TRACE_RWLOCK_POST_ENTER(p_lock, opt)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_RD_PEND_ENTER
+#define  OS_TRACE_RWLOCK_RD_PEND_ENTER(p_lock, timeout, opt, p_ts)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_WR_PEND_ENTER
+#define  OS_TRACE_RWLOCK_WR_PEND_ENTER(p_lock, timeout, opt, p_ts)
+#endif
+
 #ifndef  OS_TRACE_SEM_DEL_ENTER
 #define  OS_TRACE_SEM_DEL_ENTER(p_sem, opt)
 #endif
@@ -429,6 +481,22 @@
 #define  OS_TRACE_TASK_SUSPEND_EXIT(RetVal)
 #endif
 
+#ifndef  OS_TRACE_RWLOCK_DEL_EXIT
+#define  OS_TRACE_RWLOCK_DEL_EXIT(RetVal)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_POST_EXIT
+#define  OS_TRACE_RWLOCK_POST_EXIT(RetVal)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_RD_PEND_EXIT
+#define  OS_TRACE_RWLOCK_RD_PEND_EXIT(RetVal)
+#endif
+
+#ifndef  OS_TRACE_RWLOCK_WR_PEND_EXIT
+#define  OS_TRACE_RWLOCK_WR_PEND_EXIT(RetVal)
+#endif
+
 #ifndef  OS_TRACE_SEM_DEL_EXIT
 #define  OS_TRACE_SEM_DEL_EXIT(RetVal)
 #endif
@@ -78,6 +78,8 @@ int main(void)
 {
     OS_ERR err;
 
+    CPU_Init(); //Timestamp timer of OS_TS_GET(), before the kernel uses it
+
     OSInit(&err);
 
     OSSemCreate((OS_SEM *)&rxSem,
@@ -115,6 +117,7 @@ static void AppTaskStart(void *p_arg)
     HAL_Init();  
 
     SystemClock_Config();
+    CPU_TS_TmrInit(); //Timestamps count at the new core clock
 
     BSP_LED_Init(LED3);
     BSP_LED_Init(LED4);
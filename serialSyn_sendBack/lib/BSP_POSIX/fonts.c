@@ -0,0 +1,19 @@
+/**
+  ******************************************************************************
+  * @file    fonts.c
+  * @brief   Host (POSIX) stand-in for the STM32 Utilities fonts. The glyph
+  *          tables are not shipped, the metrics match the board fonts.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+#include <stddef.h>
+
+/* Exported variables --------------------------------------------------------*/
+sFONT Font24 = {NULL, 17, 24};
+sFONT Font20 = {NULL, 14, 20};
+sFONT Font16 = {NULL, 11, 16};
+sFONT Font12 = {NULL, 7, 12};
+sFONT Font8 = {NULL, 5, 8};
@@ -0,0 +1,110 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery_lcd.h
+  * @brief   Host (POSIX) stand-in for the STM32F429I-Discovery LCD. Drawing
+  *          goes to host memory framebuffers in the layer pixel format of the
+  *          board (ARGB8888), so screen contents can be inspected and compared.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F429I_DISCOVERY_LCD_H
+#define __STM32F429I_DISCOVERY_LCD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f429i_discovery.h"
+#include "fonts.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  CENTER_MODE             = 0x01,
+  RIGHT_MODE              = 0x02,
+  LEFT_MODE               = 0x03
+} Text_AlignModeTypdef;
+
+/* Exported constants --------------------------------------------------------*/
+#define LCD_OK                 0x00
+#define LCD_ERROR              0x01
+#define LCD_TIMEOUT            0x02
+
+#define LCD_PIXEL_WIDTH        ((uint16_t)240)
+#define LCD_PIXEL_HEIGHT       ((uint16_t)320)
+
+#define MAX_LAYER_NUMBER       2
+#define LCD_BACKGROUND_LAYER   0x0000
+#define LCD_FOREGROUND_LAYER   0x0001
+
+/* Board SDRAM addresses, mapped to host framebuffers */
+#define LCD_FRAME_BUFFER       ((uint32_t)0xD0000000)
+#define BUFFER_OFFSET          ((uint32_t)0x50000)
+
+#define LCD_COLOR_BLUE          0xFF0000FF
+#define LCD_COLOR_GREEN         0xFF00FF00
+#define LCD_COLOR_RED           0xFFFF0000
+#define LCD_COLOR_CYAN          0xFF00FFFF
+#define LCD_COLOR_MAGENTA       0xFFFF00FF
+#define LCD_COLOR_YELLOW        0xFFFFFF00
+#define LCD_COLOR_LIGHTBLUE     0xFF8080FF
+#define LCD_COLOR_LIGHTGREEN    0xFF80FF80
+#define LCD_COLOR_LIGHTRED      0xFFFF8080
+#define LCD_COLOR_WHITE         0xFFFFFFFF
+#define LCD_COLOR_LIGHTGRAY     0xFFD3D3D3
+#define LCD_COLOR_GRAY          0xFF808080
+#define LCD_COLOR_DARKGRAY      0xFF404040
+#define LCD_COLOR_BLACK         0xFF000000
+#define LCD_COLOR_BROWN         0xFFA52A2A
+#define LCD_COLOR_ORANGE        0xFFFFA500
+#define LCD_COLOR_TRANSPARENT   0xFF000000
+
+/* Exported functions --------------------------------------------------------*/
+uint8_t  BSP_LCD_Init(void);
+uint32_t BSP_LCD_GetXSize(void);
+uint32_t BSP_LCD_GetYSize(void);
+
+void     BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FrameBuffer);
+void     BSP_LCD_SetTransparency(uint32_t LayerIndex, uint8_t Transparency);
+void     BSP_LCD_SetLayerAddress(uint32_t LayerIndex, uint32_t Address);
+void     BSP_LCD_SetLayerVisible(uint32_t LayerIndex, FunctionalState state);
+void     BSP_LCD_SelectLayer(uint32_t LayerIndex);
+
+void     BSP_LCD_SetTextColor(uint32_t Color);
+uint32_t BSP_LCD_GetTextColor(void);
+void     BSP_LCD_SetBackColor(uint32_t Color);
+uint32_t BSP_LCD_GetBackColor(void);
+void     BSP_LCD_SetFont(sFONT *pFonts);
+sFONT   *BSP_LCD_GetFont(void);
+
+uint32_t BSP_LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos);
+void     BSP_LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t pixel);
+void     BSP_LCD_Clear(uint32_t Color);
+void     BSP_LCD_ClearStringLine(uint32_t Line);
+void     BSP_LCD_DisplayStringAtLine(uint16_t Line, uint8_t *ptr);
+void     BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_AlignModeTypdef Mode);
+void     BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii);
+
+void     BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length);
+void     BSP_LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length);
+void     BSP_LCD_DrawLine(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2);
+void     BSP_LCD_DrawRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void     BSP_LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
+void     BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void     BSP_LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
+
+void     BSP_LCD_DisplayOff(void);
+void     BSP_LCD_DisplayOn(void);
+
+/* Host only: framebuffer backing a board address, NULL if out of the LCD SDRAM area */
+uint32_t *BSP_POSIX_LCD_FrameBufferGet(uint32_t Address);
+/* Host only: framebuffer shown on the panel by the LTDC layers in use */
+uint32_t *BSP_POSIX_LCD_ScanOut(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F429I_DISCOVERY_LCD_H */
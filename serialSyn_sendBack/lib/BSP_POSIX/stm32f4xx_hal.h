@@ -0,0 +1,345 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal.h
+  * @brief   Host (POSIX) stand-in for the subset of the STM32F4 HAL used by the
+  *          applications. Selected by the [env:native] PlatformIO environment.
+  *
+  *          Peripherals without a host equivalent (RCC, PWR, FLASH, GPIO) accept
+  *          their configuration and do nothing. USART1 transmits to stdout and
+  *          receives from stdin, raising its interrupt through the POSIX port
+  *          (see os_cpu.h, OS_CPU_IntSrcRaise()). The LTDC registers of the
+  *          layer reload and the line interrupt are emulated at 60 frames per
+  *          second once LTDC_IRQn is enabled. The EXTI pending register of the
+  *          lines 10 to 15 is set by the host devices (HAL_POSIX_EXTI_Raise(),
+  *          e.g. the touch screen controller) and raises EXTI15_10_IRQn.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_HAL_H
+#define __STM32F4xx_HAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+  RESET = 0U,
+  SET = !RESET
+} FlagStatus, ITStatus;
+
+typedef enum
+{
+  DISABLE = 0U,
+  ENABLE = !DISABLE
+} FunctionalState;
+
+typedef enum
+{
+  USART1_IRQn     = 37,
+  EXTI15_10_IRQn  = 40,
+  LTDC_IRQn       = 88
+} IRQn_Type;
+
+#define __IO volatile
+
+/* GPIO ----------------------------------------------------------------------*/
+typedef struct
+{
+  __IO uint32_t MODER;
+  __IO uint32_t ODR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+  uint32_t Pin;
+  uint32_t Mode;
+  uint32_t Pull;
+  uint32_t Speed;
+  uint32_t Alternate;
+} GPIO_InitTypeDef;
+
+typedef enum
+{
+  GPIO_PIN_RESET = 0,
+  GPIO_PIN_SET
+} GPIO_PinState;
+
+extern GPIO_TypeDef HAL_POSIX_GPIOA;
+#define GPIOA                       (&HAL_POSIX_GPIOA)
+
+#define GPIO_PIN_0                  ((uint16_t)0x0001)
+#define GPIO_PIN_1                  ((uint16_t)0x0002)
+#define GPIO_PIN_2                  ((uint16_t)0x0004)
+#define GPIO_PIN_3                  ((uint16_t)0x0008)
+#define GPIO_PIN_4                  ((uint16_t)0x0010)
+#define GPIO_PIN_5                  ((uint16_t)0x0020)
+#define GPIO_PIN_6                  ((uint16_t)0x0040)
+#define GPIO_PIN_7                  ((uint16_t)0x0080)
+#define GPIO_PIN_8                  ((uint16_t)0x0100)
+#define GPIO_PIN_9                  ((uint16_t)0x0200)
+#define GPIO_PIN_10                 ((uint16_t)0x0400)
+#define GPIO_PIN_13                 ((uint16_t)0x2000)
+#define GPIO_PIN_14                 ((uint16_t)0x4000)
+#define GPIO_PIN_15                 ((uint16_t)0x8000)
+
+#define GPIO_MODE_OUTPUT_PP         0x00000001U
+#define GPIO_MODE_IT_FALLING        0x10210000U
+#define GPIO_MODE_AF_PP             0x00000002U
+#define GPIO_NOPULL                 0x00000000U
+#define GPIO_PULLUP                 0x00000001U
+#define GPIO_SPEED_FREQ_LOW         0x00000000U
+#define GPIO_SPEED_FREQ_VERY_HIGH   0x00000003U
+#define GPIO_AF7_USART1             ((uint8_t)0x07)
+
+/* EXTI ----------------------------------------------------------------------*/
+typedef struct
+{
+  __IO uint32_t IMR;
+  __IO uint32_t EMR;
+  __IO uint32_t RTSR;
+  __IO uint32_t FTSR;
+  __IO uint32_t SWIER;
+  __IO uint32_t PR;                               /* Pending lines, set by HAL_POSIX_EXTI_Raise() */
+} EXTI_TypeDef;
+
+extern EXTI_TypeDef HAL_POSIX_EXTI;
+#define EXTI                        (&HAL_POSIX_EXTI)
+
+/* PR is write 1 to clear, atomic against the device threads setting it */
+#define __HAL_GPIO_EXTI_GET_IT(__EXTI_LINE__)    (EXTI->PR & (__EXTI_LINE__))
+#define __HAL_GPIO_EXTI_CLEAR_IT(__EXTI_LINE__)  ((void)__atomic_fetch_and(&EXTI->PR, ~(uint32_t)(__EXTI_LINE__), __ATOMIC_SEQ_CST))
+
+/* RCC / PWR / FLASH ---------------------------------------------------------*/
+typedef struct
+{
+  uint32_t PLLState;
+  uint32_t PLLSource;
+  uint32_t PLLM;
+  uint32_t PLLN;
+  uint32_t PLLP;
+  uint32_t PLLQ;
+} RCC_PLLInitTypeDef;
+
+typedef struct
+{
+  uint32_t OscillatorType;
+  uint32_t HSEState;
+  uint32_t LSEState;
+  uint32_t HSIState;
+  uint32_t HSICalibrationValue;
+  uint32_t LSIState;
+  RCC_PLLInitTypeDef PLL;
+} RCC_OscInitTypeDef;
+
+typedef struct
+{
+  uint32_t ClockType;
+  uint32_t SYSCLKSource;
+  uint32_t AHBCLKDivider;
+  uint32_t APB1CLKDivider;
+  uint32_t APB2CLKDivider;
+} RCC_ClkInitTypeDef;
+
+typedef struct
+{
+  uint32_t PLLSAIN;
+  uint32_t PLLSAIQ;
+  uint32_t PLLSAIR;
+} RCC_PLLSAIInitTypeDef;
+
+typedef struct
+{
+  uint32_t PeriphClockSelection;
+  RCC_PLLSAIInitTypeDef PLLSAI;
+  uint32_t PLLSAIDivQ;
+  uint32_t PLLSAIDivR;
+} RCC_PeriphCLKInitTypeDef;
+
+#define RCC_OSCILLATORTYPE_HSI      0x00000002U
+#define RCC_HSI_ON                  ((uint8_t)0x01)
+#define RCC_HSICALIBRATION_DEFAULT  0x10U
+#define RCC_PLL_ON                  ((uint8_t)0x02)
+#define RCC_PLLSOURCE_HSI           0x00000000U
+#define RCC_PLLP_DIV2               0x00000002U
+#define RCC_CLOCKTYPE_SYSCLK        0x00000001U
+#define RCC_CLOCKTYPE_HCLK          0x00000002U
+#define RCC_CLOCKTYPE_PCLK1         0x00000004U
+#define RCC_CLOCKTYPE_PCLK2         0x00000008U
+#define RCC_SYSCLKSOURCE_PLLCLK     0x00000002U
+#define RCC_SYSCLK_DIV1             0x00000000U
+#define RCC_HCLK_DIV2               0x00001000U
+#define RCC_HCLK_DIV4               0x00001400U
+#define RCC_PERIPHCLK_LTDC          0x00000008U
+#define RCC_PLLSAIDIVR_2            0x00000000U
+#define PWR_REGULATOR_VOLTAGE_SCALE1  0x0000C000U
+#define FLASH_LATENCY_5             0x00000005U
+
+#define __HAL_RCC_GPIOA_CLK_ENABLE()          do { } while (0)
+#define __HAL_RCC_USART1_CLK_ENABLE()         do { } while (0)
+#define __HAL_RCC_PWR_CLK_ENABLE()            do { } while (0)
+#define __HAL_PWR_VOLTAGESCALING_CONFIG(__REGULATOR__)  do { (void)(__REGULATOR__); } while (0)
+
+/* UART ----------------------------------------------------------------------*/
+typedef struct
+{
+  __IO uint32_t SR;
+  __IO uint32_t DR;
+  __IO uint32_t BRR;
+  __IO uint32_t CR1;
+  __IO uint32_t CR2;
+  __IO uint32_t CR3;
+  __IO uint32_t GTPR;
+} USART_TypeDef;
+
+typedef struct
+{
+  uint32_t BaudRate;
+  uint32_t WordLength;
+  uint32_t StopBits;
+  uint32_t Parity;
+  uint32_t Mode;
+  uint32_t HwFlowCtl;
+  uint32_t OverSampling;
+} UART_InitTypeDef;
+
+typedef enum
+{
+  HAL_UART_STATE_RESET      = 0x00U,
+  HAL_UART_STATE_READY      = 0x20U,
+  HAL_UART_STATE_BUSY       = 0x24U,
+  HAL_UART_STATE_BUSY_TX    = 0x21U,
+  HAL_UART_STATE_BUSY_RX    = 0x22U
+} HAL_UART_StateTypeDef;
+
+typedef struct __UART_HandleTypeDef
+{
+  USART_TypeDef                 *Instance;
+  UART_InitTypeDef              Init;
+  uint8_t                       *pTxBuffPtr;
+  uint16_t                      TxXferSize;
+  __IO uint16_t                 TxXferCount;
+  uint8_t                       *pRxBuffPtr;
+  uint16_t                      RxXferSize;
+  __IO uint16_t                 RxXferCount;
+  __IO HAL_UART_StateTypeDef    gState;
+  __IO HAL_UART_StateTypeDef    RxState;
+  __IO uint32_t                 ErrorCode;
+} UART_HandleTypeDef;
+
+extern USART_TypeDef HAL_POSIX_USART1;
+#define USART1                      (&HAL_POSIX_USART1)
+
+#define USART_SR_RXNE               0x00000020U
+#define USART_SR_IDLE               0x00000010U
+#define USART_CR1_IDLEIE            0x00000010U
+#define USART_CR1_RXNEIE            0x00000020U
+
+#define UART_WORDLENGTH_8B          0x00000000U
+#define UART_STOPBITS_1             0x00000000U
+#define UART_PARITY_NONE            0x00000000U
+#define UART_MODE_TX_RX             0x0000000CU
+#define UART_HWCONTROL_NONE         0x00000000U
+#define UART_OVERSAMPLING_16        0x00000000U
+#define UART_IT_IDLE                USART_CR1_IDLEIE
+
+#define __HAL_UART_ENABLE_IT(__HANDLE__, __INTERRUPT__)   ((__HANDLE__)->Instance->CR1 |= (__INTERRUPT__))
+#define __HAL_UART_DISABLE_IT(__HANDLE__, __INTERRUPT__)  ((__HANDLE__)->Instance->CR1 &= ~(__INTERRUPT__))
+#define __HAL_UART_CLEAR_IDLEFLAG(__HANDLE__)             ((__HANDLE__)->Instance->SR &= ~USART_SR_IDLE)
+
+/* LTDC ----------------------------------------------------------------------*/
+typedef struct
+{
+  __IO uint32_t AWCR;
+  __IO uint32_t SRCR;
+  __IO uint32_t IER;
+  __IO uint32_t ISR;
+  __IO uint32_t ICR;
+  __IO uint32_t LIPCR;
+} LTDC_TypeDef;
+
+typedef struct
+{
+  __IO uint32_t CR;
+  __IO uint32_t CFBAR;
+} LTDC_Layer_TypeDef;
+
+extern LTDC_TypeDef       HAL_POSIX_LTDC;
+extern LTDC_Layer_TypeDef HAL_POSIX_LTDC_Layer[2];        /* Shadow registers, written by the software */
+extern LTDC_Layer_TypeDef HAL_POSIX_LTDC_LayerActive[2];  /* Registers in use, scanned out */
+#define LTDC                        (&HAL_POSIX_LTDC)
+#define LTDC_Layer1                 (&HAL_POSIX_LTDC_Layer[0])
+#define LTDC_Layer2                 (&HAL_POSIX_LTDC_Layer[1])
+
+#define LTDC_AWCR_AAH               0x000007FFU
+#define LTDC_SRCR_IMR               0x00000001U
+#define LTDC_SRCR_VBR               0x00000002U
+#define LTDC_IER_LIE                0x00000001U
+#define LTDC_ISR_LIF                0x00000001U
+#define LTDC_ICR_CLIF               0x00000001U
+#define LTDC_LxCR_LEN               0x00000001U
+
+#define READ_REG(REG)               ((REG))
+#define WRITE_REG(REG, VAL)         ((REG) = (VAL))
+#define SET_BIT(REG, BIT)           ((REG) |= (BIT))
+#define CLEAR_BIT(REG, BIT)         ((REG) &= ~(BIT))
+
+#define HAL_MAX_DELAY               0xFFFFFFFFU
+
+/* Exported functions --------------------------------------------------------*/
+HAL_StatusTypeDef HAL_Init(void);
+uint32_t          HAL_GetTick(void);
+void              HAL_Delay(uint32_t Delay);
+
+HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef *RCC_OscInitStruct);
+HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef *RCC_ClkInitStruct, uint32_t FLatency);
+HAL_StatusTypeDef HAL_RCCEx_PeriphCLKConfig(RCC_PeriphCLKInitTypeDef *PeriphClkInit);
+HAL_StatusTypeDef HAL_PWREx_EnableOverDrive(void);
+
+void              HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+void              HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void              HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+
+void              HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+void              HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void              HAL_NVIC_DisableIRQ(IRQn_Type IRQn);
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart);
+void              HAL_UART_MspInit(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+void              HAL_UART_IRQHandler(UART_HandleTypeDef *huart);
+void              HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart);
+void              HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart);
+
+void              USART1_IRQHandler(void);
+
+void              HAL_POSIX_LTDC_Reload(void);
+void              LTDC_IRQHandler(void);
+
+void              HAL_POSIX_EXTI_Raise(uint32_t Line);
+void              EXTI15_10_IRQHandler(void);
+
+void              HAL_POSIX_ThreadStart(pthread_t *thread, uint8_t *started, void *(*thread_main)(void *));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F4xx_HAL_H */
@@ -112,6 +112,9 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
     p_mutex->OwnerNestingCtr   =             0u;                /* Mutex is available                                   */
 #if (OS_CFG_TS_EN > 0u)
     p_mutex->TS                =             0u;
+#endif
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+    p_mutex->CeilPrio          =             OS_PRIO_INIT;      /* Priority inheritance                                 */
 #endif
     OS_PendListInit(&p_mutex->PendList);                        /* Initialize the waiting list                          */
 
@@ -126,6 +129,67 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
 }
 
 
+/*
+************************************************************************************************************************
+*                                        CREATE A MUTEX WITH A PRIORITY CEILING
+*
+* Description: This function creates a mutex which follows the immediate priority ceiling protocol: the task which gets
+*              the mutex runs at 'prio_ceil' until it releases it (see 'os.h  MUTUAL EXCLUSION SEMAPHORES  Note #2').
+*
+* Arguments  : p_mutex       is a pointer to the mutex to initialize.  Your application is responsible for allocating
+*                            storage for the mutex.
+*
+*              p_name        is a pointer to the name you would like to give the mutex.
+*
+*              prio_ceil     is the ceiling priority, the highest priority of the tasks which take the mutex.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the mutex after you called
+*                                                                 OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_mutex' is a NULL pointer
+*                                OS_ERR_OBJ_CREATED             If the mutex was already created
+*                                OS_ERR_PRIO_INVALID            If 'prio_ceil' is the idle task priority or lower
+*
+* Returns    : none
+*
+* Note(s)    : 1) A task of a higher priority than 'prio_ceil' gets OS_ERR_MUTEX_CEIL from OSMutexPend().
+*
+*              2) Once the owner runs at the ceiling, a task which takes the mutex cannot run until it is released,
+*                 unless the owner blocks while holding it.  OSMutexPend() then blocks, without priority inheritance.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+void  OSMutexCreateCeil (OS_MUTEX  *p_mutex,
+                         CPU_CHAR  *p_name,
+                         OS_PRIO    prio_ceil,
+                         OS_ERR    *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    if (prio_ceil >= (OS_CFG_PRIO_MAX - 1u)) {                  /* Cannot be the Idle Task priority                     */
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+
+    OSMutexCreate(p_mutex,
+                  p_name,
+                  p_err);
+    if (*p_err == OS_ERR_NONE) {
+        p_mutex->CeilPrio = prio_ceil;                          /* Not used by any task yet                             */
+    }
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                   DELETE A MUTEX
@@ -160,6 +224,9 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
 *
 *              2) Because ALL tasks pending on the mutex will be readied, you MUST be careful in applications where the
 *                 mutex is used for mutual exclusion because the resource(s) will no longer be guarded by the mutex.
+*
+*              3) The owner of a mutex created by OSMutexCreateCeil() runs at its ceiling even with no task waiting, so
+*                 its priority is restored with OS_OPT_DEL_NO_PEND as well as with OS_OPT_DEL_ALWAYS.
 ************************************************************************************************************************
 */
 
@@ -239,11 +306,25 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
                  OSMutexQty--;
 #endif
                  OS_TRACE_MUTEX_DEL(p_mutex);
-                 if (p_mutex->OwnerTCBPtr != (OS_TCB *)0) {     /* Does the mutex belong to a task?                     */
-                     OS_MutexGrpRemove(p_mutex->OwnerTCBPtr, p_mutex); /* yes, remove it from the task group.           */
+                 p_tcb_owner = p_mutex->OwnerTCBPtr;
+                 prio_new    = OS_CFG_PRIO_MAX;
+                 if (p_tcb_owner != (OS_TCB *)0) {              /* Does the mutex belong to a task?                     */
+                     OS_MutexGrpRemove(p_tcb_owner, p_mutex);   /* yes, remove it from the task group.                  */
+                     if (p_tcb_owner->Prio != p_tcb_owner->BasePrio) { /* Owner at a ceiling, see Note #3               */
+                         prio_new = OS_MutexGrpPrioFindHighest(p_tcb_owner);
+                         prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
+                         OS_TaskChangePrio(p_tcb_owner, prio_new);
+                         OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
+                         if (p_tcb_owner == OSTCBCurPtr) {
+                             OSPrioCur = prio_new;
+                         }
+                     }
                  }
                  OS_MutexClr(p_mutex);
                  CPU_CRITICAL_EXIT();
+                 if (prio_new != OS_CFG_PRIO_MAX) {             /* Owner's priority lowered?                            */
+                     OSSched();                                 /* Find highest priority task ready to run              */
+                 }
                 *p_err = OS_ERR_NONE;
              } else {
                  CPU_CRITICAL_EXIT();
@@ -281,6 +362,9 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
                      prio_new = (prio_new > p_tcb_owner->BasePrio) ? p_tcb_owner->BasePrio : prio_new;
                      OS_TaskChangePrio(p_tcb_owner, prio_new);
                      OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb_owner, p_tcb_owner->Prio);
+                     if (p_tcb_owner == OSTCBCurPtr) {
+                         OSPrioCur = prio_new;
+                     }
                  }
              }
 
@@ -327,6 +411,8 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 *              p_err         is a pointer to a variable that will contain an error code returned by this function.
 *
 *                                OS_ERR_NONE               The call was successful and your task owns the resource
+*                                OS_ERR_MUTEX_CEIL         If the calling task has a higher priority than the ceiling of
+*                                                          the mutex (see OSMutexCreateCeil())
 *                                OS_ERR_MUTEX_OWNER        If calling task already owns the mutex
 *                                OS_ERR_MUTEX_OVF          Mutex nesting counter overflowed
 *                                OS_ERR_OBJ_DEL            If 'p_mutex' was deleted
@@ -429,6 +515,16 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
 #endif
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+    if ((p_mutex->CeilPrio      != OS_PRIO_INIT) &&             /* Is the task above the ceiling of the mutex?          */
+        (OSTCBCurPtr->BasePrio  <  p_mutex->CeilPrio)) {
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_MUTEX_PEND_FAILED(p_mutex);
+        OS_TRACE_MUTEX_PEND_EXIT(OS_ERR_MUTEX_CEIL);
+       *p_err = OS_ERR_MUTEX_CEIL;
+        return;
+    }
+#endif
     if (p_mutex->OwnerNestingCtr == 0u) {                       /* Resource available?                                  */
         p_mutex->OwnerTCBPtr     = OSTCBCurPtr;                 /* Yes, caller may proceed                              */
         p_mutex->OwnerNestingCtr = 1u;
@@ -438,6 +534,13 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
         }
 #endif
         OS_MutexGrpAdd(OSTCBCurPtr, p_mutex);                   /* Add mutex to owner's group                           */
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+        if (OSTCBCurPtr->Prio > p_mutex->CeilPrio) {            /* Run at the ceiling of the mutex                      */
+            OS_TaskChangePrio(OSTCBCurPtr, p_mutex->CeilPrio);
+            OSPrioCur = p_mutex->CeilPrio;
+            OS_TRACE_MUTEX_TASK_PRIO_INHERIT(OSTCBCurPtr, OSTCBCurPtr->Prio);
+        }
+#endif
         CPU_CRITICAL_EXIT();
         OS_TRACE_MUTEX_PEND(p_mutex);
         OS_TRACE_MUTEX_PEND_EXIT(OS_ERR_NONE);
@@ -729,7 +832,10 @@ OS_OBJ_QTY  OSMutexPendAbort (OS_MUTEX  *p_mutex,
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) The owner gets back the priority it had before taking the mutex, or the highest priority it still
+*                 inherits or has as the ceiling of another mutex it owns.  When that lowers its priority, as when it
+*                 leaves the ceiling of the mutex, the scheduler runs even if no task was waiting on the mutex since
+*                 another task may now preempt it.
 ************************************************************************************************************************
 */
 
@@ -740,6 +846,7 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
     CPU_TS         ts;
+    OS_PRIO        prio_cur;
     OS_PRIO        prio_new;
     CPU_SR_ALLOC();
 
@@ -826,17 +933,8 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
 
     OS_MutexGrpRemove(OSTCBCurPtr, p_mutex);                    /* Remove mutex from owner's group                      */
 
-    p_pend_list = &p_mutex->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on mutex?                           */
-        p_mutex->OwnerTCBPtr     = (OS_TCB *)0;                 /* No                                                   */
-        p_mutex->OwnerNestingCtr =           0u;
-        CPU_CRITICAL_EXIT();
-        OS_TRACE_MUTEX_POST_EXIT(OS_ERR_NONE);
-       *p_err = OS_ERR_NONE;
-        return;
-    }
-                                                                /* Yes                                                  */
-    if (OSTCBCurPtr->Prio != OSTCBCurPtr->BasePrio) {           /* Has owner inherited a priority?                      */
+    prio_cur = OSTCBCurPtr->Prio;
+    if (OSTCBCurPtr->Prio != OSTCBCurPtr->BasePrio) {           /* Has owner inherited a priority or a ceiling?         */
         prio_new = OS_MutexGrpPrioFindHighest(OSTCBCurPtr);     /* Yes, find highest priority pending                   */
         prio_new = (prio_new > OSTCBCurPtr->BasePrio) ? OSTCBCurPtr->BasePrio : prio_new;
         if (prio_new > OSTCBCurPtr->Prio) {
@@ -848,6 +946,20 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
             OSPrioCur         = prio_new;
         }
     }
+
+    p_pend_list = &p_mutex->PendList;
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on mutex?                           */
+        p_mutex->OwnerTCBPtr     = (OS_TCB *)0;                 /* No                                                   */
+        p_mutex->OwnerNestingCtr =           0u;
+        CPU_CRITICAL_EXIT();
+        if ((OSTCBCurPtr->Prio != prio_cur) &&                  /* Priority lowered, see Note #1                        */
+            ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+            OSSched();                                          /* Run the scheduler                                    */
+        }
+        OS_TRACE_MUTEX_POST_EXIT(OS_ERR_NONE);
+       *p_err = OS_ERR_NONE;
+        return;
+    }
                                                                 /* Get TCB from head of pend list                       */
     p_tcb                    = p_pend_list->HeadPtr;
     p_mutex->OwnerTCBPtr     = p_tcb;                           /* Give mutex to new owner                              */
@@ -859,6 +971,12 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
                            (void *)0,
                            0u,
                            ts);
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+    if (p_tcb->Prio > p_mutex->CeilPrio) {                      /* New owner runs at the ceiling of the mutex           */
+        OS_TaskChangePrio(p_tcb, p_mutex->CeilPrio);
+        OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb, p_tcb->Prio);
+    }
+#endif
 
     CPU_CRITICAL_EXIT();
 
@@ -899,6 +1017,9 @@ void  OS_MutexClr (OS_MUTEX  *p_mutex)
     p_mutex->OwnerNestingCtr   =             0u;
 #if (OS_CFG_TS_EN > 0u)
     p_mutex->TS                =             0u;
+#endif
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+    p_mutex->CeilPrio          =             OS_PRIO_INIT;
 #endif
     OS_PendListInit(&p_mutex->PendList);                        /* Initialize the waiting list                          */
 }
@@ -1033,6 +1154,12 @@ void  OS_MutexGrpRemove (OS_TCB  *p_tcb, OS_MUTEX  *p_mutex)
 * Returns    : Highest priority pending or OS_CFG_PRIO_MAX - 1u if none found.
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The ceilings of the mutexes of the group count as tasks pending at these priorities, so the task keeps
+*                 the highest ceiling of the mutexes it still owns.
+*
+*              3) So do the tasks pending on the reader-writer locks the task holds, the priority it inherits being
+*                 the highest of both.
 ************************************************************************************************************************
 */
 
@@ -1055,9 +1182,21 @@ OS_PRIO  OS_MutexGrpPrioFindHighest (OS_TCB  *p_tcb)
                 highest_prio = prio;
             }
         }
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+        if ((*pp_mutex)->CeilPrio < highest_prio) {             /* See Note #2                                          */
+            highest_prio = (*pp_mutex)->CeilPrio;
+        }
+#endif
         pp_mutex = &(*pp_mutex)->MutexGrpNextPtr;
     }
 
+#if (OS_CFG_RWLOCK_EN > 0u)
+    prio = OS_RwLockGrpPrioFindHighest(p_tcb);                  /* See Note #3                                          */
+    if (prio < highest_prio) {
+        highest_prio = prio;
+    }
+#endif
+
     return (highest_prio);
 }
 
@@ -1119,6 +1258,12 @@ void  OS_MutexGrpPostAll (OS_TCB  *p_tcb)
                                    (void *)0,
                                    0u,
                                    ts);
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+            if (p_tcb_new->Prio > p_mutex->CeilPrio) {          /* New owner runs at the ceiling of the mutex           */
+                OS_TaskChangePrio(p_tcb_new, p_mutex->CeilPrio);
+                OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb_new, p_tcb_new->Prio);
+            }
+#endif
         }
 
         p_mutex = p_mutex_next;
@@ -774,7 +774,8 @@ OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
 *
 * Returns    : None
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_OPT_POST_ALL, the tasks waiting all receive the message and are readied by OS_PostAll() in
+*                 one critical section, and the scheduler runs once after them.
 ************************************************************************************************************************
 */
 
@@ -786,8 +787,6 @@ void  OSQPost (OS_Q         *p_q,
 {
     OS_OPT         post_type;
     OS_PEND_LIST  *p_pend_list;
-    OS_TCB        *p_tcb;
-    OS_TCB        *p_tcb_next;
     CPU_TS         ts;
     CPU_SR_ALLOC();
 
@@ -870,18 +869,17 @@ void  OSQPost (OS_Q         *p_q,
         return;
     }
 
-    p_tcb = p_pend_list->HeadPtr;
-    while (p_tcb != (OS_TCB *)0) {
-        p_tcb_next = p_tcb->PendNextPtr;
-        OS_Post((OS_PEND_OBJ *)((void *)p_q),
-                p_tcb,
+    if ((opt & OS_OPT_POST_ALL) == 0u) {                        /* Post message to all tasks waiting?                   */
+        OS_Post((OS_PEND_OBJ *)((void *)p_q),                   /* No,  only to the highest priority one                */
+                p_pend_list->HeadPtr,
                 p_void,
                 msg_size,
                 ts);
-        if ((opt & OS_OPT_POST_ALL) == 0u)  {                   /* Post message to all tasks waiting?                   */
-            break;                                              /* No                                                   */
-        }
-        p_tcb = p_tcb_next;
+    } else {
+        OS_PostAll((OS_PEND_OBJ *)((void *)p_q),                /* Yes, ready all of them at once                       */
+                   p_void,
+                   msg_size,
+                   ts);
     }
 
     CPU_CRITICAL_EXIT();
@@ -109,7 +109,12 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 #if (OS_CFG_MUTEX_EN > 0u)
     p_tcb->BasePrio = prio_new;                                 /* Update base priority                                 */
 
+#if (OS_CFG_RWLOCK_EN > 0u)
+    if ((p_tcb->MutexGrpHeadPtr  != (OS_MUTEX       *)0) ||     /* Owning a mutex or holding a reader-writer lock?      */
+        (p_tcb->RwLockGrpHeadPtr != (OS_RWLOCK_HOLD *)0)) {
+#else
     if (p_tcb->MutexGrpHeadPtr != (OS_MUTEX *)0) {              /* Owning a mutex?                                      */
+#endif
         if (prio_new > p_tcb->Prio) {
             prio_high = OS_MutexGrpPrioFindHighest(p_tcb);
             if (prio_new > prio_high) {
@@ -486,6 +491,9 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 #if (OS_CFG_MUTEX_EN > 0u)
     OS_TCB   *p_tcb_owner;
     OS_PRIO   prio_new;
+#endif
+#if (OS_CFG_RWLOCK_EN > 0u)
+    OS_RWLOCK  *p_lock;
 #endif
     CPU_SR_ALLOC();
 
@@ -582,6 +590,15 @@ void  OSTaskDel (OS_TCB  *p_tcb,
                       break;
 #endif
 
+#if (OS_CFG_RWLOCK_EN > 0u)
+                 case OS_TASK_PEND_ON_RWLOCK:                   /* Readers may get the lock, holders lose priority      */
+                      p_lock = (OS_RWLOCK *)((void *)p_tcb->PendObjPtr);
+                      OS_PendListRemove(p_tcb);
+                      p_tcb->PendOn = OS_TASK_PEND_ON_NOTHING;
+                      OS_RwLockPendChg(p_lock, p_tcb);
+                      break;
+#endif
+
                  default:
                                                                 /* Default case.                                        */
                       break;
@@ -606,6 +623,12 @@ void  OSTaskDel (OS_TCB  *p_tcb,
     }
 #endif
 
+#if (OS_CFG_RWLOCK_EN > 0u)
+    if (p_tcb->RwLockGrpHeadPtr != (OS_RWLOCK_HOLD *)0) {
+        OS_RwLockGrpPostAll(p_tcb);
+    }
+#endif
+
 #if (OS_CFG_TASK_Q_EN > 0u)
     (void)OS_MsgQFreeAll(&p_tcb->MsgQ);                         /* Free task's message queue messages                   */
 #endif
@@ -637,6 +660,71 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                               GET TASK PROFILE HISTOGRAMS
+*
+* Description: This function returns the run time and response time histograms of a task (see 'os.h  TASK PROFILE
+*              HISTOGRAMS').
+*
+* Arguments  : p_tcb       is a pointer to the TCB of the task.  A NULL pointer specifies the current task.
+*
+*              p_profile   is a pointer to the structure receiving a copy of the histograms.
+*
+*              p_err       is a pointer to a variable that will contain an error code.
+*
+*                              OS_ERR_NONE               Upon success
+*                              OS_ERR_PTR_INVALID        If 'p_profile' is a NULL pointer
+*                              OS_ERR_TASK_NOT_EXIST     If the task is not created or was deleted
+*
+* Returns    : none
+*
+* Note(s)    : (1) The times are in timestamp counts, CPU_TS_TmrFreqGet() per second.  The activation in progress is
+*                  not counted.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_PROFILE_HIST_EN > 0u)
+void  OSTaskProfileGet (OS_TCB           *p_tcb,
+                        OS_TASK_PROFILE  *p_profile,
+                        OS_ERR           *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_profile == (OS_TASK_PROFILE *)0) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Get the histograms of the current task?              */
+        p_tcb = OSTCBCurPtr;
+    }
+
+    if ((p_tcb->StkPtr    == (CPU_STK *)0) ||                   /* Make sure task exist                                 */
+        (p_tcb->TaskState == OS_TASK_STATE_DEL)) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_NOT_EXIST;
+        return;
+    }
+
+   *p_profile = p_tcb->Profile;
+    CPU_CRITICAL_EXIT();
+   *p_err     = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                    FLUSH TASK's QUEUE
@@ -2480,6 +2568,10 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
     OS_TLS_ID   id;
 #endif
+#if (OS_CFG_TASK_PROFILE_HIST_EN > 0u)
+    OS_TASK_PROFILE  *p_profile;
+    CPU_INT08U        i;
+#endif
 
 
     p_tcb->StkPtr               = (CPU_STK          *)0;
@@ -2493,6 +2585,9 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #if (OS_CFG_TICK_EN > 0u)
     p_tcb->TickNextPtr          = (OS_TCB           *)0;
     p_tcb->TickPrevPtr          = (OS_TCB           *)0;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    p_tcb->TickSlotPtr          = (OS_TCB          **)0;
+#endif
 #endif
 
 #if (OS_CFG_DBG_EN > 0u)
@@ -2530,6 +2625,9 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->FlagsPend            =                     0u;
     p_tcb->FlagsOpt             =                     0u;
     p_tcb->FlagsRdy             =                     0u;
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+    p_tcb->FlagsSlot            =      OS_FLAG_SLOT_NONE;
+#endif
 #endif
 
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
@@ -2569,6 +2667,23 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #if (OS_CFG_TICK_EN > 0u)
     p_tcb->TickRemain           =                     0u;
     p_tcb->TickCtrPrev          =                     0u;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    p_tcb->TickMatch            =                     0u;
+#endif
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+    p_tcb->PeriodicTickTs       =                     0u;
+    p_tcb->PeriodicReleaseTs    =                     0u;
+    p_tcb->Periodic.Period      =                     0u;       /* Not periodic                                         */
+    p_tcb->Periodic.Deadline    =                     0u;
+    p_tcb->Periodic.ReleaseCtr  =                     0u;
+    p_tcb->Periodic.DoneCtr     =                     0u;
+    p_tcb->Periodic.MissCtr     =                     0u;
+    p_tcb->Periodic.SkipCtr     =                     0u;
+    p_tcb->Periodic.JitterMax   =                     0u;
+    p_tcb->Periodic.JitterTotal =                     0u;
+    p_tcb->Periodic.RespMax     =                     0u;
+    p_tcb->Periodic.RespTotal   =                     0u;
+#endif
 #endif
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
@@ -2589,6 +2704,20 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->CyclesTotal          =                     0u;
 #endif
 
+#if (OS_CFG_TASK_PROFILE_HIST_EN > 0u)
+    p_tcb->ProfileAct           =  OS_FALSE;
+    p_tcb->ProfileActStart      =                     0u;
+    p_tcb->ProfileActCycles     =                     0u;
+    p_profile                   = &p_tcb->Profile;
+    p_profile->ActCtr           =                     0u;
+    p_profile->RunMax           =                     0u;
+    p_profile->RespMax          =                     0u;
+    for (i = 0u; i < OS_TASK_PROFILE_HIST_SIZE; i++) {
+        p_profile->RunHist[i]   =                     0u;
+        p_profile->RespHist[i]  =                     0u;
+    }
+#endif
+
 #ifdef CPU_CFG_INT_DIS_MEAS_EN
     p_tcb->IntDisTimeMax        =                     0u;
 #endif
@@ -2599,6 +2728,9 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->PendNextPtr          = (OS_TCB           *)0;
     p_tcb->PendPrevPtr          = (OS_TCB           *)0;
     p_tcb->PendObjPtr           = (OS_PEND_OBJ      *)0;
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+    p_tcb->PendPrio             =  OS_PRIO_INIT;
+#endif
     p_tcb->PendOn               =  OS_TASK_PEND_ON_NOTHING;
     p_tcb->PendStatus           =  OS_STATUS_PEND_OK;
     p_tcb->TaskState            =  OS_TASK_STATE_RDY;
@@ -2608,6 +2740,10 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->BasePrio             =  OS_PRIO_INIT;
     p_tcb->MutexGrpHeadPtr      = (OS_MUTEX         *)0;
 #endif
+#if (OS_CFG_RWLOCK_EN > 0u)
+    p_tcb->RwLockGrpHeadPtr     = (OS_RWLOCK_HOLD   *)0;
+    p_tcb->RwLockWr             =  OS_FALSE;
+#endif
 
 #if (OS_CFG_DBG_EN > 0u)
     p_tcb->DbgPrevPtr           = (OS_TCB           *)0;
@@ -2617,6 +2753,72 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 }
 
 
+/*
+************************************************************************************************************************
+*                                               TASK PROFILE HISTOGRAMS
+*
+* Description: OS_TaskProfileRdy() starts an activation of a task when it is made ready, OS_TaskProfileSwOut() adds the
+*              CPU time of the task when it is switched out, and ends the activation if the task blocked.
+*
+* Arguments  : p_tcb       is a pointer to the TCB of the task made ready, or switched out.
+*
+*              ts          is the timestamp of the context switch.
+*
+* Returns    : none
+*
+* Note(s)    : (1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              (2) OS_TaskProfileRdy() is called by OS_RdyListInsert(), also when the priority of a ready task changes.
+*                  Only the first call starts an activation.
+*
+*              (3) OS_TaskProfileSwOut() is called by OSTaskSwHook() of the port, after 'CyclesDelta' was updated, with
+*                  interrupts disabled.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_PROFILE_HIST_EN > 0u)
+void  OS_TaskProfileRdy (OS_TCB  *p_tcb)
+{
+    if (p_tcb->ProfileAct == OS_FALSE) {                        /* See Note #2.                                         */
+        p_tcb->ProfileAct       = OS_TRUE;
+        p_tcb->ProfileActStart  = OS_TS_GET();
+        p_tcb->ProfileActCycles = 0u;
+    }
+}
+
+
+void  OS_TaskProfileSwOut (OS_TCB  *p_tcb,
+                           CPU_TS   ts)
+{
+    OS_TASK_PROFILE  *p_profile;
+    CPU_TS            run;
+    CPU_TS            resp;
+
+
+    p_tcb->ProfileActCycles += p_tcb->CyclesDelta;
+    if ((p_tcb->ProfileAct == OS_FALSE) ||
+        (p_tcb->TaskState  == OS_TASK_STATE_RDY)) {             /* Preempted, the activation goes on                    */
+        return;
+    }
+
+    p_tcb->ProfileAct = OS_FALSE;                               /* Blocked, end of the activation                       */
+    p_profile         = &p_tcb->Profile;
+    run               = p_tcb->ProfileActCycles;
+    resp              = ts - p_tcb->ProfileActStart;
+    p_profile->ActCtr++;
+    if (p_profile->RunMax < run) {
+        p_profile->RunMax = run;
+    }
+    if (p_profile->RespMax < resp) {
+        p_profile->RespMax = resp;
+    }
+                                                                /* Bucket is the index of the MSB, see 'os.h' Note #2   */
+    p_profile->RunHist[31u - CPU_CntLeadZeros32((CPU_INT32U)run   | 1u)]++;
+    p_profile->RespHist[31u - CPU_CntLeadZeros32((CPU_INT32U)resp | 1u)]++;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                              CATCH ACCIDENTAL TASK RETURN
@@ -2754,6 +2956,9 @@ void  OS_TaskStkRedzoneInit (CPU_STK       *p_base,
 * Returns    : none.
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A reader-writer lock may have several holders, so the priority of each is updated by a call back to
+*                 this function from OS_RwLockPendChg() rather than by this loop.
 ************************************************************************************************************************
 */
 
@@ -2827,6 +3032,13 @@ void  OS_TaskChangePrio(OS_TCB  *p_tcb,
 #endif
                           break;
 
+#if (OS_CFG_RWLOCK_EN > 0u)
+                     case OS_TASK_PEND_ON_RWLOCK:               /* Holders take the priority, see Note #2               */
+                          OS_PendListChangePrio(p_tcb);
+                          OS_RwLockPendChg((OS_RWLOCK *)((void *)p_tcb->PendObjPtr), (OS_TCB *)0);
+                          break;
+#endif
+
                      case OS_TASK_PEND_ON_TASK_Q:
                      case OS_TASK_PEND_ON_TASK_SEM:
                      default:
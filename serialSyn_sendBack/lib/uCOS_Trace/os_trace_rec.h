@@ -0,0 +1,210 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                                    RAM Ring Buffer Trace Recorder
+*
+* File      : os_trace_rec.h
+* Version   : V3.08.00
+*********************************************************************************************************
+* Note(s)   : (1) The OS_TRACE_xxx() hooks of the kernel (see 'os_trace_events.h') store one fixed size
+*                 record per event in a RAM ring buffer.  Writers reserve a slot with an atomic increment,
+*                 so tasks & ISRs record without a critical section.  When the buffer is full the oldest
+*                 records are overwritten & the reader reports how many were lost.
+*
+*             (2) A single task reads the buffer with OS_TraceRecRead(), which encodes the records in
+*                 the wire format below, & sends them on a UART.  The host decoder
+*                 'tools/os_trace_decode.py' converts a capture to Chrome/Perfetto trace JSON.
+*
+*             (3) Wire format, OS_TRACE_REC_WIRE_SIZE bytes per record, little-endian :
+*
+*                     [0]     OS_TRACE_REC_SYNC
+*                     [1]     Event (OS_TRACE_EVT_xxx)
+*                     [2..3]  Value, usually the ID of the task or object
+*                     [4..7]  Timestamp, in OS_TRACE_EVT_CLOCK counts
+*                     [8..11] Argument, see the event
+*                     [12]    XOR of bytes [1..11], so text sent on the same UART is skipped
+*********************************************************************************************************
+*/
+
+#ifndef  OS_TRACE_REC_H
+#define  OS_TRACE_REC_H
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*
+* Note(s) : (1) This file is included by 'os.h' (through 'os_trace.h' & 'os_trace_events.h') before the
+*               kernel data types are declared, so the TCB is referred to as 'struct os_tcb'.
+*********************************************************************************************************
+*/
+
+#include  <cpu_core.h>
+#include  "os_type.h"
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*
+* Note(s) : (1) Number of records of the ring buffer, MUST be a power of 2.  A record takes 16 bytes.
+*
+*           (2) Longest name recorded for a task or a kernel object.
+*
+*           (3) Enabled (1), the tick, the OSIntEnter()/OSIntExit() of every interrupt & the API enter/exit
+*               events are not recorded until OS_TraceRecEvtEnSet() enables them.  With a 1 kHz tick, the
+*               tick interrupt alone makes 3000 records (39 kB) per second, more than a UART at 115200 baud
+*               sends, & the ring would keep overflowing into OS_TRACE_EVT_LOST records.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_TRACE_REC_BUF_SIZE
+#define  OS_TRACE_REC_BUF_SIZE                     1024u        /* See Note #1.                                         */
+#endif
+
+#ifndef  OS_TRACE_REC_EVT_FILTER_DFLT_EN
+#define  OS_TRACE_REC_EVT_FILTER_DFLT_EN              1u        /* See Note #3.                                         */
+#endif
+
+#define  OS_TRACE_REC_NAME_LEN_MAX                   32u        /* See Note #2.                                         */
+
+#define  OS_TRACE_REC_SYNC                         0xA5u
+#define  OS_TRACE_REC_WIRE_SIZE                      13u
+
+
+/*
+*********************************************************************************************************
+*                                               EVENTS
+*
+* Note(s) : (1) 'val' & 'arg' of each event, as stored in the record.  Task & object IDs are assigned
+*               when the task or object is created, 0 means none.
+*********************************************************************************************************
+*/
+                                                                /* ----------------- RECORDER (META) ------------------ */
+#define  OS_TRACE_EVT_CLOCK                           0u        /* arg: timestamp frequency, Hz                         */
+#define  OS_TRACE_EVT_LOST                            1u        /* arg: records overwritten before being read           */
+#define  OS_TRACE_EVT_TASK_NAME                       2u        /* val: task ID,   arg: next 4 characters of the name   */
+#define  OS_TRACE_EVT_OBJ_NAME                        3u        /* val: object ID, arg: next 4 characters of the name   */
+                                                                /* ------------------- ISR & TICK --------------------- */
+#define  OS_TRACE_EVT_ISR_ENTER                       4u
+#define  OS_TRACE_EVT_ISR_EXIT                        5u
+#define  OS_TRACE_EVT_ISR_EXIT_TO_SCHED               6u
+#define  OS_TRACE_EVT_TICK                            7u        /* arg: OSTickCtr                                       */
+#define  OS_TRACE_EVT_ISR_REGISTER                    8u        /* val: ISR ID,    arg: ISR priority                    */
+#define  OS_TRACE_EVT_ISR_BEGIN                       9u        /* val: ISR ID                                          */
+#define  OS_TRACE_EVT_ISR_END                        10u
+                                                                /* ---------------------- TASKS ----------------------- */
+#define  OS_TRACE_EVT_TASK_CREATE                    11u        /* val: task ID,   arg: priority                        */
+#define  OS_TRACE_EVT_TASK_CREATE_FAILED             12u        /* val: task ID                                         */
+#define  OS_TRACE_EVT_TASK_DEL                       13u        /* val: task ID                                         */
+#define  OS_TRACE_EVT_TASK_READY                     14u        /* val: task ID                                         */
+#define  OS_TRACE_EVT_TASK_SWITCHED_IN               15u        /* val: task ID                                         */
+#define  OS_TRACE_EVT_TASK_DLY                       16u        /* arg: delay, in ticks                                 */
+#define  OS_TRACE_EVT_TASK_SUSPEND                   17u        /* val: task ID                                         */
+#define  OS_TRACE_EVT_TASK_SUSPENDED                 18u        /* val: task ID                                         */
+#define  OS_TRACE_EVT_TASK_RESUME                    19u        /* val: task ID                                         */
+#define  OS_TRACE_EVT_TASK_PREEMPT                   20u        /* val: task ID                                         */
+#define  OS_TRACE_EVT_TASK_PRIO_CHANGE               21u        /* val: task ID,   arg: new priority                    */
+#define  OS_TRACE_EVT_TASK_PRIO_INHERIT              22u        /* val: task ID,   arg: new priority                    */
+#define  OS_TRACE_EVT_TASK_PRIO_DISINHERIT           23u        /* val: task ID,   arg: new priority                    */
+                                                                /* ------------------ KERNEL OBJECTS ------------------ */
+#define  OS_TRACE_EVT_OBJ_CREATE                     24u        /* val: object ID, arg: object type (OS_OBJ_TYPE_xxx)   */
+#define  OS_TRACE_EVT_OBJ_DEL                        25u        /* val: object ID                                       */
+#define  OS_TRACE_EVT_OBJ_POST                       26u        /* val: object ID (OSMemPut() for a partition)          */
+#define  OS_TRACE_EVT_OBJ_POST_FAILED                27u        /* val: object ID                                       */
+#define  OS_TRACE_EVT_OBJ_PEND                       28u        /* val: object ID (OSMemGet() for a partition)          */
+#define  OS_TRACE_EVT_OBJ_PEND_FAILED                29u        /* val: object ID                                       */
+#define  OS_TRACE_EVT_OBJ_PEND_BLOCK                 30u        /* val: object ID                                       */
+                                                                /* -------------------- KERNEL API -------------------- */
+#define  OS_TRACE_EVT_API_ENTER                      31u        /* val: OS_TRACE_API_xxx, arg: object ID                */
+#define  OS_TRACE_EVT_API_EXIT                       32u        /* val: OS_TRACE_API_xxx, arg: OS_ERR returned          */
+
+#define  OS_TRACE_EVT_QTY                            33u
+
+                                                                /* Types of the objects embedded in the TCB             */
+#define  OS_TRACE_OBJ_TYPE_TASK_SEM          (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'S', 'E', 'M')
+#define  OS_TRACE_OBJ_TYPE_TASK_Q            (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'M', 'S', 'Q')
+
+
+/*
+*********************************************************************************************************
+*                                          KERNEL API IDENTIFIERS
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_API_MUTEX_DEL                       0u
+#define  OS_TRACE_API_MUTEX_POST                      1u
+#define  OS_TRACE_API_MUTEX_PEND                      2u
+#define  OS_TRACE_API_TASK_MSG_Q_POST                 3u
+#define  OS_TRACE_API_TASK_MSG_Q_PEND                 4u
+#define  OS_TRACE_API_TASK_SEM_POST                   5u
+#define  OS_TRACE_API_TASK_SEM_PEND                   6u
+#define  OS_TRACE_API_TASK_RESUME                     7u
+#define  OS_TRACE_API_TASK_SUSPEND                    8u
+#define  OS_TRACE_API_SEM_DEL                         9u
+#define  OS_TRACE_API_SEM_POST                       10u
+#define  OS_TRACE_API_SEM_PEND                       11u
+#define  OS_TRACE_API_Q_DEL                          12u
+#define  OS_TRACE_API_Q_POST                         13u
+#define  OS_TRACE_API_Q_PEND                         14u
+#define  OS_TRACE_API_FLAG_DEL                       15u
+#define  OS_TRACE_API_FLAG_POST                      16u
+#define  OS_TRACE_API_FLAG_PEND                      17u
+#define  OS_TRACE_API_MEM_PUT                        18u
+#define  OS_TRACE_API_MEM_GET                        19u
+#define  OS_TRACE_API_RWLOCK_DEL                    20u
+#define  OS_TRACE_API_RWLOCK_POST                   21u
+#define  OS_TRACE_API_RWLOCK_RD_PEND                22u
+#define  OS_TRACE_API_RWLOCK_WR_PEND                23u
+
+
+/*
+*********************************************************************************************************
+*                                               MACROS
+*
+* Note(s) : (1) ID of a task, 0 for a NULL pointer (e.g. OSTaskCreate() failing argument checks).
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_REC_TASK_ID(p_tcb)         (((p_tcb) != (OS_TCB *)0) ? (p_tcb)->TaskID : 0u)
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+struct  os_tcb;                                                 /* See Note #1 of the include files.                    */
+
+void        OS_TraceRecInit      (void);
+void        OS_TraceRecStart     (void);
+void        OS_TraceRecStop      (void);
+void        OS_TraceRecClr       (void);
+
+void        OS_TraceRecEvt       (CPU_INT08U    evt,
+                                  CPU_INT16U    val,
+                                  CPU_INT32U    arg);
+
+void        OS_TraceRecEvtEnSet  (CPU_INT08U    evt,
+                                  CPU_BOOLEAN   en);
+
+void        OS_TraceRecTaskCreate(struct os_tcb  *p_tcb);
+
+void        OS_TraceRecObjCreate (CPU_INT16U   *p_id,
+                                  OS_OBJ_TYPE   type,
+                                  CPU_CHAR     *p_name);
+
+CPU_SIZE_T  OS_TraceRecRead      (CPU_INT08U   *p_buf,
+                                  CPU_SIZE_T    buf_size);
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
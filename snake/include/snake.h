@@ -0,0 +1,225 @@
+/*
+*********************************************************************************************************
+*                                             SNAKE GAME
+*
+* Note(s) : (1) The body is a ring buffer of LENGTH_MAX coordinates.  'head' is the ring index of the head,
+*               the node 'pos' places behind the head is at ring index 'head - pos', so a move writes the
+*               new head at 'head + 1' and the tail advances by itself: O(1) whatever the length, and no
+*               heap.
+*
+*           (2) A cell of the body keeps the colour of the last apple eaten when the head entered it
+*               (SNAKE_HEAD_COLOUR before the first one), so colour[] is indexed by cell and a move repaints
+*               the head, the cell behind it & the cell the tail left, whatever the length.
+*
+*           (3) occupancy[] has one bit per cell of the SNAKE_GRID_COLS x SNAKE_GRID_ROWS grid, set while a
+*               node is in the cell.  A move clears the cell the tail leaves & sets the one the head enters,
+*               so "is this cell part of the snake" is a single bit test.  A head entering a cell which is
+*               already set hit the body, which is latched in 'collision' since the game ends there.
+*
+*           (4) A new node starts on the cell of the tail and stays there when the snake moves next, so
+*               the body never takes a cell twice before a collision and the bitmap stays exact.
+*
+*           (5) The cells out of the snake are kept as a set, updated with the bitmap: free_cells[] holds
+*               all the cells, the free ones in the first free_count entries, & free_index[] the index
+*               of each cell in free_cells[].  Taking or freeing a cell swaps it with the entry at
+*               free_count, so the apple lands on a uniformly random free cell with one rand() whatever
+*               the length.
+*
+*           (6) Every cell whose colour changed since the last frame is marked in dirty[] & listed once in
+*               dirty_cells[], so SnakeRender() repaints those cells only instead of the whole screen.
+*
+*           (7) Only the compositor task draws on the LCD (see 'disp.h'), the tasks of the game send it
+*               batches of draw commands.
+*
+*           (8) The snake is steered by the taps & swipes of the touch screen (see 'touch.h'), delivered to
+*               the TouchInput task on the interrupt of the screen instead of polled.
+*
+*           (9) GameRun publishes the game as a snapshot, a snake_view_t, through a sequence lock of the
+*               kernel (OSSeqLockWrBegin()) after every step, and DrawSnake, DrawApple & Analysis copy the
+*               snapshot instead of taking the mutex of the snake: GameRun never waits for a frame being
+*               drawn.  SnakeViewUpdate() moves the dirty cells to the snapshot & DrawSnake repaints the cells
+*               whose colour differs from the ones it has drawn.
+*
+*          (10) The Analysis task waits on its task semaphore, which GameRun posts after publishing a step,
+*               so the collision & the win are checked once per step, right after it, instead of every
+*               100 ms whatever the speed.  SnakeAnalysisDone() accounts each verdict in an analysis_stat_t:
+*               the steps missed & the latency from the step published (snake_view_t 'ts') to its verdict.
+*
+*          (11) GameRun is a periodic task of the kernel (OSTimePeriodicSet()): a step is released every
+*               'interval' after the previous release, instead of 'interval' after the end of the step, so
+*               the time of the steps does not add up as drift.  The period changes with the speed from
+*               step to step & OSTimePeriodicStatGet() gives the release jitter, the response time & the
+*               deadline misses of the steps.
+*********************************************************************************************************
+*/
+
+#ifndef SNAKE_H
+#define SNAKE_H
+
+#include "main.h"
+#include "disp.h"
+#include "touch.h"
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+/* Host benchmark of the game logic instead of the game (see the native_bench environment) */
+#ifndef SNAKE_BENCH_EN
+#define SNAKE_BENCH_EN 0u
+#endif
+
+/* Game Parameters */
+#define SCALE (CPU_INT16S)10 // Map the actual pixel to a square of the grid
+#define HALF_SCALE (CPU_INT16S)5
+#define LENGTH_MAX (32 * 24)
+#define SNAKE_GRID_COLS 24 // X, cells of SCALE pixels
+#define SNAKE_GRID_ROWS 32 // Y
+#define INTEVAL_MILLISEC_MAX 999
+#define INTEVAL_MILLISEC_MIN 100
+#define INTEVAL_MILLISEC_START 500
+#define DIR_LEFT \
+    (tuple_t)    \
+    {            \
+        0, 1     \
+    }
+#define DIR_RIGHT \
+    (tuple_t)     \
+    {             \
+        0, -1     \
+    }
+#define DIR_DOWN \
+    (tuple_t)    \
+    {            \
+        1, 0     \
+    }
+#define DIR_UP \
+    (tuple_t)  \
+    {          \
+        -1, 0  \
+    }
+typedef CPU_INT08U gameresult_t;
+#define COLLISION_NO (CPU_INT08U)0
+#define COLLISION_SNAKE_HEAD (CPU_INT08U)1
+#define COLLISION_SNAKE_BODY (CPU_INT08U)2
+#define RESULT_WON (gameresult_t)0
+#define RESULT_LOST (gameresult_t)1
+#define RESULT_NONE (gameresult_t)2
+#define APPLE_START_COLOUR LCD_COLOR_RED
+#define SNAKE_START_SPEED (CPU_INT16S)1
+#define SNAKE_START_LENGTH (CPU_INT16U)1
+#define SNAKE_HEAD_COLOUR LCD_COLOR_GREEN
+#define SNAKE_START_DIRECTION DIR_LEFT
+#define SNAKE_X_OFFSET 0 - HALF_SCALE // OFFSET for centering the each squre of the grid
+#define SNAKE_Y_OFFSET 0 - HALF_SCALE
+#define SNAKE_START_COORDINATES \
+    (tuple_t)                   \
+    {                           \
+        115, 115                \
+    }
+
+#define APPLE_START_COORDINATES \
+    (tuple_t)                   \
+    {                           \
+        115, 205                \
+    }
+
+/*
+*********************************************************************************************************
+*                                            DATA STRUCTURES
+*********************************************************************************************************
+*/
+
+typedef struct tuples
+{
+    CPU_INT16S X;
+    CPU_INT16S Y;
+} tuple_t;
+
+typedef struct apples
+{
+    tuple_t coordinates;
+    uint32_t colour; // snake get a new body with the same colour as the eaten apple
+} apple_t;
+
+typedef struct snakes
+{
+    CPU_INT16U length;
+    CPU_INT16S speed;
+    tuple_t direction;
+    CPU_INT16U head;                // Ring index of the head in body[], see Note #1
+    tuple_t body[LENGTH_MAX];       // Coordinates of the nodes, ring buffer
+    uint32_t colour[LENGTH_MAX];    // Colour of each cell of the body, see Note #2
+    uint32_t body_colour;           // Colour of the cells the head leaves
+    CPU_INT32U occupancy[SNAKE_GRID_ROWS];  // Bit X of word Y is the cell (X, Y), see Note #3
+    CPU_BOOLEAN collision;          // The head entered a cell of the body
+    CPU_INT16U free_cells[LENGTH_MAX];  // Cells, the free ones first, see Note #5
+    CPU_INT16U free_index[LENGTH_MAX];  // Index of each cell in free_cells[]
+    CPU_INT16U free_count;          // Cells out of the snake
+    CPU_INT32U dirty[SNAKE_GRID_ROWS];  // Cells to repaint, see Note #6
+    CPU_INT16U dirty_cells[LENGTH_MAX];
+    CPU_INT16U dirty_count;
+} snake_t;
+
+typedef struct snake_view
+{
+    CPU_INT16U length;
+    CPU_INT16U head;                // Cell of the head
+    CPU_BOOLEAN collision;
+    CPU_INT32U step;                // Steps published
+    CPU_TS ts;                      // OS_TS_GET() when the step was published, see Note #10
+    apple_t apple;
+    uint32_t cells[LENGTH_MAX];     // Colour of each cell, LCD_COLOR_BLACK out of the snake
+} snake_view_t;                     // Snapshot of the game, see Note #9
+
+typedef struct analysis_stat
+{
+    CPU_INT32U runs;                // Analyses, with a new step or not
+    CPU_INT32U steps;               // Steps analysed
+    CPU_INT32U missed;              // Steps published but never analysed
+    CPU_INT32U step;                // Last step analysed
+    CPU_TS latency_last;            // From the step published to its verdict, in CPU_TS_TmrFreqGet() units
+    CPU_TS latency_max;
+    CPU_INT64U latency_total;
+} analysis_stat_t;                  // See Note #10
+
+typedef struct game_data
+{
+    snake_t *snake;
+    apple_t *apple;
+} gamedata_t;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void SnakeInit(snake_t *const snake);
+void AppleInit(apple_t *const apple);
+CPU_INT16U SnakeNodeIndex(const snake_t *const snake, const CPU_INT16U pos);
+void SnakeCoordinatesUpdate(snake_t *const snake);
+void SnakeSpeedUpdate(snake_t *const snake);
+void AddSnakeBodyNode(snake_t *const snake);
+CPU_INT08U SnakeCollisionCheck(const snake_t *const snake, const tuple_t *const point);
+CPU_INT08U SnakeCollisionWalk(const snake_t *const snake, const tuple_t *const point);
+CPU_BOOLEAN SnakeCellOccupied(const snake_t *const snake, const tuple_t *const point);
+CPU_INT16U SnakeCellIndex(const tuple_t *const point);
+void AppleCoordinatesUpdate(gamedata_t *const game_data);
+void AppleColourUpdate(apple_t *const apple);
+CPU_BOOLEAN TryEatApple(snake_t *const snake, const apple_t *const apple);
+CPU_BOOLEAN SnakeSteer(snake_t *const snake, const touch_evt_t *const evt);
+CPU_BOOLEAN TupleCompare(const tuple_t *const tuple1, const tuple_t *const tuple2);
+gameresult_t SnakeVerdict(const CPU_BOOLEAN collision, const CPU_INT16U length);
+void SnakeAnalysisDone(analysis_stat_t *const stat, const CPU_INT32U step, const CPU_TS ts);
+
+CPU_INT16U SnakeRender(snake_t *const snake, disp_batch_t *const batch);
+void SnakeViewInit(snake_view_t *const view, snake_t *const snake, const apple_t *const apple);
+void SnakeViewUpdate(snake_view_t *const view, snake_t *const snake, const apple_t *const apple);
+CPU_INT16U SnakeViewRender(const snake_view_t *const view, uint32_t *const shown, disp_batch_t *const batch);
+
+void SnakeBench_Run(const OS_PRIO disp_prio, const OS_PRIO touch_prio);
+
+#endif
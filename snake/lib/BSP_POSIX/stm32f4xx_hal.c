@@ -0,0 +1,474 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal.c
+  * @brief   Host (POSIX) stand-in for the STM32F4 HAL.
+  *
+  *          USART1 reception: a reader thread copies stdin into a ring and
+  *          raises the USART1 interrupt. The interrupt replays the bytes one by
+  *          one through USART1_IRQHandler() with RXNE set, then signals IDLE,
+  *          so the application handlers run exactly as they do on the board.
+  *
+  *          LTDC: a frame thread raises the LTDC interrupt 60 times per second,
+  *          at the first line of the vertical blanking. The interrupt runs
+  *          LTDC_IRQHandler() with LIF set if the line interrupt is enabled,
+  *          then applies the pending shadow register reload, immediate or
+  *          vertical blanking, like the LTDC does before the next frame.
+  *
+  *          EXTI: a host device thread sets a line of the pending register
+  *          with HAL_POSIX_EXTI_Raise(), which raises the EXTI15_10 interrupt
+  *          while it is enabled. A line pending when the interrupt is enabled
+  *          raises it then, like the NVIC does.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hal.h"
+#include "os.h"
+
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Private define ------------------------------------------------------------*/
+#define HAL_POSIX_USART1_INT_SRC    0u            /* Emulated interrupt source of USART1 */
+#define HAL_POSIX_UART_RX_BUF_SIZE  4096u         /* Must be a power of 2 */
+#define HAL_POSIX_LTDC_INT_SRC      2u            /* Emulated interrupt source of the LTDC */
+#define HAL_POSIX_LTDC_FRAME_US     16667u        /* 60 frames per second */
+#define HAL_POSIX_EXTI_INT_SRC      3u            /* Emulated interrupt source of the EXTI lines 10 to 15 */
+#define HAL_POSIX_EXTI_15_10        0x0000FC00u
+
+/* Private variables ---------------------------------------------------------*/
+GPIO_TypeDef  HAL_POSIX_GPIOA;
+USART_TypeDef HAL_POSIX_USART1;
+LTDC_TypeDef  HAL_POSIX_LTDC;
+LTDC_Layer_TypeDef HAL_POSIX_LTDC_Layer[2];
+LTDC_Layer_TypeDef HAL_POSIX_LTDC_LayerActive[2];
+EXTI_TypeDef  HAL_POSIX_EXTI;
+
+static UART_HandleTypeDef *HAL_POSIX_UartHandle;
+
+static uint8_t           HAL_POSIX_UartRxBuf[HAL_POSIX_UART_RX_BUF_SIZE];
+static volatile uint32_t HAL_POSIX_UartRxHead;     /* Written by the reader thread only */
+static volatile uint32_t HAL_POSIX_UartRxTail;     /* Written by the USART1 ISR only */
+static pthread_t         HAL_POSIX_UartRxThread;
+static uint8_t           HAL_POSIX_UartRxThreadStarted;
+
+static struct timespec   HAL_POSIX_TickStart;
+
+static pthread_t         HAL_POSIX_LtdcThread;
+static uint8_t           HAL_POSIX_LtdcThreadStarted;
+
+static volatile uint8_t  HAL_POSIX_Exti15_10En;
+
+/* Private function prototypes -----------------------------------------------*/
+static void  HAL_POSIX_USART1_ISR(void);
+static void *HAL_POSIX_UartRxThreadMain(void *p_arg);
+static void  HAL_POSIX_UartRxThreadStart(void);
+static void  HAL_POSIX_LTDC_ISR(void);
+static void *HAL_POSIX_LtdcThreadMain(void *p_arg);
+static void  HAL_POSIX_EXTI15_10_ISR(void);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * \brief Initialize the HAL. The kernel tick is started by the port (OSStartHighRdy()).
+ */
+HAL_StatusTypeDef HAL_Init(void)
+{
+  (void)clock_gettime(CLOCK_MONOTONIC, &HAL_POSIX_TickStart);
+  return HAL_OK;
+}
+
+/**
+ * \brief Milliseconds elapsed since HAL_Init().
+ */
+uint32_t HAL_GetTick(void)
+{
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)((now.tv_sec - HAL_POSIX_TickStart.tv_sec) * 1000 +
+                    (now.tv_nsec - HAL_POSIX_TickStart.tv_nsec) / 1000000);
+}
+
+/**
+ * \brief Busy wait, overridden by the applications which delay through the kernel.
+ */
+__attribute__((weak)) void HAL_Delay(uint32_t Delay)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while ((HAL_GetTick() - tickstart) < Delay)
+  {
+  }
+}
+
+HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef *RCC_OscInitStruct)
+{
+  (void)RCC_OscInitStruct;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef *RCC_ClkInitStruct, uint32_t FLatency)
+{
+  (void)RCC_ClkInitStruct;
+  (void)FLatency;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RCCEx_PeriphCLKConfig(RCC_PeriphCLKInitTypeDef *PeriphClkInit)
+{
+  (void)PeriphClkInit;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_PWREx_EnableOverDrive(void)
+{
+  return HAL_OK;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+  GPIOx->MODER |= GPIO_Init->Pin;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+  if (PinState != GPIO_PIN_RESET)
+  {
+    GPIOx->ODR |= GPIO_Pin;
+  }
+  else
+  {
+    GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+  }
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+  GPIOx->ODR ^= GPIO_Pin;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+  (void)IRQn;
+  (void)PreemptPriority;
+  (void)SubPriority;
+}
+
+/**
+ * \brief Route an interrupt to the emulated interrupt source of the port.
+ */
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  if (IRQn == USART1_IRQn)
+  {
+    OS_CPU_IntSrcHandlerSet(HAL_POSIX_USART1_INT_SRC, HAL_POSIX_USART1_ISR);
+    HAL_POSIX_UartRxThreadStart();
+  }
+  else if (IRQn == LTDC_IRQn)
+  {
+    OS_CPU_IntSrcHandlerSet(HAL_POSIX_LTDC_INT_SRC, HAL_POSIX_LTDC_ISR);
+    HAL_POSIX_ThreadStart(&HAL_POSIX_LtdcThread, &HAL_POSIX_LtdcThreadStarted, HAL_POSIX_LtdcThreadMain);
+  }
+  else if (IRQn == EXTI15_10_IRQn)
+  {
+    OS_CPU_IntSrcHandlerSet(HAL_POSIX_EXTI_INT_SRC, HAL_POSIX_EXTI15_10_ISR);
+    __atomic_store_n(&HAL_POSIX_Exti15_10En, 1u, __ATOMIC_SEQ_CST);
+    if ((__atomic_load_n(&EXTI->PR, __ATOMIC_SEQ_CST) & HAL_POSIX_EXTI_15_10) != 0u)
+    {
+      OS_CPU_IntSrcRaise(HAL_POSIX_EXTI_INT_SRC);   /* Pending while disabled */
+    }
+  }
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+  if (IRQn == USART1_IRQn)
+  {
+    OS_CPU_IntSrcHandlerSet(HAL_POSIX_USART1_INT_SRC, (CPU_FNCT_VOID)0);
+  }
+  else if (IRQn == LTDC_IRQn)
+  {
+    OS_CPU_IntSrcHandlerSet(HAL_POSIX_LTDC_INT_SRC, (CPU_FNCT_VOID)0);
+  }
+  else if (IRQn == EXTI15_10_IRQn)
+  {
+    __atomic_store_n(&HAL_POSIX_Exti15_10En, 0u, __ATOMIC_SEQ_CST);   /* The lines stay pending */
+  }
+}
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
+{
+  if (huart == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  HAL_POSIX_UartHandle = huart;
+  HAL_UART_MspInit(huart);
+  huart->gState = HAL_UART_STATE_READY;
+  huart->RxState = HAL_UART_STATE_READY;
+  return HAL_OK;
+}
+
+__attribute__((weak)) void HAL_UART_MspInit(UART_HandleTypeDef *huart)
+{
+  (void)huart;
+}
+
+/**
+ * \brief Transmit to stdout. write() is async-signal safe, so it is preemption safe too.
+ */
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+  ssize_t n;
+
+  (void)huart;
+  (void)Timeout;
+  while (Size > 0u)
+  {
+    n = write(STDOUT_FILENO, pData, Size);
+    if (n <= 0)
+    {
+      return HAL_ERROR;
+    }
+    pData += n;
+    Size -= (uint16_t)n;
+  }
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  return HAL_UART_Transmit(huart, pData, Size, HAL_MAX_DELAY);
+}
+
+HAL_StatusTypeDef HAL_UART_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  if ((pData == NULL) || (Size == 0u))
+  {
+    return HAL_ERROR;
+  }
+
+  huart->pRxBuffPtr = pData;
+  huart->RxXferSize = Size;
+  huart->RxXferCount = Size;
+  huart->RxState = HAL_UART_STATE_BUSY_RX;
+  SET_BIT(huart->Instance->CR1, USART_CR1_RXNEIE);
+
+  if (HAL_POSIX_UartRxHead != HAL_POSIX_UartRxTail)   /* Bytes received while no reception was active */
+  {
+    OS_CPU_IntSrcRaise(HAL_POSIX_USART1_INT_SRC);
+  }
+  return HAL_OK;
+}
+
+/**
+ * \brief Store the received byte, completing the reception when the buffer is full.
+ */
+void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
+{
+  uint32_t isrflags = READ_REG(huart->Instance->SR);
+  uint32_t cr1its = READ_REG(huart->Instance->CR1);
+
+  if (((isrflags & USART_SR_RXNE) != RESET) && ((cr1its & USART_CR1_RXNEIE) != RESET))
+  {
+    CLEAR_BIT(huart->Instance->SR, USART_SR_RXNE);
+    *huart->pRxBuffPtr++ = (uint8_t)huart->Instance->DR;
+    if (--huart->RxXferCount == 0u)
+    {
+      CLEAR_BIT(huart->Instance->CR1, USART_CR1_RXNEIE);
+      huart->RxState = HAL_UART_STATE_READY;
+      HAL_UART_RxCpltCallback(huart);
+    }
+  }
+}
+
+__attribute__((weak)) void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  (void)huart;
+}
+
+__attribute__((weak)) void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+  (void)huart;
+}
+
+__attribute__((weak)) void USART1_IRQHandler(void)
+{
+  if (HAL_POSIX_UartHandle != NULL)
+  {
+    HAL_UART_IRQHandler(HAL_POSIX_UartHandle);
+  }
+}
+
+/**
+ * \brief Copy the shadow layer registers to the registers in use if a reload is pending (LTDC->SRCR).
+ *        The BSP stand-in calls it after an immediate reload, a write to SRCR by the application
+ *        takes effect at the next frame.
+ */
+void HAL_POSIX_LTDC_Reload(void)
+{
+  if ((LTDC->SRCR & (LTDC_SRCR_IMR | LTDC_SRCR_VBR)) != 0u)
+  {
+    HAL_POSIX_LTDC_LayerActive[0] = HAL_POSIX_LTDC_Layer[0];
+    HAL_POSIX_LTDC_LayerActive[1] = HAL_POSIX_LTDC_Layer[1];
+    LTDC->SRCR = 0u;
+  }
+}
+
+__attribute__((weak)) void LTDC_IRQHandler(void)
+{
+  LTDC->ICR = LTDC_ICR_CLIF;
+}
+
+/**
+ * \brief Set an EXTI line pending, from a host device thread, and raise its interrupt if enabled.
+ *        Only the lines 10 to 15 have an interrupt.
+ */
+void HAL_POSIX_EXTI_Raise(uint32_t Line)
+{
+  (void)__atomic_fetch_or(&EXTI->PR, Line, __ATOMIC_SEQ_CST);
+  if (((Line & HAL_POSIX_EXTI_15_10) != 0u) && (__atomic_load_n(&HAL_POSIX_Exti15_10En, __ATOMIC_SEQ_CST) != 0u))
+  {
+    OS_CPU_IntSrcRaise(HAL_POSIX_EXTI_INT_SRC);
+  }
+}
+
+__attribute__((weak)) void EXTI15_10_IRQHandler(void)
+{
+  __HAL_GPIO_EXTI_CLEAR_IT(HAL_POSIX_EXTI_15_10);
+}
+
+/**
+ * \brief Start a device thread once, with the interrupt signals blocked (see os_cpu_c.c, OS_CPU_IntSrcRaise()).
+ */
+void HAL_POSIX_ThreadStart(pthread_t *thread, uint8_t *started, void *(*thread_main)(void *))
+{
+  sigset_t set;
+  sigset_t set_prev;
+
+  if (*started != 0u)
+  {
+    return;
+  }
+  *started = 1u;
+
+  (void)sigfillset(&set);
+  (void)pthread_sigmask(SIG_BLOCK, &set, &set_prev);
+  (void)pthread_create(thread, NULL, thread_main, NULL);
+  (void)pthread_sigmask(SIG_SETMASK, &set_prev, NULL);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+ * \brief Emulated USART1 interrupt, called by the port between OSIntEnter() and OSIntExit().
+ */
+static void HAL_POSIX_USART1_ISR(void)
+{
+  uint32_t tail = HAL_POSIX_UartRxTail;
+  uint8_t rx = 0u;
+
+  while ((tail != __atomic_load_n(&HAL_POSIX_UartRxHead, __ATOMIC_ACQUIRE)) &&
+         ((USART1->CR1 & USART_CR1_RXNEIE) != 0u))
+  {
+    USART1->DR = HAL_POSIX_UartRxBuf[tail & (HAL_POSIX_UART_RX_BUF_SIZE - 1u)];
+    USART1->SR |= USART_SR_RXNE;
+    tail++;
+    __atomic_store_n(&HAL_POSIX_UartRxTail, tail, __ATOMIC_RELEASE);
+    rx = 1u;
+    USART1_IRQHandler();
+  }
+
+  if ((rx != 0u) && ((USART1->CR1 & USART_CR1_IDLEIE) != 0u))  /* End of the burst */
+  {
+    USART1->SR |= USART_SR_IDLE;
+    USART1_IRQHandler();
+  }
+}
+
+static void *HAL_POSIX_UartRxThreadMain(void *p_arg)
+{
+  uint8_t buf[256];
+  ssize_t n;
+  ssize_t i;
+  uint32_t head;
+
+  (void)p_arg;
+  for (;;)
+  {
+    n = read(STDIN_FILENO, buf, sizeof(buf));
+    if (n <= 0)
+    {
+      return NULL;                                /* stdin closed, the line stays silent */
+    }
+
+    head = HAL_POSIX_UartRxHead;
+    for (i = 0; i < n; i++)
+    {
+      while ((head - __atomic_load_n(&HAL_POSIX_UartRxTail, __ATOMIC_ACQUIRE)) >= HAL_POSIX_UART_RX_BUF_SIZE)
+      {
+        OS_CPU_IntSrcRaise(HAL_POSIX_USART1_INT_SRC);
+        (void)usleep(1000u);                      /* Ring full, wait for the ISR to drain it */
+      }
+      HAL_POSIX_UartRxBuf[head & (HAL_POSIX_UART_RX_BUF_SIZE - 1u)] = buf[i];
+      head++;
+    }
+    __atomic_store_n(&HAL_POSIX_UartRxHead, head, __ATOMIC_RELEASE);
+    OS_CPU_IntSrcRaise(HAL_POSIX_USART1_INT_SRC);
+  }
+}
+
+/**
+ * \brief Start the stdin reader.
+ */
+static void HAL_POSIX_UartRxThreadStart(void)
+{
+  HAL_POSIX_ThreadStart(&HAL_POSIX_UartRxThread, &HAL_POSIX_UartRxThreadStarted, HAL_POSIX_UartRxThreadMain);
+}
+
+/**
+ * \brief Emulated LTDC interrupt at the vertical blanking, called by the port between OSIntEnter() and
+ *        OSIntExit().
+ */
+static void HAL_POSIX_LTDC_ISR(void)
+{
+  if ((LTDC->IER & LTDC_IER_LIE) != 0u)
+  {
+    LTDC->ISR |= LTDC_ISR_LIF;
+    LTDC_IRQHandler();
+    if ((LTDC->ICR & LTDC_ICR_CLIF) != 0u)
+    {
+      LTDC->ISR &= ~LTDC_ISR_LIF;
+      LTDC->ICR = 0u;
+    }
+  }
+  HAL_POSIX_LTDC_Reload();                        /* The frame ends, the pending reload is applied */
+}
+
+/**
+ * \brief Emulated EXTI15_10 interrupt, called by the port between OSIntEnter() and OSIntExit(). Lines
+ *        which became pending while it was disabled wait for HAL_NVIC_EnableIRQ().
+ */
+static void HAL_POSIX_EXTI15_10_ISR(void)
+{
+  if ((__atomic_load_n(&HAL_POSIX_Exti15_10En, __ATOMIC_SEQ_CST) != 0u) &&
+      ((__atomic_load_n(&EXTI->PR, __ATOMIC_SEQ_CST) & HAL_POSIX_EXTI_15_10) != 0u))
+  {
+    EXTI15_10_IRQHandler();
+  }
+}
+
+static void *HAL_POSIX_LtdcThreadMain(void *p_arg)
+{
+  (void)p_arg;
+  for (;;)
+  {
+    (void)usleep(HAL_POSIX_LTDC_FRAME_US);
+    OS_CPU_IntSrcRaise(HAL_POSIX_LTDC_INT_SRC);
+  }
+  return NULL;
+}
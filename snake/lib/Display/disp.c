@@ -0,0 +1,871 @@
+/*
+*********************************************************************************************************
+*                                              COMPOSITOR
+*
+* Note(s) : (1) See 'disp.h'.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include <string.h>
+#include "disp.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define DISP_BOX_OPAQUE 0x01u // Every pixel of the box is written
+
+#define DISP_MASK_RADIUS_MAX 40u // Circles drawn from a mask by the blitter, larger ones by the BSP
+#define DISP_MASK_DIM (2u * DISP_MASK_RADIUS_MAX + 1u)
+
+#ifdef CPU_CFG_KA_IPL_BOUNDARY
+#define DISP_LTDC_IRQ_PRIO CPU_CFG_KA_IPL_BOUNDARY // Kernel aware, the ISR posts
+#else
+#define DISP_LTDC_IRQ_PRIO 0u
+#endif
+
+/*
+*********************************************************************************************************
+*                                            DATA STRUCTURES
+*********************************************************************************************************
+*/
+
+typedef struct disp_box
+{
+    CPU_INT32S x0; // Inclusive
+    CPU_INT32S y0;
+    CPU_INT32S x1; // Exclusive
+    CPU_INT32S y1;
+    CPU_INT08U flags;
+} disp_box_t;
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+disp_stat_t DispStat;
+
+static OS_TCB DispTCB;
+static CPU_STK DispStk[DISP_TASK_STK_SIZE];
+
+static OS_Q DispQ;
+static OS_SEM DispBatchSem;
+static OS_MEM DispBatchMem;
+static disp_batch_t DispBatchPool[DISP_BATCH_NBR];
+
+static disp_cmd_t DispFrame[DISP_FRAME_SIZE * (1u + DISP_DBL_BUF_EN)]; // Frame shown first, see Note #6c of disp.h
+static disp_box_t DispFrameBox[DISP_FRAME_SIZE * (1u + DISP_DBL_BUF_EN)];
+
+static blit_surf_t DispSurf;                         // Framebuffer drawn, see Note #7 of disp.h
+static CPU_INT08U DispMask[DISP_MASK_DIM * DISP_MASK_DIM]; // A8 mask of the last circle drawn
+static blit_surf_t DispMaskSurf;
+static CPU_INT08U DispMaskType;
+static CPU_INT16U DispMaskRadius;
+
+#if (DISP_DBL_BUF_EN > 0u)
+static OS_SEM DispFrameSem;                // Posted once per frame shown, see Note #6b of disp.h
+static volatile CPU_BOOLEAN DispFlipPending; // The back buffer is drawn, to be shown
+static uint32_t DispFlipAddress;
+static CPU_INT08U DispBackLayer = LCD_FOREGROUND_LAYER; // BSP layer of the buffer not shown
+static CPU_INT16U DispShownCount;          // Commands of the frame shown, at the start of DispFrame[]
+#endif
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void DispTask(void *p_arg);
+
+static CPU_INT32U DispRender(disp_cmd_t *const cmds, disp_box_t *const boxes, const CPU_INT16U count);
+static CPU_INT16U DispCoalesce(const disp_cmd_t *const cmds, disp_box_t *const boxes, const CPU_INT16U count);
+static void DispCmdBox(const disp_cmd_t *const cmd, disp_box_t *const box);
+static CPU_BOOLEAN DispCmdSame(const disp_cmd_t *const cmd1, const disp_cmd_t *const cmd2);
+static CPU_INT32U DispCmdDraw(const disp_cmd_t *const cmd, const disp_box_t *const box);
+static const blit_surf_t *DispMaskGet(const CPU_INT08U type, const CPU_INT16U radius);
+static disp_cmd_t *DispCmdAdd(disp_batch_t *const batch, const CPU_INT08U type, const uint32_t colour);
+static void DispStatFrame(const CPU_INT32U pixels);
+#if (DISP_DBL_BUF_EN > 0u)
+static void DispFlip(void);
+static CPU_INT16U DispShownKeep(disp_cmd_t *const cmds, const disp_box_t *const boxes, const CPU_INT16U first, const CPU_INT16U count);
+#endif
+
+/*
+*********************************************************************************************************
+*                                                  TASKS
+*********************************************************************************************************
+*/
+
+/**
+ * \brief Render the batches of the other tasks, once per frame, see Note #2 of disp.h
+ */
+static void DispTask(void *p_arg)
+{
+    OS_ERR err;
+    CPU_TS ts;
+    OS_MSG_SIZE size;
+    disp_batch_t *batch = NULL; // Not NULL: carried from the last frame, it did not fit
+    CPU_INT16U first;
+    CPU_INT16U count;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        if (batch == NULL)
+        {
+            batch = (disp_batch_t *)OSQPend((OS_Q *)&DispQ,
+                                            (OS_TICK)0,
+                                            (OS_OPT)OS_OPT_PEND_BLOCKING,
+                                            (OS_MSG_SIZE *)&size,
+                                            (CPU_TS *)&ts,
+                                            (OS_ERR *)&err);
+        }
+#if (DISP_DBL_BUF_EN > 0u)
+        first = DispShownCount;
+        DispStat.replayed += first;
+#else
+        first = 0u;
+#endif
+        count = first;
+        while (batch != NULL)
+        {
+            if (((CPU_INT32U)count - first + batch->count) > DISP_FRAME_SIZE) // CPU_INT16U operands promote to int
+            {
+                break;
+            }
+            memcpy(&DispFrame[count], batch->cmds, batch->count * sizeof(disp_cmd_t));
+            count += batch->count;
+            DispStat.cmds += batch->count;
+            DispBatchPut(batch);
+
+            batch = (disp_batch_t *)OSQPend((OS_Q *)&DispQ,
+                                            (OS_TICK)0,
+                                            (OS_OPT)OS_OPT_PEND_NON_BLOCKING,
+                                            (OS_MSG_SIZE *)&size,
+                                            (CPU_TS *)&ts,
+                                            (OS_ERR *)&err);
+        }
+        DispStatFrame(DispRender(DispFrame, DispFrameBox, count));
+
+#if (DISP_DBL_BUF_EN > 0u)
+        DispShownCount = DispShownKeep(DispFrame, DispFrameBox, first, count);
+        DispFlip();
+#else
+        DispFrameWait(&err);
+#endif
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+/**
+ * \brief Create the batch pool, the queue and the compositor task
+ * \param [IN] prio - priority of the compositor task
+ * \param [OUT] p_err - error of the kernel object or task which could not be created
+ */
+void DispInit(const OS_PRIO prio, OS_ERR *const p_err)
+{
+#if (DISP_DBL_BUF_EN > 0u)
+    OSSemCreate((OS_SEM *)&DispFrameSem,
+                (CPU_CHAR *)"Disp Frame Sem",
+                (OS_SEM_CTR)0,
+                (OS_ERR *)p_err);
+    if (*p_err != OS_ERR_NONE)
+    {
+        return;
+    }
+
+    DispBackLayer = LCD_FOREGROUND_LAYER;
+    BSP_LCD_SelectLayer(DispBackLayer);
+
+    LTDC->LIPCR = (LTDC->AWCR & LTDC_AWCR_AAH) + 1u; // First line of the vertical blanking
+    LTDC->IER |= LTDC_IER_LIE;
+    HAL_NVIC_SetPriority(LTDC_IRQn, DISP_LTDC_IRQ_PRIO, 0u);
+    HAL_NVIC_EnableIRQ(LTDC_IRQn);
+#endif
+
+    OSMemCreate((OS_MEM *)&DispBatchMem,
+                (CPU_CHAR *)"Disp Batch Pool",
+                (void *)&DispBatchPool[0],
+                (OS_MEM_QTY)DISP_BATCH_NBR,
+                (OS_MEM_SIZE)sizeof(disp_batch_t),
+                (OS_ERR *)p_err);
+    if (*p_err != OS_ERR_NONE)
+    {
+        return;
+    }
+
+    OSSemCreate((OS_SEM *)&DispBatchSem,
+                (CPU_CHAR *)"Disp Batch Sem",
+                (OS_SEM_CTR)DISP_BATCH_NBR,
+                (OS_ERR *)p_err);
+    if (*p_err != OS_ERR_NONE)
+    {
+        return;
+    }
+
+    OSQCreate((OS_Q *)&DispQ,
+              (CPU_CHAR *)"Disp Q",
+              (OS_MSG_QTY)DISP_BATCH_NBR,
+              (OS_ERR *)p_err);
+    if (*p_err != OS_ERR_NONE)
+    {
+        return;
+    }
+
+    OSTaskCreate((OS_TCB *)&DispTCB,
+                 (CPU_CHAR *)"Compositor Task",
+                 (OS_TASK_PTR)DispTask,
+                 (void *)0,
+                 (OS_PRIO)prio,
+                 (CPU_STK *)&DispStk[0],
+                 (CPU_STK_SIZE)DISP_TASK_STK_SIZE / 10,
+                 (CPU_STK_SIZE)DISP_TASK_STK_SIZE,
+                 (OS_MSG_QTY)0u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)p_err);
+}
+
+/**
+ * \brief Take an empty batch from the pool, see Note #4 of disp.h
+ * \param [IN] timeout - ticks to wait for a free batch, 0 waits forever
+ * \param [OUT] p_err - OS_ERR_NONE, or the error of the semaphore pend
+ * \return the batch, NULL on error
+ */
+disp_batch_t *DispBatchGet(const OS_TICK timeout, OS_ERR *const p_err)
+{
+    CPU_TS ts;
+    disp_batch_t *batch;
+
+    OSSemPend((OS_SEM *)&DispBatchSem,
+              (OS_TICK)timeout,
+              (OS_OPT)OS_OPT_PEND_BLOCKING,
+              (CPU_TS *)&ts,
+              (OS_ERR *)p_err);
+    if (*p_err != OS_ERR_NONE)
+    {
+        return NULL;
+    }
+
+    batch = (disp_batch_t *)OSMemGet((OS_MEM *)&DispBatchMem, (OS_ERR *)p_err);
+    if (batch != NULL)
+    {
+        DispBatchInit(batch);
+    }
+    return batch;
+}
+
+/**
+ * \brief Send a batch to the compositor, which gives it back to the pool once copied
+ * \details An empty batch goes straight back to the pool, the compositor is not woken up
+ * \param [IN] batch - from DispBatchGet(), not to be used after
+ * \param [OUT] p_err - error of the queue post, the batch is back in the pool then
+ */
+void DispBatchPost(disp_batch_t *const batch, OS_ERR *const p_err)
+{
+    if (batch->count == 0u)
+    {
+        DispBatchPut(batch);
+        *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    OSQPost((OS_Q *)&DispQ,
+            (void *)batch,
+            (OS_MSG_SIZE)sizeof(disp_batch_t),
+            (OS_OPT)OS_OPT_POST_FIFO,
+            (OS_ERR *)p_err);
+    if (*p_err != OS_ERR_NONE)
+    {
+        DispBatchPut(batch);
+    }
+}
+
+/**
+ * \brief Give a batch back to the pool without drawing it
+ * \param [IN] batch - from DispBatchGet()
+ */
+void DispBatchPut(disp_batch_t *const batch)
+{
+    OS_ERR err;
+
+    OSMemPut((OS_MEM *)&DispBatchMem, (void *)batch, (OS_ERR *)&err);
+    OSSemPost((OS_SEM *)&DispBatchSem, (OS_OPT)OS_OPT_POST_1, (OS_ERR *)&err);
+}
+
+/**
+ * \brief Empty a batch, for a batch out of the pool
+ */
+void DispBatchInit(disp_batch_t *const batch)
+{
+    batch->count = 0u;
+}
+
+/**
+ * \brief Coalesce and draw a batch in the calling task, without the compositor task
+ * \details For a batch out of the pool (e.g. a benchmark); the LCD must not be drawn by the compositor
+ * meanwhile.  The batch is emptied.
+ * \return pixels written
+ */
+CPU_INT32U DispBatchRender(disp_batch_t *const batch)
+{
+    static disp_box_t boxes[DISP_BATCH_SIZE];
+    CPU_INT32U pixels;
+
+    DispStat.cmds += batch->count;
+    pixels = DispRender(batch->cmds, boxes, batch->count);
+    DispStatFrame(pixels);
+    batch->count = 0u;
+    return pixels;
+}
+
+/**
+ * \brief Wait for the next frame: the next one shown with DISP_DBL_BUF_EN, see Note #6b of disp.h, else
+ * DISP_FRAME_MS
+ * \param [OUT] p_err - error of the semaphore pend or of the delay
+ */
+void DispFrameWait(OS_ERR *const p_err)
+{
+#if (DISP_DBL_BUF_EN > 0u)
+    CPU_TS ts;
+
+    OSSemPend((OS_SEM *)&DispFrameSem,
+              (OS_TICK)0,
+              (OS_OPT)OS_OPT_PEND_BLOCKING,
+              (CPU_TS *)&ts,
+              (OS_ERR *)p_err);
+#else
+    OSTimeDlyHMSM((CPU_INT16U)0,
+                  (CPU_INT16U)0,
+                  (CPU_INT16U)0,
+                  (CPU_INT32U)DISP_FRAME_MS,
+                  (OS_OPT)OS_OPT_TIME_HMSM_STRICT,
+                  (OS_ERR *)p_err);
+#endif
+}
+
+#if (DISP_DBL_BUF_EN > 0u)
+/**
+ * \brief LTDC line interrupt at the vertical blanking: show the back buffer if drawn, see Note #6b of disp.h
+ * \details On the host, the port already entered the ISR, the nesting is harmless
+ */
+void LTDC_IRQHandler(void)
+{
+    OS_ERR err;
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();
+    CPU_CRITICAL_EXIT();
+
+    LTDC->ICR = LTDC_ICR_CLIF;
+    if (DispFlipPending == DEF_TRUE)
+    {
+        LTDC_Layer1->CFBAR = DispFlipAddress;
+        LTDC->SRCR = LTDC_SRCR_IMR; // Still in the blanking, the next frame scans the new buffer out
+        DispFlipPending = DEF_FALSE;
+    }
+
+    // Only to waiters: a count left would let a later DispFrameWait() return without a new frame. A task deleted
+    // while it waits, as GameOver() does, leaves the pend list, so no count is left for it
+    if (DispFrameSem.PendList.HeadPtr != (OS_TCB *)0)
+    {
+        OSSemPost((OS_SEM *)&DispFrameSem, (OS_OPT)OS_OPT_POST_ALL, (OS_ERR *)&err);
+    }
+
+    OSIntExit();
+}
+#endif
+
+/**
+ * \brief Add a command to a batch
+ * \return DEF_FAIL if the batch is full, the command is not added
+ */
+CPU_BOOLEAN DispClear(disp_batch_t *const batch, const uint32_t colour)
+{
+    return (DispCmdAdd(batch, DISP_CMD_CLEAR, colour) != NULL) ? DEF_OK : DEF_FAIL;
+}
+
+CPU_BOOLEAN DispFillRect(disp_batch_t *const batch, const CPU_INT16U x, const CPU_INT16U y, const CPU_INT16U w, const CPU_INT16U h, const uint32_t colour)
+{
+    disp_cmd_t *cmd = DispCmdAdd(batch, DISP_CMD_FILL_RECT, colour);
+
+    if (cmd == NULL)
+    {
+        return DEF_FAIL;
+    }
+    cmd->x = x;
+    cmd->y = y;
+    cmd->w = w;
+    cmd->h = h;
+    return DEF_OK;
+}
+
+CPU_BOOLEAN DispFillCircle(disp_batch_t *const batch, const CPU_INT16U x, const CPU_INT16U y, const CPU_INT16U radius, const uint32_t colour)
+{
+    disp_cmd_t *cmd = DispCmdAdd(batch, DISP_CMD_FILL_CIRCLE, colour);
+
+    if (cmd == NULL)
+    {
+        return DEF_FAIL;
+    }
+    cmd->x = x;
+    cmd->y = y;
+    cmd->w = radius;
+    return DEF_OK;
+}
+
+CPU_BOOLEAN DispDrawCircle(disp_batch_t *const batch, const CPU_INT16U x, const CPU_INT16U y, const CPU_INT16U radius, const uint32_t colour)
+{
+    disp_cmd_t *cmd = DispCmdAdd(batch, DISP_CMD_DRAW_CIRCLE, colour);
+
+    if (cmd == NULL)
+    {
+        return DEF_FAIL;
+    }
+    cmd->x = x;
+    cmd->y = y;
+    cmd->w = radius;
+    return DEF_OK;
+}
+
+CPU_BOOLEAN DispDrawLine(disp_batch_t *const batch, const CPU_INT16U x1, const CPU_INT16U y1, const CPU_INT16U x2, const CPU_INT16U y2, const uint32_t colour)
+{
+    disp_cmd_t *cmd = DispCmdAdd(batch, DISP_CMD_DRAW_LINE, colour);
+
+    if (cmd == NULL)
+    {
+        return DEF_FAIL;
+    }
+    cmd->x = x1;
+    cmd->y = y1;
+    cmd->w = x2;
+    cmd->h = y2;
+    return DEF_OK;
+}
+
+/**
+ * \details The text is copied, up to DISP_TEXT_LEN_MAX characters
+ */
+CPU_BOOLEAN DispText(disp_batch_t *const batch, const CPU_INT16U x, const CPU_INT16U y, const CPU_CHAR *const text, const Text_AlignModeTypdef mode, sFONT *const font, const uint32_t colour, const uint32_t back_colour)
+{
+    disp_cmd_t *cmd = DispCmdAdd(batch, DISP_CMD_TEXT, colour);
+
+    if (cmd == NULL)
+    {
+        return DEF_FAIL;
+    }
+    cmd->x = x;
+    cmd->y = y;
+    cmd->mode = (CPU_INT08U)mode;
+    cmd->font = font;
+    cmd->back_colour = back_colour;
+    strncpy((char *)cmd->text, (const char *)text, DISP_TEXT_LEN_MAX);
+    cmd->text[DISP_TEXT_LEN_MAX] = '\0';
+    return DEF_OK;
+}
+
+/**
+ * \brief Coalesce and draw the commands of a frame, see Note #3 of disp.h
+ * \return pixels written
+ */
+static CPU_INT32U DispRender(disp_cmd_t *const cmds, disp_box_t *const boxes, const CPU_INT16U count)
+{
+    CPU_INT32U pixels = 0u;
+    CPU_INT16U i;
+    OS_ERR err;
+
+#if (DISP_DBL_BUF_EN > 0u)
+    BlitSurfInit(&DispSurf, BlitFrameBuffer(DISP_BUF_ADDR(DispBackLayer)), BSP_LCD_GetXSize(), BSP_LCD_GetYSize(), BLIT_FMT_ARGB8888);
+#else
+    BlitSurfInit(&DispSurf, BlitFrameBuffer(LCD_FRAME_BUFFER), BSP_LCD_GetXSize(), BSP_LCD_GetYSize(), BLIT_FMT_ARGB8888);
+#endif
+
+    DispStat.culled += DispCoalesce(cmds, boxes, count);
+    for (i = 0u; i < count; i++)
+    {
+        if (boxes[i].x1 > boxes[i].x0)
+        {
+            pixels += DispCmdDraw(&cmds[i], &boxes[i]);
+        }
+    }
+
+    BlitWait(&err); // The frame is drawn on return
+    return pixels;
+}
+
+/**
+ * \brief Compute the box of every command, and empty the box of the ones a later command paints over
+ * \return commands dropped
+ */
+static CPU_INT16U DispCoalesce(const disp_cmd_t *const cmds, disp_box_t *const boxes, const CPU_INT16U count)
+{
+    CPU_INT16U culled = 0u;
+    CPU_INT16U i;
+    CPU_INT16U j;
+
+    for (i = 0u; i < count; i++)
+    {
+        DispCmdBox(&cmds[i], &boxes[i]);
+    }
+
+    for (i = 0u; i < count; i++)
+    {
+        for (j = i + 1u; j < count; j++)
+        {
+            // A later dropped command still counts: what paints over it paints over this one too
+            if ((DispCmdSame(&cmds[i], &cmds[j]) == DEF_TRUE) ||
+                (((boxes[j].flags & DISP_BOX_OPAQUE) != 0u) &&
+                 (boxes[j].x0 <= boxes[i].x0) && (boxes[j].y0 <= boxes[i].y0) &&
+                 (boxes[j].x1 >= boxes[i].x1) && (boxes[j].y1 >= boxes[i].y1)))
+            {
+                boxes[i].x1 = boxes[i].x0;
+                culled++;
+                break;
+            }
+        }
+    }
+    return culled;
+}
+
+/**
+ * \brief Bounding box of the pixels a command writes, opaque when it writes them all
+ * \details Same geometry as the BSP_LCD_xxx() functions
+ */
+static void DispCmdBox(const disp_cmd_t *const cmd, disp_box_t *const box)
+{
+    CPU_INT32S len;
+    CPU_INT32S cols;
+
+    box->flags = 0u;
+    switch (cmd->type)
+    {
+    case DISP_CMD_CLEAR:
+        box->x0 = 0;
+        box->y0 = 0;
+        box->x1 = (CPU_INT32S)BSP_LCD_GetXSize();
+        box->y1 = (CPU_INT32S)BSP_LCD_GetYSize();
+        box->flags = DISP_BOX_OPAQUE;
+        break;
+    case DISP_CMD_FILL_RECT:
+        box->x0 = cmd->x;
+        box->y0 = cmd->y;
+        box->x1 = cmd->x + cmd->w;
+        box->y1 = cmd->y + cmd->h;
+        box->flags = DISP_BOX_OPAQUE;
+        break;
+    case DISP_CMD_FILL_CIRCLE:
+    case DISP_CMD_DRAW_CIRCLE:
+        box->x0 = cmd->x - cmd->w;
+        box->y0 = cmd->y - cmd->w;
+        box->x1 = cmd->x + cmd->w + 1;
+        box->y1 = cmd->y + cmd->w + 1;
+        break;
+    case DISP_CMD_DRAW_LINE:
+        box->x0 = (cmd->x < cmd->w) ? cmd->x : cmd->w;
+        box->y0 = (cmd->y < cmd->h) ? cmd->y : cmd->h;
+        box->x1 = ((cmd->x > cmd->w) ? cmd->x : cmd->w) + 1;
+        box->y1 = ((cmd->y > cmd->h) ? cmd->y : cmd->h) + 1;
+        break;
+    case DISP_CMD_TEXT:
+        len = (CPU_INT32S)strlen((const char *)cmd->text);
+        cols = (CPU_INT32S)BSP_LCD_GetXSize() / cmd->font->Width;
+        switch (cmd->mode)
+        {
+        case CENTER_MODE:
+            box->x0 = cmd->x + ((cols - len) * cmd->font->Width) / 2;
+            break;
+        case RIGHT_MODE:
+            box->x0 = -cmd->x + (cols - len) * cmd->font->Width;
+            break;
+        default:
+            box->x0 = cmd->x;
+            break;
+        }
+        box->y0 = cmd->y;
+        box->x1 = box->x0 + len * cmd->font->Width;
+        box->y1 = cmd->y + cmd->font->Height;
+        if ((len <= cols) && (box->x0 >= 0))
+        {
+            box->flags = DISP_BOX_OPAQUE; // Each glyph writes its cell in the text or the back colour
+        }
+        break;
+    default:
+        box->x0 = 0;
+        box->y0 = 0;
+        box->x1 = 0;
+        box->y1 = 0;
+        break;
+    }
+}
+
+/**
+ * \return DEF_TRUE if both commands write the same pixels in the same colours
+ */
+static CPU_BOOLEAN DispCmdSame(const disp_cmd_t *const cmd1, const disp_cmd_t *const cmd2)
+{
+    if ((cmd1->type != cmd2->type) || (cmd1->colour != cmd2->colour))
+    {
+        return DEF_FALSE;
+    }
+
+    switch (cmd1->type)
+    {
+    case DISP_CMD_CLEAR:
+        return DEF_TRUE;
+    case DISP_CMD_TEXT:
+        return ((cmd1->x == cmd2->x) && (cmd1->y == cmd2->y) && (cmd1->mode == cmd2->mode) &&
+                (cmd1->font == cmd2->font) && (cmd1->back_colour == cmd2->back_colour) &&
+                (strcmp((const char *)cmd1->text, (const char *)cmd2->text) == 0))
+                   ? DEF_TRUE
+                   : DEF_FALSE;
+    default:
+        return ((cmd1->x == cmd2->x) && (cmd1->y == cmd2->y) && (cmd1->w == cmd2->w) && (cmd1->h == cmd2->h))
+                   ? DEF_TRUE
+                   : DEF_FALSE;
+    }
+}
+
+/**
+ * \brief Draw a command with the blitter, else with the BSP, which only the compositor calls, see Notes #1 & #7
+ * of disp.h
+ * \return pixels written, the box for a circle
+ */
+static CPU_INT32U DispCmdDraw(const disp_cmd_t *const cmd, const disp_box_t *const box)
+{
+    const blit_surf_t *mask;
+    blit_rect_t rect;
+    CPU_INT32S len;
+    CPU_INT32S cols;
+    OS_ERR err;
+
+    switch (cmd->type)
+    {
+    case DISP_CMD_CLEAR:
+    case DISP_CMD_FILL_RECT:
+        (void)BlitFill(&DispSurf, box->x0, box->y0, box->x1 - box->x0, box->y1 - box->y0, cmd->colour);
+        return (CPU_INT32U)((box->x1 - box->x0) * (box->y1 - box->y0));
+    case DISP_CMD_FILL_CIRCLE:
+    case DISP_CMD_DRAW_CIRCLE:
+        mask = DispMaskGet(cmd->type, cmd->w);
+        if (mask != NULL)
+        {
+            rect.x = 0;
+            rect.y = 0;
+            rect.w = mask->width;
+            rect.h = mask->height;
+            (void)BlitBlend(&DispSurf, box->x0, box->y0, mask, &rect, cmd->colour);
+            return (CPU_INT32U)((box->x1 - box->x0) * (box->y1 - box->y0));
+        }
+        break;
+    case DISP_CMD_TEXT:
+        len = (CPU_INT32S)strlen((const char *)cmd->text);
+        cols = (CPU_INT32S)BSP_LCD_GetXSize() / cmd->font->Width;
+        if (TextDraw(&DispSurf, box->x0, box->y0, cmd->text, (CPU_INT16U)((len < cols) ? len : cols), cmd->font, cmd->colour, cmd->back_colour) == DEF_OK)
+        {
+            return (CPU_INT32U)((box->x1 - box->x0) * (box->y1 - box->y0));
+        }
+        break;
+    case DISP_CMD_DRAW_LINE:
+        if ((cmd->x == cmd->w) || (cmd->y == cmd->h)) // Both ends included, like BSP_LCD_DrawLine()
+        {
+            (void)BlitFill(&DispSurf, box->x0, box->y0, box->x1 - box->x0, box->y1 - box->y0, cmd->colour);
+        }
+        else
+        {
+            BlitWait(&err);
+            BSP_LCD_SetTextColor(cmd->colour);
+            BSP_LCD_DrawLine(cmd->x, cmd->y, cmd->w, cmd->h);
+        }
+        return (CPU_INT32U)((box->x1 - box->x0 > box->y1 - box->y0) ? box->x1 - box->x0 : box->y1 - box->y0);
+    default:
+        break;
+    }
+
+    // The CPU draws the rest with the BSP, once the blitter is done, see Note #3 of blit.h
+    BlitWait(&err);
+    BSP_LCD_SetTextColor(cmd->colour);
+    switch (cmd->type)
+    {
+    case DISP_CMD_FILL_CIRCLE:
+        BSP_LCD_FillCircle(cmd->x, cmd->y, cmd->w);
+        break;
+    case DISP_CMD_DRAW_CIRCLE:
+        BSP_LCD_DrawCircle(cmd->x, cmd->y, cmd->w);
+        break;
+    case DISP_CMD_TEXT:
+        BSP_LCD_SetBackColor(cmd->back_colour);
+        BSP_LCD_SetFont(cmd->font);
+        BSP_LCD_DisplayStringAt(cmd->x, cmd->y, (uint8_t *)cmd->text, (Text_AlignModeTypdef)cmd->mode);
+        break;
+    default:
+        return 0u;
+    }
+    return (CPU_INT32U)((box->x1 - box->x0) * (box->y1 - box->y0));
+}
+
+/**
+ * \brief A8 mask of a circle in a (2 * radius + 1) square, the pixels of BSP_LCD_FillCircle() or
+ * BSP_LCD_DrawCircle() at 0xFF, made again when the circle changes
+ * \return the mask, NULL if the radius is over DISP_MASK_RADIUS_MAX
+ */
+static const blit_surf_t *DispMaskGet(const CPU_INT08U type, const CPU_INT16U radius)
+{
+    CPU_INT32S dim = 2 * (CPU_INT32S)radius + 1;
+    CPU_INT32S d = 3 - 2 * (CPU_INT32S)radius;
+    CPU_INT32S cur_x = 0;
+    CPU_INT32S cur_y = radius;
+    CPU_INT32S c = radius; // Centre
+    CPU_INT32S i;
+    OS_ERR err;
+
+    if (radius > DISP_MASK_RADIUS_MAX)
+    {
+        return NULL;
+    }
+    if ((DispMaskSurf.pixels != NULL) && (DispMaskType == type) && (DispMaskRadius == radius))
+    {
+        return &DispMaskSurf;
+    }
+
+    BlitWait(&err); // The blitter may still read the last mask
+    BlitSurfInit(&DispMaskSurf, DispMask, (CPU_INT16U)dim, (CPU_INT16U)dim, BLIT_FMT_A8);
+    DispMaskType = type;
+    DispMaskRadius = radius;
+    memset(DispMask, 0, (size_t)(dim * dim));
+
+    // Same steps as the BSP
+    while (cur_x <= cur_y)
+    {
+        if (type == DISP_CMD_FILL_CIRCLE)
+        {
+            for (i = -cur_y; i < cur_y; i++)
+            {
+                DispMask[(c + cur_x) * dim + c + i] = 0xFFu;
+                DispMask[(c - cur_x) * dim + c + i] = 0xFFu;
+            }
+            for (i = -cur_x; i < cur_x; i++)
+            {
+                DispMask[(c - cur_y) * dim + c + i] = 0xFFu;
+                DispMask[(c + cur_y) * dim + c + i] = 0xFFu;
+            }
+        }
+        DispMask[(c - cur_y) * dim + c + cur_x] = 0xFFu; // The outline, drawn by BSP_LCD_FillCircle() too
+        DispMask[(c - cur_y) * dim + c - cur_x] = 0xFFu;
+        DispMask[(c - cur_x) * dim + c + cur_y] = 0xFFu;
+        DispMask[(c - cur_x) * dim + c - cur_y] = 0xFFu;
+        DispMask[(c + cur_y) * dim + c + cur_x] = 0xFFu;
+        DispMask[(c + cur_y) * dim + c - cur_x] = 0xFFu;
+        DispMask[(c + cur_x) * dim + c + cur_y] = 0xFFu;
+        DispMask[(c + cur_x) * dim + c - cur_y] = 0xFFu;
+
+        if (d < 0)
+        {
+            d += 4 * cur_x + 6;
+        }
+        else
+        {
+            d += 4 * (cur_x - cur_y) + 10;
+            cur_y--;
+        }
+        cur_x++;
+    }
+    return &DispMaskSurf;
+}
+
+/**
+ * \return the new command at the end of the batch, NULL if full
+ */
+static disp_cmd_t *DispCmdAdd(disp_batch_t *const batch, const CPU_INT08U type, const uint32_t colour)
+{
+    disp_cmd_t *cmd;
+
+    if (batch->count >= DISP_BATCH_SIZE)
+    {
+        return NULL;
+    }
+    cmd = &batch->cmds[batch->count++];
+    cmd->type = type;
+    cmd->mode = 0u;
+    cmd->x = 0u;
+    cmd->y = 0u;
+    cmd->w = 0u;
+    cmd->h = 0u;
+    cmd->colour = colour;
+    cmd->back_colour = 0u;
+    cmd->font = NULL;
+    cmd->text[0] = '\0';
+    return cmd;
+}
+
+#if (DISP_DBL_BUF_EN > 0u)
+/**
+ * \brief Have the back buffer shown at the next vertical blanking and wait for it, then draw in the other one
+ */
+static void DispFlip(void)
+{
+    OS_ERR err = OS_ERR_NONE;
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    DispFlipAddress = DISP_BUF_ADDR(DispBackLayer);
+    DispFlipPending = DEF_TRUE;
+    CPU_CRITICAL_EXIT();
+
+    while ((DispFlipPending == DEF_TRUE) && (err == OS_ERR_NONE))
+    {
+        DispFrameWait(&err);
+    }
+
+    DispBackLayer = (DispBackLayer == LCD_FOREGROUND_LAYER) ? LCD_BACKGROUND_LAYER : LCD_FOREGROUND_LAYER;
+    BSP_LCD_SelectLayer(DispBackLayer);
+}
+
+/**
+ * \brief Keep the commands of the frame just drawn which were not culled, at the start of cmds[], to draw
+ * them again in the other buffer, see Note #6c of disp.h
+ * \param [IN] first - first command of the frame, the ones before are the frame shown before
+ * \return commands kept
+ */
+static CPU_INT16U DispShownKeep(disp_cmd_t *const cmds, const disp_box_t *const boxes, const CPU_INT16U first, const CPU_INT16U count)
+{
+    CPU_INT16U kept = 0u;
+    CPU_INT16U i;
+
+    for (i = first; i < count; i++)
+    {
+        if (boxes[i].x1 > boxes[i].x0)
+        {
+            cmds[kept++] = cmds[i]; // kept <= i
+        }
+    }
+    return kept;
+}
+#endif
+
+static void DispStatFrame(const CPU_INT32U pixels)
+{
+    DispStat.frames++;
+    DispStat.pixels_frame = pixels;
+    if (pixels > DispStat.pixels_max)
+    {
+        DispStat.pixels_max = pixels;
+    }
+}
@@ -0,0 +1,165 @@
+/*
+*********************************************************************************************************
+*                                              COMPOSITOR
+*
+* Note(s) : (1) The compositor task is the only task drawing on the LCD.  The other tasks fill a batch of
+*               draw commands & post it to the queue of the compositor, so they no longer draw while
+*               holding the game mutexes, nor share the text colour & the font of the BSP.
+*
+*           (2) The compositor waits for a batch, takes every batch queued by then & renders their commands
+*               as one frame, then waits for the next frame (see Note #6): the screen is written at most
+*               once per frame, whatever the number of tasks drawing.  The batches which do not fit in a
+*               frame are rendered in the next one.
+*
+*           (3) Before a frame is rendered, a command is dropped when a later command of the frame paints
+*               over all of its pixels: the same command again, or a fill, clear or text covering its
+*               bounding box.
+*
+*           (4) The batches come from a pool of DISP_BATCH_NBR, counted by a semaphore, so DispBatchGet()
+*               waits for the compositor to give one back instead of failing.
+*
+*           (5) The coordinates are the ones of the BSP_LCD_xxx() functions, origin at the top left corner.
+*
+*           (6) With DISP_DBL_BUF_EN, the background layer is the only one shown and the compositor draws in
+*               the framebuffer it does not show, the one of the BSP layer selected for drawing:
+*
+*               (a) LCD_Init() of the application puts BSP layer n on DISP_BUF_ADDR(n) & disables the
+*                   foreground layer, with both framebuffers cleared to the same colour.
+*
+*               (b) Once a frame is drawn, the LTDC line interrupt at the first line of the vertical
+*                   blanking writes its address in the background layer & reloads it, so the panel never
+*                   shows a frame being drawn.  The interrupt then posts DispFrameSem to all its waiters:
+*                   DispFrameWait() returns once per frame shown, the compositor draws the next frame in
+*                   the other buffer & the tasks of the application produce the next batches.
+*
+*               (c) The buffer drawn next is one frame late: the commands of the frame shown are drawn
+*                   again before the new ones, and culled with them (see Note #3).
+*
+*               Without it, the compositor draws in the framebuffer shown & a frame lasts DISP_FRAME_MS.
+*
+*           (7) The compositor draws with the blitter (see 'blit.h'): the fills, clears & straight lines are
+*               fills, the circles blend an A8 mask of the pixels the BSP would draw in their colour, so the
+*               DMA2D writes the pixels while the compositor waits.  The text is drawn from the glyph atlas &
+*               the run cache of 'text.h', the text of a font without an atlas & the other lines by the BSP,
+*               once the blitter is done.  The colours are opaque, as the BSP writes them as is.
+*********************************************************************************************************
+*/
+
+#ifndef DISP_H
+#define DISP_H
+
+#include "os.h"
+#include "stm32f429i_discovery_lcd.h"
+#include "blit.h"
+#include "text.h"
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#ifndef DISP_BATCH_NBR
+#define DISP_BATCH_NBR 4u // Batches of the pool, see Note #4
+#endif
+
+#ifndef DISP_BATCH_SIZE
+#define DISP_BATCH_SIZE 16u // Commands of a batch
+#endif
+
+#ifndef DISP_FRAME_SIZE
+#define DISP_FRAME_SIZE 64u // Commands of a frame, a fuller frame is rendered in parts
+#endif
+
+#ifndef DISP_FRAME_MS
+#define DISP_FRAME_MS 20u // Frame period without DISP_DBL_BUF_EN
+#endif
+
+#ifndef DISP_DBL_BUF_EN
+#define DISP_DBL_BUF_EN 1u // Draw in a back buffer shown at the vertical blanking, see Note #6
+#endif
+
+#if (DISP_BATCH_SIZE > DISP_FRAME_SIZE)
+#error "DISP_BATCH_SIZE must fit in a frame, DISP_FRAME_SIZE"
+#endif
+
+#define DISP_BUF_ADDR(layer) (LCD_FRAME_BUFFER + (uint32_t)(layer)*BUFFER_OFFSET) // Framebuffer of a BSP layer, see Note #6
+
+#define DISP_TASK_STK_SIZE 256u
+#define DISP_TEXT_LEN_MAX 39u
+
+/* Commands */
+#define DISP_CMD_CLEAR (CPU_INT08U)0       // The whole screen
+#define DISP_CMD_FILL_RECT (CPU_INT08U)1   // x, y, w, h
+#define DISP_CMD_FILL_CIRCLE (CPU_INT08U)2 // Centre x, y, radius w
+#define DISP_CMD_DRAW_CIRCLE (CPU_INT08U)3 // Centre x, y, radius w
+#define DISP_CMD_DRAW_LINE (CPU_INT08U)4   // From x, y to w, h
+#define DISP_CMD_TEXT (CPU_INT08U)5        // At x, y in mode, font & back_colour
+
+/*
+*********************************************************************************************************
+*                                            DATA STRUCTURES
+*********************************************************************************************************
+*/
+
+typedef struct disp_cmd
+{
+    CPU_INT08U type; // DISP_CMD_xxx
+    CPU_INT08U mode; // Text_AlignModeTypdef of a text
+    CPU_INT16U x;
+    CPU_INT16U y;
+    CPU_INT16U w;
+    CPU_INT16U h;
+    uint32_t colour;
+    uint32_t back_colour;
+    sFONT *font;
+    CPU_CHAR text[DISP_TEXT_LEN_MAX + 1u];
+} disp_cmd_t;
+
+typedef struct disp_batch
+{
+    CPU_INT16U count;
+    disp_cmd_t cmds[DISP_BATCH_SIZE];
+} disp_batch_t;
+
+typedef struct disp_stat
+{
+    CPU_INT32U frames;       // Frames rendered
+    CPU_INT32U cmds;         // Commands received
+    CPU_INT32U culled;       // Commands dropped, see Note #3
+    CPU_INT32U replayed;     // Commands of the frame shown drawn again in the back buffer, see Note #6
+    CPU_INT32U pixels_frame; // Pixels written by the last frame
+    CPU_INT32U pixels_max;   // Most pixels written by one frame
+} disp_stat_t;
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+extern disp_stat_t DispStat;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void DispInit(const OS_PRIO prio, OS_ERR *const p_err);
+
+disp_batch_t *DispBatchGet(const OS_TICK timeout, OS_ERR *const p_err);
+void DispBatchPost(disp_batch_t *const batch, OS_ERR *const p_err);
+void DispBatchPut(disp_batch_t *const batch);
+void DispBatchInit(disp_batch_t *const batch);
+CPU_INT32U DispBatchRender(disp_batch_t *const batch);
+void DispFrameWait(OS_ERR *const p_err);
+
+CPU_BOOLEAN DispClear(disp_batch_t *const batch, const uint32_t colour);
+CPU_BOOLEAN DispFillRect(disp_batch_t *const batch, const CPU_INT16U x, const CPU_INT16U y, const CPU_INT16U w, const CPU_INT16U h, const uint32_t colour);
+CPU_BOOLEAN DispFillCircle(disp_batch_t *const batch, const CPU_INT16U x, const CPU_INT16U y, const CPU_INT16U radius, const uint32_t colour);
+CPU_BOOLEAN DispDrawCircle(disp_batch_t *const batch, const CPU_INT16U x, const CPU_INT16U y, const CPU_INT16U radius, const uint32_t colour);
+CPU_BOOLEAN DispDrawLine(disp_batch_t *const batch, const CPU_INT16U x1, const CPU_INT16U y1, const CPU_INT16U x2, const CPU_INT16U y2, const uint32_t colour);
+CPU_BOOLEAN DispText(disp_batch_t *const batch, const CPU_INT16U x, const CPU_INT16U y, const CPU_CHAR *const text, const Text_AlignModeTypdef mode, sFONT *const font, const uint32_t colour, const uint32_t back_colour);
+
+#endif
@@ -0,0 +1,382 @@
+/*
+*********************************************************************************************************
+*                                            TEXT RENDERING
+*
+* Note(s) : (1) See 'text.h'.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include <string.h>
+#include "text.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define TEXT_RUN_ALIGN 8u // Start of the pixels of a run in the pool, for the wide stores of the blitter
+
+/*
+*********************************************************************************************************
+*                                            DATA STRUCTURES
+*********************************************************************************************************
+*/
+
+typedef struct text_atlas
+{
+    const sFONT *font;                             // NULL: free
+    blit_surf_t surf;                              // A8, the glyphs side by side, see Note #2 of text.h
+    CPU_INT32U ink[(TEXT_GLYPH_NBR + 31u) / 32u]; // Glyphs with a set bit, the others are only the back colour
+} text_atlas_t;
+
+typedef struct text_run
+{
+    const sFONT *font; // NULL: free
+    uint32_t colour;
+    uint32_t back_colour;
+    CPU_INT32U hash;
+    CPU_INT32U seq;    // Order of the rendering, the lowest is dropped first
+    CPU_INT32U offset; // Pixels in TextRunPool[]
+    CPU_INT32U size;
+    blit_surf_t surf;
+    CPU_INT16U len;
+    CPU_CHAR text[TEXT_RUN_LEN_MAX + 1u];
+} text_run_t;
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+text_stat_t TextStat;
+
+static CPU_INT08U TextAtlasPool[TEXT_ATLAS_SIZE];
+static CPU_INT32U TextAtlasUsed;
+static text_atlas_t TextAtlas[TEXT_FONT_NBR];
+
+static CPU_INT08U TextRunPool[TEXT_RUN_POOL_SIZE] __attribute__((aligned(TEXT_RUN_ALIGN)));
+static CPU_INT32U TextRunHead; // Next free byte of the ring, see Note #3 of text.h
+static CPU_INT32U TextRunSeq;
+static text_run_t TextRun[TEXT_RUN_NBR];
+static CPU_INT32U TextSeen[TEXT_RUN_NBR]; // Hashes of the strings drawn once
+static CPU_INT08U TextSeenNext;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static const text_atlas_t *TextAtlasFind(const sFONT *const font);
+static void TextGlyphs(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const CPU_CHAR *const text, const CPU_INT16U len, const text_atlas_t *const atlas, const uint32_t colour, const uint32_t back_colour);
+static CPU_INT32U TextHash(const CPU_CHAR *const text, const CPU_INT16U len, const sFONT *const font, const uint32_t colour, const uint32_t back_colour);
+static text_run_t *TextRunFind(const CPU_INT32U hash, const CPU_CHAR *const text, const CPU_INT16U len, const sFONT *const font, const uint32_t colour, const uint32_t back_colour);
+static CPU_BOOLEAN TextRunSeen(const CPU_INT32U hash);
+static text_run_t *TextRunAlloc(const CPU_INT32U size);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+/**
+ * \brief Atlas of a font, expanded from its table on the first call, see Note #2 of text.h
+ * \return the A8 atlas, glyph c at x (c - TEXT_GLYPH_FIRST) * font->Width; NULL if TEXT_ATLAS_SIZE or
+ * TEXT_FONT_NBR is full
+ */
+const blit_surf_t *TextAtlasGet(const sFONT *const font)
+{
+    const text_atlas_t *atlas = TextAtlasFind(font);
+
+    return (atlas != NULL) ? &atlas->surf : NULL;
+}
+
+/**
+ * \brief Draw len characters of text at x, y, the pixels of BSP_LCD_DisplayChar() for each, see Note #1 of
+ * text.h
+ * \details The characters out of the font tables are drawn blank, in the back colour.  Cached in a run from the
+ * second call with the same text, font & colours, see Note #3 of text.h.  The blitter may still be drawing on
+ * return (see Note #2 of blit.h).
+ * \return DEF_FAIL if the font has no atlas, nothing is drawn
+ */
+CPU_BOOLEAN TextDraw(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const CPU_CHAR *const text, const CPU_INT16U len, const sFONT *const font, const uint32_t colour, const uint32_t back_colour)
+{
+    const text_atlas_t *atlas = TextAtlasFind(font);
+    CPU_INT32S w = (CPU_INT32S)len * font->Width;
+    CPU_INT32U hash;
+    text_run_t *run;
+    blit_rect_t rect;
+
+    if (atlas == NULL)
+    {
+        return DEF_FAIL;
+    }
+    if ((len == 0u) || (len > TEXT_RUN_LEN_MAX))
+    {
+        TextGlyphs(dst, x, y, text, len, atlas, colour, back_colour);
+        return DEF_OK;
+    }
+
+    hash = TextHash(text, len, font, colour, back_colour);
+    run = TextRunFind(hash, text, len, font, colour, back_colour);
+    if (run != NULL)
+    {
+        TextStat.run_hits++;
+    }
+    else
+    {
+        run = (TextRunSeen(hash) == DEF_TRUE) ? TextRunAlloc((CPU_INT32U)w * font->Height * 4u) : NULL;
+        if (run == NULL)
+        {
+            TextGlyphs(dst, x, y, text, len, atlas, colour, back_colour);
+            return DEF_OK;
+        }
+
+        run->font = font;
+        run->colour = colour;
+        run->back_colour = back_colour;
+        run->hash = hash;
+        run->len = len;
+        memcpy(run->text, text, len);
+        run->text[len] = '\0';
+        BlitSurfInit(&run->surf, &TextRunPool[run->offset], (CPU_INT16U)w, font->Height, BLIT_FMT_ARGB8888);
+        TextGlyphs(&run->surf, 0, 0, text, len, atlas, colour, back_colour);
+        TextStat.run_fills++;
+    }
+
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = run->surf.width;
+    rect.h = run->surf.height;
+    (void)BlitCopy(dst, x, y, &run->surf, &rect);
+    return DEF_OK;
+}
+
+/**
+ * \brief Drop the runs cached and the strings seen, e.g. to time the drawing without the cache
+ */
+void TextFlush(void)
+{
+    OS_ERR err;
+
+    BlitWait(&err); // A copy may still read a run
+    memset(TextRun, 0, sizeof(TextRun));
+    memset(TextSeen, 0, sizeof(TextSeen));
+    TextRunHead = 0u;
+}
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+/**
+ * \brief Atlas of a font, expanded from the bits of its table like DrawChar() of the BSP on the first call
+ */
+static const text_atlas_t *TextAtlasFind(const sFONT *const font)
+{
+    text_atlas_t *atlas = NULL;
+    CPU_INT32U size = (CPU_INT32U)font->Width * font->Height * TEXT_GLYPH_NBR;
+    CPU_INT32U bytes = (font->Width + 7u) / 8u; // Of a line of a glyph in the table
+    CPU_INT32U offset = 8u * bytes - font->Width;
+    CPU_INT32U line;
+    CPU_INT32U g;
+    CPU_INT32U i;
+    CPU_INT32U j;
+    const uint8_t *c;
+    CPU_INT08U *p;
+
+    for (i = 0u; i < TEXT_FONT_NBR; i++)
+    {
+        if (TextAtlas[i].font == font)
+        {
+            return &TextAtlas[i];
+        }
+        if ((atlas == NULL) && (TextAtlas[i].font == NULL))
+        {
+            atlas = &TextAtlas[i];
+        }
+    }
+    if ((atlas == NULL) || (size > TEXT_ATLAS_SIZE - TextAtlasUsed))
+    {
+        return NULL;
+    }
+
+    atlas->font = font;
+    BlitSurfInit(&atlas->surf, &TextAtlasPool[TextAtlasUsed], (CPU_INT16U)(font->Width * TEXT_GLYPH_NBR), font->Height, BLIT_FMT_A8);
+    TextAtlasUsed += size;
+    memset(atlas->surf.pixels, 0, size);
+    memset(atlas->ink, 0, sizeof(atlas->ink));
+    TextStat.atlases++;
+    if (font->table == NULL) // The host fonts, the cells only
+    {
+        return atlas;
+    }
+
+    for (g = 0u; g < TEXT_GLYPH_NBR; g++)
+    {
+        c = &font->table[g * font->Height * bytes];
+        for (i = 0u; i < font->Height; i++)
+        {
+            line = 0u;
+            for (j = 0u; j < bytes; j++)
+            {
+                line = (line << 8) | c[i * bytes + j];
+            }
+            p = (CPU_INT08U *)atlas->surf.pixels + i * atlas->surf.pitch + g * font->Width;
+            for (j = 0u; j < font->Width; j++)
+            {
+                if ((line & (1u << (font->Width - j + offset - 1u))) != 0u)
+                {
+                    p[j] = 0xFFu;
+                    atlas->ink[g / 32u] |= 1u << (g % 32u);
+                }
+            }
+        }
+    }
+    return atlas;
+}
+
+/**
+ * \brief Draw the glyphs one by one: the cells in the back colour, then the glyphs with ink blended over it
+ */
+static void TextGlyphs(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const CPU_CHAR *const text, const CPU_INT16U len, const text_atlas_t *const atlas, const uint32_t colour, const uint32_t back_colour)
+{
+    const sFONT *font = atlas->font;
+    blit_rect_t rect;
+    CPU_INT32U g;
+    CPU_INT16U i;
+
+    (void)BlitFill(dst, x, y, (CPU_INT32S)len * font->Width, font->Height, back_colour);
+    rect.y = 0;
+    rect.w = font->Width;
+    rect.h = font->Height;
+    for (i = 0u; i < len; i++)
+    {
+        g = (CPU_INT32U)(CPU_INT08U)text[i] - (CPU_INT32U)TEXT_GLYPH_FIRST;
+        if ((g >= TEXT_GLYPH_NBR) || ((atlas->ink[g / 32u] & (1u << (g % 32u))) == 0u))
+        {
+            continue;
+        }
+        rect.x = (CPU_INT32S)(g * font->Width);
+        (void)BlitBlend(dst, x + (CPU_INT32S)i * font->Width, y, &atlas->surf, &rect, colour);
+        TextStat.glyphs++;
+    }
+}
+
+/**
+ * \brief FNV-1a of the key of a run
+ */
+static CPU_INT32U TextHash(const CPU_CHAR *const text, const CPU_INT16U len, const sFONT *const font, const uint32_t colour, const uint32_t back_colour)
+{
+    CPU_INT32U hash = 2166136261u;
+    CPU_INT16U i;
+
+    for (i = 0u; i < len; i++)
+    {
+        hash = (hash ^ (CPU_INT08U)text[i]) * 16777619u;
+    }
+    hash = (hash ^ (CPU_INT32U)(uintptr_t)font) * 16777619u;
+    hash = (hash ^ colour) * 16777619u;
+    hash = (hash ^ back_colour) * 16777619u;
+    return (hash != 0u) ? hash : 1u; // 0 is a free entry of TextSeen[]
+}
+
+static text_run_t *TextRunFind(const CPU_INT32U hash, const CPU_CHAR *const text, const CPU_INT16U len, const sFONT *const font, const uint32_t colour, const uint32_t back_colour)
+{
+    CPU_INT16U i;
+
+    for (i = 0u; i < TEXT_RUN_NBR; i++)
+    {
+        if ((TextRun[i].font == font) && (TextRun[i].hash == hash) && (TextRun[i].len == len) &&
+            (TextRun[i].colour == colour) && (TextRun[i].back_colour == back_colour) &&
+            (memcmp(TextRun[i].text, text, len) == 0))
+        {
+            return &TextRun[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * \return DEF_TRUE if the string was drawn before, else remember it, see Note #3 of text.h
+ */
+static CPU_BOOLEAN TextRunSeen(const CPU_INT32U hash)
+{
+    CPU_INT16U i;
+
+    for (i = 0u; i < TEXT_RUN_NBR; i++)
+    {
+        if (TextSeen[i] == hash)
+        {
+            TextSeen[i] = 0u;
+            return DEF_TRUE;
+        }
+    }
+    TextSeen[TextSeenNext] = hash;
+    TextSeenNext = (CPU_INT08U)((TextSeenNext + 1u) % TEXT_RUN_NBR);
+    return DEF_FALSE;
+}
+
+/**
+ * \brief Room for the pixels of a run at the head of the ring, the runs there and the oldest one if no entry
+ * is free are dropped
+ * \details The blitter draws in order: a copy from a dropped run is done before the new run is drawn over it
+ * \return the run, NULL if size is over TEXT_RUN_POOL_SIZE
+ */
+static text_run_t *TextRunAlloc(const CPU_INT32U size)
+{
+    text_run_t *run = NULL;
+    CPU_INT16U i;
+
+    if (size > TEXT_RUN_POOL_SIZE)
+    {
+        return NULL;
+    }
+    if (TextRunHead + size > TEXT_RUN_POOL_SIZE) // The head may be past the end, aligned
+    {
+        TextRunHead = 0u;
+    }
+
+    for (i = 0u; i < TEXT_RUN_NBR; i++)
+    {
+        if ((TextRun[i].font != NULL) &&
+            (TextRun[i].offset < TextRunHead + size) && (TextRunHead < TextRun[i].offset + TextRun[i].size))
+        {
+            TextRun[i].font = NULL;
+            TextStat.run_drops++;
+        }
+        if ((TextRun[i].font == NULL) && (run == NULL))
+        {
+            run = &TextRun[i];
+        }
+    }
+    if (run == NULL)
+    {
+        run = &TextRun[0];
+        for (i = 1u; i < TEXT_RUN_NBR; i++)
+        {
+            if (TextRun[i].seq < run->seq)
+            {
+                run = &TextRun[i];
+            }
+        }
+        TextStat.run_drops++;
+    }
+
+    run->offset = TextRunHead;
+    run->size = size;
+    run->seq = TextRunSeq++;
+    TextRunHead += (size + TEXT_RUN_ALIGN - 1u) & ~(TEXT_RUN_ALIGN - 1u);
+    return run;
+}
@@ -0,0 +1,93 @@
+/*
+*********************************************************************************************************
+*                                            TEXT RENDERING
+*
+* Note(s) : (1) Draws the text of the BSP fonts with the blitter (see 'blit.h') instead of the pixel by pixel
+*               loop of BSP_LCD_DisplayChar(), same pixels: each glyph writes its cell, the text colour on
+*               the set bits of the font table & the back colour elsewhere.
+*
+*           (2) The glyphs of a font are expanded once, on its first use, into an atlas: an A8 surface of
+*               the printable characters side by side, 0xFF on the set bits.  A glyph is drawn by blending
+*               its rectangle of the atlas in the text colour over the back colour, so one atlas serves every
+*               pair of colours.  The atlases share TEXT_ATLAS_SIZE bytes, sized for Font12 & Font16: the
+*               text of a font which does not fit is left to the BSP (TextDraw() fails).
+*
+*           (3) A string drawn again is a run: its pixels, in both colours, are kept in a cache keyed by the
+*               text, the font & the colours, and drawn by one copy.  A run is cached the second time it is
+*               drawn, so the text which changes at every draw (e.g. coordinates) does not push the static
+*               one out.  The runs share a ring of TEXT_RUN_POOL_SIZE bytes, the oldest are dropped to make
+*               room.
+*
+*           (4) One task draws text at a time, the one of the blitter (see Note #4 of 'blit.h').
+*********************************************************************************************************
+*/
+
+#ifndef TEXT_H
+#define TEXT_H
+
+#include "blit.h"
+#include "fonts.h"
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#ifndef TEXT_ATLAS_SIZE
+#define TEXT_ATLAS_SIZE ((7u * 12u + 11u * 16u) * TEXT_GLYPH_NBR) // Bytes of the atlases, Font12 & Font16, see Note #2
+#endif
+
+#ifndef TEXT_FONT_NBR
+#define TEXT_FONT_NBR 2u // Fonts with an atlas
+#endif
+
+#ifndef TEXT_RUN_NBR
+#define TEXT_RUN_NBR 8u // Runs cached, see Note #3
+#endif
+
+#ifndef TEXT_RUN_POOL_SIZE
+#define TEXT_RUN_POOL_SIZE (16u * 1024u) // Bytes of the pixels of the runs, ARGB8888
+#endif
+
+#ifndef TEXT_RUN_LEN_MAX
+#define TEXT_RUN_LEN_MAX 39u // Characters of a run, longer text is drawn glyph by glyph
+#endif
+
+#define TEXT_GLYPH_FIRST ' '
+#define TEXT_GLYPH_NBR 95u // ' ' to '~', the characters of the font tables
+
+/*
+*********************************************************************************************************
+*                                            DATA STRUCTURES
+*********************************************************************************************************
+*/
+
+typedef struct text_stat
+{
+    CPU_INT32U atlases;   // Atlases expanded
+    CPU_INT32U glyphs;    // Glyphs blended, in a frame or in a run
+    CPU_INT32U run_hits;  // Strings drawn by one copy, see Note #3
+    CPU_INT32U run_fills; // Runs rendered in the cache
+    CPU_INT32U run_drops; // Runs dropped for room
+} text_stat_t;
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+extern text_stat_t TextStat;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+const blit_surf_t *TextAtlasGet(const sFONT *const font);
+CPU_BOOLEAN TextDraw(const blit_surf_t *const dst, const CPU_INT32S x, const CPU_INT32S y, const CPU_CHAR *const text, const CPU_INT16U len, const sFONT *const font, const uint32_t colour, const uint32_t back_colour);
+void TextFlush(void);
+
+#endif
@@ -0,0 +1,372 @@
+/*
+*********************************************************************************************************
+*                                             TOUCH INPUT
+*
+* Note(s) : (1) See 'touch.h'.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "touch.h"
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#ifdef CPU_CFG_KA_IPL_BOUNDARY
+#define TOUCH_IRQ_PRIO CPU_CFG_KA_IPL_BOUNDARY // Kernel aware, the ISR posts
+#else
+#define TOUCH_IRQ_PRIO 0u
+#endif
+
+/*
+*********************************************************************************************************
+*                                            DATA STRUCTURES
+*********************************************************************************************************
+*/
+
+typedef struct touch_sub
+{
+    OS_TCB *tcb;
+    CPU_INT08U mask;                 // TOUCH_EVT_xxx sent to the task
+    CPU_INT08U next;                 // Slot of the next event in ring[]
+    touch_evt_t ring[TOUCH_EVT_NBR]; // See Note #4 of touch.h
+} touch_sub_t;
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+touch_stat_t TouchStat;
+
+static OS_TCB TouchTCB;
+static CPU_STK TouchStk[TOUCH_TASK_STK_SIZE];
+
+static touch_sub_t TouchSub[TOUCH_SUB_NBR];
+static CPU_INT08U TouchSubCount;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void TouchTask(void *p_arg);
+static void TouchTrack(void);
+static void TouchSend(touch_evt_t *const evt);
+static CPU_INT32U TouchNow(void);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+/**
+ * \brief Create the driver task & enable the interrupt of the touch screen, after BSP_TS_Init()
+ * \param [IN] prio - of the driver task, above the subscribers so an event is sent as soon as it is seen
+ * \param [OUT] p_err - error of the task creation
+ */
+void TouchInit(const OS_PRIO prio, OS_ERR *const p_err)
+{
+    OSTaskCreate((OS_TCB *)&TouchTCB,
+                 (CPU_CHAR *)"Touch Task",
+                 (OS_TASK_PTR)TouchTask,
+                 (void *)0,
+                 (OS_PRIO)prio,
+                 (CPU_STK *)&TouchStk[0],
+                 (CPU_STK_SIZE)TOUCH_TASK_STK_SIZE / 10,
+                 (CPU_STK_SIZE)TOUCH_TASK_STK_SIZE,
+                 (OS_MSG_QTY)0u,
+                 (OS_TICK)0u,
+                 (void *)0,
+                 (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR *)p_err);
+    if (*p_err != OS_ERR_NONE)
+    {
+        return;
+    }
+
+    (void)BSP_TS_ITConfig(); // Controller interrupts & EXTI line
+    HAL_NVIC_SetPriority(STMPE811_INT_EXTI, TOUCH_IRQ_PRIO, 0u);
+    HAL_NVIC_EnableIRQ(STMPE811_INT_EXTI);
+}
+
+/**
+ * \brief Send the events of a type to a task, see Note #4 of touch.h
+ * \param [IN] p_tcb - created with a task message queue of 1 to TOUCH_EVT_NBR - 1 messages
+ * \param [IN] mask - TOUCH_EVT_xxx
+ * \param [OUT] p_err - OS_ERR_NONE, OS_ERR_Q_SIZE for a queue of another size, OS_ERR_Q_MAX if there are
+ * TOUCH_SUB_NBR subscribers already
+ */
+void TouchSubscribe(OS_TCB *const p_tcb, const CPU_INT08U mask, OS_ERR *const p_err)
+{
+    touch_sub_t *sub;
+    CPU_SR_ALLOC();
+
+    if ((p_tcb->MsgQ.NbrEntriesSize == 0u) || (p_tcb->MsgQ.NbrEntriesSize >= TOUCH_EVT_NBR))
+    {
+        *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (TouchSubCount >= TOUCH_SUB_NBR)
+    {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_Q_MAX;
+        return;
+    }
+    sub = &TouchSub[TouchSubCount];
+    sub->tcb = p_tcb;
+    sub->mask = mask;
+    sub->next = 0u;
+    TouchSubCount++;
+    CPU_CRITICAL_EXIT();
+    *p_err = OS_ERR_NONE;
+}
+
+/**
+ * \brief Wait for an event of a subscription of the calling task
+ * \param [IN] timeout - ticks, 0 waits forever
+ * \param [OUT] p_err - error of the queue pend
+ * \return the event, to be copied before pending again, NULL on error
+ */
+const touch_evt_t *TouchPend(const OS_TICK timeout, OS_ERR *const p_err)
+{
+    OS_MSG_SIZE size;
+    CPU_TS ts;
+    const touch_evt_t *evt;
+
+    evt = (const touch_evt_t *)OSTaskQPend((OS_TICK)timeout,
+                                          (OS_OPT)OS_OPT_PEND_BLOCKING,
+                                          (OS_MSG_SIZE *)&size,
+                                          (CPU_TS *)&ts,
+                                          (OS_ERR *)p_err);
+    return (*p_err == OS_ERR_NONE) ? evt : NULL;
+}
+
+/**
+ * \brief STMPE811 INT, see Note #1 of touch.h
+ */
+void EXTI15_10_IRQHandler(void)
+{
+    OS_ERR err;
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();
+    CPU_CRITICAL_EXIT();
+
+    if (__HAL_GPIO_EXTI_GET_IT(STMPE811_INT_PIN) != 0u)
+    {
+        __HAL_GPIO_EXTI_CLEAR_IT(STMPE811_INT_PIN);
+        HAL_NVIC_DisableIRQ(STMPE811_INT_EXTI); // Until the touch is over, the task samples meanwhile
+        OSTaskSemPost((OS_TCB *)&TouchTCB, (OS_OPT)OS_OPT_POST_NONE, (OS_ERR *)&err);
+    }
+
+    OSIntExit();
+}
+
+/*
+*********************************************************************************************************
+*                                                  TASKS
+*********************************************************************************************************
+*/
+
+/**
+ * \brief Track a touch per interrupt, see Note #1 of touch.h
+ */
+static void TouchTask(void *p_arg)
+{
+    OS_ERR err;
+    CPU_TS ts;
+    TS_StateTypeDef state;
+
+    (void)p_arg;
+    while (DEF_TRUE)
+    {
+        OSTaskSemPend((OS_TICK)0,
+                      (OS_OPT)OS_OPT_PEND_BLOCKING,
+                      (CPU_TS *)&ts,
+                      (OS_ERR *)&err);
+        TouchStat.wakeups++;
+
+        TouchTrack();
+
+        BSP_TS_ITClear();
+        HAL_NVIC_EnableIRQ(STMPE811_INT_EXTI);
+
+        // A touch which started before the clear raised no new interrupt
+        BSP_TS_GetState(&state);
+        TouchStat.samples++;
+        if (state.TouchDetected != 0u)
+        {
+            OSTaskSemPost((OS_TCB *)&TouchTCB, (OS_OPT)OS_OPT_POST_NONE, (OS_ERR *)&err);
+        }
+    }
+}
+
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+/**
+ * \brief Sample the screen until it is released & send the gesture, see Notes #2 & #3 of touch.h
+ */
+static void TouchTrack(void)
+{
+    OS_ERR err;
+    TS_StateTypeDef state;
+    touch_evt_t evt = {0};
+    CPU_INT08U touched = 0u;
+    CPU_INT08U released = 0u;
+    CPU_BOOLEAN pressed = DEF_FALSE;
+    CPU_BOOLEAN held = DEF_FALSE; // Long press sent
+    CPU_INT32U start = 0u;
+
+    while (DEF_TRUE)
+    {
+        BSP_TS_GetState(&state);
+        TouchStat.samples++;
+
+        if (state.TouchDetected != 0u)
+        {
+            released = 0u;
+            if (touched == 0u)
+            {
+                evt.x = state.X;
+                evt.y = state.Y;
+                start = TouchNow();
+            }
+            if (touched < TOUCH_DEBOUNCE)
+            {
+                touched++;
+                pressed = (touched >= TOUCH_DEBOUNCE) ? DEF_TRUE : DEF_FALSE;
+            }
+
+            evt.dx = (CPU_INT16S)((CPU_INT32S)state.X - (CPU_INT32S)evt.x);
+            evt.dy = (CPU_INT16S)((CPU_INT32S)state.Y - (CPU_INT32S)evt.y);
+            evt.ms = TouchNow() - start;
+            if ((pressed == DEF_TRUE) && (held == DEF_FALSE) && (evt.ms >= TOUCH_LONG_MS) &&
+                (evt.dx > -TOUCH_SWIPE_MIN) && (evt.dx < TOUCH_SWIPE_MIN) &&
+                (evt.dy > -TOUCH_SWIPE_MIN) && (evt.dy < TOUCH_SWIPE_MIN))
+            {
+                evt.type = TOUCH_EVT_LONG_PRESS;
+                evt.dir = TOUCH_DIR_NONE;
+                TouchSend(&evt);
+                held = DEF_TRUE;
+            }
+        }
+        else
+        {
+            if (pressed == DEF_FALSE)
+            {
+                touched = 0u; // Bounce, see Note #2
+            }
+            released++;
+            if (released >= TOUCH_DEBOUNCE)
+            {
+                break;
+            }
+        }
+
+        OSTimeDlyHMSM((CPU_INT16U)0,
+                      (CPU_INT16U)0,
+                      (CPU_INT16U)0,
+                      (CPU_INT32U)TOUCH_SAMPLE_MS,
+                      (OS_OPT)OS_OPT_TIME_HMSM_NON_STRICT,
+                      (OS_ERR *)&err);
+    }
+
+    if ((pressed == DEF_FALSE) || (held == DEF_TRUE))
+    {
+        return;
+    }
+
+    if ((evt.dx >= TOUCH_SWIPE_MIN) || (evt.dx <= -TOUCH_SWIPE_MIN) ||
+        (evt.dy >= TOUCH_SWIPE_MIN) || (evt.dy <= -TOUCH_SWIPE_MIN))
+    {
+        evt.type = TOUCH_EVT_SWIPE;
+        if (((evt.dx < 0) ? -evt.dx : evt.dx) >= ((evt.dy < 0) ? -evt.dy : evt.dy))
+        {
+            evt.dir = (evt.dx > 0) ? TOUCH_DIR_RIGHT : TOUCH_DIR_LEFT;
+        }
+        else
+        {
+            evt.dir = (evt.dy > 0) ? TOUCH_DIR_DOWN : TOUCH_DIR_UP;
+        }
+    }
+    else
+    {
+        evt.type = TOUCH_EVT_TAP;
+        evt.dir = TOUCH_DIR_NONE;
+    }
+    TouchSend(&evt);
+}
+
+/**
+ * \brief Post an event to its subscribers, see Note #4 of touch.h
+ */
+static void TouchSend(touch_evt_t *const evt)
+{
+    OS_ERR err;
+    touch_sub_t *sub;
+    CPU_INT08U i;
+
+    switch (evt->type)
+    {
+    case TOUCH_EVT_TAP:
+        TouchStat.taps++;
+        break;
+    case TOUCH_EVT_SWIPE:
+        TouchStat.swipes++;
+        break;
+    default:
+        TouchStat.long_presses++;
+        break;
+    }
+
+    for (i = 0u; i < TouchSubCount; i++)
+    {
+        sub = &TouchSub[i];
+        if ((sub->mask & evt->type) == 0u)
+        {
+            continue;
+        }
+
+        sub->ring[sub->next] = *evt;
+        OSTaskQPost((OS_TCB *)sub->tcb,
+                    (void *)&sub->ring[sub->next],
+                    (OS_MSG_SIZE)sizeof(touch_evt_t),
+                    (OS_OPT)OS_OPT_POST_FIFO,
+                    (OS_ERR *)&err);
+        if (err != OS_ERR_NONE)
+        {
+            TouchStat.dropped++;
+            continue;
+        }
+        sub->next = (CPU_INT08U)((sub->next + 1u) % TOUCH_EVT_NBR);
+    }
+}
+
+/**
+ * \return milliseconds of the kernel tick
+ */
+static CPU_INT32U TouchNow(void)
+{
+    OS_ERR err;
+
+    return (CPU_INT32U)((CPU_INT64U)OSTimeGet(&err) * 1000u / OSCfg_TickRate_Hz);
+}
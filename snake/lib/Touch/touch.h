@@ -0,0 +1,131 @@
+/*
+*********************************************************************************************************
+*                                             TOUCH INPUT
+*
+* Note(s) : (1) The touch screen is read on its interrupt instead of polled: the STMPE811 pulls its INT pin
+*               (STMPE811_INT_PIN, EXTI line 15) when the screen is touched, the ISR masks the line & wakes
+*               the driver task, which samples the screen every TOUCH_SAMPLE_MS while it is touched, then
+*               clears the interrupts of the controller & unmasks the line.  While the screen is not
+*               touched, no task runs for the touch input.
+*
+*           (2) A touch starts after TOUCH_DEBOUNCE samples touched in a row & ends after TOUCH_DEBOUNCE
+*               samples released in a row, so a shorter contact or bounce is no touch.
+*
+*           (3) A touch is one gesture, from its first sample touched to its last one:
+*
+*               (a) TOUCH_EVT_LONG_PRESS, sent while the screen is still touched, once it has been held
+*                   TOUCH_LONG_MS within TOUCH_SWIPE_MIN pixels of where it started.  Nothing is sent
+*                   at its release.
+*
+*               (b) TOUCH_EVT_SWIPE, at the release of a touch which moved TOUCH_SWIPE_MIN pixels or more
+*                   along an axis, in the direction of the larger move.
+*
+*               (c) TOUCH_EVT_TAP otherwise, at the release, at the point where the touch started.
+*
+*               The coordinates are the ones of BSP_TS_GetState().
+*
+*           (4) The events go to the task message queue of the tasks subscribed to their type.  Each
+*               subscriber has a ring of TOUCH_EVT_NBR events & gets pointers to it: an event stays valid
+*               while fewer than TOUCH_EVT_NBR - 1 newer ones are posted to the same task, so a subscriber
+*               copies an event before pending again & its queue holds fewer than TOUCH_EVT_NBR messages
+*               (TouchSubscribe() checks).  An event which does not fit in the queue is dropped.
+*********************************************************************************************************
+*/
+
+#ifndef TOUCH_H
+#define TOUCH_H
+
+#include "os.h"
+#include "stm32f429i_discovery_ts.h"
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*/
+
+#ifndef TOUCH_SAMPLE_MS
+#define TOUCH_SAMPLE_MS 10u // Sampling period while touched, see Note #1
+#endif
+
+#ifndef TOUCH_DEBOUNCE
+#define TOUCH_DEBOUNCE 2u // Samples in a row to start or end a touch, see Note #2
+#endif
+
+#ifndef TOUCH_LONG_MS
+#define TOUCH_LONG_MS 600u // Hold of a long press, see Note #3a
+#endif
+
+#ifndef TOUCH_SWIPE_MIN
+#define TOUCH_SWIPE_MIN 40 // Pixels of a swipe, see Note #3b
+#endif
+
+#ifndef TOUCH_SUB_NBR
+#define TOUCH_SUB_NBR 4u // Subscribers
+#endif
+
+#ifndef TOUCH_EVT_NBR
+#define TOUCH_EVT_NBR 8u // Events of the ring of a subscriber, see Note #4
+#endif
+
+#define TOUCH_TASK_STK_SIZE 256u
+
+/* Event types, bits of a subscription mask */
+#define TOUCH_EVT_TAP (CPU_INT08U)0x01
+#define TOUCH_EVT_SWIPE (CPU_INT08U)0x02
+#define TOUCH_EVT_LONG_PRESS (CPU_INT08U)0x04
+#define TOUCH_EVT_ALL (CPU_INT08U)0x07
+
+/* Swipe directions, in the coordinates of the touch screen */
+#define TOUCH_DIR_NONE (CPU_INT08U)0
+#define TOUCH_DIR_LEFT (CPU_INT08U)1  // X decreasing
+#define TOUCH_DIR_RIGHT (CPU_INT08U)2 // X increasing
+#define TOUCH_DIR_UP (CPU_INT08U)3    // Y decreasing
+#define TOUCH_DIR_DOWN (CPU_INT08U)4  // Y increasing
+
+/*
+*********************************************************************************************************
+*                                            DATA STRUCTURES
+*********************************************************************************************************
+*/
+
+typedef struct touch_evt
+{
+    CPU_INT08U type; // TOUCH_EVT_xxx
+    CPU_INT08U dir;  // TOUCH_DIR_xxx of a swipe
+    CPU_INT16U x;    // Where the touch started
+    CPU_INT16U y;
+    CPU_INT16S dx;   // Move from there to the last sample touched
+    CPU_INT16S dy;
+    CPU_INT32U ms;   // Held, from the first sample touched to the last one
+} touch_evt_t;
+
+typedef struct touch_stat
+{
+    CPU_INT32U wakeups;      // Interrupts which woke the driver task
+    CPU_INT32U samples;      // BSP_TS_GetState() calls
+    CPU_INT32U taps;         // Events sent, whatever the subscribers
+    CPU_INT32U swipes;
+    CPU_INT32U long_presses;
+    CPU_INT32U dropped;      // Events which did not fit in the queue of a subscriber
+} touch_stat_t;
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+extern touch_stat_t TouchStat;
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void TouchInit(const OS_PRIO prio, OS_ERR *const p_err);
+void TouchSubscribe(OS_TCB *const p_tcb, const CPU_INT08U mask, OS_ERR *const p_err);
+const touch_evt_t *TouchPend(const OS_TICK timeout, OS_ERR *const p_err);
+
+#endif
@@ -86,8 +86,8 @@ void  OSStatReset (OS_ERR  *p_err)
 
 #if (OS_CFG_TMR_EN > 0u)
 #if (OS_CFG_TS_EN > 0u)
-    OSTmrTaskTime         = 0u;
-    OSTmrTaskTimeMax      = 0u;
+    OSTmrTaskDflt.Time    = 0u;
+    OSTmrTaskDflt.TimeMax = 0u;
 #endif
 #endif
 
@@ -5,6 +5,7 @@
 */
 
 #include "main.h"
+#include "snake.h"
 
 /*
 *********************************************************************************************************
@@ -16,113 +17,14 @@
 #define TASK_STK_SIZE 256u
 
 /* Task Priority */
+#define TOUCH_PRIO 9u // Driver of the touch screen, wakes on its interrupt, see 'touch.h'
 #define APP_TASK_START_PRIO 10u
 #define TOUCH_INPUT_PRIO 11u
 #define ANALYSIS_PRIO 12u
 #define GAME_RUN_PRIO 13u
 #define DRAW_SNAKE_PRIO 14u
 #define DRAW_APPLE_PRIO 15u
-
-/* Debug logger */
-// typedef unsigned char LOG_MASK    //typedef not working
-#define LOG_TOUCH_SCREEN (uint8_t)0x01
-#define LOG_BOARD_DATA_CORRUPT (uint8_t)0x02
-#define LOG_ERR_ANALYS (uint8_t)0x04
-#define LOG_ERR_MEMORY (uint8_t)0x08
-#define LOG_CPU_STATUS (uint8_t)0x20
-#define LOG_TASK_COUNT (uint8_t)0x40
-#define LOG_CONTEXT_SWITCH (uint8_t)0x80
-#define LOG_OS_STATUS (uint8_t)0xe0
-#define LOG_ALL (uint8_t)0xff
-#define LOG_EN 1u
-
-/* Data structures */
-typedef struct tuples
-{
-    CPU_INT16S X;
-    CPU_INT16S Y;
-} tuple_t;
-
-typedef struct apples
-{
-    tuple_t coordinates;
-    uint32_t colour; // snake get a new body with the same colour as the eaten apple
-} apple_t;
-
-typedef struct snake_body_nodes
-{
-    tuple_t coordinates;
-    uint32_t colour;
-    struct snake_body_nodes *previous_node;
-    struct snake_body_nodes *next_node;
-} snake_body_node_t;
-
-typedef struct snakes
-{
-    CPU_INT16U length;
-    CPU_INT16S speed;
-    tuple_t direction;
-    snake_body_node_t *head;
-    snake_body_node_t *tail;
-} snake_t;
-
-typedef struct game_data
-{
-    snake_t *snake;
-    apple_t *apple;
-} gamedata_t;
-
-/* Game Parameters */
-#define SCALE (CPU_INT16S)10 // Map the actual pixel to a square of the grid
-#define HALF_SCALE (CPU_INT16S)5
-#define LENGTH_MAX 32 * 24
-#define INTEVAL_MILLISEC_MAX 999
-#define INTEVAL_MILLISEC_MIN 100
-#define INTEVAL_MILLISEC_START 500
-#define DIR_LEFT \
-    (tuple_t)    \
-    {            \
-        0, 1     \
-    }
-#define DIR_RIGHT \
-    (tuple_t)     \
-    {             \
-        0, -1     \
-    }
-#define DIR_DOWN \
-    (tuple_t)    \
-    {            \
-        1, 0     \
-    }
-#define DIR_UP \
-    (tuple_t)  \
-    {          \
-        -1, 0  \
-    }
-typedef CPU_INT08U gameresult_t;
-#define COLLISION_NO (CPU_INT08U)0
-#define COLLISION_SNAKE_HEAD (CPU_INT08U)1
-#define COLLISION_SNAKE_BODY (CPU_INT08U)2
-#define RESULT_WON (gameresult_t)0
-#define RESULT_LOST (gameresult_t)1
-#define APPLE_START_COLOUR LCD_COLOR_RED
-#define SNAKE_START_SPEED (CPU_INT16S)1
-#define SNAKE_START_LENGTH (CPU_INT16U)1
-#define SNAKE_HEAD_COLOUR LCD_COLOR_GREEN
-#define SNAKE_START_DIRECTION DIR_LEFT
-#define SNAKE_X_OFFSET 0 - HALF_SCALE // OFFSET for centering the each squre of the grid
-#define SNAKE_Y_OFFSET 0 - HALF_SCALE
-#define SNAKE_START_COORDINATES \
-    (tuple_t)                   \
-    {                           \
-        115, 115                \
-    }
-
-#define APPLE_START_COORDINATES \
-    (tuple_t)                   \
-    {                           \
-        115, 205                \
-    }
+#define COMPOSITOR_PRIO 16u // Draws the batches of DrawSnake & DrawApple, see 'disp.h'
 
 /*
 *********************************************************************************************************
@@ -148,8 +50,11 @@ static CPU_STK AnalysisStk[TASK_STK_SIZE];
 
 static TS_StateTypeDef TS_State;
 
-OS_MUTEX mutex_apple;
-OS_MUTEX mutex_snake;
+OS_MUTEX mutex_snake; // The direction, between TouchInput & GameRun
+OS_SEQLOCK seqlock_view; // Snapshot of the game GameRun publishes, see Note #9 of snake.h
+static snake_view_t view_buf[2];
+
+analysis_stat_t AnalysisStat; // Step-to-verdict latency, see Note #10 of snake.h
 
 /*
 *********************************************************************************************************
@@ -170,21 +75,9 @@ static void SystemClock_Config(void);
 static void LCD_Init(void);
 
 /* Game Functions */
-static void SnakeInit(snake_t *const snake);
-static void AppleInit(apple_t *const apple);
-static void SnakeCoordinatesUpdate(snake_t *const snake);
-static void SnakeSpeedUpdate(snake_t *const snake);
-static snake_body_node_t *NewSnakeNode(void);
-static void AddSnakeBodyNode(snake_t *const snake);
-static const CPU_INT08U SnakeCollisionCheck(const snake_body_node_t *const snake_head, const tuple_t *const point);
-static void FreeSnake(snake_body_node_t *snake_head);
-static void AppleCoordinatesUpdate(gamedata_t *const game_data);
-static void AppleColourUpdate(apple_t *const apple);
-static const CPU_BOOLEAN TryEatApple(snake_t *const snake, const apple_t *const apple);
 static void GameOver(void *p_arg);
 static void PrintResult(const gameresult_t result);
-static void logger(const uint8_t mask);
-static const CPU_BOOLEAN TupleCompare(const tuple_t *const tuple1, const tuple_t *const tuple2);
+static void DrawTest(disp_batch_t *const batch);
 static CPU_INT16U NodeDistance(const tuple_t *const point1, const tuple_t *const point2);
 
 /*
@@ -197,12 +90,9 @@ int main(void)
 {
     OS_ERR err;
 
-    OSInit(&err);
+    CPU_Init(); //Timestamp timer of OS_TS_GET(), before the kernel uses it
 
-    // mutex is actually not needed in this App at all. Because each Task run on their own turn by Task Control Block, there is no cocurrency. But I decided to leave the original code for case study
-    OSMutexCreate((OS_MUTEX *)&mutex_apple,
-                  (CPU_CHAR *)"Mutex for apple",
-                  (OS_ERR *)&err);
+    OSInit(&err);
 
     OSMutexCreate((OS_MUTEX *)&mutex_snake,
                   (CPU_CHAR *)"Mutex for snake",
@@ -233,31 +123,41 @@ int main(void)
 static void AppTaskStart(void *p_arg)
 {
     OS_ERR err;
-    snake_t snake;
-    apple_t apple;
-    gamedata_t data = {&snake, &apple};
+    static snake_t snake; // a few KiB, off the task stack
+    static apple_t apple;
+    static gamedata_t data = {&snake, &apple};
 
     AppleInit(&apple);
     SnakeInit(&snake);
+    SnakeViewInit(&view_buf[0], &snake, &apple);
+    OSSeqLockCreate(&seqlock_view, (CPU_CHAR *)"Snapshot of the game", &view_buf[0], &view_buf[1], sizeof(snake_view_t), &err);
 
     HAL_Init();
 
     SystemClock_Config();
+    CPU_TS_TmrInit(); //Timestamps count at the new core clock
 
     BSP_LED_Init(LED3);
     BSP_LED_Init(LED4);
 
     LCD_Init();
+    BlitInit(&err); // Before the first transfer, see 'blit.h'
+
+#if (SNAKE_BENCH_EN > 0u)
+    SnakeBench_Run(COMPOSITOR_PRIO, TOUCH_PRIO); //Does not return
+#endif
+
+    DispInit(COMPOSITOR_PRIO, &err); // The only task drawing on the LCD from now on
 
     uint8_t status = 0;
     status = BSP_TS_Init(BSP_LCD_GetXSize(), BSP_LCD_GetYSize());
 
     if (status != TS_OK)
     {
-        BSP_LCD_SetBackColor(LCD_COLOR_WHITE);
-        BSP_LCD_SetTextColor(LCD_COLOR_RED);
-        BSP_LCD_DisplayStringAt(0, BSP_LCD_GetYSize() - 95, (uint8_t *)"ERROR", CENTER_MODE);
-        BSP_LCD_DisplayStringAt(0, BSP_LCD_GetYSize() - 80, (uint8_t *)"Touchscreen cannot be initialized", CENTER_MODE);
+        disp_batch_t *batch = DispBatchGet(0u, &err);
+        DispText(batch, 0, BSP_LCD_GetYSize() - 95, (CPU_CHAR *)"ERROR", CENTER_MODE, &Font12, LCD_COLOR_RED, LCD_COLOR_WHITE);
+        DispText(batch, 0, BSP_LCD_GetYSize() - 80, (CPU_CHAR *)"Touchscreen cannot be initialized", CENTER_MODE, &Font12, LCD_COLOR_RED, LCD_COLOR_WHITE);
+        DispBatchPost(batch, &err);
     }
     else
     {
@@ -274,6 +174,8 @@ static void AppTaskStart(void *p_arg)
                      (void *)0,
                      (OS_OPT)(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
                      (OS_ERR *)&err);
+        TouchSubscribe(&TouchInputTCB, TOUCH_EVT_TAP | TOUCH_EVT_SWIPE, &err);
+        TouchInit(TOUCH_PRIO, &err);
 
         OSTaskCreate((OS_TCB *)&GameRunTCB,
                      (CPU_CHAR *)"GameRun Task",
@@ -292,7 +194,7 @@ static void AppTaskStart(void *p_arg)
         OSTaskCreate((OS_TCB *)&DrawSnakeTCB,
                      (CPU_CHAR *)"DrawSnake Task",
                      (OS_TASK_PTR)DrawSnake,
-                     (void *)data.snake,
+                     (void *)NULL,
                      (OS_PRIO)DRAW_SNAKE_PRIO,
                      (CPU_STK *)&DrawSnakeStk[0],
                      (CPU_STK_SIZE)TASK_STK_SIZE / 10,
@@ -306,7 +208,7 @@ static void AppTaskStart(void *p_arg)
         OSTaskCreate((OS_TCB *)&DrawAppleTCB,
                      (CPU_CHAR *)"DrawApple Task",
                      (OS_TASK_PTR)DrawApple,
-                     (void *)data.apple,
+                     (void *)NULL,
                      (OS_PRIO)DRAW_APPLE_PRIO,
                      (CPU_STK *)&DrawAppleStk[0],
                      (CPU_STK_SIZE)TASK_STK_SIZE / 10,
@@ -320,7 +222,7 @@ static void AppTaskStart(void *p_arg)
         OSTaskCreate((OS_TCB *)&AnalysisTCB,
                      (CPU_CHAR *)"Analysis Task",
                      (OS_TASK_PTR)Analysis,
-                     (void *)data.snake,
+                     (void *)NULL,
                      (OS_PRIO)ANALYSIS_PRIO,
                      (CPU_STK *)&AnalysisStk[0],
                      (CPU_STK_SIZE)TASK_STK_SIZE / 10,
@@ -345,59 +247,70 @@ static void AppTaskStart(void *p_arg)
 */
 
 /**
- * @brief Converts user touch input to UP, DOWN, LEFT, RIGHT
- * @param [IN] p_arg - cast to gamedata_t* before use
+ * @brief Converts the taps & swipes of the touch screen to UP, DOWN, LEFT, RIGHT
+ * @details A tap steers by the zone it hits, a swipe to the direction it moves on the screen; the snake turns
+ * only across its direction
+ * @param [IN] p_arg - cast to snake_t* before use
  * @author siyuan xu, e2101066@edu.vamk.fi, 12.2022
  */
 static void TouchInput(void *p_arg)
 {
     OS_ERR err;
     CPU_TS ts;
+    touch_evt_t evt;
+    const touch_evt_t *p_evt;
     snake_t *snake = ((snake_t *)p_arg);
     while (DEF_TRUE)
     {
-        BSP_TS_GetState(&TS_State);
-        // logger(LOG_TOUCH_SCREEN);
-
-        if (TS_State.TouchDetected)
+        p_evt = TouchPend(0u, &err); // See 'touch.h'
+        if (p_evt == NULL)
         {
-            OSMutexPend((OS_MUTEX *)&mutex_snake,
-                        (OS_TICK)0,
-                        (OS_OPT)OS_OPT_PEND_BLOCKING,
-                        (CPU_TS *)&ts,
-                        (OS_ERR *)&err);
+            continue;
+        }
+        evt = *p_evt;
+        TS_State.TouchDetected = 1u;
+        TS_State.X = evt.x;
+        TS_State.Y = evt.y;
 
-            if (TS_State.Y < 75)
-            {
-                if (TupleCompare(&(snake->direction), &DIR_UP) || TupleCompare(&(snake->direction), &DIR_DOWN)) // can turn LEFT only if current direction is UP or DOWN
-                    snake->direction = DIR_LEFT;
-            }
-            else if (TS_State.Y < 225)
+        OSMutexPend((OS_MUTEX *)&mutex_snake,
+                    (OS_TICK)0,
+                    (OS_OPT)OS_OPT_PEND_BLOCKING,
+                    (CPU_TS *)&ts,
+                    (OS_ERR *)&err);
+
+        if (evt.type == TOUCH_EVT_SWIPE)
+        {
+            SnakeSteer(snake, &evt);
+        }
+        else if (TS_State.Y < 75)
+        {
+            if (TupleCompare(&(snake->direction), &DIR_UP) || TupleCompare(&(snake->direction), &DIR_DOWN)) // can turn LEFT only if current direction is UP or DOWN
+                snake->direction = DIR_LEFT;
+        }
+        else if (TS_State.Y < 225)
+        {
+            if ((TupleCompare(&(snake->direction), &DIR_LEFT) || TupleCompare(&(snake->direction), &DIR_RIGHT))) // can turn UP/DOWN only if current direction is LEFT or RIGHT
             {
-                if ((TupleCompare(&(snake->direction), &DIR_LEFT) || TupleCompare(&(snake->direction), &DIR_RIGHT))) // can turn UP/DOWN only if current direction is LEFT or RIGHT
+                if (TS_State.X < 120)
                 {
-                    if (TS_State.X < 120)
-                    {
-
-                        snake->direction = DIR_UP;
-                    }
-                    else
-                    {
-                        snake->direction = DIR_DOWN;
-                    }
+
+                    snake->direction = DIR_UP;
+                }
+                else
+                {
+                    snake->direction = DIR_DOWN;
                 }
             }
-            else if (TS_State.Y >= 225)
-            {
-                if ((TupleCompare(&(snake->direction), &DIR_UP) || TupleCompare(&(snake->direction), &DIR_DOWN))) // can turn RIGHT only if current direction is UP or DOWN
-                    snake->direction = DIR_RIGHT;
-            }
-
-            OSMutexPost((OS_MUTEX *)&mutex_snake,
-                        (OS_OPT)OS_OPT_POST_NONE,
-                        (OS_ERR *)&err);
         }
-        OSTimeDly(1, OS_OPT_TIME_DLY, &err);
+        else if (TS_State.Y >= 225)
+        {
+            if ((TupleCompare(&(snake->direction), &DIR_UP) || TupleCompare(&(snake->direction), &DIR_DOWN))) // can turn RIGHT only if current direction is UP or DOWN
+                snake->direction = DIR_RIGHT;
+        }
+
+        OSMutexPost((OS_MUTEX *)&mutex_snake,
+                    (OS_OPT)OS_OPT_POST_NONE,
+                    (OS_ERR *)&err);
     }
 }
 
@@ -413,6 +326,7 @@ static void GameRun(void *p_arg)
     CPU_INT16U interval = INTEVAL_MILLISEC_START;
     snake_t *snake = ((gamedata_t *)p_arg)->snake;
     apple_t *apple = ((gamedata_t *)p_arg)->apple;
+    snake_view_t *view;
 
     while (DEF_TRUE)
     {
@@ -430,75 +344,64 @@ static void GameRun(void *p_arg)
         SnakeCoordinatesUpdate(snake);
         SnakeSpeedUpdate(snake);
 
-        OSMutexPend((OS_MUTEX *)&mutex_apple,
-                    (OS_TICK)0,
-                    (OS_OPT)OS_OPT_PEND_BLOCKING,
-                    (CPU_TS *)&ts,
-                    (OS_ERR *)&err);
-
         if (TryEatApple(snake, apple))
         {
             AppleCoordinatesUpdate((gamedata_t *)p_arg);
             AppleColourUpdate(apple);
         }
 
-        OSMutexPost((OS_MUTEX *)&mutex_apple,
-                    (OS_OPT)OS_OPT_POST_NONE,
-                    (OS_ERR *)&err);
-
         OSMutexPost((OS_MUTEX *)&mutex_snake,
                     (OS_OPT)OS_OPT_POST_NONE,
                     (OS_ERR *)&err);
 
-        OSTimeDlyHMSM(
-            (CPU_INT16U)0,
-            (CPU_INT16U)0,
-            (CPU_INT16U)0,
-            (CPU_INT16U)interval,
-            OS_OPT_TIME_DLY,
-            &err);
+        // The next step 'interval' after the release of this one, see Note #11 of snake.h
+        OSTimePeriodicSet((OS_TICK)((CPU_INT32U)interval * OSCfg_TickRate_Hz / 1000u),
+                          (OS_TICK)0,
+                          (OS_ERR *)&err);
+
+        // Publish the step, the tasks reading the game never make GameRun wait
+        view = (snake_view_t *)OSSeqLockWrBegin(&seqlock_view, OS_OPT_SEQLOCK_COPY, &err);
+        SnakeViewUpdate(view, snake, apple);
+        OSSeqLockWrEnd(&seqlock_view, &err);
+
+        OSTaskSemPost((OS_TCB *)&AnalysisTCB, // The verdict of the step, see Note #10 of snake.h
+                      (OS_OPT)OS_OPT_POST_NONE,
+                      (OS_ERR *)&err);
+
+        OSTimePeriodicWait((OS_ERR *)&err);
     }
 }
 
 /**
  * \brief Draw snake to the LCD Screen
- * \param [IN] p_arg - cast to gamedata_t* before use
+ * \param [IN] p_arg - unused
  * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
  */
 static void DrawSnake(void *p_arg)
 {
     OS_ERR err;
-    CPU_TS ts;
-    snake_t *snake = (snake_t *)p_arg;
-    snake_body_node_t *snake_node;
+    static snake_view_t view;          // Copy of the snapshot, off the task stack
+    static uint32_t shown[LENGTH_MAX]; // Colour of each cell drawn
+    disp_batch_t *batch;
+    CPU_INT16U cell;
+
+    for (cell = 0u; cell < LENGTH_MAX; cell++)
+    {
+        shown[cell] = LCD_COLOR_BLACK; // The screen LCD_Init() cleared
+    }
 
     while (DEF_TRUE)
     {
-        BSP_LCD_Clear(LCD_COLOR_BLACK);
-        OSMutexPend((OS_MUTEX *)&mutex_snake,
-                    (OS_TICK)0,
-                    (OS_OPT)OS_OPT_PEND_BLOCKING,
-                    (CPU_TS *)&ts,
-                    (OS_ERR *)&err);
-        snake_node = snake->head;
-        while (snake_node != NULL)
-        {
-            BSP_LCD_SetTextColor(snake_node->colour);
-            BSP_LCD_FillRect(snake_node->coordinates.X + SNAKE_X_OFFSET, snake_node->coordinates.Y + SNAKE_Y_OFFSET, SCALE, SCALE);
-            snake_node = snake_node->next_node;
-        }
+        batch = DispBatchGet(0u, &err);
 
-        OSMutexPost((OS_MUTEX *)&mutex_snake,
-                    (OS_OPT)OS_OPT_POST_NONE,
-                    (OS_ERR *)&err);
+        (void)OSSeqLockRead(&seqlock_view, &view, &err); // Never waits for GameRun, see Note #9 of snake.h
+
+        // Only the cells changed since the last frame
+        (void)SnakeViewRender(&view, shown, batch);
+
+        DispBatchPost(batch, &err); // Given back without waking the compositor up if no cell changed
 
-        OSTimeDlyHMSM(
-            (CPU_INT16U)0,
-            (CPU_INT16U)0,
-            (CPU_INT16U)0,
-            (CPU_INT16U)20,
-            OS_OPT_TIME_DLY,
-            &err);
+        DispFrameWait(&err); // Once per frame shown
     }
 }
 
@@ -506,92 +409,88 @@ static void DrawSnake(void *p_arg)
  * \brief Testing Circle and Rect offset
  * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
  */
-static void DrawTest(void)
+static void DrawTest(disp_batch_t *const batch)
 {
-    BSP_LCD_FillCircle(100, 100, HALF_SCALE);
-    BSP_LCD_FillRect(100 + SNAKE_X_OFFSET , 100 + SNAKE_Y_OFFSET, SCALE, SCALE);
+    DispFillCircle(batch, 100, 100, HALF_SCALE, LCD_COLOR_WHITE);
+    DispFillRect(batch, 100 + SNAKE_X_OFFSET, 100 + SNAKE_Y_OFFSET, SCALE, SCALE, LCD_COLOR_WHITE);
 }
 
 /**
  * \brief Draw apple to the LCD Screen
- * \param [IN] p_arg - cast to gamedata_t* before use
+ * \param [IN] p_arg - unused
  * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
  */
 static void DrawApple(void *p_arg)
 {
     OS_ERR err;
-    CPU_TS ts;
-    apple_t *apple = (apple_t *)p_arg;
+    OS_SEQ seq;
+    const snake_view_t *view;
+    apple_t apple;
+    disp_batch_t *batch;
 
     while (DEF_TRUE)
     {
-        OSMutexPend((OS_MUTEX *)&mutex_apple,
-                    (OS_TICK)0,
-                    (OS_OPT)OS_OPT_PEND_BLOCKING,
-                    (CPU_TS *)&ts,
-                    (OS_ERR *)&err);
+        batch = DispBatchGet(0u, &err);
+
+        do // The apple only, read in place
+        {
+            view = (const snake_view_t *)OSSeqLockRdBegin(&seqlock_view, &seq, &err);
+            apple = view->apple;
+        } while (OSSeqLockRdRetry(&seqlock_view, seq));
 
-        BSP_LCD_SetTextColor(apple->colour);
-        BSP_LCD_FillCircle(apple->coordinates.X, apple->coordinates.Y, HALF_SCALE);
-        // DrawTest();
+        // Every frame, a cell the snake leaves may be repainted over the new apple. HALF_SCALE - 1 keeps the circle in
+        // its cell: the centre is HALF_SCALE pixels from the left & top edges, HALF_SCALE - 1 from the right & bottom
+        DispFillCircle(batch, apple.coordinates.X, apple.coordinates.Y, HALF_SCALE - 1, apple.colour);
+        // DrawTest(batch);
 
-        OSMutexPost((OS_MUTEX *)&mutex_apple,
-                    (OS_OPT)OS_OPT_POST_NONE,
-                    (OS_ERR *)&err);
+        DispBatchPost(batch, &err);
 
-        OSTimeDlyHMSM(
-            (CPU_INT16U)0,
-            (CPU_INT16U)0,
-            (CPU_INT16U)0,
-            (CPU_INT16U)20,
-            OS_OPT_TIME_DLY,
-            &err);
+        DispFrameWait(&err);
     }
 }
 
 /**
- * \brief Check if snake's head hit it's body
- * \param [IN] p_arg - cast to gamedata_t* before use
+ * \brief Check if snake's head hit it's body, once per step
+ * \param [IN] p_arg - unused
  * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
  */
 static void Analysis(void *p_arg)
 {
     OS_ERR err;
     CPU_TS ts;
+    OS_SEQ seq;
+    const snake_view_t *view;
+    CPU_BOOLEAN collision;
+    CPU_INT16U length;
+    CPU_INT32U step;
+    CPU_TS ts_step;
+    gameresult_t result;
 
-    snake_t *snake = (snake_t *)p_arg;
     while (DEF_TRUE)
     {
-        OSMutexPend((OS_MUTEX *)&mutex_snake,
-                    (OS_TICK)0,
-                    (OS_OPT)OS_OPT_PEND_BLOCKING,
-                    (CPU_TS *)&ts,
-                    (OS_ERR *)&err);
+        OSTaskSemPend((OS_TICK)0, // Posted by GameRun after each step, see Note #10 of snake.h
+                      (OS_OPT)OS_OPT_PEND_BLOCKING,
+                      (CPU_TS *)&ts,
+                      (OS_ERR *)&err);
 
-        // TBD - check if snake head hits the body
-        if (SnakeCollisionCheck(snake->head, &(snake->head->coordinates)) == COLLISION_SNAKE_BODY)
+        do // Above GameRun, the read is never restarted
         {
-            // game over
-            PrintResult(RESULT_LOST);
-            GameOver(p_arg);
-        }
+            view = (const snake_view_t *)OSSeqLockRdBegin(&seqlock_view, &seq, &err);
+            collision = view->collision;
+            length = view->length;
+            step = view->step;
+            ts_step = view->ts;
+        } while (OSSeqLockRdRetry(&seqlock_view, seq));
 
-        if (snake->length == LENGTH_MAX)
+        result = SnakeVerdict(collision, length);
+        SnakeAnalysisDone(&AnalysisStat, step, ts_step);
+
+        if (result != RESULT_NONE)
         {
-            PrintResult(RESULT_WON);
+            // game over
+            PrintResult(result);
             GameOver(p_arg);
         }
-
-        OSMutexPost((OS_MUTEX *)&mutex_snake,
-                    (OS_OPT)OS_OPT_POST_NONE,
-                    (OS_ERR *)&err);
-
-        OSTimeDlyHMSM((CPU_INT16U)0,
-                      (CPU_INT16U)0,
-                      (CPU_INT16U)0,
-                      (CPU_INT32U)100u,
-                      (OS_OPT)OS_OPT_TIME_HMSM_STRICT,
-                      (OS_ERR *)&err);
     }
 }
 
@@ -600,152 +499,6 @@ static void Analysis(void *p_arg)
 *                                      NON-TASK FUNCTIONS
 *********************************************************************************************************
 */
-/**
- * \brief a snake, nonreentrant/not thread safe
- * \param [IN] *snake
- * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
- */
-static void SnakeInit(snake_t *const snake)
-{
-    snake->length = SNAKE_START_LENGTH;
-    snake->speed = SNAKE_START_SPEED;
-    snake->direction = SNAKE_START_DIRECTION;
-    snake->head = NewSnakeNode();
-    snake->head->coordinates = SNAKE_START_COORDINATES;
-    snake->head->colour = SNAKE_HEAD_COLOUR;
-    snake->head->previous_node = NULL;
-    snake->head->next_node = NULL;
-    snake->tail = snake->head;
-}
-
-/**
- * \brief an apple, nonreentrant/not thread safe
- * \param [IN] *apple
- * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
- */
-static void AppleInit(apple_t *apple)
-{
-    apple->coordinates = APPLE_START_COORDINATES;
-    apple->colour = APPLE_START_COLOUR;
-}
-
-/**
- * \brief Check for collision of a point and the snake, nonreentrant/not thread safe
- * \param [IN] *snake_head
- * \param [IN] point - a point on the map
- * \return collision_type
- * \details
- * -COLLISION_NO
- * -COLLISION_SNAKE_HEAD
- * -COLLISION_SNAKE_BODY
- * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
- */
-static const CPU_INT08U SnakeCollisionCheck(const snake_body_node_t *const snake_head, const tuple_t *const point)
-{
-    CPU_INT08U collision_type = COLLISION_NO;
-    snake_body_node_t *snake_node;
-
-    // check the head
-    if (TupleCompare(&(snake_head->coordinates), point))
-    {
-        collision_type = COLLISION_SNAKE_HEAD;
-    }
-
-    // check the body
-    snake_node = snake_head;
-    while (snake_node != NULL)
-    {
-        snake_node = snake_node->next_node;
-        if (TupleCompare(&(snake_node->coordinates), point))
-        {
-            collision_type = COLLISION_SNAKE_BODY;
-            break;
-        }
-    }
-
-    return collision_type;
-}
-
-/**
- * \brief Update apple's coordinates, nonreentrant/not thread safe
- * \param [IN] *apple
- * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
- */
-static void AppleCoordinatesUpdate(gamedata_t *const game_data)
-{
-    tuple_t new_coordinates;
-    new_coordinates.X = 5 + (rand() % 24) * SCALE;
-    new_coordinates.Y = 5 + (rand() % 32) * SCALE;
-    while (SnakeCollisionCheck(game_data->snake->head, &new_coordinates))
-    {
-        new_coordinates.X = 5 + (rand() % 24) * SCALE;
-        new_coordinates.Y = 5 + (rand() % 32) * SCALE;
-    }
-    game_data->apple->coordinates = new_coordinates;
-}
-
-static void AppleColourUpdate(apple_t *const apple)
-{
-    uint32_t colours[7] = {
-        LCD_COLOR_RED,
-        LCD_COLOR_ORANGE,
-        LCD_COLOR_YELLOW,
-        LCD_COLOR_GREEN,
-        LCD_COLOR_BLUE,
-        LCD_COLOR_MAGENTA,
-        LCD_COLOR_WHITE};
-    int32_t option = rand() % 7;
-    apple->colour = colours[option];
-}
-
-/**
- * \brief update the coordinates of the snake, nonreentrant/not thread safe
- * \param [IN] snake
- * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
- */
-static void SnakeCoordinatesUpdate(snake_t *const snake)
-{
-    snake_body_node_t *snake_node = snake->tail;
-
-    // Update the coordinates from the tail to head->next
-    while (snake_node != snake->head)
-    {
-        snake_node->coordinates = snake_node->previous_node->coordinates;
-        snake_node = snake_node->previous_node;
-    }
-
-    // Update the head
-    snake->head->coordinates.X += SCALE * snake->direction.X;
-    if (snake->head->coordinates.X > 240)
-    {
-        snake->head->coordinates.X = 5;
-    }
-    if (snake->head->coordinates.X < 0)
-    {
-        snake->head->coordinates.X = 235;
-    }
-
-    snake->head->coordinates.Y += SCALE * snake->direction.Y;
-    if (snake->head->coordinates.Y > 320)
-    {
-        snake->head->coordinates.Y = 5;
-    }
-    if (snake->head->coordinates.Y < 0)
-    {
-        snake->head->coordinates.Y = 315;
-    }
-}
-
-/**
- * \brief update the speed of the snake, nonreentrant/not thread safe
- * \param [IN] snake
- * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
- */
-static void SnakeSpeedUpdate(snake_t *const snake)
-{
-    snake->speed = snake->length + snake->length;
-}
-
 /**
  * \brief very fast approximation of squreroot precision to unsigned integer
  * \details Newton-Raphson method
@@ -788,155 +541,6 @@ static CPU_INT16U NodeDistance(const tuple_t *const point1, const tuple_t *const
     return distance;
 }
 
-/**
- * \brief Produce a new snake node on the heap
- * \return *new_snake_node
- * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
- **/
-static snake_body_node_t *NewSnakeNode(void)
-{
-    snake_body_node_t *new_snake_node = (snake_body_node_t *)malloc(sizeof(snake_body_node_t));
-    if (new_snake_node == NULL)
-    {
-        // Error handling
-        logger(LOG_ERR_MEMORY);
-    }
-
-    return new_snake_node;
-}
-
-/**
- * \brief add a snake body node to the end
- * \param [IN] *snake
- * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
- **/
-static void AddSnakeBodyNode(snake_t *const snake)
-{
-    snake_body_node_t *new_body_node = NewSnakeNode();
-    if (snake->length > 1)
-    {
-        new_body_node->coordinates.X = snake->tail->coordinates.X + (snake->tail->coordinates.X - snake->tail->previous_node->coordinates.X);
-        new_body_node->coordinates.Y = snake->tail->coordinates.Y + (snake->tail->coordinates.Y - snake->tail->previous_node->coordinates.Y);
-    }
-    else
-    {
-        new_body_node->coordinates.X = snake->tail->coordinates.X - SCALE * snake->direction.X;
-        new_body_node->coordinates.Y = snake->tail->coordinates.Y - SCALE * snake->direction.Y;
-    }
-
-    new_body_node->previous_node = snake->tail;
-    new_body_node->next_node = NULL;
-    snake->tail->next_node = new_body_node;
-    snake->tail = new_body_node;
-    snake->length++;
-}
-
-/**
- * \brief Free the heap allocated to snake
- * \param [IN] *snake_head
- * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
- **/
-static void FreeSnake(snake_body_node_t *snake_head)
-{
-    snake_body_node_t *snake_node_to_free;
-
-    while (snake_head != NULL)
-    {
-        snake_node_to_free = snake_head;
-        snake_head = snake_head->next_node;
-        free(snake_node_to_free);
-    }
-}
-
-/**
- * Check if snake eats the apple, nonreentrant/not thread safe
- * \param [IN] snake
- * \param [IN] apple
- * \return TRUE or FALSE
- * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
- */
-static const CPU_BOOLEAN TryEatApple(snake_t *const snake, const apple_t *const apple)
-{
-    // if (NodeDistance(&snake->head->coordinates, &apple->coordinates) == 0)
-    if (TupleCompare(&snake->head->coordinates, &apple->coordinates))
-    {
-        AddSnakeBodyNode(snake);
-        snake->tail->colour = apple->colour;
-        return OS_TRUE;
-    }
-    return OS_FALSE;
-}
-
-/**
- * \brief Compare two tuples
- * \param [IN] tuple1
- * \param [IN] tuple2
- * \return Return 1 if the same, 0 if not
- * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
- */
-static const CPU_BOOLEAN TupleCompare(const tuple_t *const tuple1, const tuple_t *const tuple2)
-{
-    if (tuple1->X == tuple2->X && tuple1->Y == tuple2->Y)
-    {
-        return (CPU_BOOLEAN)1u;
-    }
-    else
-    {
-        return (CPU_BOOLEAN)0u;
-    }
-}
-
-/**
- * A simple Debug logger for detected touch screen position
- * \param [IN] mask - mask for desired log info
- * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
- */
-static void logger(const uint8_t mask)
-{
-    BSP_LCD_SetTextColor(LCD_COLOR_GREEN);
-    BSP_LCD_SetFont(&Font12);
-    uint8_t log[64];
-    if (mask & LOG_TOUCH_SCREEN)
-    {
-        if (TS_State.TouchDetected)
-        {
-            sprintf((char *)log, "x:%u, y:%u, z:%u", TS_State.X, TS_State.Y, TS_State.Z);
-            BSP_LCD_DisplayStringAt(0, 10, log, LEFT_MODE);
-        }
-    }
-
-    if (mask & LOG_BOARD_DATA_CORRUPT)
-    {
-        sprintf((char *)log, "Error! GameBoard data corruption!");
-        BSP_LCD_DisplayStringAt(0, 15, log, LEFT_MODE);
-    }
-
-    if (mask & LOG_ERR_ANALYS)
-    {
-        sprintf((char *)log, "Error! Analysis turn data corruption!");
-        BSP_LCD_DisplayStringAt(0, 20, log, LEFT_MODE);
-    }
-
-    if (mask & LOG_ERR_MEMORY)
-    {
-        sprintf((char *)log, "Error! Memory allocation failed!");
-        BSP_LCD_DisplayStringAt(0, 20, log, LEFT_MODE);
-    }
-    // TO-DO Extra logs
-    //  if (mask & LOG_CPU_STATUS)
-    //  {
-
-    // }
-    // if (mask & LOG_TASK_COUNT)
-    // {
-
-    // }
-    // if (mask & LOG_CONTEXT_SWITCH)
-    // {
-
-    // }
-}
-
 void HAL_Delay(uint32_t Delay)
 {
     OS_ERR err;
@@ -952,21 +556,23 @@ void HAL_Delay(uint32_t Delay)
  */
 static void PrintResult(const gameresult_t result)
 {
-    BSP_LCD_SetTextColor(LCD_COLOR_RED);
-    BSP_LCD_SetFont(&Font12);
+    OS_ERR err;
+    disp_batch_t *batch = DispBatchGet(0u, &err);
 
     switch (result)
     {
     case 0:
-        BSP_LCD_DisplayStringAt(0, BSP_LCD_GetYSize() - 280, (uint8_t *)"WON!", CENTER_MODE);
+        DispText(batch, 0, BSP_LCD_GetYSize() - 280, (CPU_CHAR *)"WON!", CENTER_MODE, &Font12, LCD_COLOR_RED, LCD_COLOR_WHITE);
         break;
     case 1:
-        BSP_LCD_DisplayStringAt(0, BSP_LCD_GetYSize() - 280, (uint8_t *)"LOOSE!", CENTER_MODE);
+        DispText(batch, 0, BSP_LCD_GetYSize() - 280, (CPU_CHAR *)"LOOSE!", CENTER_MODE, &Font12, LCD_COLOR_RED, LCD_COLOR_WHITE);
         break;
     default:
         // the code should never come herer
         break;
     }
+
+    DispBatchPost(batch, &err);
 }
 
 /**
@@ -988,8 +594,6 @@ static void GameOver(void *p_arg)
 
     OSTaskDel((OS_TCB *)&AnalysisTCB,
               (OS_ERR *)&err);
-
-    FreeSnake(((gamedata_t *)p_arg)->snake->head);
 }
 
 /*
@@ -1002,7 +606,15 @@ static void LCD_Init(void)
 {
     BSP_LCD_Init();
     BSP_LCD_LayerDefaultInit(LCD_BACKGROUND_LAYER, LCD_FRAME_BUFFER);
+#if (DISP_DBL_BUF_EN > 0u)
+    // Back buffer of the compositor, shown through the background layer only, see Note #6 of disp.h
+    BSP_LCD_LayerDefaultInit(LCD_FOREGROUND_LAYER, DISP_BUF_ADDR(LCD_FOREGROUND_LAYER));
+    BSP_LCD_SetLayerVisible(LCD_FOREGROUND_LAYER, DISABLE);
+    BSP_LCD_SelectLayer(LCD_BACKGROUND_LAYER);
+    BSP_LCD_Clear(LCD_COLOR_BLACK);
+#else
     BSP_LCD_LayerDefaultInit(LCD_FOREGROUND_LAYER, LCD_FRAME_BUFFER);
+#endif
     BSP_LCD_SelectLayer(LCD_FOREGROUND_LAYER);
     BSP_LCD_DisplayOn();
     BSP_LCD_Clear(LCD_COLOR_BLACK);
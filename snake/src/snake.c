@@ -0,0 +1,470 @@
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "snake.h"
+
+#include <string.h>
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void SnakeCell(const tuple_t *const point, CPU_INT16U *const col, CPU_INT16U *const row);
+static void SnakeCellSet(snake_t *const snake, const tuple_t *const point);
+static void SnakeCellClr(snake_t *const snake, const tuple_t *const point);
+static void SnakeFreeSwap(snake_t *const snake, const CPU_INT16U cell, const CPU_INT16U index);
+static void SnakeDirtyMark(snake_t *const snake, const CPU_INT16U cell);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+/**
+ * \brief a snake, nonreentrant/not thread safe
+ * \param [IN] *snake
+ * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
+ */
+void SnakeInit(snake_t *const snake)
+{
+    CPU_INT16U cell;
+
+    snake->length = SNAKE_START_LENGTH;
+    snake->speed = SNAKE_START_SPEED;
+    snake->direction = SNAKE_START_DIRECTION;
+    snake->head = 0u;
+    snake->body[snake->head] = SNAKE_START_COORDINATES;
+    snake->body_colour = SNAKE_HEAD_COLOUR;
+    memset(snake->occupancy, 0, sizeof(snake->occupancy));
+    memset(snake->dirty, 0, sizeof(snake->dirty));
+    snake->dirty_count = 0u;
+    for (cell = 0u; cell < LENGTH_MAX; cell++)
+    {
+        snake->free_cells[cell] = cell;
+        snake->free_index[cell] = cell;
+    }
+    snake->free_count = LENGTH_MAX;
+    SnakeCellSet(snake, &snake->body[snake->head]);
+    snake->colour[SnakeCellIndex(&snake->body[snake->head])] = snake->body_colour;
+    snake->collision = DEF_FALSE;
+}
+
+/**
+ * \brief an apple, nonreentrant/not thread safe
+ * \param [IN] *apple
+ * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
+ */
+void AppleInit(apple_t *apple)
+{
+    apple->coordinates = APPLE_START_COORDINATES;
+    apple->colour = APPLE_START_COLOUR;
+}
+
+/**
+ * \brief Ring index in body[] of the node 'pos' places behind the head, see Note #1 of snake.h
+ * \param [IN] snake
+ * \param [IN] pos - 0 for the head, up to LENGTH_MAX - 1
+ * \return index in snake->body[]
+ */
+CPU_INT16U SnakeNodeIndex(const snake_t *const snake, const CPU_INT16U pos)
+{
+    return (snake->head >= pos) ? (snake->head - pos) : (snake->head + LENGTH_MAX - pos);
+}
+
+/**
+ * \brief Check for collision of a point and the snake, nonreentrant/not thread safe
+ * \details A bit test of the occupancy bitmap, see Note #3 of snake.h.  For the head itself, the result is
+ * whether the head ever ran into the body.
+ * \param [IN] *snake
+ * \param [IN] point - a point on the map
+ * \return collision_type
+ * \details
+ * -COLLISION_NO
+ * -COLLISION_SNAKE_HEAD
+ * -COLLISION_SNAKE_BODY
+ * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
+ */
+CPU_INT08U SnakeCollisionCheck(const snake_t *const snake, const tuple_t *const point)
+{
+    if (TupleCompare(&(snake->body[snake->head]), point))
+    {
+        return (snake->collision == DEF_TRUE) ? COLLISION_SNAKE_BODY : COLLISION_SNAKE_HEAD;
+    }
+
+    return SnakeCellOccupied(snake, point) ? COLLISION_SNAKE_BODY : COLLISION_NO;
+}
+
+/**
+ * \brief SnakeCollisionCheck() by walking the body, the reference the bitmap is checked against on the host
+ * \param [IN] *snake
+ * \param [IN] point - a point on the map
+ * \return COLLISION_NO, COLLISION_SNAKE_HEAD or COLLISION_SNAKE_BODY
+ */
+CPU_INT08U SnakeCollisionWalk(const snake_t *const snake, const tuple_t *const point)
+{
+    CPU_INT08U collision_type = COLLISION_NO;
+    CPU_INT16U index = snake->head;
+    CPU_INT16U pos;
+
+    // check the head
+    if (TupleCompare(&(snake->body[index]), point))
+    {
+        collision_type = COLLISION_SNAKE_HEAD;
+    }
+
+    // check the body
+    for (pos = 1u; pos < snake->length; pos++)
+    {
+        index = (index == 0u) ? (LENGTH_MAX - 1u) : (index - 1u);
+        if (TupleCompare(&(snake->body[index]), point))
+        {
+            collision_type = COLLISION_SNAKE_BODY;
+            break;
+        }
+    }
+
+    return collision_type;
+}
+
+/**
+ * \brief Test the bit of the cell of a point in the occupancy bitmap
+ * \param [IN] *snake
+ * \param [IN] point - a point on the map
+ * \return DEF_TRUE if a node of the snake is in the cell
+ */
+CPU_BOOLEAN SnakeCellOccupied(const snake_t *const snake, const tuple_t *const point)
+{
+    CPU_INT16U col;
+    CPU_INT16U row;
+
+    SnakeCell(point, &col, &row);
+    return ((snake->occupancy[row] & (1u << col)) != 0u) ? DEF_TRUE : DEF_FALSE;
+}
+
+/**
+ * \brief Index of the cell of a point, row by row from the cell (0, 0)
+ * \param [IN] point - a point on the map
+ * \return cell, 0 to LENGTH_MAX - 1
+ */
+CPU_INT16U SnakeCellIndex(const tuple_t *const point)
+{
+    CPU_INT16U col;
+    CPU_INT16U row;
+
+    SnakeCell(point, &col, &row);
+    return row * SNAKE_GRID_COLS + col;
+}
+
+/**
+ * \brief Update apple's coordinates, nonreentrant/not thread safe
+ * \details One draw among the free cells, see Note #5 of snake.h.  The apple stays put when the snake fills
+ * the screen.
+ * \param [IN] *apple
+ * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
+ */
+void AppleCoordinatesUpdate(gamedata_t *const game_data)
+{
+    const snake_t *snake = game_data->snake;
+    CPU_INT16U cell;
+
+    if (snake->free_count == 0u)
+    {
+        return;
+    }
+
+    cell = snake->free_cells[rand() % snake->free_count];
+    game_data->apple->coordinates.X = 5 + (cell % SNAKE_GRID_COLS) * SCALE;
+    game_data->apple->coordinates.Y = 5 + (cell / SNAKE_GRID_COLS) * SCALE;
+}
+
+void AppleColourUpdate(apple_t *const apple)
+{
+    uint32_t colours[7] = {
+        LCD_COLOR_RED,
+        LCD_COLOR_ORANGE,
+        LCD_COLOR_YELLOW,
+        LCD_COLOR_GREEN,
+        LCD_COLOR_BLUE,
+        LCD_COLOR_MAGENTA,
+        LCD_COLOR_WHITE};
+    int32_t option = rand() % 7;
+    apple->colour = colours[option];
+}
+
+/**
+ * \brief move the snake one square, nonreentrant/not thread safe
+ * \details The new head is written after the old one in the ring and the tail advances with it, so the
+ * body is not copied (see Note #1 of snake.h)
+ * \param [IN] snake
+ * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
+ */
+void SnakeCoordinatesUpdate(snake_t *const snake)
+{
+    tuple_t head = snake->body[snake->head];
+    tuple_t tail = snake->body[SnakeNodeIndex(snake, snake->length - 1u)];
+
+    head.X += SCALE * snake->direction.X;
+    if (head.X > 240)
+    {
+        head.X = 5;
+    }
+    if (head.X < 0)
+    {
+        head.X = 235;
+    }
+
+    head.Y += SCALE * snake->direction.Y;
+    if (head.Y > 320)
+    {
+        head.Y = 5;
+    }
+    if (head.Y < 0)
+    {
+        head.Y = 315;
+    }
+
+    snake->head = (snake->head == LENGTH_MAX - 1u) ? 0u : (snake->head + 1u);
+    snake->body[snake->head] = head;
+
+    // The cell behind the head turns to its body colour (see Note #2 of snake.h)
+    SnakeDirtyMark(snake, SnakeCellIndex(&snake->body[SnakeNodeIndex(snake, 1u)]));
+
+    // The tail leaves its cell, unless a new node waits there (see Note #4 of snake.h)
+    if (!TupleCompare(&tail, &snake->body[SnakeNodeIndex(snake, snake->length - 1u)]))
+    {
+        SnakeCellClr(snake, &tail);
+    }
+
+    // Then the head enters its cell
+    if (SnakeCellOccupied(snake, &head))
+    {
+        snake->collision = DEF_TRUE;
+    }
+    SnakeCellSet(snake, &head);
+    snake->colour[SnakeCellIndex(&head)] = snake->body_colour;
+}
+
+/**
+ * \brief update the speed of the snake, nonreentrant/not thread safe
+ * \param [IN] snake
+ * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
+ */
+void SnakeSpeedUpdate(snake_t *const snake)
+{
+    snake->speed = snake->length + snake->length;
+}
+
+/**
+ * \brief add a snake body node to the end, unless the body is LENGTH_MAX long
+ * \details The new node starts on the cell of the tail, see Note #4 of snake.h
+ * \param [IN] *snake
+ * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
+ **/
+void AddSnakeBodyNode(snake_t *const snake)
+{
+    if (snake->length >= LENGTH_MAX)
+    {
+        return; // the ring is full, the game is won
+    }
+
+    snake->body[SnakeNodeIndex(snake, snake->length)] = snake->body[SnakeNodeIndex(snake, snake->length - 1u)];
+    snake->length++;
+}
+
+/**
+ * Check if snake eats the apple, nonreentrant/not thread safe
+ * \param [IN] snake
+ * \param [IN] apple
+ * \return TRUE or FALSE
+ * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
+ */
+CPU_BOOLEAN TryEatApple(snake_t *const snake, const apple_t *const apple)
+{
+    // if (NodeDistance(&snake->head->coordinates, &apple->coordinates) == 0)
+    if (TupleCompare(&snake->body[snake->head], &apple->coordinates))
+    {
+        AddSnakeBodyNode(snake);
+        snake->body_colour = apple->colour;
+        return OS_TRUE;
+    }
+    return OS_FALSE;
+}
+
+/**
+ * \brief Turn the snake towards a swipe, nonreentrant/not thread safe
+ * \details The snake moves on the screen the way the swipe did: X & Y of the direction are the ones of the
+ * LCD, like the coordinates of the touch screen.  It turns only across its direction, never back on itself.
+ * \param [IN] snake
+ * \param [IN] evt - TOUCH_EVT_SWIPE
+ * \return TRUE if the direction changed
+ */
+CPU_BOOLEAN SnakeSteer(snake_t *const snake, const touch_evt_t *const evt)
+{
+    tuple_t direction;
+
+    switch (evt->dir)
+    {
+    case TOUCH_DIR_LEFT:
+        direction = (tuple_t){-1, 0};
+        break;
+    case TOUCH_DIR_RIGHT:
+        direction = (tuple_t){1, 0};
+        break;
+    case TOUCH_DIR_UP:
+        direction = (tuple_t){0, -1};
+        break;
+    case TOUCH_DIR_DOWN:
+        direction = (tuple_t){0, 1};
+        break;
+    default:
+        return OS_FALSE;
+    }
+
+    if ((direction.X == snake->direction.X) || (direction.Y == snake->direction.Y))
+    {
+        return OS_FALSE; // Same axis, ahead or back
+    }
+    snake->direction = direction;
+    return OS_TRUE;
+}
+
+/**
+ * \brief Compare two tuples
+ * \param [IN] tuple1
+ * \param [IN] tuple2
+ * \return Return 1 if the same, 0 if not
+ * \author siyuan xu, e2101066@edu.vamk.fi, 12.2022
+ */
+CPU_BOOLEAN TupleCompare(const tuple_t *const tuple1, const tuple_t *const tuple2)
+{
+    if (tuple1->X == tuple2->X && tuple1->Y == tuple2->Y)
+    {
+        return (CPU_BOOLEAN)1u;
+    }
+    else
+    {
+        return (CPU_BOOLEAN)0u;
+    }
+}
+
+/**
+ * \brief The verdict of a step
+ * \param [IN] collision - the head entered a cell of the body, see Note #3 of snake.h
+ * \param [IN] length
+ * \return RESULT_LOST, RESULT_WON or RESULT_NONE while the game goes on
+ */
+gameresult_t SnakeVerdict(const CPU_BOOLEAN collision, const CPU_INT16U length)
+{
+    if (collision == DEF_TRUE)
+    {
+        return RESULT_LOST;
+    }
+    return (length == LENGTH_MAX) ? RESULT_WON : RESULT_NONE;
+}
+
+/**
+ * \brief Account an analysis once its verdict is out, see Note #10 of snake.h, nonreentrant/not thread safe
+ * \param [IN,OUT] stat
+ * \param [IN] step - snake_view_t 'step' analysed
+ * \param [IN] ts - snake_view_t 'ts' of the step
+ */
+void SnakeAnalysisDone(analysis_stat_t *const stat, const CPU_INT32U step, const CPU_TS ts)
+{
+    CPU_TS latency = OS_TS_GET() - ts;
+
+    stat->runs++;
+    if (step == stat->step)
+    {
+        return; // Analysed already
+    }
+    stat->missed += step - stat->step - 1u;
+    stat->step = step;
+    stat->steps++;
+    stat->latency_last = latency;
+    stat->latency_total += latency;
+    if (latency > stat->latency_max)
+    {
+        stat->latency_max = latency;
+    }
+}
+
+/**
+ * \brief Cell of the grid of a point, the coordinates of a node are its centre
+ * \details Points out of the screen wrap around like the snake does
+ * \param [IN] point - a point on the map
+ * \param [OUT] col, row - cell of the point
+ */
+static void SnakeCell(const tuple_t *const point, CPU_INT16U *const col, CPU_INT16U *const row)
+{
+    *col = (CPU_INT16U)(((point->X - HALF_SCALE + SNAKE_GRID_COLS * SCALE) / SCALE) % SNAKE_GRID_COLS);
+    *row = (CPU_INT16U)(((point->Y - HALF_SCALE + SNAKE_GRID_ROWS * SCALE) / SCALE) % SNAKE_GRID_ROWS);
+}
+
+/**
+ * \brief Take the cell of a point, in the bitmap and out of the free cells
+ */
+static void SnakeCellSet(snake_t *const snake, const tuple_t *const point)
+{
+    CPU_INT16U col;
+    CPU_INT16U row;
+
+    SnakeCell(point, &col, &row);
+    if ((snake->occupancy[row] & (1u << col)) == 0u)
+    {
+        snake->occupancy[row] |= (1u << col);
+        snake->free_count--;
+        SnakeFreeSwap(snake, row * SNAKE_GRID_COLS + col, snake->free_count);
+        SnakeDirtyMark(snake, row * SNAKE_GRID_COLS + col);
+    }
+}
+
+/**
+ * \brief Free the cell of a point, in the bitmap and in the free cells
+ */
+static void SnakeCellClr(snake_t *const snake, const tuple_t *const point)
+{
+    CPU_INT16U col;
+    CPU_INT16U row;
+
+    SnakeCell(point, &col, &row);
+    if ((snake->occupancy[row] & (1u << col)) != 0u)
+    {
+        snake->occupancy[row] &= ~(1u << col);
+        SnakeFreeSwap(snake, row * SNAKE_GRID_COLS + col, snake->free_count);
+        snake->free_count++;
+        SnakeDirtyMark(snake, row * SNAKE_GRID_COLS + col);
+    }
+}
+
+/**
+ * \brief Swap a cell with the entry 'index' of free_cells[], see Note #5 of snake.h
+ */
+static void SnakeFreeSwap(snake_t *const snake, const CPU_INT16U cell, const CPU_INT16U index)
+{
+    CPU_INT16U other = snake->free_cells[index];
+
+    snake->free_cells[snake->free_index[cell]] = other;
+    snake->free_index[other] = snake->free_index[cell];
+    snake->free_cells[index] = cell;
+    snake->free_index[cell] = index;
+}
+
+/**
+ * \brief List a cell to repaint on the next frame, once, see Note #6 of snake.h
+ */
+static void SnakeDirtyMark(snake_t *const snake, const CPU_INT16U cell)
+{
+    CPU_INT16U row = cell / SNAKE_GRID_COLS;
+    CPU_INT32U bit = 1u << (cell % SNAKE_GRID_COLS);
+
+    if ((snake->dirty[row] & bit) == 0u)
+    {
+        snake->dirty[row] |= bit;
+        snake->dirty_cells[snake->dirty_count++] = cell;
+    }
+}
@@ -0,0 +1,1394 @@
+/*
+*********************************************************************************************************
+*                                        SNAKE LOGIC BENCHMARK
+*
+* Note(s) : (1) Built with SNAKE_BENCH_EN (see the native_bench environment), the start task runs this
+*               instead of the game and prints one line per result on stdout:
+*
+*                   snake op=move length=768 n=100000 ns=3.10
+*
+*               'op=move' is SnakeCoordinatesUpdate(), the step of the snake, at lengths 1 to LENGTH_MAX.
+*               'op=collision' is the head-vs-body SnakeCollisionCheck() of the Analysis task, a bit test of
+*               the occupancy bitmap, & 'op=collision_walk' the same check walking the body.  The snake
+*               lies on a serpentine over the grid, so it does not run into itself before LENGTH_MAX, and
+*               'op=collision_check' counts as errors the checks of the head not finding COLLISION_SNAKE_HEAD:
+*
+*                   snake op=collision_check checks=1200000 errors=0
+*
+*               'op=apple' is AppleCoordinatesUpdate(), one draw among the free cells, & 'op=apple_retry' the
+*               former placement, drawing any cell until the walk of the body misses it.
+*               'op=render' is the SnakeRender() of a frame after a move drawn by DispBatchRender(), the work of
+*               DrawSnake & of the compositor, & 'op=render_full' the former frame clearing the screen &
+*               painting every node, with the pixels each one writes per frame:
+*
+*                   snake op=render length=768 n=1000 ns=180.20 pixels=300
+*
+*           (2) 'op=verify' plays random games, turning & growing at random, and checks the occupancy bitmap
+*               against the walk of the body after every move, for the head & for random cells, that the
+*               free cells are the cells out of the bitmap, and that the screen SnakeRender() keeps up to
+*               date shows every cell in its colour:
+*
+*                   snake op=verify games=200 moves=61234 errors=0
+*
+*           (3) Time is read with CPU_TS_TmrRd(), in nanoseconds on the host.
+*
+*           (4) 'op=flip' starts the compositor and plays a random game through it, one move per frame shown,
+*               then checks the framebuffer the LTDC scans out (BSP_POSIX_LCD_ScanOut()) as op=verify does,
+*               with the time per frame:
+*
+*                   snake op=flip frames=120 us=16667 errors=0
+*
+*           (5) 'op=blit_fill' is a full screen BlitFill() of the software blitter, & 'op=bsp_fill' the same
+*               BSP_LCD_Clear(), a loop over the pixels in BSP_POSIX:
+*
+*                   snake op=blit_fill length=0 n=1000 ns=32160.95 pixels=76800
+*
+*               'op=blit_check' checks the fills (every alignment, ARGB8888 & RGB565), the
+*               pixel format conversion, the blending & the clipping of the blitter against the pixels
+*               expected, and the circles of the compositor against BSP_LCD_FillCircle() &
+*               BSP_LCD_DrawCircle():
+*
+*                   snake op=blit_check cases=544 errors=0
+*
+*           (6) 'op=text_bsp' is a line of text of BSP_LCD_DisplayStringAt(), pixel by pixel, 'op=text_glyph'
+*               the same line of TextDraw() blending the glyphs of the atlas, & 'op=text_run' the line cached
+*               as a run, one copy.  The fonts of the host have no glyph table, so these use fonts of the
+*               metrics of Font12 & Font16 with random glyphs:
+*
+*                   snake op=text_run length=21 n=1000 ns=505.78 pixels=3696
+*
+*               'op=text_check' draws every glyph through the compositor, a first time, a second one when
+*               the run is cached & a third one from the cache, and checks each against the BSP:
+*
+*                   snake op=text_check cases=30 errors=0
+*
+*           (7) 'op=touch' replays a trace on the touch screen of the host (BSP_POSIX_TS_Replay()): a tap, a
+*               5 ms contact, a swipe right, a swipe up & a long press, and checks the gestures 'touch.h'
+*               sends, the turns SnakeSteer() makes of the swipes, and that the screen is not sampled once
+*               released:
+*
+*                   snake op=touch events=4 samples=128 wakeups=5 errors=0
+*
+*           (8) 'op=snapshot' shares the game between a writer stepping it every tick, as GameRun does, and a
+*               reader of a lower priority drawing frame after frame, as DrawSnake does, in two modes:
+*               'mode=mutex' the former one, the reader holding the mutex of the snake during SnakeRender(),
+*               & 'mode=seqlock' the snapshot of the game (see Note #9 of snake.h), the reader copying it &
+*               drawing the cells which differ.  It prints the frames drawn, the writes blocked by the
+*               reader, the time the writer waits for it in all, per write & at most, the cost of a write
+*               and the reads restarted; mode=seqlock also checks that every copy is a whole step.  The
+*               game draws one step per frame at most, so 'wait_ns_write' is the wait removed from a frame
+*               showing a new step:
+*
+*                   snake op=snapshot mode=mutex writes=500 frames=440735 blocked=229 wait_ns=1233755 wait_ns_write=2467 wait_ns_max=6736 write_ns=1117 retries=0 errors=0
+*
+*           (9) 'op=analysis' steps the snake at the fastest & the slowest pace of the game & publishes each
+*               step as GameRun does, with an analysis task above it, as Analysis is: 'mode=poll' the former
+*               one, waking every 100 ms, & 'mode=event' woken by GameRun after each step (see Note #10 of
+*               snake.h).  It prints the analyses, the steps analysed & missed and the step-to-verdict
+*               latency of SnakeAnalysisDone(), on average & at most; mode=event also checks that each step
+*               is analysed exactly once:
+*
+*                   snake op=analysis mode=event interval_ms=500 steps=10 runs=10 missed=0 latency_us=6 latency_us_max=11 errors=0
+*
+*          (10) 'op=periodic' runs jobs of 'work_ms' of CPU time every 'period_ms', as GameRun steps the snake:
+*               'mode=dly' the former loop, delaying 'period_ms' after each job, & 'mode=periodic' a periodic
+*               task of the kernel (see Note #11 of snake.h).  It prints how late the last release is on the
+*               periods of the jobs ('drift_ms'), then the deadline misses & the releases skipped, the release
+*               jitter & the response time of OSTimePeriodicStatGet(), on average & at most.  mode=periodic
+*               checks the misses & the skips expected of the work, the period & the deadline, and that the
+*               releases only drift by the periods skipped:
+*
+*                   snake op=periodic mode=periodic period_ms=10 deadline_ms=10 work_ms=3 jobs=50 drift_ms=0 misses=0 skips=0 jitter_us=5 jitter_us_max=7 resp_us=3007 resp_us_max=3012 errors=0
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include <string.h>
+#include "snake.h"
+
+#if (SNAKE_BENCH_EN > 0u)
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define SNAKE_BENCH_N 100000u           //Operations per result
+#define SNAKE_BENCH_GAMES 200u          //Random games of op=verify
+#define SNAKE_BENCH_CELLS 8u            //Random cells checked after every move of op=verify
+#define SNAKE_BENCH_APPLE_N 1000u       //Placements per result, the retries take ~1 ms each near LENGTH_MAX
+#define SNAKE_BENCH_RENDER_N 1000u      //Frames per result
+#define SNAKE_BENCH_FLIP_FRAMES 120u    //Frames of op=flip, 2 s at 60 Hz
+#define SNAKE_BENCH_FILL_N 1000u        //Full screen fills per result
+#define SNAKE_BENCH_BLIT_DIM 16u        //Side of the surfaces of op=blit_check
+#define SNAKE_BENCH_TEXT_N 1000u        //Lines of text per result
+#define SNAKE_BENCH_TOUCH_SAMPLES 128u  //Samples of the trace of op=touch
+#define SNAKE_BENCH_TOUCH_IDLE_MS 200u  //Released, no sample expected
+#define SNAKE_BENCH_SNAPSHOT_WRITES 500u //Steps of op=snapshot per mode, one per tick
+#define SNAKE_BENCH_SNAPSHOT_STK_SIZE 256u
+#define SNAKE_BENCH_ANALYSIS_STEPS 10u   //Steps of op=analysis per mode & pace
+#define SNAKE_BENCH_ANALYSIS_POLL_MS 100u //Period of the former Analysis
+#define SNAKE_BENCH_PERIODIC_JOBS 50u    //Jobs of op=periodic per mode
+#define SNAKE_BENCH_PERIODIC_MS 10u      //Period of op=periodic
+
+/*
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static const CPU_INT16U SnakeBenchLength[] = {1u, 8u, 64u, 256u, 512u, LENGTH_MAX};
+
+static const CPU_INT16U SnakeBenchAppleLength[] = {1u, 256u, 512u, 704u, 760u, LENGTH_MAX - 1u};
+
+static snake_t SnakeBenchSnake;
+static apple_t SnakeBenchApple;
+static disp_batch_t SnakeBenchBatch; // Drawn in the start task, there is no compositor task
+static uint8_t SnakeBenchGlyphs[2u * 16u * TEXT_GLYPH_NBR];      // Random glyphs, see Note #6
+static sFONT SnakeBenchFont[2] = {{SnakeBenchGlyphs, 7u, 12u},   // Font12, 1 byte per line
+                                  {SnakeBenchGlyphs, 11u, 16u}}; // Font16, 2 bytes per line
+static BSP_POSIX_TS_SampleTypeDef SnakeBenchTrace[SNAKE_BENCH_TOUCH_SAMPLES]; // See Note #7
+
+/* op=snapshot, see Note #8 */
+static OS_TCB SnakeBenchReaderTCB;
+static OS_TCB *SnakeBenchWriterTCBPtr;
+static CPU_STK SnakeBenchReaderStk[SNAKE_BENCH_SNAPSHOT_STK_SIZE];
+static OS_MUTEX SnakeBenchMutex;
+static OS_SEQLOCK SnakeBenchSeqLock;
+static snake_view_t SnakeBenchView[3]; // The 2 buffers of the sequence lock & the copy of the reader
+static uint32_t SnakeBenchShown[LENGTH_MAX];
+static volatile CPU_BOOLEAN SnakeBenchStop;
+static CPU_INT32U SnakeBenchFrames;
+static CPU_INT32U SnakeBenchErrors;
+static analysis_stat_t SnakeBenchAnalysisStat; // op=analysis, see Note #9
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static void SnakeBench_Grow(snake_t *const snake, const CPU_INT16U length);
+static void SnakeBench_Verify(void);
+static void SnakeBench_Turn(snake_t *const snake);
+static void SnakeBench_AppleRetry(gamedata_t *const game_data);
+static CPU_BOOLEAN SnakeBench_FreeCheck(const snake_t *const snake, const tuple_t *const point);
+static CPU_INT32U SnakeBench_RenderFull(const snake_t *const snake);
+static CPU_INT32U SnakeBench_RenderCheck(const snake_t *const snake, const uint32_t *const fb);
+static void SnakeBench_Flip(const OS_PRIO disp_prio);
+static void SnakeBench_Touch(const OS_PRIO touch_prio);
+static void SnakeBench_Snapshot(const CPU_BOOLEAN seqlock);
+static void SnakeBench_SnapshotReader(void *p_arg);
+static void SnakeBench_Analysis(const CPU_BOOLEAN event, const CPU_INT16U interval_ms);
+static void SnakeBench_AnalysisTask(void *p_arg);
+static void SnakeBench_Periodic(const CPU_BOOLEAN periodic, const CPU_INT16U work_ms, const CPU_INT16U deadline_ms);
+static CPU_INT32U SnakeBench_TouchStroke(CPU_INT32U count, const CPU_INT32U ms, const CPU_INT32U duration, const CPU_INT16U x0, const CPU_INT16U y0, const CPU_INT16S dx, const CPU_INT16S dy);
+static void SnakeBench_Blit(void);
+static CPU_INT32U SnakeBench_BlitSurf(const CPU_INT08U format, CPU_INT32U *const cases);
+static CPU_INT32U SnakeBench_BlitCircle(const CPU_INT16U radius, const CPU_BOOLEAN fill);
+static void SnakeBench_Text(void);
+static CPU_INT32U SnakeBench_TextCheck(sFONT *const font, const CPU_CHAR *const text, const Text_AlignModeTypdef mode);
+static CPU_INT32U SnakeBench_Render(snake_t *const snake);
+static void SnakeBench_Print(const CPU_CHAR *op, const CPU_INT16U length, const CPU_INT32U n, const CPU_INT64U ts_total, const CPU_INT32U pixels);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+/**
+ * \param [IN] disp_prio - priority of the compositor task, started for op=flip
+ * \param [IN] touch_prio - priority of the touch driver task, started for op=touch
+ */
+void SnakeBench_Run(const OS_PRIO disp_prio, const OS_PRIO touch_prio)
+{
+    snake_t *snake = &SnakeBenchSnake;
+    gamedata_t data = {&SnakeBenchSnake, &SnakeBenchApple};
+    CPU_INT32U ts_start;
+    CPU_INT64U ts_total;
+    CPU_INT32U pixels;
+    CPU_INT32U i;
+    CPU_INT32U r;
+    CPU_INT32U errors = 0u;
+
+    for (i = 0u; i < sizeof(SnakeBenchLength) / sizeof(SnakeBenchLength[0]); i++)
+    {
+        SnakeBench_Grow(snake, SnakeBenchLength[i]);
+
+        ts_start = CPU_TS_TmrRd();
+        for (r = 0u; r < SNAKE_BENCH_N; r++)
+        {
+            SnakeCoordinatesUpdate(snake);
+        }
+        ts_total = (CPU_INT32U)(CPU_TS_TmrRd() - ts_start);
+        SnakeBench_Print("move", snake->length, SNAKE_BENCH_N, ts_total, 0u);
+    }
+
+    for (i = 0u; i < sizeof(SnakeBenchLength) / sizeof(SnakeBenchLength[0]); i++)
+    {
+        SnakeBench_Grow(snake, SnakeBenchLength[i]);
+
+        ts_start = CPU_TS_TmrRd();
+        for (r = 0u; r < SNAKE_BENCH_N; r++)
+        {
+            errors += (SnakeCollisionCheck(snake, &snake->body[snake->head]) != COLLISION_SNAKE_HEAD) ? 1u : 0u;
+        }
+        ts_total = (CPU_INT32U)(CPU_TS_TmrRd() - ts_start);
+        SnakeBench_Print("collision", snake->length, SNAKE_BENCH_N, ts_total, 0u);
+
+        ts_start = CPU_TS_TmrRd();
+        for (r = 0u; r < SNAKE_BENCH_N; r++)
+        {
+            errors += (SnakeCollisionWalk(snake, &snake->body[snake->head]) != COLLISION_SNAKE_HEAD) ? 1u : 0u;
+        }
+        ts_total = (CPU_INT32U)(CPU_TS_TmrRd() - ts_start);
+        SnakeBench_Print("collision_walk", snake->length, SNAKE_BENCH_N, ts_total, 0u);
+    }
+    // The serpentine never runs into itself, the head only meets the head
+    OS_CPU_PosixPrintf("snake op=collision_check checks=%lu errors=%lu\n",
+                       (unsigned long)(2u * SNAKE_BENCH_N * (sizeof(SnakeBenchLength) / sizeof(SnakeBenchLength[0]))),
+                       (unsigned long)errors);
+
+    for (i = 0u; i < sizeof(SnakeBenchAppleLength) / sizeof(SnakeBenchAppleLength[0]); i++)
+    {
+        SnakeBench_Grow(snake, SnakeBenchAppleLength[i]);
+
+        ts_start = CPU_TS_TmrRd();
+        for (r = 0u; r < SNAKE_BENCH_APPLE_N; r++)
+        {
+            AppleCoordinatesUpdate(&data);
+        }
+        ts_total = (CPU_INT32U)(CPU_TS_TmrRd() - ts_start);
+        SnakeBench_Print("apple", snake->length, SNAKE_BENCH_APPLE_N, ts_total, 0u);
+
+        ts_start = CPU_TS_TmrRd();
+        for (r = 0u; r < SNAKE_BENCH_APPLE_N; r++)
+        {
+            SnakeBench_AppleRetry(&data);
+        }
+        ts_total = (CPU_INT32U)(CPU_TS_TmrRd() - ts_start);
+        SnakeBench_Print("apple_retry", snake->length, SNAKE_BENCH_APPLE_N, ts_total, 0u);
+    }
+
+    for (i = 0u; i < sizeof(SnakeBenchLength) / sizeof(SnakeBenchLength[0]); i++)
+    {
+        SnakeBench_Grow(snake, SnakeBenchLength[i]);
+        (void)SnakeBench_Render(snake);
+
+        ts_total = 0u;
+        pixels = 0u;
+        for (r = 0u; r < SNAKE_BENCH_RENDER_N; r++)
+        {
+            SnakeCoordinatesUpdate(snake);
+            ts_start = CPU_TS_TmrRd();
+            pixels += SnakeBench_Render(snake);
+            ts_total += (CPU_INT32U)(CPU_TS_TmrRd() - ts_start);
+        }
+        SnakeBench_Print("render", snake->length, SNAKE_BENCH_RENDER_N, ts_total, pixels / SNAKE_BENCH_RENDER_N);
+
+        ts_total = 0u;
+        pixels = 0u;
+        for (r = 0u; r < SNAKE_BENCH_RENDER_N; r++)
+        {
+            SnakeCoordinatesUpdate(snake);
+            ts_start = CPU_TS_TmrRd();
+            pixels += SnakeBench_RenderFull(snake);
+            ts_total += (CPU_INT32U)(CPU_TS_TmrRd() - ts_start);
+        }
+        SnakeBench_Print("render_full", snake->length, SNAKE_BENCH_RENDER_N, ts_total, pixels / SNAKE_BENCH_RENDER_N);
+    }
+
+    SnakeBench_Verify();
+    SnakeBench_Blit();
+    SnakeBench_Text();
+    SnakeBench_Snapshot(DEF_FALSE);
+    SnakeBench_Snapshot(DEF_TRUE);
+    SnakeBench_Analysis(DEF_FALSE, INTEVAL_MILLISEC_MIN);
+    SnakeBench_Analysis(DEF_FALSE, INTEVAL_MILLISEC_START);
+    SnakeBench_Analysis(DEF_TRUE, INTEVAL_MILLISEC_MIN);
+    SnakeBench_Analysis(DEF_TRUE, INTEVAL_MILLISEC_START);
+    SnakeBench_Periodic(DEF_FALSE, 3u, SNAKE_BENCH_PERIODIC_MS);
+    SnakeBench_Periodic(DEF_TRUE, 3u, SNAKE_BENCH_PERIODIC_MS);
+    SnakeBench_Periodic(DEF_TRUE, 3u, 2u);                          // Every job misses its deadline
+    SnakeBench_Periodic(DEF_TRUE, 3u * SNAKE_BENCH_PERIODIC_MS / 2u, SNAKE_BENCH_PERIODIC_MS); // Every job overruns its period
+    SnakeBench_Touch(touch_prio);
+    SnakeBench_Flip(disp_prio);
+
+    OS_CPU_PosixPrintf("done\n");
+    exit(0);
+}
+
+/**
+ * \brief A snake of 'length' nodes along a serpentine over the grid, see Note #1
+ * \details Rows of SNAKE_GRID_COLS cells in X, alternately forwards and backwards, wrapping around the screen
+ */
+static void SnakeBench_Grow(snake_t *const snake, const CPU_INT16U length)
+{
+    CPU_INT32U step;
+
+    SnakeInit(snake);
+    for (step = 0u; snake->length < length; step++)
+    {
+        if ((step % SNAKE_GRID_COLS) == SNAKE_GRID_COLS - 1u)
+        {
+            snake->direction = DIR_LEFT;
+        }
+        else
+        {
+            snake->direction = (((step / SNAKE_GRID_COLS) & 1u) == 0u) ? DIR_DOWN : DIR_UP;
+        }
+        AddSnakeBodyNode(snake);
+        SnakeCoordinatesUpdate(snake);
+    }
+}
+
+/**
+ * \brief Random games checking the occupancy bitmap against the walk of the body, see Note #2
+ */
+static void SnakeBench_Verify(void)
+{
+    snake_t *snake = &SnakeBenchSnake;
+    tuple_t point;
+    CPU_INT32U moves = 0u;
+    CPU_INT32U errors = 0u;
+    CPU_INT32U game;
+    CPU_INT32U i;
+
+    srand(1u);
+    for (game = 0u; game < SNAKE_BENCH_GAMES; game++)
+    {
+        SnakeInit(snake);
+        BSP_LCD_Clear(LCD_COLOR_BLACK);
+        while (snake->collision == DEF_FALSE)
+        {
+            SnakeBench_Turn(snake);
+            if ((rand() % 4) == 0)
+            {
+                AddSnakeBodyNode(snake); // like TryEatApple(), with a new colour
+                snake->body_colour = (CPU_INT32U)rand() | LCD_COLOR_BLACK;
+            }
+            SnakeCoordinatesUpdate(snake);
+            moves++;
+
+            if (SnakeCollisionCheck(snake, &snake->body[snake->head]) != SnakeCollisionWalk(snake, &snake->body[snake->head]))
+            {
+                errors++;
+            }
+            if (snake->collision == DEF_TRUE)
+            {
+                break; // the bitmap is not kept past the end of the game, see Note #3 of snake.h
+            }
+            (void)SnakeBench_Render(snake);
+            errors += SnakeBench_RenderCheck(snake, NULL);
+            for (i = 0u; i < SNAKE_BENCH_CELLS; i++)
+            {
+                point.X = 5 + (rand() % SNAKE_GRID_COLS) * SCALE;
+                point.Y = 5 + (rand() % SNAKE_GRID_ROWS) * SCALE;
+                if ((SnakeCollisionCheck(snake, &point) != SnakeCollisionWalk(snake, &point)) ||
+                    (SnakeBench_FreeCheck(snake, &point) == DEF_FALSE))
+                {
+                    errors++;
+                }
+            }
+        }
+    }
+
+    OS_CPU_PosixPrintf("snake op=verify games=%lu moves=%lu errors=%lu\n",
+                       (unsigned long)SNAKE_BENCH_GAMES, (unsigned long)moves, (unsigned long)errors);
+}
+
+/**
+ * \brief A random game drawn by the compositor, the screen shown checked after every frame, see Note #4
+ */
+static void SnakeBench_Flip(const OS_PRIO disp_prio)
+{
+    snake_t *snake = &SnakeBenchSnake;
+    disp_batch_t *batch;
+    OS_ERR err;
+    CPU_BOOLEAN clear = DEF_FALSE;
+    CPU_INT32U ts_start;
+    CPU_INT64U ts_total = 0u;
+    CPU_INT32U errors = 0u;
+    CPU_INT32U frame;
+
+    // Both framebuffers alike, as LCD_Init() leaves them
+    BSP_LCD_SelectLayer(LCD_BACKGROUND_LAYER);
+    BSP_LCD_Clear(LCD_COLOR_BLACK);
+    BSP_LCD_SelectLayer(LCD_FOREGROUND_LAYER);
+    BSP_LCD_Clear(LCD_COLOR_BLACK);
+    DispInit(disp_prio, &err);
+
+    srand(2u);
+    SnakeInit(snake);
+    for (frame = 0u; frame < SNAKE_BENCH_FLIP_FRAMES; frame++)
+    {
+        ts_start = CPU_TS_TmrRd();
+        SnakeBench_Turn(snake);
+        SnakeCoordinatesUpdate(snake);
+        if (snake->collision == DEF_TRUE)
+        {
+            SnakeInit(snake);
+            clear = DEF_TRUE;
+        }
+        do
+        {
+            batch = DispBatchGet(0u, &err);
+            if (clear == DEF_TRUE)
+            {
+                (void)DispClear(batch, LCD_COLOR_BLACK);
+                clear = DEF_FALSE;
+            }
+            (void)SnakeRender(snake, batch);
+            DispBatchPost(batch, &err);
+        } while (snake->dirty_count > 0u);
+
+        DispFrameWait(&err);
+        ts_total += (CPU_INT32U)(CPU_TS_TmrRd() - ts_start);
+        errors += SnakeBench_RenderCheck(snake, BSP_POSIX_LCD_ScanOut());
+    }
+
+    OS_CPU_PosixPrintf("snake op=flip frames=%lu us=%lu errors=%lu\n",
+                       (unsigned long)SNAKE_BENCH_FLIP_FRAMES, (unsigned long)(ts_total / SNAKE_BENCH_FLIP_FRAMES / 1000u), (unsigned long)errors);
+}
+
+/**
+ * \brief Gestures of a replayed trace, see Note #7
+ */
+static void SnakeBench_Touch(const OS_PRIO touch_prio)
+{
+    static const touch_evt_t expected[] = {
+        {TOUCH_EVT_TAP, TOUCH_DIR_NONE, 60u, 100u, 0, 0, 0u},
+        {TOUCH_EVT_SWIPE, TOUCH_DIR_RIGHT, 40u, 160u, 0, 0, 0u},
+        {TOUCH_EVT_SWIPE, TOUCH_DIR_UP, 120u, 250u, 0, 0, 0u},
+        {TOUCH_EVT_LONG_PRESS, TOUCH_DIR_NONE, 120u, 160u, 0, 0, 0u},
+    };
+    static const tuple_t steered[] = {{0, 1}, {1, 0}, {0, -1}, {0, -1}}; // Direction after each event
+    snake_t *snake = &SnakeBenchSnake;
+    const touch_evt_t *evt;
+    OS_ERR err;
+    CPU_INT32U count = 0u;
+    CPU_INT32U events = 0u;
+    CPU_INT32U errors = 0u;
+    CPU_INT32U samples;
+    CPU_INT32U i;
+
+    count = SnakeBench_TouchStroke(count, 100u, 100u, 60u, 100u, 0, 0);    // Tap
+    count = SnakeBench_TouchStroke(count, 400u, 5u, 150u, 150u, 0, 0);     // Bounce, no touch
+    count = SnakeBench_TouchStroke(count, 600u, 100u, 40u, 160u, 160, 6);  // Swipe right
+    count = SnakeBench_TouchStroke(count, 900u, 80u, 120u, 250u, -4, -160); // Swipe up
+    count = SnakeBench_TouchStroke(count, 1200u, 800u, 120u, 160u, 3, -3); // Long press
+
+    SnakeInit(snake);
+    TouchSubscribe(OSTCBCurPtr, TOUCH_EVT_ALL, &err);
+    if (err == OS_ERR_NONE)
+    {
+        TouchInit(touch_prio, &err);
+    }
+    if ((err != OS_ERR_NONE) || (BSP_POSIX_TS_Replay(SnakeBenchTrace, count) != TS_OK))
+    {
+        errors++;
+    }
+
+    for (i = 0u; (errors == 0u) && (i < sizeof(expected) / sizeof(expected[0])); i++)
+    {
+        evt = TouchPend(3u * OSCfg_TickRate_Hz, &err);
+        if (evt == NULL)
+        {
+            errors++;
+            break;
+        }
+        events++;
+        if ((evt->type != expected[i].type) || (evt->dir != expected[i].dir) ||
+            (evt->x != expected[i].x) || (evt->y != expected[i].y))
+        {
+            errors++;
+        }
+        if (evt->type == TOUCH_EVT_SWIPE)
+        {
+            (void)SnakeSteer(snake, evt);
+        }
+        if (!TupleCompare(&snake->direction, &steered[i]))
+        {
+            errors++;
+        }
+    }
+
+    // Nothing at the release of the long press, then the driver task waits for the interrupt
+    if (TouchPend(2u * SNAKE_BENCH_TOUCH_IDLE_MS * OSCfg_TickRate_Hz / 1000u, &err) != NULL)
+    {
+        errors++;
+    }
+    samples = TouchStat.samples;
+    OSTimeDlyHMSM(0u, 0u, 0u, SNAKE_BENCH_TOUCH_IDLE_MS, OS_OPT_TIME_HMSM_NON_STRICT, &err);
+    if (TouchStat.samples != samples)
+    {
+        errors++;
+    }
+
+    OS_CPU_PosixPrintf("snake op=touch events=%lu samples=%lu wakeups=%lu errors=%lu\n",
+                       (unsigned long)events, (unsigned long)TouchStat.samples, (unsigned long)TouchStat.wakeups, (unsigned long)errors);
+}
+
+/**
+ * \brief The game shared by a writer & a reader drawing it, see Note #8
+ * \details The start task is the writer, the reader runs below it
+ * \param [IN] seqlock - DEF_FALSE for mode=mutex, DEF_TRUE for mode=seqlock
+ */
+static void SnakeBench_Snapshot(const CPU_BOOLEAN seqlock)
+{
+    snake_t *snake = &SnakeBenchSnake;
+    snake_view_t *view;
+    OS_ERR err;
+    CPU_TS ts;
+    CPU_INT32U ts_start;
+    CPU_INT32U ts_wait;
+    CPU_INT64U wait_total = 0u;
+    CPU_INT64U write_total = 0u;
+    CPU_INT32U wait_max = 0u;
+    CPU_INT32U blocked = 0u;
+    CPU_INT32U write;
+    CPU_INT32U cell;
+
+    srand(3u);
+    SnakeInit(snake);
+    AppleInit(&SnakeBenchApple);
+    BSP_LCD_Clear(LCD_COLOR_BLACK);
+    for (cell = 0u; cell < LENGTH_MAX; cell++)
+    {
+        SnakeBenchShown[cell] = LCD_COLOR_BLACK;
+    }
+    if (seqlock == DEF_TRUE)
+    {
+        SnakeViewInit(&SnakeBenchView[0], snake, &SnakeBenchApple);
+        OSSeqLockCreate(&SnakeBenchSeqLock, (CPU_CHAR *)"Bench snapshot", &SnakeBenchView[0], &SnakeBenchView[1], sizeof(snake_view_t), &err);
+    }
+    else
+    {
+        OSMutexCreate(&SnakeBenchMutex, (CPU_CHAR *)"Bench snake", &err);
+    }
+    SnakeBenchStop = DEF_FALSE;
+    SnakeBenchFrames = 0u;
+    SnakeBenchErrors = 0u;
+    SnakeBenchWriterTCBPtr = OSTCBCurPtr;
+    OSTaskCreate(&SnakeBenchReaderTCB, (CPU_CHAR *)"Bench reader", SnakeBench_SnapshotReader, (void *)(CPU_ADDR)seqlock,
+                 OSTCBCurPtr->Prio + 1u, &SnakeBenchReaderStk[0], SNAKE_BENCH_SNAPSHOT_STK_SIZE / 10u,
+                 SNAKE_BENCH_SNAPSHOT_STK_SIZE, 0u, 0u, NULL, OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR, &err);
+
+    for (write = 0u; write < SNAKE_BENCH_SNAPSHOT_WRITES; write++)
+    {
+        OSTimeDly(1u, OS_OPT_TIME_DLY, &err); // The reader draws meanwhile
+
+        ts_start = CPU_TS_TmrRd();
+        if (seqlock == DEF_TRUE)
+        {
+            ts_wait = 0u; // OSSeqLockWrBegin() never waits
+        }
+        else
+        {
+            if (SnakeBenchMutex.OwnerTCBPtr != NULL)
+            {
+                blocked++;
+            }
+            OSMutexPend(&SnakeBenchMutex, 0u, OS_OPT_PEND_BLOCKING, &ts, &err);
+            ts_wait = (CPU_INT32U)(CPU_TS_TmrRd() - ts_start);
+        }
+
+        SnakeBench_Turn(snake);
+        if ((rand() % 4) == 0)
+        {
+            AddSnakeBodyNode(snake); // like TryEatApple(), with a new colour
+            snake->body_colour = LCD_COLOR_BLUE | ((CPU_INT32U)(rand() % 0x100) << 8);
+        }
+        SnakeCoordinatesUpdate(snake);
+
+        if (seqlock == DEF_TRUE)
+        {
+            view = (snake_view_t *)OSSeqLockWrBegin(&SnakeBenchSeqLock,
+                                                    (snake->collision == DEF_TRUE) ? OS_OPT_SEQLOCK_NONE : OS_OPT_SEQLOCK_COPY, &err);
+            if (snake->collision == DEF_TRUE)
+            {
+                SnakeInit(snake); // A new game, the whole snapshot
+                SnakeViewInit(view, snake, &SnakeBenchApple);
+            }
+            else
+            {
+                SnakeViewUpdate(view, snake, &SnakeBenchApple);
+            }
+            OSSeqLockWrEnd(&SnakeBenchSeqLock, &err);
+        }
+        else
+        {
+            if (snake->collision == DEF_TRUE)
+            {
+                SnakeInit(snake); // The cells of the last game stay on the screen, only the waits matter
+            }
+            OSMutexPost(&SnakeBenchMutex, OS_OPT_POST_NONE, &err);
+        }
+        write_total += (CPU_INT32U)(CPU_TS_TmrRd() - ts_start) - ts_wait;
+        wait_total += ts_wait;
+        if (ts_wait > wait_max)
+        {
+            wait_max = ts_wait;
+        }
+    }
+
+    SnakeBenchStop = DEF_TRUE;
+    (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, &ts, &err); // The reader is out of its frame
+    OSTaskDel(&SnakeBenchReaderTCB, &err);
+    if (seqlock == DEF_FALSE)
+    {
+        OSMutexDel(&SnakeBenchMutex, OS_OPT_DEL_ALWAYS, &err);
+    }
+
+    OS_CPU_PosixPrintf("snake op=snapshot mode=%s writes=%lu frames=%lu blocked=%lu wait_ns=%llu wait_ns_write=%lu wait_ns_max=%lu write_ns=%lu retries=%lu errors=%lu\n",
+                       (seqlock == DEF_TRUE) ? "seqlock" : "mutex", (unsigned long)SNAKE_BENCH_SNAPSHOT_WRITES, (unsigned long)SnakeBenchFrames,
+                       (unsigned long)blocked, (unsigned long long)wait_total, (unsigned long)(wait_total / SNAKE_BENCH_SNAPSHOT_WRITES),
+                       (unsigned long)wait_max,
+                       (unsigned long)(write_total / SNAKE_BENCH_SNAPSHOT_WRITES),
+                       (unsigned long)((seqlock == DEF_TRUE) ? SnakeBenchSeqLock.RdRetryCtr : 0u), (unsigned long)SnakeBenchErrors);
+}
+
+/**
+ * \brief The reader of op=snapshot, frame after frame until SnakeBenchStop, like DrawSnake
+ * \param [IN] p_arg - DEF_TRUE for mode=seqlock
+ */
+static void SnakeBench_SnapshotReader(void *p_arg)
+{
+    CPU_BOOLEAN seqlock = (CPU_BOOLEAN)(CPU_ADDR)p_arg;
+    snake_view_t *view = &SnakeBenchView[2];
+    OS_ERR err;
+    CPU_TS ts;
+    CPU_INT16U cells;
+    CPU_INT16U cell;
+
+    while (SnakeBenchStop == DEF_FALSE)
+    {
+        DispBatchInit(&SnakeBenchBatch);
+        if (seqlock == DEF_TRUE)
+        {
+            (void)OSSeqLockRead(&SnakeBenchSeqLock, view, &err);
+            (void)SnakeViewRender(view, SnakeBenchShown, &SnakeBenchBatch);
+
+            cells = 0u; // A whole step: as many cells in the snake as nodes, the head in its colour
+            for (cell = 0u; cell < LENGTH_MAX; cell++)
+            {
+                if (view->cells[cell] != LCD_COLOR_BLACK)
+                {
+                    cells++;
+                }
+            }
+            if ((cells != view->length) || (view->cells[view->head] != SNAKE_HEAD_COLOUR))
+            {
+                SnakeBenchErrors++;
+            }
+        }
+        else
+        {
+            OSMutexPend(&SnakeBenchMutex, 0u, OS_OPT_PEND_BLOCKING, &ts, &err);
+            (void)SnakeRender(&SnakeBenchSnake, &SnakeBenchBatch);
+            OSMutexPost(&SnakeBenchMutex, OS_OPT_POST_NONE, &err);
+        }
+        (void)DispBatchRender(&SnakeBenchBatch); // The compositor, out of the lock
+        SnakeBenchFrames++;
+    }
+
+    (void)OSTaskSemPost(SnakeBenchWriterTCBPtr, OS_OPT_POST_NONE, &err); // Deleted by the writer, above it
+    OSTaskSuspend(NULL, &err);
+}
+
+/**
+ * \brief Steps analysed by polling or on the event of each step, see Note #9
+ * \details The start task is GameRun, publishing through the sequence lock of op=snapshot
+ * \param [IN] event - DEF_FALSE for mode=poll, DEF_TRUE for mode=event
+ * \param [IN] interval_ms - between the steps
+ */
+static void SnakeBench_Analysis(const CPU_BOOLEAN event, const CPU_INT16U interval_ms)
+{
+    snake_t *snake = &SnakeBenchSnake;
+    snake_view_t *view;
+    analysis_stat_t *stat = &SnakeBenchAnalysisStat;
+    OS_ERR err;
+    CPU_ERR cpu_err;
+    CPU_TS ts;
+    CPU_INT32U errors = 0u;
+    CPU_INT32U step;
+    CPU_INT64U freq_us = CPU_TS_TmrFreqGet(&cpu_err) / 1000000u;
+
+    SnakeInit(snake); // Alone, it never collides
+    view = (snake_view_t *)OSSeqLockWrBegin(&SnakeBenchSeqLock, OS_OPT_SEQLOCK_NONE, &err);
+    SnakeViewInit(view, snake, &SnakeBenchApple);
+    OSSeqLockWrEnd(&SnakeBenchSeqLock, &err);
+    memset(stat, 0, sizeof(*stat));
+    SnakeBenchStop = DEF_FALSE;
+    SnakeBenchWriterTCBPtr = OSTCBCurPtr;
+    OSTaskCreate(&SnakeBenchReaderTCB, (CPU_CHAR *)"Bench analysis", SnakeBench_AnalysisTask, (void *)(CPU_ADDR)event,
+                 OSTCBCurPtr->Prio - 1u, &SnakeBenchReaderStk[0], SNAKE_BENCH_SNAPSHOT_STK_SIZE / 10u,
+                 SNAKE_BENCH_SNAPSHOT_STK_SIZE, 0u, 0u, NULL, OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR, &err);
+
+    for (step = 0u; step < SNAKE_BENCH_ANALYSIS_STEPS; step++)
+    {
+        OSTimeDlyHMSM(0u, 0u, 0u, interval_ms, OS_OPT_TIME_HMSM_NON_STRICT, &err);
+        SnakeCoordinatesUpdate(snake);
+        view = (snake_view_t *)OSSeqLockWrBegin(&SnakeBenchSeqLock, OS_OPT_SEQLOCK_COPY, &err);
+        SnakeViewUpdate(view, snake, &SnakeBenchApple);
+        OSSeqLockWrEnd(&SnakeBenchSeqLock, &err);
+        if (event == DEF_TRUE)
+        {
+            OSTaskSemPost(&SnakeBenchReaderTCB, OS_OPT_POST_NONE, &err); // Runs the analysis at once, above
+        }
+    }
+    OSTimeDlyHMSM(0u, 0u, 0u, SNAKE_BENCH_ANALYSIS_POLL_MS, OS_OPT_TIME_HMSM_NON_STRICT, &err); // The last poll
+
+    SnakeBenchStop = DEF_TRUE;
+    if (event == DEF_TRUE)
+    {
+        OSTaskSemPost(&SnakeBenchReaderTCB, OS_OPT_POST_NONE, &err);
+    }
+    (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, &ts, &err); // The analysis task is out of its loop
+    OSTaskDel(&SnakeBenchReaderTCB, &err);
+
+    if ((stat->missed > 0u) || ((event == DEF_TRUE) && ((stat->runs != SNAKE_BENCH_ANALYSIS_STEPS) || (stat->steps != SNAKE_BENCH_ANALYSIS_STEPS))))
+    {
+        errors++;
+    }
+    OS_CPU_PosixPrintf("snake op=analysis mode=%s interval_ms=%u steps=%lu runs=%lu missed=%lu latency_us=%lu latency_us_max=%lu errors=%lu\n",
+                       (event == DEF_TRUE) ? "event" : "poll", (unsigned)interval_ms, (unsigned long)stat->steps, (unsigned long)stat->runs,
+                       (unsigned long)stat->missed, (unsigned long)((stat->steps > 0u) ? (stat->latency_total / stat->steps / freq_us) : 0u),
+                       (unsigned long)(stat->latency_max / freq_us), (unsigned long)errors);
+}
+
+/**
+ * \brief The analysis of op=analysis, until SnakeBenchStop, like Analysis
+ * \param [IN] p_arg - DEF_TRUE for mode=event
+ */
+static void SnakeBench_AnalysisTask(void *p_arg)
+{
+    CPU_BOOLEAN event = (CPU_BOOLEAN)(CPU_ADDR)p_arg;
+    const snake_view_t *view;
+    OS_ERR err;
+    OS_SEQ seq;
+    CPU_TS ts;
+    CPU_INT32U step;
+    CPU_TS ts_step;
+
+    while (SnakeBenchStop == DEF_FALSE)
+    {
+        if (event == DEF_TRUE)
+        {
+            (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, &ts, &err);
+        }
+        else
+        {
+            OSTimeDlyHMSM(0u, 0u, 0u, SNAKE_BENCH_ANALYSIS_POLL_MS, OS_OPT_TIME_HMSM_STRICT, &err);
+        }
+        if (SnakeBenchStop == DEF_TRUE)
+        {
+            break;
+        }
+        do
+        {
+            view = (const snake_view_t *)OSSeqLockRdBegin(&SnakeBenchSeqLock, &seq, &err);
+            step = view->step;
+            ts_step = view->ts;
+        } while (OSSeqLockRdRetry(&SnakeBenchSeqLock, seq));
+        if (step > 0u)
+        {
+            SnakeAnalysisDone(&SnakeBenchAnalysisStat, step, ts_step);
+        }
+    }
+
+    (void)OSTaskSemPost(SnakeBenchWriterTCBPtr, OS_OPT_POST_NONE, &err); // Deleted by the writer
+    OSTaskSuspend(NULL, &err);
+}
+
+/**
+ * \brief Jobs of CPU time released by delays or as a periodic task, see Note #10
+ * \param [IN] periodic - DEF_FALSE for mode=dly, DEF_TRUE for mode=periodic
+ * \param [IN] work_ms - CPU time of a job
+ * \param [IN] deadline_ms - from the release of a job to its end, mode=periodic
+ */
+static void SnakeBench_Periodic(const CPU_BOOLEAN periodic, const CPU_INT16U work_ms, const CPU_INT16U deadline_ms)
+{
+    OS_PERIODIC_STAT stat;
+    OS_ERR err;
+    CPU_ERR cpu_err;
+    CPU_TS ts;
+    OS_TICK tick_start;
+    OS_TICK period = SNAKE_BENCH_PERIODIC_MS * OSCfg_TickRate_Hz / 1000u;
+    CPU_INT32U drift_ms;
+    CPU_INT32U skips;
+    CPU_INT32U errors = 0u;
+    CPU_INT32U job;
+    CPU_INT64U freq_us = CPU_TS_TmrFreqGet(&cpu_err) / 1000000u;
+
+    memset(&stat, 0, sizeof(stat));
+    OSTimeDly(1u, OS_OPT_TIME_DLY, &err); // Start right after a tick
+    tick_start = OSTimeGet(&err);
+    if (periodic == DEF_TRUE)
+    {
+        OSTimePeriodicSet(period, deadline_ms * OSCfg_TickRate_Hz / 1000u, &err);
+    }
+
+    for (job = 0u; job < SNAKE_BENCH_PERIODIC_JOBS; job++)
+    {
+        ts = CPU_TS_TmrRd();
+        while ((CPU_INT64U)(CPU_TS)(CPU_TS_TmrRd() - ts) < (CPU_INT64U)work_ms * 1000u * freq_us)
+        {
+        }
+        if (periodic == DEF_TRUE)
+        {
+            OSTimePeriodicWait(&err);
+        }
+        else
+        {
+            OSTimeDly(period, OS_OPT_TIME_DLY, &err);
+        }
+    }
+    drift_ms = (CPU_INT32U)((OSTimeGet(&err) - tick_start - SNAKE_BENCH_PERIODIC_JOBS * period) * 1000u / OSCfg_TickRate_Hz);
+
+    if (periodic == DEF_TRUE)
+    {
+        OSTimePeriodicStatGet(NULL, &stat, &err);
+        OSTimePeriodicSet(0u, 0u, &err); // Aperiodic again, for the next mode
+
+        // A job overrunning its period skips the next release, or more, unless the ticks of the host fall behind
+        skips = SNAKE_BENCH_PERIODIC_JOBS * (work_ms / SNAKE_BENCH_PERIODIC_MS);
+        if ((stat.ReleaseCtr != SNAKE_BENCH_PERIODIC_JOBS + 1u) || (stat.DoneCtr != SNAKE_BENCH_PERIODIC_JOBS) ||
+            (stat.MissCtr != ((work_ms > deadline_ms) ? SNAKE_BENCH_PERIODIC_JOBS : 0u)) ||
+            ((skips == 0u) != (stat.SkipCtr == 0u)) || (drift_ms != stat.SkipCtr * SNAKE_BENCH_PERIODIC_MS))
+        {
+            errors++;
+        }
+    }
+    OS_CPU_PosixPrintf("snake op=periodic mode=%s period_ms=%u deadline_ms=%u work_ms=%u jobs=%u drift_ms=%lu misses=%lu skips=%lu jitter_us=%lu jitter_us_max=%lu resp_us=%lu resp_us_max=%lu errors=%lu\n",
+                       (periodic == DEF_TRUE) ? "periodic" : "dly", (unsigned)SNAKE_BENCH_PERIODIC_MS, (unsigned)deadline_ms, (unsigned)work_ms,
+                       (unsigned)SNAKE_BENCH_PERIODIC_JOBS, (unsigned long)drift_ms, (unsigned long)stat.MissCtr, (unsigned long)stat.SkipCtr,
+                       (unsigned long)((stat.ReleaseCtr > 0u) ? (stat.JitterTotal / stat.ReleaseCtr / freq_us) : 0u),
+                       (unsigned long)(stat.JitterMax / freq_us),
+                       (unsigned long)((stat.DoneCtr > 0u) ? (stat.RespTotal / stat.DoneCtr / freq_us) : 0u),
+                       (unsigned long)(stat.RespMax / freq_us), (unsigned long)errors);
+}
+
+/**
+ * \brief Append a contact to the trace of op=touch, one sample per 10 ms & the release
+ * \param [IN] count - samples of the trace so far
+ * \param [IN] ms - start, from the start of the replay
+ * \param [IN] x0, y0 - start point, moving by dx, dy over the duration
+ * \return samples of the trace
+ */
+static CPU_INT32U SnakeBench_TouchStroke(CPU_INT32U count, const CPU_INT32U ms, const CPU_INT32U duration, const CPU_INT16U x0, const CPU_INT16U y0, const CPU_INT16S dx, const CPU_INT16S dy)
+{
+    CPU_INT32U t;
+
+    for (t = 0u; (t < duration) && (count < SNAKE_BENCH_TOUCH_SAMPLES - 1u); t += 10u)
+    {
+        SnakeBenchTrace[count].Ms = ms + t;
+        SnakeBenchTrace[count].TouchDetected = 1u;
+        SnakeBenchTrace[count].X = (uint16_t)((CPU_INT32S)x0 + (CPU_INT32S)dx * (CPU_INT32S)t / (CPU_INT32S)duration);
+        SnakeBenchTrace[count].Y = (uint16_t)((CPU_INT32S)y0 + (CPU_INT32S)dy * (CPU_INT32S)t / (CPU_INT32S)duration);
+        count++;
+    }
+    SnakeBenchTrace[count].Ms = ms + duration;
+    SnakeBenchTrace[count].TouchDetected = 0u;
+    SnakeBenchTrace[count].X = SnakeBenchTrace[count - 1u].X;
+    SnakeBenchTrace[count].Y = SnakeBenchTrace[count - 1u].Y;
+    return count + 1u;
+}
+
+/**
+ * \brief The blitter timed against the BSP and checked, see Note #5
+ */
+static void SnakeBench_Blit(void)
+{
+    blit_surf_t screen;
+    CPU_INT32U ts_start;
+    CPU_INT64U ts_total;
+    CPU_INT32U cases = 0u;
+    CPU_INT32U errors = 0u;
+    CPU_INT32U r;
+    CPU_INT16U radius;
+
+    BlitSurfInit(&screen, BlitFrameBuffer(LCD_FRAME_BUFFER), BSP_LCD_GetXSize(), BSP_LCD_GetYSize(), BLIT_FMT_ARGB8888);
+    BSP_LCD_SelectLayer(LCD_BACKGROUND_LAYER); // LCD_FRAME_BUFFER
+
+    ts_start = CPU_TS_TmrRd();
+    for (r = 0u; r < SNAKE_BENCH_FILL_N; r++)
+    {
+        (void)BlitFill(&screen, 0, 0, screen.width, screen.height, (r & 1u) ? LCD_COLOR_BLACK : LCD_COLOR_WHITE);
+    }
+    ts_total = (CPU_INT32U)(CPU_TS_TmrRd() - ts_start);
+    SnakeBench_Print("blit_fill", 0u, SNAKE_BENCH_FILL_N, ts_total, (CPU_INT32U)screen.width * screen.height);
+
+    ts_start = CPU_TS_TmrRd();
+    for (r = 0u; r < SNAKE_BENCH_FILL_N; r++)
+    {
+        BSP_LCD_Clear((r & 1u) ? LCD_COLOR_BLACK : LCD_COLOR_WHITE);
+    }
+    ts_total = (CPU_INT32U)(CPU_TS_TmrRd() - ts_start);
+    SnakeBench_Print("bsp_fill", 0u, SNAKE_BENCH_FILL_N, ts_total, (CPU_INT32U)screen.width * screen.height);
+
+    errors += SnakeBench_BlitSurf(BLIT_FMT_ARGB8888, &cases);
+    errors += SnakeBench_BlitSurf(BLIT_FMT_RGB565, &cases);
+
+    BSP_LCD_SelectLayer(LCD_FOREGROUND_LAYER); // Drawn by DispBatchRender()
+    for (radius = 0u; radius <= 44u; radius++)
+    {
+        errors += SnakeBench_BlitCircle(radius, DEF_TRUE);
+        errors += SnakeBench_BlitCircle(radius, DEF_FALSE);
+        cases += 2u;
+    }
+
+    OS_CPU_PosixPrintf("snake op=blit_check cases=%lu errors=%lu\n", (unsigned long)cases, (unsigned long)errors);
+}
+
+/**
+ * \brief Fill, convert, blend & clip a SNAKE_BENCH_BLIT_DIM square in the middle of a larger surface, every
+ * pixel of which is checked after each operation
+ * \param [OUT] cases - operations checked, added
+ * \return pixels in the wrong colour
+ */
+static CPU_INT32U SnakeBench_BlitSurf(const CPU_INT08U format, CPU_INT32U *const cases)
+{
+    static CPU_INT08U pixels[(SNAKE_BENCH_BLIT_DIM + 2u) * (SNAKE_BENCH_BLIT_DIM + 2u) * 4u];
+    static CPU_INT08U mask[SNAKE_BENCH_BLIT_DIM];
+    static uint32_t argb[SNAKE_BENCH_BLIT_DIM];
+    const uint32_t colours[] = {LCD_COLOR_RED, LCD_COLOR_GREEN, LCD_COLOR_BLUE, LCD_COLOR_WHITE}; // Exact in RGB565
+    const CPU_INT32U pitch = SNAKE_BENCH_BLIT_DIM + 2u;
+    const CPU_INT08U size = BlitPixelSize(format);
+    blit_surf_t outer;
+    blit_surf_t surf;
+    blit_surf_t line;
+    blit_rect_t rect;
+    CPU_INT32U errors = 0u;
+    CPU_INT32S x;
+    CPU_INT32S y;
+    CPU_INT32S w;
+    CPU_INT32S i;
+    uint32_t expected;
+    uint32_t got;
+
+    // A 1 pixel frame around surf, which must stay untouched
+    BlitSurfInit(&outer, pixels, (CPU_INT16U)pitch, (CPU_INT16U)pitch, format);
+    BlitSurfInit(&surf, &pixels[(pitch + 1u) * size], SNAKE_BENCH_BLIT_DIM, SNAKE_BENCH_BLIT_DIM, format);
+    surf.pitch = (CPU_INT16U)pitch;
+    BlitSurfInit(&line, argb, SNAKE_BENCH_BLIT_DIM, 1u, BLIT_FMT_ARGB8888);
+
+    // Every start & width of a line, partly out of the surface too
+    for (x = -2; x < (CPU_INT32S)SNAKE_BENCH_BLIT_DIM; x++)
+    {
+        for (w = 0; w <= (CPU_INT32S)SNAKE_BENCH_BLIT_DIM - x + 2; w++)
+        {
+            (void)BlitFill(&outer, 0, 0, (CPU_INT32S)pitch, (CPU_INT32S)pitch, LCD_COLOR_BLACK);
+            (void)BlitFill(&surf, x, 3, w, 2, colours[(x + w) & 3]);
+            (*cases)++;
+            for (y = -1; y <= (CPU_INT32S)SNAKE_BENCH_BLIT_DIM; y++)
+            {
+                for (i = -1; i <= (CPU_INT32S)SNAKE_BENCH_BLIT_DIM; i++)
+                {
+                    rect.x = i + 1;
+                    rect.y = y + 1;
+                    rect.w = 1;
+                    rect.h = 1;
+                    (void)BlitCopy(&line, 0, 0, &outer, &rect);
+                    expected = ((y >= 3) && (y < 5) && (i >= x) && (i < x + w) && (i >= 0) && (i < (CPU_INT32S)SNAKE_BENCH_BLIT_DIM))
+                                   ? colours[(x + w) & 3]
+                                   : LCD_COLOR_BLACK;
+                    if (argb[0] != expected)
+                    {
+                        errors++;
+                    }
+                }
+            }
+        }
+    }
+
+    // Convert to the format & back, then blend a mask of 0, 128 & 255 over white
+    for (i = 0; i < (CPU_INT32S)SNAKE_BENCH_BLIT_DIM; i++)
+    {
+        argb[i] = colours[i & 3];
+        mask[i] = (i % 3 == 0) ? 0u : ((i % 3 == 1) ? 128u : 255u);
+    }
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = SNAKE_BENCH_BLIT_DIM;
+    rect.h = 1;
+    (void)BlitCopy(&surf, 0, 0, &line, &rect);
+    memset(argb, 0, sizeof(argb));
+    (void)BlitCopy(&line, 0, 0, &surf, &rect);
+    (*cases)++;
+    for (i = 0; i < (CPU_INT32S)SNAKE_BENCH_BLIT_DIM; i++)
+    {
+        if (argb[i] != colours[i & 3])
+        {
+            errors++;
+        }
+    }
+
+    BlitSurfInit(&line, mask, SNAKE_BENCH_BLIT_DIM, 1u, BLIT_FMT_A8);
+    (void)BlitFill(&surf, 0, 0, SNAKE_BENCH_BLIT_DIM, 1, LCD_COLOR_WHITE);
+    (void)BlitBlend(&surf, 0, 0, &line, &rect, LCD_COLOR_BLUE);
+    (*cases)++;
+    BlitSurfInit(&line, argb, SNAKE_BENCH_BLIT_DIM, 1u, BLIT_FMT_ARGB8888);
+    (void)BlitCopy(&line, 0, 0, &surf, &rect);
+    for (i = 0; i < (CPU_INT32S)SNAKE_BENCH_BLIT_DIM; i++)
+    {
+        got = argb[i];
+        switch (mask[i])
+        {
+        case 0u:
+            expected = LCD_COLOR_WHITE;
+            break;
+        case 255u:
+            expected = LCD_COLOR_BLUE;
+            break;
+        default:
+            expected = 0xFF7F7FFFu; // 255 * 127 / 255 on red & green, blue kept
+            break;
+        }
+        if ((format == BLIT_FMT_RGB565) && (mask[i] == 128u))
+        {
+            expected = 0xFF7B7DFFu; // Stored in 5 & 6 bits
+        }
+        if (got != expected)
+        {
+            errors++;
+        }
+    }
+
+    return errors;
+}
+
+/**
+ * \brief A circle of the compositor against the one of the BSP, in the layer drawn
+ * \return 1 if a pixel differs
+ */
+static CPU_INT32U SnakeBench_BlitCircle(const CPU_INT16U radius, const CPU_BOOLEAN fill)
+{
+    static uint32_t drawn[(2u * 44u + 1u) * (2u * 44u + 1u)];
+    const CPU_INT16U x = 120u;
+    const CPU_INT16U y = 160u;
+    CPU_INT32U i;
+    CPU_INT32U j;
+    CPU_INT32U dim = 2u * radius + 1u;
+
+    BSP_LCD_Clear(LCD_COLOR_BLACK);
+    DispBatchInit(&SnakeBenchBatch);
+    if (fill == DEF_TRUE)
+    {
+        (void)DispFillCircle(&SnakeBenchBatch, x, y, radius, LCD_COLOR_RED);
+    }
+    else
+    {
+        (void)DispDrawCircle(&SnakeBenchBatch, x, y, radius, LCD_COLOR_RED);
+    }
+    (void)DispBatchRender(&SnakeBenchBatch);
+    for (i = 0u; i < dim * dim; i++)
+    {
+        drawn[i] = BSP_LCD_ReadPixel(x - radius + i % dim, y - radius + i / dim);
+    }
+
+    BSP_LCD_Clear(LCD_COLOR_BLACK);
+    BSP_LCD_SetTextColor(LCD_COLOR_RED);
+    if (fill == DEF_TRUE)
+    {
+        BSP_LCD_FillCircle(x, y, radius);
+    }
+    else
+    {
+        BSP_LCD_DrawCircle(x, y, radius);
+    }
+    for (j = 0u; j < dim * dim; j++)
+    {
+        if (drawn[j] != BSP_LCD_ReadPixel(x - radius + j % dim, y - radius + j / dim))
+        {
+            return 1u;
+        }
+    }
+    return 0u;
+}
+
+/**
+ * \brief Text of the BSP, of the glyph atlas & of the run cache timed, and checked against the BSP, see
+ * Note #6
+ */
+static void SnakeBench_Text(void)
+{
+    static const CPU_CHAR line[] = "Score 0123456789 WON!";
+    CPU_CHAR text[DISP_TEXT_LEN_MAX + 1u];
+    blit_surf_t screen;
+    sFONT *font;
+    CPU_INT32U ts_start;
+    CPU_INT64U ts_total;
+    CPU_INT32U cases = 0u;
+    CPU_INT32U errors = 0u;
+    CPU_INT32U pixels;
+    CPU_INT32U seed = 1u;
+    CPU_INT32U len;
+    CPU_INT32U r;
+    CPU_INT32U f;
+    CPU_INT32U g;
+
+    for (r = 0u; r < sizeof(SnakeBenchGlyphs); r++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        SnakeBenchGlyphs[r] = (uint8_t)(seed >> 16);
+    }
+    BlitSurfInit(&screen, BlitFrameBuffer(LCD_FRAME_BUFFER), BSP_LCD_GetXSize(), BSP_LCD_GetYSize(), BLIT_FMT_ARGB8888);
+    BSP_LCD_SelectLayer(LCD_BACKGROUND_LAYER); // LCD_FRAME_BUFFER
+    BSP_LCD_SetTextColor(LCD_COLOR_GREEN);
+    BSP_LCD_SetBackColor(LCD_COLOR_WHITE);
+
+    font = &SnakeBenchFont[1];
+    len = sizeof(line) - 1u;
+    pixels = len * font->Width * font->Height;
+    BSP_LCD_SetFont(font);
+    ts_start = CPU_TS_TmrRd();
+    for (r = 0u; r < SNAKE_BENCH_TEXT_N; r++)
+    {
+        BSP_LCD_DisplayStringAt(0u, 100u, (uint8_t *)line, LEFT_MODE);
+    }
+    ts_total = (CPU_INT32U)(CPU_TS_TmrRd() - ts_start);
+    SnakeBench_Print("text_bsp", (CPU_INT16U)len, SNAKE_BENCH_TEXT_N, ts_total, pixels);
+
+    ts_total = 0u;
+    for (r = 0u; r < SNAKE_BENCH_TEXT_N; r++)
+    {
+        TextFlush(); // Each line drawn for the first time
+        ts_start = CPU_TS_TmrRd();
+        (void)TextDraw(&screen, 0, 100, line, (CPU_INT16U)len, font, LCD_COLOR_GREEN, LCD_COLOR_WHITE);
+        ts_total += (CPU_INT32U)(CPU_TS_TmrRd() - ts_start);
+    }
+    SnakeBench_Print("text_glyph", (CPU_INT16U)len, SNAKE_BENCH_TEXT_N, ts_total, pixels);
+
+    ts_start = CPU_TS_TmrRd();
+    for (r = 0u; r < SNAKE_BENCH_TEXT_N; r++)
+    {
+        (void)TextDraw(&screen, 0, 100, line, (CPU_INT16U)len, font, LCD_COLOR_GREEN, LCD_COLOR_WHITE);
+    }
+    ts_total = (CPU_INT32U)(CPU_TS_TmrRd() - ts_start);
+    SnakeBench_Print("text_run", (CPU_INT16U)len, SNAKE_BENCH_TEXT_N, ts_total, pixels);
+
+    // Every glyph, in lines as long as the screen allows, then centred
+    BSP_LCD_SelectLayer(LCD_FOREGROUND_LAYER); // Drawn by DispBatchRender()
+    for (f = 0u; f < sizeof(SnakeBenchFont) / sizeof(SnakeBenchFont[0]); f++)
+    {
+        font = &SnakeBenchFont[f];
+        len = BSP_LCD_GetXSize() / font->Width;
+        for (g = 0u; g < TEXT_GLYPH_NBR; g += len)
+        {
+            for (r = 0u; (r < len) && (g + r < TEXT_GLYPH_NBR); r++)
+            {
+                text[r] = (CPU_CHAR)(TEXT_GLYPH_FIRST + g + r);
+            }
+            text[r] = '\0';
+            errors += SnakeBench_TextCheck(font, text, LEFT_MODE);
+            cases += 3u;
+        }
+        errors += SnakeBench_TextCheck(font, (const CPU_CHAR *)"WON!", CENTER_MODE);
+        cases += 3u;
+    }
+
+    OS_CPU_PosixPrintf("snake op=text_check cases=%lu errors=%lu\n", (unsigned long)cases, (unsigned long)errors);
+}
+
+/**
+ * \brief A line of text of the compositor drawn three times, see Note #6, each against the BSP
+ * \return lines with a pixel which differs
+ */
+static CPU_INT32U SnakeBench_TextCheck(sFONT *const font, const CPU_CHAR *const text, const Text_AlignModeTypdef mode)
+{
+    static uint32_t drawn[240u * 16u];
+    const CPU_INT16U y = 100u;
+    CPU_INT32U errors = 0u;
+    CPU_INT32U w = BSP_LCD_GetXSize();
+    CPU_INT32U i;
+    CPU_INT32U r;
+
+    BSP_LCD_Clear(LCD_COLOR_BLACK);
+    BSP_LCD_SetFont(font);
+    BSP_LCD_SetTextColor(LCD_COLOR_RED);
+    BSP_LCD_SetBackColor(LCD_COLOR_WHITE);
+    BSP_LCD_DisplayStringAt(0u, y, (uint8_t *)text, mode);
+    for (i = 0u; i < w * font->Height; i++)
+    {
+        drawn[i] = BSP_LCD_ReadPixel(i % w, y + i / w);
+    }
+
+    for (r = 0u; r < 3u; r++)
+    {
+        BSP_LCD_Clear(LCD_COLOR_BLACK);
+        DispBatchInit(&SnakeBenchBatch);
+        (void)DispText(&SnakeBenchBatch, 0u, y, text, mode, font, LCD_COLOR_RED, LCD_COLOR_WHITE);
+        (void)DispBatchRender(&SnakeBenchBatch);
+        for (i = 0u; i < w * font->Height; i++)
+        {
+            if (drawn[i] != BSP_LCD_ReadPixel(i % w, y + i / w))
+            {
+                errors++;
+                break;
+            }
+        }
+    }
+    return errors;
+}
+
+/**
+ * \brief Turn like the touch screen lets the player do, now and then
+ */
+static void SnakeBench_Turn(snake_t *const snake)
+{
+    if ((rand() % 3) != 0)
+    {
+        return;
+    }
+    if (snake->direction.X == 0)
+    {
+        snake->direction = ((rand() & 1) == 0) ? DIR_UP : DIR_DOWN;
+    }
+    else
+    {
+        snake->direction = ((rand() & 1) == 0) ? DIR_LEFT : DIR_RIGHT;
+    }
+}
+
+/**
+ * \brief Print 'snake op=<op> length=<length> n=<n> ns=<average>' with two decimals, and ' pixels=<pixels>'
+ * unless 0
+ */
+static void SnakeBench_Print(const CPU_CHAR *op, const CPU_INT16U length, const CPU_INT32U n, const CPU_INT64U ts_total, const CPU_INT32U pixels)
+{
+    CPU_INT64U ns100;
+    CPU_ERR err;
+
+    ns100 = (ts_total * 100u / n) * 1000000000u / CPU_TS_TmrFreqGet(&err);
+    OS_CPU_PosixPrintf("snake op=%s length=%u n=%lu ns=%lu.%02lu",
+                       op,
+                       (unsigned)length,
+                       (unsigned long)n,
+                       (unsigned long)(ns100 / 100u),
+                       (unsigned long)(ns100 % 100u));
+    if (pixels > 0u)
+    {
+        OS_CPU_PosixPrintf(" pixels=%lu", (unsigned long)pixels);
+    }
+    OS_CPU_PosixPrintf("\n");
+}
+
+/**
+ * \brief The apple placement before the free cells, for comparison
+ */
+static void SnakeBench_AppleRetry(gamedata_t *const game_data)
+{
+    tuple_t new_coordinates;
+    new_coordinates.X = 5 + (rand() % 24) * SCALE;
+    new_coordinates.Y = 5 + (rand() % 32) * SCALE;
+    while (SnakeCollisionWalk(game_data->snake, &new_coordinates))
+    {
+        new_coordinates.X = 5 + (rand() % 24) * SCALE;
+        new_coordinates.Y = 5 + (rand() % 32) * SCALE;
+    }
+    game_data->apple->coordinates = new_coordinates;
+}
+
+/**
+ * \brief Check the free cells against the bitmap for the cell of a point, and their number
+ * \return DEF_TRUE if consistent
+ */
+static CPU_BOOLEAN SnakeBench_FreeCheck(const snake_t *const snake, const tuple_t *const point)
+{
+    CPU_INT16U cell = ((point->Y - 5) / SCALE) * SNAKE_GRID_COLS + (point->X - 5) / SCALE;
+    CPU_INT16U used = 0u;
+    CPU_INT16U row;
+    CPU_BOOLEAN free;
+
+    for (row = 0u; row < SNAKE_GRID_ROWS; row++)
+    {
+        used += (CPU_INT16U)__builtin_popcount(snake->occupancy[row]);
+    }
+
+    free = (snake->free_index[cell] < snake->free_count) ? DEF_TRUE : DEF_FALSE;
+    return ((snake->free_cells[snake->free_index[cell]] == cell) &&
+            (used + snake->free_count == LENGTH_MAX) &&
+            (free != SnakeCellOccupied(snake, point)))
+               ? DEF_TRUE
+               : DEF_FALSE;
+}
+
+/**
+ * \brief Draw the dirty cells like DrawSnake & the compositor do, in batches
+ * \return pixels written
+ */
+static CPU_INT32U SnakeBench_Render(snake_t *const snake)
+{
+    CPU_INT32U pixels = 0u;
+
+    DispBatchInit(&SnakeBenchBatch);
+    while (SnakeRender(snake, &SnakeBenchBatch) > 0u)
+    {
+        pixels += DispBatchRender(&SnakeBenchBatch);
+    }
+    return pixels;
+}
+
+/**
+ * \brief The frame before SnakeRender(), for comparison: clear the screen and paint every node
+ * \return pixels written
+ */
+static CPU_INT32U SnakeBench_RenderFull(const snake_t *const snake)
+{
+    const tuple_t *snake_node;
+    CPU_INT16U pos;
+
+    BSP_LCD_Clear(LCD_COLOR_BLACK);
+    for (pos = 0u; pos < snake->length; pos++)
+    {
+        snake_node = &snake->body[SnakeNodeIndex(snake, pos)];
+        BSP_LCD_SetTextColor((pos == 0u) ? SNAKE_HEAD_COLOUR : snake->colour[SnakeCellIndex(snake_node)]);
+        BSP_LCD_FillRect(snake_node->X + SNAKE_X_OFFSET, snake_node->Y + SNAKE_Y_OFFSET, SCALE, SCALE);
+    }
+
+    return BSP_LCD_GetXSize() * BSP_LCD_GetYSize() + (CPU_INT32U)snake->length * SCALE * SCALE;
+}
+
+/**
+ * \brief Compare the centre of every cell on the screen with its colour
+ * \param [IN] fb - framebuffer to check, NULL for the layer drawn
+ * \return number of cells in the wrong colour
+ */
+static CPU_INT32U SnakeBench_RenderCheck(const snake_t *const snake, const uint32_t *const fb)
+{
+    CPU_INT16U head = SnakeCellIndex(&snake->body[snake->head]);
+    CPU_INT32U errors = 0u;
+    CPU_INT32U colour;
+    CPU_INT16U cell;
+    tuple_t point;
+
+    for (cell = 0u; cell < LENGTH_MAX; cell++)
+    {
+        point.X = 5 + (cell % SNAKE_GRID_COLS) * SCALE;
+        point.Y = 5 + (cell / SNAKE_GRID_COLS) * SCALE;
+        if (cell == head)
+        {
+            colour = SNAKE_HEAD_COLOUR;
+        }
+        else
+        {
+            colour = SnakeCellOccupied(snake, &point) ? snake->colour[cell] : LCD_COLOR_BLACK;
+        }
+        if (((fb != NULL) ? fb[point.Y * BSP_LCD_GetXSize() + point.X] : BSP_LCD_ReadPixel(point.X, point.Y)) != colour)
+        {
+            errors++;
+        }
+    }
+
+    return errors;
+}
+
+#endif
@@ -0,0 +1,175 @@
+/*
+*********************************************************************************************************
+*                                          SNAKE RENDERER
+*
+* Note(s) : (1) Repaints the cells listed in snake->dirty_cells[] (see Note #6 of snake.h) instead of clearing
+*               the screen & painting every node each frame.  A move changes 3 cells, so a frame writes
+*               about 3 * SCALE * SCALE pixels at any length, and the screen no longer flickers.
+*
+*           (2) The cells are added to a batch of the compositor (see 'disp.h') as fills.  The cells which
+*               do not fit in the batch stay dirty for the next batch.
+*
+*           (3) The apple is painted by the DrawApple task on a free cell, which the snake repaints when the
+*               head takes it.  Its radius is HALF_SCALE - 1, so it stays in its cell and never paints over
+*               the neighbour cells, which are repainted only when dirty.
+*
+*           (4) In the game, SnakeViewUpdate() moves the dirty cells to the snapshot GameRun publishes (see
+*               Note #9 of snake.h) instead, and DrawSnake repaints the cells of its copy of the snapshot
+*               which differ from the ones it has drawn: a copy missing some writes repaints all the cells
+*               they changed.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                            LOCAL INCLUDES
+*********************************************************************************************************
+*/
+
+#include "snake.h"
+
+#include <string.h>
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static uint32_t SnakeCellColour(const snake_t *const snake, const CPU_INT16U cell, const CPU_INT16U head);
+
+/*
+*********************************************************************************************************
+*                                      NON-TASK FUNCTIONS
+*********************************************************************************************************
+*/
+
+/**
+ * \brief Repaint the cells changed since the last frame, nonreentrant/not thread safe
+ * \param [IN] snake
+ * \param [IN] batch - of the compositor, the cells are added to it
+ * \return cells added, see Note #2
+ */
+CPU_INT16U SnakeRender(snake_t *const snake, disp_batch_t *const batch)
+{
+    CPU_INT16U head = SnakeCellIndex(&snake->body[snake->head]);
+    CPU_INT16U cells = 0u;
+    CPU_INT16U cell;
+
+    while (snake->dirty_count > 0u)
+    {
+        cell = snake->dirty_cells[snake->dirty_count - 1u];
+        if (DispFillRect(batch, (cell % SNAKE_GRID_COLS) * SCALE, (cell / SNAKE_GRID_COLS) * SCALE, SCALE, SCALE,
+                         SnakeCellColour(snake, cell, head)) == DEF_FAIL)
+        {
+            break;
+        }
+
+        snake->dirty[cell / SNAKE_GRID_COLS] &= ~((CPU_INT32U)1u << (cell % SNAKE_GRID_COLS));
+        snake->dirty_count--;
+        cells++;
+    }
+
+    return cells;
+}
+
+/**
+ * \brief The first snapshot of a game, every cell, nonreentrant/not thread safe
+ * \param [OUT] view
+ * \param [IN] snake - its dirty cells are in the snapshot from then on
+ * \param [IN] apple
+ */
+void SnakeViewInit(snake_view_t *const view, snake_t *const snake, const apple_t *const apple)
+{
+    CPU_INT16U head = SnakeCellIndex(&snake->body[snake->head]);
+    CPU_INT16U cell;
+
+    for (cell = 0u; cell < LENGTH_MAX; cell++)
+    {
+        view->cells[cell] = SnakeCellColour(snake, cell, head);
+    }
+    memset(snake->dirty, 0, sizeof(snake->dirty));
+    snake->dirty_count = 0u;
+    view->length = snake->length;
+    view->head = head;
+    view->collision = snake->collision;
+    view->step = 0u;
+    view->ts = OS_TS_GET();
+    view->apple = *apple;
+}
+
+/**
+ * \brief Bring a snapshot up to date with the cells changed since, see Note #4, nonreentrant/not thread safe
+ * \param [IN,OUT] view - a copy of the last snapshot published
+ * \param [IN] snake - its dirty cells are cleared
+ * \param [IN] apple
+ */
+void SnakeViewUpdate(snake_view_t *const view, snake_t *const snake, const apple_t *const apple)
+{
+    CPU_INT16U head = SnakeCellIndex(&snake->body[snake->head]);
+    CPU_INT16U cell;
+
+    while (snake->dirty_count > 0u)
+    {
+        cell = snake->dirty_cells[--snake->dirty_count];
+        view->cells[cell] = SnakeCellColour(snake, cell, head);
+        snake->dirty[cell / SNAKE_GRID_COLS] &= ~((CPU_INT32U)1u << (cell % SNAKE_GRID_COLS));
+    }
+    view->length = snake->length;
+    view->head = head;
+    view->collision = snake->collision;
+    view->step++;
+    view->ts = OS_TS_GET();
+    view->apple = *apple;
+}
+
+/**
+ * \brief Repaint the cells of a snapshot which differ from the ones drawn, see Note #4
+ * \param [IN] view - a copy of a snapshot
+ * \param [IN,OUT] shown - colour of each cell drawn, updated with the cells added
+ * \param [IN] batch - of the compositor, the cells are added to it
+ * \return cells added, the ones which do not fit in the batch are left for the next one
+ */
+CPU_INT16U SnakeViewRender(const snake_view_t *const view, uint32_t *const shown, disp_batch_t *const batch)
+{
+    CPU_INT16U cells = 0u;
+    CPU_INT16U cell;
+
+    for (cell = 0u; cell < LENGTH_MAX; cell++)
+    {
+        if (view->cells[cell] == shown[cell])
+        {
+            continue;
+        }
+        if (DispFillRect(batch, (cell % SNAKE_GRID_COLS) * SCALE, (cell / SNAKE_GRID_COLS) * SCALE, SCALE, SCALE,
+                         view->cells[cell]) == DEF_FAIL)
+        {
+            break;
+        }
+        shown[cell] = view->cells[cell];
+        cells++;
+    }
+
+    return cells;
+}
+
+/**
+ * \brief Colour of a cell, nonreentrant/not thread safe
+ * \param [IN] head - cell of the head
+ */
+static uint32_t SnakeCellColour(const snake_t *const snake, const CPU_INT16U cell, const CPU_INT16U head)
+{
+    tuple_t point;
+
+    point.X = 5 + (cell % SNAKE_GRID_COLS) * SCALE;
+    point.Y = 5 + (cell / SNAKE_GRID_COLS) * SCALE;
+    if (cell == head)
+    {
+        return SNAKE_HEAD_COLOUR;
+    }
+    if (SnakeCellOccupied(snake, &point))
+    {
+        return snake->colour[cell];
+    }
+    return LCD_COLOR_BLACK;
+}
@@ -518,6 +518,10 @@ void        CPU_BitBandSet   (CPU_ADDR    addr,
 #define  CPU_REG_DEMCR               (*((CPU_REG32 *)(0xE000EDFC)))             /* Debug Except & Monitor Ctrl Reg.     */
 #define  CPU_REG_STIR                (*((CPU_REG32 *)(0xE000EF00)))             /* Software Trigger Int Reg.            */
 
+                                                                                /* ----------- DWT REGISTERS ---------- */
+#define  CPU_REG_DWT_CTRL            (*((CPU_REG32 *)(0xE0001000)))             /* DWT Ctrl Reg.                        */
+#define  CPU_REG_DWT_CYCCNT          (*((CPU_REG32 *)(0xE0001004)))             /* DWT Cycle Cnt Reg.                   */
+
 
 /*
 *********************************************************************************************************
@@ -614,6 +618,12 @@ void        CPU_BitBandSet   (CPU_ADDR    addr,
 #define  CPU_REG_SCB_DFSR_BKPT                    0x00000002
 #define  CPU_REG_SCB_DFSR_HALTED                  0x00000001
 
+                                                                /* ---------- DEBUG EXCEPT & MONITOR CTRL BITS --------- */
+#define  CPU_REG_DEMCR_TRCENA                     0x01000000
+
+                                                                /* ----------------- DWT CTRL REG BITS ---------------- */
+#define  CPU_REG_DWT_CTRL_CYCCNTENA               0x00000001
+
                                                                 /* -------- COPROCESSOR ACCESS CONTROL REG BITS ------- */
 #define  CPU_REG_SCB_CPACR_CP10_FULL_ACCESS       0x00300000
 #define  CPU_REG_SCB_CPACR_CP11_FULL_ACCESS       0x00C00000
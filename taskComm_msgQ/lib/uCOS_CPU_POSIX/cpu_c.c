@@ -0,0 +1,318 @@
+/*
+*********************************************************************************************************
+*                                               uC/CPU
+*                                    CPU CONFIGURATION & PORT LAYER
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                            CPU PORT FILE
+*
+*                                            POSIX (Linux)
+*
+* Filename : cpu_c.c
+* Version  : v1.32.00
+*********************************************************************************************************
+* Note(s)  : (1) This file replaces 'cpu_a.s' of the ARMv7-M port.  The interrupt mask is emulated with
+*                the host signal mask (see 'cpu.h  INTERRUPT SIGNALS').
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#include  <cpu.h>
+#include  <cpu_core.h>
+
+#include  <lib_def.h>
+
+#include  <signal.h>
+#include  <time.h>
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void  CPU_IntSigSetGet (sigset_t  *p_set);
+
+
+/*
+*********************************************************************************************************
+*                                    DISABLE/ENABLE INTERRUPTS
+*
+* Description : Disable/Enable interrupts, i.e. block/unblock the host interrupt signals.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  CPU_IntDis (void)
+{
+    sigset_t  set;
+
+
+    CPU_IntSigSetGet(&set);
+    (void)sigprocmask(SIG_BLOCK, &set, (sigset_t *)0);
+}
+
+
+void  CPU_IntEn (void)
+{
+    sigset_t  set;
+
+
+    CPU_IntSigSetGet(&set);
+    (void)sigprocmask(SIG_UNBLOCK, &set, (sigset_t *)0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      CRITICAL SECTION FUNCTIONS
+*
+* Description : Disable/Enable interrupts by preserving the state of interrupts.  Generally speaking you
+*               would store the state of the interrupt disable flag in the local variable 'cpu_sr' and
+*               then disable interrupts.  'cpu_sr' is allocated in all of uC/OS-III's functions that need
+*               to disable interrupts.  You would restore the interrupt disable state by copying back
+*               'cpu_sr' into the host signal mask.
+*
+* Argument(s) : cpu_sr      Previous interrupt state returned by CPU_SR_Save() :
+*
+*                               0   interrupts were enabled  (signals unblocked).
+*                               1   interrupts were disabled (signals blocked).
+*
+* Return(s)   : CPU_SR_Save() returns the interrupt state prior to disabling interrupts.
+*
+* Note(s)     : (1) Signal handlers are entered with the interrupt signals already blocked (see
+*                   'os_cpu_c.c  OS_CPU_PosixIntInit()'), so a critical section nested in an ISR never
+*                   re-enables interrupts on exit.
+*********************************************************************************************************
+*/
+
+CPU_SR  CPU_SR_Save (void)
+{
+    sigset_t  set;
+    sigset_t  set_prev;
+
+
+    CPU_IntSigSetGet(&set);
+    (void)sigprocmask(SIG_BLOCK, &set, &set_prev);
+
+    return ((sigismember(&set_prev, CPU_INT_SIG_TICK) == 1) ? (CPU_SR)1u : (CPU_SR)0u);
+}
+
+
+void  CPU_SR_Restore (CPU_SR  cpu_sr)
+{
+    sigset_t  set;
+
+
+    if (cpu_sr == (CPU_SR)0u) {                                 /* Only re-enable if enabled on entry (see Note #1).    */
+        CPU_IntSigSetGet(&set);
+        (void)sigprocmask(SIG_UNBLOCK, &set, (sigset_t *)0);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         WAIT FOR INTERRUPT
+*
+* Description : Suspend the host process until an interrupt signal is delivered.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) sigsuspend() atomically unblocks the interrupt signals & waits, so an interrupt that
+*                   becomes pending between the caller's last check & the call is never lost.
+*********************************************************************************************************
+*/
+
+void  CPU_WaitForInt (void)
+{
+    sigset_t  set;
+
+
+    (void)sigprocmask(SIG_SETMASK, (sigset_t *)0, &set);
+    (void)sigdelset(&set, CPU_INT_SIG_TICK);
+    (void)sigdelset(&set, CPU_INT_SIG_EXT);
+    (void)sigsuspend(&set);                                     /* See Note #1.                                         */
+}
+
+
+void  CPU_WaitForExcept (void)
+{
+    CPU_WaitForInt();
+}
+
+
+/*
+*********************************************************************************************************
+*                                         CPU_CntLeadZeros()
+*                                        COUNT LEADING ZEROS
+*
+* Description : Counts the number of contiguous, most-significant, leading zero bits before the
+*                   first binary one bit in a data value.
+*
+* Argument(s) : val         Data value to count leading zero bits.
+*
+* Return(s)   : Number of contiguous, most-significant, leading zero bits in 'val'.
+*
+* Note(s)     : (1) The GCC builtins are undefined for a zero argument, hence the explicit check.
+*********************************************************************************************************
+*/
+
+CPU_DATA  CPU_CntLeadZeros (CPU_DATA  val)
+{
+    if (val == 0u) {                                            /* See Note #1.                                         */
+        return ((CPU_DATA)DEF_INT_CPU_NBR_BITS);
+    }
+
+    return ((CPU_DATA)__builtin_clz((unsigned int)val));
+}
+
+
+CPU_DATA  CPU_CntTrailZeros (CPU_DATA  val)
+{
+    if (val == 0u) {
+        return ((CPU_DATA)DEF_INT_CPU_NBR_BITS);
+    }
+
+    return ((CPU_DATA)__builtin_ctz((unsigned int)val));
+}
+
+
+/*
+*********************************************************************************************************
+*                                            CPU_RevBits()
+*                                            REVERSE BITS
+*
+* Description : Reverses the bits in a data value.
+*
+* Argument(s) : val         Data value to reverse bits.
+*
+* Return(s)   : Value with all bits in 'val' reversed.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+CPU_DATA  CPU_RevBits (CPU_DATA  val)
+{
+    CPU_DATA    val_rev;
+    CPU_INT08U  ix;
+
+
+    val_rev = 0u;
+    for (ix = 0u; ix < DEF_INT_CPU_NBR_BITS; ix++) {
+        val_rev = (val_rev << 1u) | (val & 1u);
+        val   >>= 1u;
+    }
+
+    return (val_rev);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          CPU_TS_TmrInit()
+*
+* Description : Initialize the CPU timestamp timer, CLOCK_MONOTONIC in nanoseconds.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Note(s)     : (1) Called by CPU_Init(), see 'cpu_core.h  FUNCTION PROTOTYPES  CPU_TS_TmrInit()'.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+void  CPU_TS_TmrInit (void)
+{
+    CPU_TS_TmrFreqSet((CPU_TS_TMR_FREQ)1000000000u);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           CPU_TS_TmrRd()
+*
+* Description : Get current CPU timestamp timer count value.
+*
+* Argument(s) : none.
+*
+* Return(s)   : CLOCK_MONOTONIC in nanoseconds, wrapping on 32 bits like the DWT cycle counter of the
+*               ARMv7-M port.
+*
+* Note(s)     : (1) Called by OS_TS_GET(), see 'cpu_core.h  FUNCTION PROTOTYPES  CPU_TS_TmrRd()'.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+CPU_TS_TMR  CPU_TS_TmrRd (void)
+{
+    struct timespec  ts;
+
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((CPU_TS_TMR)((CPU_INT64U)ts.tv_sec * 1000000000u + (CPU_INT64U)ts.tv_nsec));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         CPU_IntSigSetGet()
+*
+* Description : Build the set of host signals emulating kernel-aware interrupts.
+*
+* Argument(s) : p_set       Pointer to the signal set to fill.
+*
+* Return(s)   : none.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  CPU_IntSigSetGet (sigset_t  *p_set)
+{
+    (void)sigemptyset(p_set);
+    (void)sigaddset(p_set, CPU_INT_SIG_TICK);
+    (void)sigaddset(p_set, CPU_INT_SIG_EXT);
+}
+
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,180 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX (Linux) Port
+*
+* File      : os_cpu.h
+* Version   : V3.08.00
+*********************************************************************************************************
+* For       : POSIX (Linux) host process
+* Mode      : ucontext(3) task contexts, signal driven tick
+* Toolchain : GNU C Compiler
+*********************************************************************************************************
+* Note(s)   : (1) Every task runs on its own host stack inside ONE host thread.  Context switches are
+*                 performed with swapcontext(), from task level (OSCtxSw()) as well as from the tick
+*                 signal handler (OSIntCtxSw()), which gives true preemption like PendSV does.
+*
+*             (2) The task stack passed to OSTaskCreate() only holds a pointer to the host context, so
+*                 application stack sizes do not need to change between the board & the host.  The
+*                 host stack size is set by OS_CPU_POSIX_TASK_STK_SIZE.
+*
+*             (3) Host C library calls which take internal locks (malloc(), stdio, ...) are NOT
+*                 preemption safe: a task switched out by the tick signal inside one of them keeps the
+*                 lock, & the next task calling the library deadlocks on it or corrupts its state.
+*                 Call them inside a critical section, which blocks the interrupt signals, or print with
+*                 OS_CPU_PosixPrintf().  The port allocates & frees the host stacks the same way.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_H
+#define  OS_CPU_H
+
+#ifdef   OS_CPU_GLOBALS
+#define  OS_CPU_EXT
+#else
+#define  OS_CPU_EXT  extern
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     EXTERNAL C LANGUAGE LINKAGE
+*
+* Note(s) : (1) C++ compilers MUST 'extern'ally declare ALL C function prototypes & variable/object
+*               declarations for correct C language linkage.
+*********************************************************************************************************
+*/
+
+#ifdef __cplusplus
+extern  "C" {                                    /* See Note #1.                                       */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                               DEFINES
+*
+* Note(s) : (1) Host stack size of each task, in bytes.  The C library needs far more stack than the
+*               few hundred words the applications give their tasks on the board.
+*
+*           (2) Frequency of the host 'SysTick' counter.  OS_CPU_SysTickInit() counts in microseconds.
+*
+*           (3) Number of emulated external interrupt sources (see OS_CPU_IntSrcRaise()).
+*
+*           (4) Longest dynamic tick period, in timer counts.  Same limit as the 24-bit SysTick reload.
+*
+*           (5) Longest text printed by OS_CPU_PosixPrintf(), terminating NUL included.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CPU_POSIX_TASK_STK_SIZE
+#define  OS_CPU_POSIX_TASK_STK_SIZE    (64u * 1024u)             /* See Note #1.                                       */
+#endif
+
+#define  OS_CPU_POSIX_SYSTICK_FREQ_HZ  1000000u                 /* See Note #2.                                       */
+
+#define  OS_CPU_POSIX_INT_SRC_MAX      32u                      /* See Note #3.                                       */
+
+#define  OS_CPU_POSIX_DYN_TICK_CNTS_MAX  0x01000000u            /* See Note #4.                                       */
+
+#define  OS_CPU_POSIX_PRINT_BUF_SIZE   512u                     /* See Note #5.                                       */
+
+
+/*
+*********************************************************************************************************
+*                                               MACROS
+*********************************************************************************************************
+*/
+
+#define  OS_TASK_SW()               OSCtxSw()
+
+
+/*
+*********************************************************************************************************
+*                                       TIMESTAMP CONFIGURATION
+*
+* Note(s) : (1) OS_TS_GET() is generally defined as CPU_TS_Get32() to allow CPU timestamp timer to be of
+*               any data type size.
+*
+*           (2) For architectures that provide 32-bit or higher precision free running counters
+*               (i.e. cycle count registers):
+*
+*               (a) OS_TS_GET() may be defined as CPU_TS_TmrRd() to improve performance when retrieving
+*                   the timestamp.
+*
+*               (b) CPU_TS_TmrRd() MUST be configured to be greater or equal to 32-bits to avoid
+*                   truncation of TS.
+*********************************************************************************************************
+*/
+
+#if      OS_CFG_TS_EN == 1u
+#define  OS_TS_GET()               (CPU_TS)CPU_TS_TmrRd()   /* See Note #2a.                                          */
+#else
+#define  OS_TS_GET()               (CPU_TS)0u
+#endif
+
+#if (CPU_CFG_TS_32_EN    > 0u) && \
+    (CPU_CFG_TS_TMR_SIZE < CPU_WORD_SIZE_32)
+                                                            /* CPU_CFG_TS_TMR_SIZE MUST be >= 32-bit (see Note #2b).  */
+#error  "cpu_cfg.h, CPU_CFG_TS_TMR_SIZE MUST be >= CPU_WORD_SIZE_32"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+                                                  /* See OS_CPU_C.C                                    */
+void  OSCtxSw               (void);
+void  OSIntCtxSw            (void);
+void  OSStartHighRdy        (void);
+
+void  OS_CPU_SysTickInit    (CPU_INT32U   cnts);
+void  OS_CPU_SysTickInitFreq(CPU_INT32U   cpu_freq);
+
+void  OS_CPU_SysTickHandler (void);
+
+void  OS_CPU_IntSrcHandlerSet(CPU_INT08U     src,
+                              CPU_FNCT_VOID  isr);
+void  OS_CPU_IntSrcRaise    (CPU_INT08U     src);
+
+int   OS_CPU_PosixPrintf    (const char    *p_fmt,
+                             ...);
+
+
+/*
+*********************************************************************************************************
+*                                   EXTERNAL C LANGUAGE LINKAGE END
+*********************************************************************************************************
+*/
+
+#ifdef __cplusplus
+}                                                 /* End of 'extern'al C lang linkage.                 */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
@@ -0,0 +1,1044 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX (Linux) Port
+*
+* File    : os_cpu_c.c
+* Version : V3.08.00
+*********************************************************************************************************
+* For     : POSIX (Linux) host process
+* Mode    : ucontext(3) task contexts, signal driven tick
+*********************************************************************************************************
+* Note(s) : (1) See 'os_cpu.h  Note(s)'.
+*********************************************************************************************************
+*/
+
+#define   OS_CPU_GLOBALS
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_cpu_c__c = "$Id: $";
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "os.h"
+
+#include  <pthread.h>
+#include  <signal.h>
+#include  <stdarg.h>
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <sys/time.h>
+#include  <time.h>
+#include  <ucontext.h>
+#include  <unistd.h>
+
+
+#ifdef __cplusplus
+extern  "C" {
+#endif
+
+/*
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  os_cpu_posix_ctx {
+    ucontext_t    Ctx;                                          /* Saved host context of the task                       */
+    OS_TASK_PTR   TaskPtr;                                      /* Task entry point & argument                          */
+    void         *ArgPtr;
+    void         *StkPtr;                                       /* Host stack the task executes on                      */
+} OS_CPU_POSIX_CTX;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_CPU_POSIX_CTX   *OS_CPU_PosixCtxCurPtr;              /* Context of the running task                          */
+static  OS_CPU_POSIX_CTX   *OS_CPU_PosixCtxDelPtr;              /* Context of a task that deleted itself                */
+
+static  pthread_t           OS_CPU_PosixThread;                 /* Host thread running the kernel                       */
+static  CPU_BOOLEAN         OS_CPU_PosixThreadRdy;
+
+static  CPU_FNCT_VOID       OS_CPU_PosixIntSrcTbl[OS_CPU_POSIX_INT_SRC_MAX];
+static  CPU_INT32U          OS_CPU_PosixIntSrcPend;
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  CPU_INT32U          OS_CPU_PosixDynTickCnts;            /* Timer cnts per tick, 0 until OS_CPU_SysTickInit()    */
+static  OS_TICK             OS_CPU_PosixDynTickStep;            /* Ticks until the programmed timer signal              */
+static  CPU_INT64U          OS_CPU_PosixDynTickBase;            /* Time of the tick base, in timer cnts                 */
+static  OS_TICK             OS_CPU_PosixDynTickElapsed;         /* Ticks last returned by OS_DynTickGet()               */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  void               OS_CPU_PosixIntInit    (void);
+static  void               OS_CPU_PosixSigHandler (int                signo);
+static  void               OS_CPU_PosixIntSrcHandler(void);
+static  void               OS_CPU_PosixTaskEntry  (void);
+static  void               OS_CPU_PosixCtxSw      (void);
+static  void               OS_CPU_PosixCtxFree    (void);
+static  OS_CPU_POSIX_CTX  *OS_CPU_PosixCtxGet     (OS_TCB            *p_tcb);
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  CPU_INT64U          OS_CPU_PosixDynTickNow (void);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           IDLE TASK HOOK
+*
+* Description: This function is called by the idle task.  This hook has been added to allow you to do
+*              such things as STOP the CPU to conserve power.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) The host process sleeps until the next signal, the equivalent of a WFI instruction.
+*                 The idle counter used by the statistic task therefore counts idle periods, not loops.
+*********************************************************************************************************
+*/
+
+void  OSIdleTaskHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppIdleTaskHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppIdleTaskHookPtr)();
+    }
+#endif
+
+    CPU_WaitForInt();                                           /* See Note #1.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                       OS INITIALIZATION HOOK
+*
+* Description: This function is called by OSInit() at the beginning of OSInit().
+*
+* Arguments  : None.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSInitHook (void)
+{
+    OS_CPU_PosixCtxCurPtr = (OS_CPU_POSIX_CTX *)0;
+    OS_CPU_PosixCtxDelPtr = (OS_CPU_POSIX_CTX *)0;
+
+    OS_CPU_PosixIntInit();
+}
+
+
+/*
+*********************************************************************************************************
+*                                           REDZONE HIT HOOK
+*
+* Description: This function is called when a task's stack overflowed.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the offending task. NULL if ISR.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+void  OSRedzoneHitHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppRedzoneHitHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppRedzoneHitHookPtr)(p_tcb);
+    } else {
+        CPU_SW_EXCEPTION(;);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+    CPU_SW_EXCEPTION(;);
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         STATISTIC TASK HOOK
+*
+* Description: This function is called every second by uC/OS-III's statistics task.  This allows your
+*              application to add functionality to the statistics task.
+*
+* Arguments  : None.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSStatTaskHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppStatTaskHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppStatTaskHookPtr)();
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          TASK CREATION HOOK
+*
+* Description: This function is called when a task is created.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task being created.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSTaskCreateHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskCreateHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskCreateHookPtr)(p_tcb);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                           TASK DELETION HOOK
+*
+* Description: This function is called when a task is deleted.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task being deleted.
+*
+* Note(s)    : 1) A task deleting itself is still running on its host stack, so its context is released
+*                 by the next task to run (see OS_CPU_PosixCtxFree()).
+*********************************************************************************************************
+*/
+
+void  OSTaskDelHook (OS_TCB  *p_tcb)
+{
+    OS_CPU_POSIX_CTX  *p_ctx;
+
+
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskDelHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskDelHookPtr)(p_tcb);
+    }
+#endif
+
+    p_ctx = OS_CPU_PosixCtxGet(p_tcb);
+    if (p_ctx == OS_CPU_PosixCtxCurPtr) {                       /* See Note #1.                                         */
+        OS_CPU_PosixCtxDelPtr = p_ctx;
+    } else {
+        free(p_ctx->StkPtr);
+        free(p_ctx);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            TASK RETURN HOOK
+*
+* Description: This function is called if a task accidentally returns.  In other words, a task should
+*              either be an infinite loop or delete itself when done.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task that is returning.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+void  OSTaskReturnHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskReturnHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskReturnHookPtr)(p_tcb);
+    }
+#else
+    (void)p_tcb;                                                /* Prevent compiler warning                             */
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                        INITIALIZE A TASK'S STACK
+*
+* Description: This function is called by either OSTaskCreate() or OSTaskCreateExt() to initialize the
+*              stack frame of the task being created.  This function is highly processor specific.
+*
+* Arguments  : p_task       Pointer to the task entry point address.
+*
+*              p_arg        Pointer to a user supplied data area that will be passed to the task
+*                               when the task first executes.
+*
+*              p_stk_base   Pointer to the base address of the stack.
+*
+*              stk_size     Size of the stack, in number of CPU_STK elements.
+*
+*              opt          Options used to alter the behavior of OS_Task_StkInit().
+*                            (see OS.H for OS_TASK_OPT_xxx).
+*
+* Returns    : Always returns the location of the new top-of-stack once the processor registers have
+*              been placed on the stack in the proper order.
+*
+* Note(s)    : (1) Interrupts are enabled when task starts executing.
+*
+*              (2) The only 'register' pushed on the task stack is the pointer to the host context,
+*                  which is retrieved again from 'OS_TCB.StkPtr' (see 'os_cpu.h  Note #2').
+*
+*              (3) OSTaskCreate() calls this function with interrupts enabled, so the host stack is
+*                  allocated in a critical section (see 'os_cpu.h  Note #3').
+**********************************************************************************************************
+*/
+
+CPU_STK  *OSTaskStkInit (OS_TASK_PTR    p_task,
+                         void          *p_arg,
+                         CPU_STK       *p_stk_base,
+                         CPU_STK       *p_stk_limit,
+                         CPU_STK_SIZE   stk_size,
+                         OS_OPT         opt)
+{
+    OS_CPU_POSIX_CTX  *p_ctx;
+    CPU_STK           *p_stk;
+    CPU_SR_ALLOC();
+
+
+    (void)p_stk_limit;                                          /* Prevent compiler warnings                            */
+    (void)opt;
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #3.                                         */
+    p_ctx = (OS_CPU_POSIX_CTX *)calloc(1u, sizeof(OS_CPU_POSIX_CTX));
+    if (p_ctx != (OS_CPU_POSIX_CTX *)0) {
+        p_ctx->StkPtr = malloc(OS_CPU_POSIX_TASK_STK_SIZE);
+    }
+    CPU_CRITICAL_EXIT();
+    if (p_ctx == (OS_CPU_POSIX_CTX *)0) {
+        CPU_SW_EXCEPTION((CPU_STK *)0);
+    }
+    if (p_ctx->StkPtr == (void *)0) {
+        CPU_SW_EXCEPTION((CPU_STK *)0);
+    }
+    p_ctx->TaskPtr = p_task;
+    p_ctx->ArgPtr  = p_arg;
+
+    (void)getcontext(&p_ctx->Ctx);
+    p_ctx->Ctx.uc_stack.ss_sp   = p_ctx->StkPtr;
+    p_ctx->Ctx.uc_stack.ss_size = OS_CPU_POSIX_TASK_STK_SIZE;
+    p_ctx->Ctx.uc_link          = (ucontext_t *)0;
+    (void)sigemptyset(&p_ctx->Ctx.uc_sigmask);                  /* See Note #1.                                         */
+    makecontext(&p_ctx->Ctx, OS_CPU_PosixTaskEntry, 0);
+
+    p_stk      = &p_stk_base[stk_size];                         /* See Note #2.                                         */
+    *(--p_stk) = (CPU_STK)p_ctx;
+
+    return (p_stk);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           TASK SWITCH HOOK
+*
+* Description: This function is called when a task switch is performed.  This allows you to perform other
+*              operations during a context switch.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*              2) It is assumed that the global pointer 'OSTCBHighRdyPtr' points to the TCB of the task
+*                 that will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCurPtr' points
+*                 to the task being switched out (i.e. the preempted task).
+*********************************************************************************************************
+*/
+
+void  OSTaskSwHook (void)
+{
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    CPU_TS  ts;
+#endif
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+    CPU_TS  int_dis_time;
+#endif
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+    CPU_BOOLEAN  stk_status;
+#endif
+
+
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskSwHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppTaskSwHookPtr)();
+    }
+#endif
+
+    OS_TRACE_TASK_SWITCHED_IN(OSTCBHighRdyPtr);
+
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    ts = OS_TS_GET();
+    if (OSTCBCurPtr != OSTCBHighRdyPtr) {
+        OSTCBCurPtr->CyclesDelta  = ts - OSTCBCurPtr->CyclesStart;
+        OSTCBCurPtr->CyclesTotal += (OS_CYCLES)OSTCBCurPtr->CyclesDelta;
+#if (OS_CFG_TASK_PROFILE_HIST_EN > 0u)
+        OS_TaskProfileSwOut(OSTCBCurPtr, ts);                   /* Run & response time histograms                       */
+#endif
+    }
+
+    OSTCBHighRdyPtr->CyclesStart = ts;
+#endif
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+    int_dis_time = CPU_IntDisMeasMaxCurReset();                 /* Keep track of per-task interrupt disable time        */
+    if (OSTCBCurPtr->IntDisTimeMax < int_dis_time) {
+        OSTCBCurPtr->IntDisTimeMax = int_dis_time;
+    }
+#endif
+
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+                                                                /* Keep track of per-task scheduler lock time           */
+    if (OSTCBCurPtr->SchedLockTimeMax < OSSchedLockTimeMaxCur) {
+        OSTCBCurPtr->SchedLockTimeMax = OSSchedLockTimeMaxCur;
+    }
+    OSSchedLockTimeMaxCur = (CPU_TS)0;                          /* Reset the per-task value                             */
+#endif
+
+#if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
+                                                                /* Check if stack overflowed.                           */
+    stk_status = OSTaskStkRedzoneChk((OS_TCB *)0u);
+    if (stk_status != OS_TRUE) {
+        OSRedzoneHitHook(OSTCBCurPtr);
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                              TICK HOOK
+*
+* Description: This function is called every tick.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is assumed to be called from the Tick ISR.
+*********************************************************************************************************
+*/
+
+void  OSTimeTickHook (void)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTimeTickHookPtr != (OS_APP_HOOK_VOID)0) {
+        (*OS_AppTimeTickHookPtr)();
+    }
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                START HIGHEST PRIORITY TASK READY-TO-RUN
+*
+* Description: This function is called by OSStart() to start the highest priority task that was created
+*              by your application before calling OSStart().
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) OSStartHighRdy() MUST:
+*                 a) Call OSTaskSwHook() then,
+*                 b) Set OSTCBCurPtr = OSTCBHighRdyPtr,
+*                 c) Start the kernel tick,
+*                 d) Restore the context of the task & never return.
+*
+*              2) The board relies on HAL_Init() to start SysTick; the host has no HAL, so the tick is
+*                 started here at OS_CFG_TICK_RATE_HZ.
+*********************************************************************************************************
+*/
+
+void  OSStartHighRdy (void)
+{
+    OS_CPU_POSIX_CTX  *p_ctx;
+
+
+    CPU_IntDis();                                               /* Prevent interruption during context switch           */
+
+    OSTaskSwHook();
+
+    OSPrioCur             = OSPrioHighRdy;
+    OSTCBCurPtr           = OSTCBHighRdyPtr;
+    p_ctx                 = OS_CPU_PosixCtxGet(OSTCBHighRdyPtr);
+    OS_CPU_PosixCtxCurPtr = p_ctx;
+
+    OS_CPU_SysTickInitFreq(OS_CPU_POSIX_SYSTICK_FREQ_HZ);       /* See Note #2.                                         */
+
+    (void)setcontext(&p_ctx->Ctx);                              /* Interrupts are enabled by the task's signal mask     */
+
+    CPU_SW_EXCEPTION(;);                                        /* setcontext() only returns on failure                 */
+}
+
+
+/*
+*********************************************************************************************************
+*                       PERFORM A CONTEXT SWITCH (From task level) - OSCtxSw()
+*                   PERFORM A CONTEXT SWITCH (From interrupt level) - OSIntCtxSw()
+*
+* Description: OSCtxSw() is called when OS wants to perform a task context switch.  OSIntCtxSw() is
+*              called by OSIntExit() when it determines a context switch is needed as the result of an
+*              interrupt.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Both are called with interrupts disabled.  OSIntCtxSw() runs inside the signal handler;
+*                 the preempted task resumes inside that handler & returns from it normally, just like
+*                 PendSV returning to an interrupted thread.  The preempted task may be anywhere out of a
+*                 critical section, hence 'os_cpu.h  Note #3'.
+*********************************************************************************************************
+*/
+
+void  OSCtxSw (void)
+{
+    OS_CPU_PosixCtxSw();
+}
+
+
+void  OSIntCtxSw (void)
+{
+    OS_CPU_PosixCtxSw();
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SYS TICK HANDLER
+*
+* Description: Handle the host interval timer signal, which is used to generate the uC/OS-III tick
+*              interrupt.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function is called by the CPU_INT_SIG_TICK signal handler.
+*
+*              2) With the dynamic tick, each signal reports the ticks programmed by OS_DynTickSet() & moves
+*                 the tick base forward by as many ticks, however late the signal was delivered.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SysTickHandler  (void)
+{
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK  ticks;
+#endif
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();                                               /* Tell uC/OS-III that we are starting an ISR           */
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    ticks                       = OS_CPU_PosixDynTickStep;      /* See Note #2.                                         */
+    OS_CPU_PosixDynTickBase    += (CPU_INT64U)ticks * OS_CPU_PosixDynTickCnts;
+    OS_CPU_PosixDynTickElapsed  = 0u;
+#endif
+    CPU_CRITICAL_EXIT();
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OSTimeDynTick(ticks);                                       /* Call uC/OS-III's OSTimeDynTick()                     */
+#else
+    OSTimeTick();                                               /* Call uC/OS-III's OSTimeTick()                        */
+#endif
+
+    OSIntExit();                                                /* Tell uC/OS-III that we are leaving the ISR           */
+}
+
+
+/*
+*********************************************************************************************************
+*                                         INITIALIZE SYS TICK
+*
+* Description: Initialize the SysTick using the CPU clock frequency.
+*
+* Arguments  : cpu_freq         CPU clock frequency.
+*
+* Note(s)    : 1) Either OS_CPU_SysTickInitFreq or OS_CPU_SysTickInit() can be called.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SysTickInitFreq (CPU_INT32U  cpu_freq)
+{
+#if (OS_CFG_TICK_EN > 0u)
+    CPU_INT32U  cnts;
+
+
+    cnts = (cpu_freq / (CPU_INT32U)OSCfg_TickRate_Hz);          /* Determine nbr SysTick cnts between two OS tick intr. */
+
+    OS_CPU_SysTickInit(cnts);
+#else
+    (void)cpu_freq;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                         INITIALIZE SYS TICK
+*
+* Description: Initialize the SysTick using the number of countes between two ticks.
+*
+* Arguments  : cnts         Number of SysTick counts between two OS tick interrupts, in microseconds
+*                           (see 'os_cpu.h  OS_CPU_POSIX_SYSTICK_FREQ_HZ').
+*
+* Note(s)    : 1) Either OS_CPU_SysTickInitFreq or OS_CPU_SysTickInit() can be called.
+*
+*              2) With the dynamic tick, the interval timer is a one-shot timer reprogrammed by
+*                 OS_DynTickSet() to the next expiry of the tick list.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
+{
+#if (OS_CFG_TICK_EN > 0u)
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #2.                                         */
+    OS_CPU_PosixDynTickCnts    = cnts;
+    OS_CPU_PosixDynTickBase    = OS_CPU_PosixDynTickNow();      /* The tick base is now                                 */
+    OS_CPU_PosixDynTickElapsed = 0u;
+    (void)OS_DynTickSet(OSTickCtrStep);
+    CPU_CRITICAL_EXIT();
+#else
+    struct  itimerval  tmr;
+
+
+    tmr.it_interval.tv_sec  = (time_t)(cnts / OS_CPU_POSIX_SYSTICK_FREQ_HZ);
+    tmr.it_interval.tv_usec = (suseconds_t)(cnts % OS_CPU_POSIX_SYSTICK_FREQ_HZ);
+    tmr.it_value            = tmr.it_interval;
+
+    (void)setitimer(ITIMER_REAL, &tmr, (struct itimerval *)0);
+#endif
+#else
+    (void)cnts;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                      GET ELAPSED DYNAMIC TICKS
+*
+* Description: Return the number of whole ticks elapsed since the tick base, i.e. since the last timer
+*              signal or since the kernel last accounted for elapsed ticks.
+*
+* Arguments  : None.
+*
+* Returns    : The number of elapsed ticks, at most the number programmed by OS_DynTickSet().
+*
+* Note(s)    : 1) This function is called by uC/OS-III with interrupts disabled.
+*
+*              2) Past the programmed expiry, the timer signal is pending (or about to be) & has not
+*                 updated OSTickCtr yet, so its ticks are reported here.  The kernel adds them to
+*                 OSTickCtr & calls OS_DynTickSet(), which drops the signal.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+OS_TICK  OS_DynTickGet (void)
+{
+    OS_TICK  elapsed;
+
+
+    if (OS_CPU_PosixDynTickCnts == 0u) {                        /* Timer not initialized yet                            */
+        return (0u);
+    }
+
+    elapsed = (OS_TICK)((OS_CPU_PosixDynTickNow() - OS_CPU_PosixDynTickBase) / OS_CPU_PosixDynTickCnts);
+    if (elapsed > OS_CPU_PosixDynTickStep) {                    /* See Note #2.                                         */
+        elapsed = OS_CPU_PosixDynTickStep;
+    }
+    OS_CPU_PosixDynTickElapsed = elapsed;
+
+    return (elapsed);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     SET NEXT DYNAMIC TICK EXPIRY
+*
+* Description: Reprogram the interval timer to expire 'ticks' ticks after the tick base.
+*
+* Arguments  : ticks        Number of ticks until the next expiry of the tick list, 0 when the tick list
+*                           is empty.
+*
+* Returns    : The number of ticks programmed, which the next timer signal reports.
+*
+* Note(s)    : 1) This function is called by uC/OS-III with interrupts disabled, i.e. with the timer
+*                 signal blocked.
+*
+*              2) The kernel has added the ticks of the last OS_DynTickGet() to OSTickCtr, so the tick
+*                 base moves forward by as many ticks.  The expiry is computed from the base, so
+*                 reprogramming does not make the tick drift.
+*
+*              3) A period is limited to OS_CPU_POSIX_DYN_TICK_CNTS_MAX, like the 24-bit SysTick of the
+*                 board.  Longer (or no) delays wake the kernel once per period.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickSet (OS_TICK  ticks)
+{
+    struct  itimerval  tmr;
+    struct  timespec   zero;
+    sigset_t           set;
+    CPU_INT64U         now;
+    CPU_INT64U         expiry;
+    CPU_INT64U         dly;
+    OS_TICK            ticks_max;
+
+
+    if (OS_CPU_PosixDynTickCnts == 0u) {                        /* Timer not initialized yet                            */
+        return (ticks);
+    }
+
+    OS_CPU_PosixDynTickBase    += (CPU_INT64U)OS_CPU_PosixDynTickElapsed * OS_CPU_PosixDynTickCnts;
+    OS_CPU_PosixDynTickElapsed  = 0u;                           /* See Note #2.                                         */
+
+    ticks_max = (OS_TICK)(OS_CPU_POSIX_DYN_TICK_CNTS_MAX / OS_CPU_PosixDynTickCnts);
+    if ((ticks == 0u) || (ticks > ticks_max)) {                 /* See Note #3.                                         */
+        ticks = ticks_max;
+    }
+    OS_CPU_PosixDynTickStep = ticks;
+
+    now    = OS_CPU_PosixDynTickNow();
+    expiry = OS_CPU_PosixDynTickBase + (CPU_INT64U)ticks * OS_CPU_PosixDynTickCnts;
+    dly    = (expiry > now) ? (expiry - now) : 1u;              /* Already due: signal as soon as possible              */
+
+    (void)sigpending(&set);                                     /* Drop the signal of the previous expiry               */
+    if (sigismember(&set, CPU_INT_SIG_TICK) == 1) {
+        (void)sigemptyset(&set);
+        (void)sigaddset(&set, CPU_INT_SIG_TICK);
+        zero.tv_sec  = 0;
+        zero.tv_nsec = 0;
+        (void)sigtimedwait(&set, (siginfo_t *)0, &zero);
+    }
+
+    tmr.it_interval.tv_sec  = 0;                                /* One-shot                                             */
+    tmr.it_interval.tv_usec = 0;
+    tmr.it_value.tv_sec     = (time_t)(dly / OS_CPU_POSIX_SYSTICK_FREQ_HZ);
+    tmr.it_value.tv_usec    = (suseconds_t)(dly % OS_CPU_POSIX_SYSTICK_FREQ_HZ);
+    (void)setitimer(ITIMER_REAL, &tmr, (struct itimerval *)0);
+
+    return (ticks);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      GET DYNAMIC TICK TIMER TIME
+*
+* Description: Return the host monotonic time, in interval timer counts (see 'os_cpu.h  Note #2').
+*
+* Arguments  : None.
+*
+* Returns    : The current time.
+*
+* Note(s)    : None.
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  OS_CPU_PosixDynTickNow (void)
+{
+    struct  timespec  now;
+
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((CPU_INT64U)now.tv_sec  * OS_CPU_POSIX_SYSTICK_FREQ_HZ +
+            (CPU_INT64U)now.tv_nsec / (1000000000u / OS_CPU_POSIX_SYSTICK_FREQ_HZ));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   EXTERNAL INTERRUPT SOURCES
+*
+* Description: OS_CPU_IntSrcHandlerSet() installs the ISR of an emulated interrupt source.
+*
+*              OS_CPU_IntSrcRaise() marks a source pending & interrupts the kernel thread.  It may be
+*              called from any host thread, e.g. a BSP stand-in reading a host device.
+*
+* Arguments  : src          Interrupt source number, 0 to OS_CPU_POSIX_INT_SRC_MAX - 1.
+*
+*              isr          ISR of the source.  It is called between OSIntEnter() & OSIntExit().
+*
+* Note(s)    : 1) Host threads calling OS_CPU_IntSrcRaise() MUST block CPU_INT_SIG_TICK &
+*                 CPU_INT_SIG_EXT, otherwise the host kernel may deliver the tick to them.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_IntSrcHandlerSet (CPU_INT08U     src,
+                               CPU_FNCT_VOID  isr)
+{
+    CPU_SR_ALLOC();
+
+
+    if (src >= OS_CPU_POSIX_INT_SRC_MAX) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    OS_CPU_PosixIntSrcTbl[src] = isr;
+    CPU_CRITICAL_EXIT();
+}
+
+
+void  OS_CPU_IntSrcRaise (CPU_INT08U  src)
+{
+    if (src >= OS_CPU_POSIX_INT_SRC_MAX) {
+        return;
+    }
+
+    (void)__atomic_fetch_or(&OS_CPU_PosixIntSrcPend, (CPU_INT32U)1u << src, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&OS_CPU_PosixThreadRdy, __ATOMIC_ACQUIRE) == DEF_TRUE) {
+        (void)pthread_kill(OS_CPU_PosixThread, CPU_INT_SIG_EXT);
+    }                                                           /* Else served by the first raise after OSInit()        */
+}
+
+
+/*
+*********************************************************************************************************
+*                                        PREEMPTION SAFE PRINT
+*
+* Description: Print to stdout from a task, like printf().
+*
+* Arguments  : p_fmt        Format string, followed by its arguments.
+*
+* Returns    : The number of characters written, or a negative value on error.
+*
+* Note(s)    : 1) The text is formatted in a critical section (see 'os_cpu.h  Note #3') then written by
+*                 write(), which is async-signal safe, so the tick keeps running while the text is out.
+*
+*              2) Text longer than OS_CPU_POSIX_PRINT_BUF_SIZE - 1 characters is truncated.
+*********************************************************************************************************
+*/
+
+int  OS_CPU_PosixPrintf (const char  *p_fmt,
+                         ...)
+{
+    char     buf[OS_CPU_POSIX_PRINT_BUF_SIZE];
+    va_list  args;
+    int      len;
+    CPU_SR_ALLOC();
+
+
+    va_start(args, p_fmt);
+    CPU_CRITICAL_ENTER();                                       /* See Note #1.                                         */
+    len = vsnprintf(buf, sizeof(buf), p_fmt, args);
+    CPU_CRITICAL_EXIT();
+    va_end(args);
+
+    if (len > 0) {
+        if (len >= (int)sizeof(buf)) {                          /* See Note #2.                                         */
+            len = (int)sizeof(buf) - 1;
+        }
+        len = (int)write(STDOUT_FILENO, buf, (size_t)len);
+    }
+
+    return (len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL HELPER FUNCTIONS
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        OS_CPU_PosixIntInit()
+*
+* Description: Install the signal handlers emulating the kernel-aware interrupts.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Both signals are masked while either handler runs, so the emulated ISRs share a single
+*                 priority level & never nest.
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_PosixIntInit (void)
+{
+    struct  sigaction  act;
+
+
+    OS_CPU_PosixThread = pthread_self();
+
+    act.sa_handler = OS_CPU_PosixSigHandler;
+    act.sa_flags   = SA_RESTART;
+    (void)sigemptyset(&act.sa_mask);                            /* See Note #1.                                         */
+    (void)sigaddset(&act.sa_mask, CPU_INT_SIG_TICK);
+    (void)sigaddset(&act.sa_mask, CPU_INT_SIG_EXT);
+
+    (void)sigaction(CPU_INT_SIG_TICK, &act, (struct sigaction *)0);
+    (void)sigaction(CPU_INT_SIG_EXT,  &act, (struct sigaction *)0);
+
+    __atomic_store_n(&OS_CPU_PosixThreadRdy, DEF_TRUE, __ATOMIC_RELEASE);
+}
+
+
+static  void  OS_CPU_PosixSigHandler (int  signo)
+{
+    if (signo == CPU_INT_SIG_TICK) {
+        OS_CPU_SysTickHandler();
+    } else {
+        OS_CPU_PosixIntSrcHandler();
+    }
+}
+
+
+static  void  OS_CPU_PosixIntSrcHandler (void)
+{
+    CPU_INT32U     pend;
+    CPU_INT08U     src;
+    CPU_FNCT_VOID  isr;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();
+    CPU_CRITICAL_EXIT();
+
+    pend = __atomic_exchange_n(&OS_CPU_PosixIntSrcPend, 0u, __ATOMIC_SEQ_CST);
+    while (pend != 0u) {
+        src   = (CPU_INT08U)CPU_CntTrailZeros((CPU_DATA)pend);
+        pend &= ~((CPU_INT32U)1u << src);
+        isr   = OS_CPU_PosixIntSrcTbl[src];
+        if (isr != (CPU_FNCT_VOID)0) {
+            (*isr)();
+        }
+    }
+
+    OSIntExit();
+}
+
+
+/*
+*********************************************************************************************************
+*                                       OS_CPU_PosixTaskEntry()
+*
+* Description: First function executed by every task on its host stack.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) A task that returns is handled exactly as on the board, through OS_TaskReturn().
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_PosixTaskEntry (void)
+{
+    OS_CPU_POSIX_CTX  *p_ctx;
+
+
+    OS_CPU_PosixCtxFree();
+
+    p_ctx = OS_CPU_PosixCtxCurPtr;
+    (*p_ctx->TaskPtr)(p_ctx->ArgPtr);
+
+    OS_TaskReturn();                                            /* See Note #1.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                         OS_CPU_PosixCtxSw()
+*
+* Description: Save the context of the running task & restore the one of OSTCBHighRdyPtr.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Execution resumes after swapcontext() once this task is switched back in.
+*********************************************************************************************************
+*/
+
+static  void  OS_CPU_PosixCtxSw (void)
+{
+    OS_CPU_POSIX_CTX  *p_ctx_cur;
+    OS_CPU_POSIX_CTX  *p_ctx_new;
+
+
+    OSTaskSwHook();
+
+    OSPrioCur             = OSPrioHighRdy;
+    OSTCBCurPtr           = OSTCBHighRdyPtr;
+
+    p_ctx_cur             = OS_CPU_PosixCtxCurPtr;
+    p_ctx_new             = OS_CPU_PosixCtxGet(OSTCBHighRdyPtr);
+    OS_CPU_PosixCtxCurPtr = p_ctx_new;
+
+    (void)swapcontext(&p_ctx_cur->Ctx, &p_ctx_new->Ctx);
+
+    OS_CPU_PosixCtxFree();                                      /* See Note #1.                                         */
+}
+
+
+static  void  OS_CPU_PosixCtxFree (void)
+{
+    OS_CPU_POSIX_CTX  *p_ctx;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();                                       /* A new task runs this with interrupts enabled         */
+    p_ctx = OS_CPU_PosixCtxDelPtr;
+    if ((p_ctx != (OS_CPU_POSIX_CTX *)0) &&
+        (p_ctx != OS_CPU_PosixCtxCurPtr)) {
+        OS_CPU_PosixCtxDelPtr = (OS_CPU_POSIX_CTX *)0;
+        free(p_ctx->StkPtr);
+        free(p_ctx);
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+static  OS_CPU_POSIX_CTX  *OS_CPU_PosixCtxGet (OS_TCB  *p_tcb)
+{
+    return (*(OS_CPU_POSIX_CTX **)p_tcb->StkPtr);
+}
+
+
+#ifdef __cplusplus
+}
+#endif
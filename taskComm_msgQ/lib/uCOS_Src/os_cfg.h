@@ -31,14 +31,21 @@
 #define OS_CFG_APP_HOOKS_EN                        1u           /* Enable (1) or Disable (0) application specific hooks                  */
 #define OS_CFG_ARG_CHK_EN                          1u           /* Enable (1) or Disable (0) argument checking                           */
 #define OS_CFG_CALLED_FROM_ISR_CHK_EN              1u           /* Enable (1) or Disable (0) check for called from ISR                   */
+#ifndef OS_CFG_DBG_EN                                           /* The trace environments override this (see platformio.ini)             */
 #define OS_CFG_DBG_EN                              0u           /* Enable (1) or Disable (0) debug code/variables                        */
+#endif
 #define OS_CFG_TICK_EN                             1u           /* Enable (1) or Disable (0) the kernel tick                             */
 #define OS_CFG_DYN_TICK_EN                         0u           /* Enable (1) or Disable (0) the Dynamic Tick                            */
+#define OS_CFG_TICK_WHEEL_EN                       0u           /* Hierarchical timing wheel (1) or delta list (0) for the tick list     */
 #define OS_CFG_INVALID_OS_CALLS_CHK_EN             1u           /* Enable (1) or Disable (0) checks for invalid kernel calls             */
 #define OS_CFG_OBJ_TYPE_CHK_EN                     1u           /* Enable (1) or Disable (0) object type checking                        */
-#define OS_CFG_TS_EN                               0u           /* Enable (1) or Disable (0) time stamping                               */
+#define OS_CFG_TS_EN                               1u           /* Enable (1) or Disable (0) time stamping                               */
 
 #define OS_CFG_PRIO_MAX                           64u           /* Defines the maximum number of task priorities (see OS_PRIO data type) */
+#define OS_CFG_PRIO_TBL_2LVL_EN                    1u           /* Two-level ready bitmap (summary + leaf words) above 2 words of prios  */
+#ifndef OS_CFG_PEND_LIST_BITMAP_EN                              /* May be enabled from the build flags of an environment                 */
+#define OS_CFG_PEND_LIST_BITMAP_EN                 0u           /* Pend lists indexed by a priority bitmap (O(1) insert), see os.h       */
+#endif
 
 #define OS_CFG_SCHED_LOCK_TIME_MEAS_EN             0u           /* Include code to measure scheduler lock time                           */
 #define OS_CFG_SCHED_ROUND_ROBIN_EN                1u           /* Include code for Round-Robin scheduling                               */
@@ -51,6 +58,9 @@
 #define OS_CFG_FLAG_DEL_EN                         1u           /*     Include code for OSFlagDel()                                      */
 #define OS_CFG_FLAG_MODE_CLR_EN                    1u           /*     Include code for Wait on Clear EVENT FLAGS                        */
 #define OS_CFG_FLAG_PEND_ABORT_EN                  1u           /*     Include code for OSFlagPendAbort()                                */
+#ifndef OS_CFG_FLAG_INDEX_EN                                    /*     May be enabled from the build flags of an environment             */
+#define OS_CFG_FLAG_INDEX_EN                       0u           /*     Index the tasks waiting on each bit of a group, see os.h          */
+#endif
 
 
                                                                 /* ------------------------ MEMORY MANAGEMENT -------------------------  */
@@ -61,6 +71,7 @@
 #define OS_CFG_MUTEX_EN                            1u           /* Enable (1) or Disable (0) code generation for MUTEX                   */
 #define OS_CFG_MUTEX_DEL_EN                        1u           /*     Include code for OSMutexDel()                                     */
 #define OS_CFG_MUTEX_PEND_ABORT_EN                 1u           /*     Include code for OSMutexPendAbort()                               */
+#define OS_CFG_MUTEX_CEIL_EN                       1u           /*     Include code for OSMutexCreateCeil(), priority ceiling mutexes    */
 
 
                                                                 /* -------------------------- MESSAGE QUEUES --------------------------  */
@@ -70,6 +81,13 @@
 #define OS_CFG_Q_PEND_ABORT_EN                     1u           /*     Include code for OSQPendAbort()                                   */
 
 
+                                                                /* ----------------------- READER-WRITER LOCKS ------------------------  */
+#define OS_CFG_RWLOCK_EN                           1u           /* Enable (1) or Disable (0) code generation for READER-WRITER LOCKS     */
+#define OS_CFG_RWLOCK_DEL_EN                       1u           /*     Include code for OSRwLockDel()                                    */
+#define OS_CFG_RWLOCK_PEND_ABORT_EN                1u           /*     Include code for OSRwLockPendAbort()                              */
+#define OS_CFG_RWLOCK_RD_MAX                       4u           /*     Maximum number of tasks reading a lock at once                    */
+
+
                                                                 /* ---------------------------- SEMAPHORES ----------------------------- */
 #define OS_CFG_SEM_EN                              1u           /* Enable (1) or Disable (0) code generation for SEMAPHORES              */
 #define OS_CFG_SEM_DEL_EN                          1u           /*     Include code for OSSemDel()                                       */
@@ -77,6 +95,10 @@
 #define OS_CFG_SEM_SET_EN                          1u           /*     Include code for OSSemSet()                                       */
 
 
+                                                                /* -------------------------- SEQUENCE LOCKS --------------------------- */
+#define OS_CFG_SEQLOCK_EN                          1u           /* Enable (1) or Disable (0) code generation for SEQUENCE LOCKS          */
+
+
                                                                 /* -------------------------- TASK MANAGEMENT -------------------------- */
 #define OS_CFG_STAT_TASK_EN                        1u           /* Enable (1) or Disable (0) the statistics task                         */
 #define OS_CFG_STAT_TASK_STK_CHK_EN                1u           /*     Check task stacks from the statistic task                         */
@@ -85,6 +107,7 @@
 #define OS_CFG_TASK_DEL_EN                         1u           /* Include code for OSTaskDel()                                          */
 #define OS_CFG_TASK_IDLE_EN                        1u           /* Include the idle task                                                 */
 #define OS_CFG_TASK_PROFILE_EN                     1u           /* Include variables in OS_TCB for profiling                             */
+#define OS_CFG_TASK_PROFILE_HIST_EN                1u           /* Include per-task run/response time histograms (OSTaskProfileGet())    */
 #define OS_CFG_TASK_Q_EN                           1u           /* Include code for OSTaskQXXXX()                                        */
 #define OS_CFG_TASK_Q_PEND_ABORT_EN                1u           /* Include code for OSTaskQPendAbort()                                   */
 #define OS_CFG_TASK_REG_TBL_SIZE                   1u           /* Number of task specific registers                                     */
@@ -103,6 +126,7 @@
                                                                 /* ------------------------- TIME MANAGEMENT --------------------------  */
 #define OS_CFG_TIME_DLY_HMSM_EN                    1u           /* Include code for OSTimeDlyHMSM()                                      */
 #define OS_CFG_TIME_DLY_RESUME_EN                  1u           /* Include code for OSTimeDlyResume()                                    */
+#define OS_CFG_TIME_PERIODIC_EN                    1u           /* Include code for OSTimePeriodicXXX(), periods & deadlines of tasks    */
 
 
                                                                 /* ------------------------- TIMER MANAGEMENT -------------------------- */
@@ -111,8 +135,14 @@
 
 
                                                                 /* ------------------------- TRACE RECORDER ---------------------------- */
+#ifndef OS_CFG_TRACE_EN                                         /* The trace environments override this (see platformio.ini)             */
 #define OS_CFG_TRACE_EN                            0u           /* Enable (1) or Disable (0) uC/OS-III Trace instrumentation             */
+#endif
+#ifndef OS_CFG_TRACE_API_ENTER_EN                               /* The trace environments override this (see platformio.ini)             */
 #define OS_CFG_TRACE_API_ENTER_EN                  0u           /* Enable (1) or Disable (0) uC/OS-III Trace API enter instrumentation   */
+#endif
+#ifndef OS_CFG_TRACE_API_EXIT_EN                                /* The trace environments override this (see platformio.ini)             */
 #define OS_CFG_TRACE_API_EXIT_EN                   0u           /* Enable (1) or Disable (0) uC/OS-III Trace API exit  instrumentation   */
+#endif
 
 #endif
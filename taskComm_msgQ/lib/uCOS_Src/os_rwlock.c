@@ -0,0 +1,1461 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                     READER-WRITER LOCK MANAGEMENT
+*
+* File    : os_rwlock.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_rwlock__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_RWLOCK_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                  LOCAL PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void             OS_RwLockPend         (OS_RWLOCK       *p_lock,
+                                                CPU_BOOLEAN      wr,
+                                                OS_TICK          timeout,
+                                                OS_OPT           opt,
+                                                CPU_TS          *p_ts,
+                                                OS_ERR          *p_err);
+
+static  CPU_BOOLEAN      OS_RwLockAvail        (OS_RWLOCK       *p_lock,
+                                                CPU_BOOLEAN      wr);
+
+static  OS_TCB          *OS_RwLockWrPendFind   (OS_RWLOCK       *p_lock);
+
+static  OS_RWLOCK_HOLD  *OS_RwLockHoldFind     (OS_RWLOCK       *p_lock,
+                                                OS_TCB          *p_tcb);
+
+static  void             OS_RwLockHoldAdd      (OS_RWLOCK       *p_lock,
+                                                OS_TCB          *p_tcb,
+                                                CPU_BOOLEAN      wr);
+
+static  void             OS_RwLockHoldRemove   (OS_RWLOCK_HOLD  *p_hold);
+
+#if (OS_CFG_RWLOCK_DEL_EN > 0u)
+static  void             OS_RwLockHoldRemoveAll(OS_RWLOCK       *p_lock);
+#endif
+
+static  void             OS_RwLockGrant        (OS_RWLOCK       *p_lock,
+                                                CPU_TS           ts);
+
+static  void             OS_RwLockPrioUpdate   (OS_RWLOCK       *p_lock);
+
+
+/*
+************************************************************************************************************************
+*                                            CREATE A READER-WRITER LOCK
+*
+* Description: This function creates a reader-writer lock, which lets up to OS_CFG_RWLOCK_RD_MAX tasks read the data it
+*              guards at once, or a single task write it (see 'os.h  READER-WRITER LOCKS').
+*
+* Arguments  : p_lock        is a pointer to the lock to initialize.  Your application is responsible for allocating
+*                            storage for the lock.
+*
+*              p_name        is a pointer to the name you would like to give the lock.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the lock after you called
+*                                                                 OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_CREATED             If the lock was already created
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSRwLockCreate (OS_RWLOCK  *p_lock,
+                      CPU_CHAR   *p_name,
+                      OS_ERR     *p_err)
+{
+    OS_OBJ_QTY  i;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_RWLOCK *)0) {                             /* Validate 'p_lock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+    if (p_lock->Type == OS_OBJ_TYPE_RWLOCK) {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+    p_lock->Type              =  OS_OBJ_TYPE_RWLOCK;            /* Mark the data structure as a reader-writer lock      */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_lock->NamePtr           =  p_name;
+#else
+    (void)p_name;
+#endif
+    for (i = 0u; i < OS_CFG_RWLOCK_RD_MAX; i++) {               /* No task holds the lock                               */
+        p_lock->HoldTbl[i].TCBPtr     = (OS_TCB         *)0;
+        p_lock->HoldTbl[i].LockPtr    =  p_lock;
+        p_lock->HoldTbl[i].GrpNextPtr = (OS_RWLOCK_HOLD *)0;
+        p_lock->HoldTbl[i].NestingCtr =                   0u;
+    }
+    p_lock->WrTCBPtr          = (OS_TCB *)0;
+    p_lock->RdCtr             =           0u;
+    p_lock->WrPendCtr         =           0u;
+#if (OS_CFG_TS_EN > 0u)
+    p_lock->TS                =           0u;
+#endif
+    OS_PendListInit(&p_lock->PendList);                         /* Initialize the waiting list                          */
+
+#if (OS_CFG_DBG_EN > 0u)
+    OS_RwLockDbgListAdd(p_lock);
+    OSRwLockQty++;
+#endif
+
+    OS_TRACE_RWLOCK_CREATE(p_lock, p_name);
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                            DELETE A READER-WRITER LOCK
+*
+* Description: This function deletes a reader-writer lock and readies all tasks pending on the lock.
+*
+* Arguments  : p_lock        is a pointer to the lock to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the lock ONLY if no task pending
+*                                OS_OPT_DEL_ALWAYS           Deletes the lock even if tasks are waiting.
+*                                                            In this case, all the tasks pending will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    The call was successful and the lock was deleted
+*                                OS_ERR_DEL_ISR                 If you attempted to delete the lock from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME    If you are trying to delete the lock after you called
+*                                                                 OSStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_lock' is not pointing to a reader-writer lock
+*                                OS_ERR_OPT_INVALID             An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
+*                                OS_ERR_TASK_WAITING            One or more tasks were waiting on the lock
+*
+* Returns    : == 0          if no tasks were waiting on the lock, or upon error.
+*              >  0          if one or more tasks waiting on the lock are now readied and informed.
+*
+* Note(s)    : 1) This function must be used with care.  Tasks that would normally expect the presence of the lock MUST
+*                 check the return code of OSRwLockRdPend() and OSRwLockWrPend().
+*
+*              2) The tasks holding the lock lose it, and get back the priority they had before inheriting one from the
+*                 tasks waiting on it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_RWLOCK_DEL_EN > 0u)
+OS_OBJ_QTY  OSRwLockDel (OS_RWLOCK  *p_lock,
+                         OS_OPT      opt,
+                         OS_ERR     *p_err)
+{
+    OS_OBJ_QTY     nbr_tasks;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+    OS_TRACE_RWLOCK_DEL_ENTER(p_lock, opt);
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+        OS_TRACE_RWLOCK_DEL_EXIT(OS_ERR_ILLEGAL_DEL_RUN_TIME);
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to delete a lock from an ISR             */
+        OS_TRACE_RWLOCK_DEL_EXIT(OS_ERR_DEL_ISR);
+       *p_err = OS_ERR_DEL_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+        OS_TRACE_RWLOCK_DEL_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_RWLOCK *)0) {                             /* Validate 'p_lock'                                    */
+        OS_TRACE_RWLOCK_DEL_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_lock->Type != OS_OBJ_TYPE_RWLOCK) {                   /* Make sure the lock was created                       */
+        OS_TRACE_RWLOCK_DEL_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_lock->PendList;
+    nbr_tasks   = 0u;
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:                                /* Delete the lock only if no task waiting              */
+             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+#if (OS_CFG_DBG_EN > 0u)
+                 OS_RwLockDbgListRemove(p_lock);
+                 OSRwLockQty--;
+#endif
+                 OS_TRACE_RWLOCK_DEL(p_lock);
+                 OS_RwLockHoldRemoveAll(p_lock);                /* Remove the lock from the holders' groups             */
+                 OS_RwLockClr(p_lock);
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_NONE;
+             } else {
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_WAITING;
+             }
+             break;
+
+        case OS_OPT_DEL_ALWAYS:                                 /* Always delete the lock                               */
+#if (OS_CFG_TS_EN > 0u)
+             ts = OS_TS_GET();                                  /* Get timestamp                                        */
+#else
+             ts = 0u;
+#endif
+             while (p_pend_list->HeadPtr != (OS_TCB *)0) {      /* Remove all tasks from the pend list                  */
+                 p_tcb = p_pend_list->HeadPtr;
+                 if (p_tcb->RwLockWr == OS_TRUE) {
+                     p_lock->WrPendCtr--;
+                 }
+                 OS_PendAbort(p_tcb,
+                              ts,
+                              OS_STATUS_PEND_DEL);
+                 nbr_tasks++;
+             }
+#if (OS_CFG_DBG_EN > 0u)
+             OS_RwLockDbgListRemove(p_lock);
+             OSRwLockQty--;
+#endif
+             OS_TRACE_RWLOCK_DEL(p_lock);
+             OS_RwLockHoldRemoveAll(p_lock);                    /* See Note #2                                          */
+             OS_RwLockClr(p_lock);
+             CPU_CRITICAL_EXIT();
+             OSSched();                                         /* Find highest priority task ready to run              */
+            *p_err = OS_ERR_NONE;
+             break;
+
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_OPT_INVALID;
+             break;
+    }
+    OS_TRACE_RWLOCK_DEL_EXIT(*p_err);
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                       PEND ON A READER-WRITER LOCK TO READ
+*                                       PEND ON A READER-WRITER LOCK TO WRITE
+*
+* Description: These functions wait for a reader-writer lock, to read or to write the data it guards.
+*
+* Arguments  : p_lock        is a pointer to the lock
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            lock up to the amount of time (in 'ticks') specified by this argument.  If you specify 0,
+*                            however, your task will wait forever at the specified lock or, until it becomes available.
+*
+*              opt           determines whether the user wants to block if the lock is available or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the lock was posted or
+*                            pend aborted or the lock deleted.  If you pass a NULL pointer (i.e. (CPU_TS *)0) then you
+*                            will not get the timestamp.  In other words, passing a NULL pointer is valid and indicates
+*                            that you don't need the timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task holds the lock
+*                                OS_ERR_OBJ_DEL            If 'p_lock' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_lock' is not pointing at a reader-writer lock
+*                                OS_ERR_OPT_INVALID        If you didn't specify a valid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the pend was aborted by another task
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the lock was not available
+*                                OS_ERR_RWLOCK_OVF         The nesting counter of the calling task overflowed
+*                                OS_ERR_RWLOCK_OWNER       If the calling task already holds the lock, see Note #2
+*                                OS_ERR_RWLOCK_UPGRADE     If the calling task reads the lock and pends to write it
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            The lock was not received within the specified timeout
+*                                OS_ERR_TICK_DISABLED      If kernel ticks are disabled and a timeout is specified
+*
+* Returns    : none
+*
+* Note(s)    : 1) A reader waits while a writer holds the lock, while OS_CFG_RWLOCK_RD_MAX readers hold it, and while a
+*                 writer waits for it (see 'os.h  READER-WRITER LOCKS  Note #3').
+*
+*              2) A task which holds the lock may pend on it again, to read or, if it writes it, to write; the pends
+*                 nest and the lock is released by the last matching OSRwLockPost().  A reader cannot upgrade to a
+*                 writer since two readers doing so would wait for each other.
+*
+*              3) These APIs 'MUST NOT' be called from a timer callback function.
+************************************************************************************************************************
+*/
+
+void  OSRwLockRdPend (OS_RWLOCK  *p_lock,
+                      OS_TICK     timeout,
+                      OS_OPT      opt,
+                      CPU_TS     *p_ts,
+                      OS_ERR     *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OS_TRACE_RWLOCK_RD_PEND_ENTER(p_lock, timeout, opt, p_ts);
+    OS_RwLockPend(p_lock,
+                  OS_FALSE,
+                  timeout,
+                  opt,
+                  p_ts,
+                  p_err);
+    OS_TRACE_RWLOCK_RD_PEND_EXIT(*p_err);
+}
+
+
+void  OSRwLockWrPend (OS_RWLOCK  *p_lock,
+                      OS_TICK     timeout,
+                      OS_OPT      opt,
+                      CPU_TS     *p_ts,
+                      OS_ERR     *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OS_TRACE_RWLOCK_WR_PEND_ENTER(p_lock, timeout, opt, p_ts);
+    OS_RwLockPend(p_lock,
+                  OS_TRUE,
+                  timeout,
+                  opt,
+                  p_ts,
+                  p_err);
+    OS_TRACE_RWLOCK_WR_PEND_EXIT(*p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                        ABORT WAITING ON A READER-WRITER LOCK
+*
+* Description: This function aborts & readies any tasks currently waiting on a reader-writer lock.  This function should
+*              be used to fault-abort the wait on the lock, rather than to normally signal the lock via OSRwLockPost().
+*
+* Arguments  : p_lock        is a pointer to the lock
+*
+*              opt           determines the type of ABORT performed:
+*
+*                                OS_OPT_PEND_ABORT_1          ABORT wait for a single task (HPT) waiting on the lock
+*                                OS_OPT_PEND_ABORT_ALL        ABORT wait for ALL tasks that are  waiting on the lock
+*                                OS_OPT_POST_NO_SCHED         Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               At least one task waiting on the lock was readied and
+*                                                          informed of the aborted wait; check return value for the
+*                                                          number of tasks whose wait on the lock was aborted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_lock' is not pointing at a reader-writer lock
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT_ISR     If you attempted to call this function from an ISR
+*                                OS_ERR_PEND_ABORT_NONE    No task were pending
+*
+* Returns    : == 0          if no tasks were waiting on the lock, or upon error.
+*              >  0          if one or more tasks waiting on the lock are now readied and informed.
+*
+* Note(s)    : 1) Aborting the wait of the writers may let the readers waiting behind them get the lock, and the holders
+*                 may lose the priority they inherited from the tasks aborted.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_RWLOCK_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY  OSRwLockPendAbort (OS_RWLOCK  *p_lock,
+                               OS_OPT      opt,
+                               OS_ERR     *p_err)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_TS         ts;
+    OS_OBJ_QTY     nbr_tasks;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_OBJ_QTY)0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to Pend Abort from an ISR                */
+       *p_err =  OS_ERR_PEND_ABORT_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_RWLOCK *)0) {                             /* Validate 'p_lock'                                    */
+       *p_err =  OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_ABORT_1:
+        case OS_OPT_PEND_ABORT_ALL:
+        case OS_OPT_PEND_ABORT_1   | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_PEND_ABORT_ALL | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_lock->Type != OS_OBJ_TYPE_RWLOCK) {                   /* Make sure the lock was created                       */
+       *p_err =  OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_pend_list = &p_lock->PendList;
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on the lock?                        */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err =  OS_ERR_PEND_ABORT_NONE;
+        return (0u);
+    }
+
+    nbr_tasks = 0u;
+#if (OS_CFG_TS_EN > 0u)
+    ts        = OS_TS_GET();                                    /* Get local time stamp so all tasks get the same time  */
+#else
+    ts        = 0u;
+#endif
+    while (p_pend_list->HeadPtr != (OS_TCB *)0) {
+        p_tcb = p_pend_list->HeadPtr;
+        if (p_tcb->RwLockWr == OS_TRUE) {
+            p_lock->WrPendCtr--;
+        }
+        OS_PendAbort(p_tcb,
+                     ts,
+                     OS_STATUS_PEND_ABORT);
+        nbr_tasks++;
+        if ((opt & OS_OPT_PEND_ABORT_ALL) == 0u) {              /* Pend abort all tasks waiting?                        */
+            break;                                              /* No                                                   */
+        }
+    }
+    OS_RwLockGrant(p_lock, ts);                                 /* See Note #1                                          */
+    OS_RwLockPrioUpdate(p_lock);
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (nbr_tasks);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            POST TO A READER-WRITER LOCK
+*
+* Description: This function releases a reader-writer lock, held to read or to write.
+*
+* Arguments  : p_lock        is a pointer to the lock
+*
+*              opt           is an option you can specify to alter the behavior of the post.  The choices are:
+*
+*                                OS_OPT_POST_NONE        No special option selected
+*                                OS_OPT_POST_NO_SCHED    If you don't want the scheduler to be called after the post.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and the lock was released
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_lock' is not pointing at a reader-writer lock
+*                                OS_ERR_OPT_INVALID        If you specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_POST_ISR           If you attempted to post from an ISR
+*                                OS_ERR_RWLOCK_NESTING     The calling task nested its use of the lock
+*                                OS_ERR_RWLOCK_NOT_OWNER   If the calling task does not hold the lock
+*
+* Returns    : none
+*
+* Note(s)    : 1) When the last reader or the writer releases the lock, the highest priority writer waiting gets it or,
+*                 if no writer waits, the highest priority readers waiting get it, up to OS_CFG_RWLOCK_RD_MAX.
+*
+*              2) The task gets back the priority it had before taking the lock, or the highest priority it still
+*                 inherits from the other locks and mutexes it holds.
+************************************************************************************************************************
+*/
+
+void  OSRwLockPost (OS_RWLOCK  *p_lock,
+                    OS_OPT      opt,
+                    OS_ERR     *p_err)
+{
+    OS_RWLOCK_HOLD  *p_hold;
+    CPU_TS           ts;
+    OS_PRIO          prio_new;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OS_TRACE_RWLOCK_POST_ENTER(p_lock, opt);
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        OS_TRACE_RWLOCK_POST_FAILED(p_lock);
+        OS_TRACE_RWLOCK_POST_EXIT(OS_ERR_POST_ISR);
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+        OS_TRACE_RWLOCK_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_RWLOCK *)0) {                             /* Validate 'p_lock'                                    */
+        OS_TRACE_RWLOCK_POST_FAILED(p_lock);
+        OS_TRACE_RWLOCK_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+             OS_TRACE_RWLOCK_POST_FAILED(p_lock);
+             OS_TRACE_RWLOCK_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_lock->Type != OS_OBJ_TYPE_RWLOCK) {                   /* Make sure the lock was created                       */
+        OS_TRACE_RWLOCK_POST_FAILED(p_lock);
+        OS_TRACE_RWLOCK_POST_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_hold = OS_RwLockHoldFind(p_lock, OSTCBCurPtr);
+    if (p_hold == (OS_RWLOCK_HOLD *)0) {                        /* Make sure a holder is releasing the lock             */
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_RWLOCK_POST_FAILED(p_lock);
+        OS_TRACE_RWLOCK_POST_EXIT(OS_ERR_RWLOCK_NOT_OWNER);
+       *p_err = OS_ERR_RWLOCK_NOT_OWNER;
+        return;
+    }
+
+    OS_TRACE_RWLOCK_POST(p_lock);
+
+#if (OS_CFG_TS_EN > 0u)
+    ts          = OS_TS_GET();                                  /* Get timestamp                                        */
+    p_lock->TS  = ts;
+#else
+    ts          = 0u;
+#endif
+    p_hold->NestingCtr--;                                       /* Decrement holder's nesting counter                   */
+    if (p_hold->NestingCtr > 0u) {                              /* Are we done with all nestings?                       */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+        OS_TRACE_RWLOCK_POST_EXIT(OS_ERR_RWLOCK_NESTING);
+       *p_err = OS_ERR_RWLOCK_NESTING;
+        return;
+    }
+
+    OS_RwLockHoldRemove(p_hold);                                /* Remove the lock from holder's group                  */
+
+    if (OSTCBCurPtr->Prio != OSTCBCurPtr->BasePrio) {           /* Has holder inherited a priority?  See Note #2        */
+        prio_new = OS_MutexGrpPrioFindHighest(OSTCBCurPtr);     /* Yes, find highest priority pending                   */
+        prio_new = (prio_new > OSTCBCurPtr->BasePrio) ? OSTCBCurPtr->BasePrio : prio_new;
+        if (prio_new > OSTCBCurPtr->Prio) {
+            OS_RdyListRemove(OSTCBCurPtr);
+            OSTCBCurPtr->Prio = prio_new;                       /* Lower holder's priority back to its original one     */
+            OS_TRACE_RWLOCK_TASK_PRIO_DISINHERIT(OSTCBCurPtr, prio_new);
+            OS_PrioInsert(prio_new);
+            OS_RdyListInsertTail(OSTCBCurPtr);                  /* Insert holder in ready list at new priority          */
+            OSPrioCur         = prio_new;
+        }
+    }
+
+    OS_RwLockGrant(p_lock, ts);                                 /* Give the lock to the tasks waiting, see Note #1      */
+    OS_RwLockPrioUpdate(p_lock);
+    CPU_CRITICAL_EXIT();
+
+    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+        OSSched();                                              /* Run the scheduler                                    */
+    }
+    OS_TRACE_RWLOCK_POST_EXIT(OS_ERR_NONE);
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                      CLEAR THE CONTENTS OF A READER-WRITER LOCK
+*
+* Description: This function is called by OSRwLockDel() to clear the contents of a reader-writer lock
+*
+
+* Argument(s): p_lock       is a pointer to the lock to clear
+*              ------
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_RwLockClr (OS_RWLOCK  *p_lock)
+{
+    OS_OBJ_QTY  i;
+
+
+#if (OS_OBJ_TYPE_REQ > 0u)
+    p_lock->Type              =  OS_OBJ_TYPE_NONE;              /* Mark the data structure as a NONE                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_lock->NamePtr           = (CPU_CHAR *)((void *)"?RWLOCK");
+#endif
+    for (i = 0u; i < OS_CFG_RWLOCK_RD_MAX; i++) {
+        p_lock->HoldTbl[i].TCBPtr     = (OS_TCB         *)0;
+        p_lock->HoldTbl[i].GrpNextPtr = (OS_RWLOCK_HOLD *)0;
+        p_lock->HoldTbl[i].NestingCtr =                   0u;
+    }
+    p_lock->WrTCBPtr          = (OS_TCB *)0;
+    p_lock->RdCtr             =           0u;
+    p_lock->WrPendCtr         =           0u;
+#if (OS_CFG_TS_EN > 0u)
+    p_lock->TS                =           0u;
+#endif
+    OS_PendListInit(&p_lock->PendList);                         /* Initialize the waiting list                          */
+}
+
+
+/*
+************************************************************************************************************************
+*                                   ADD/REMOVE READER-WRITER LOCK TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a reader-writer lock to/from the debug list.
+*
+* Arguments  : p_lock      is a pointer to the lock to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN > 0u)
+void  OS_RwLockDbgListAdd (OS_RWLOCK  *p_lock)
+{
+    p_lock->DbgNamePtr                 = (CPU_CHAR *)((void *)" ");
+    p_lock->DbgPrevPtr                 = (OS_RWLOCK *)0;
+    if (OSRwLockDbgListPtr == (OS_RWLOCK *)0) {
+        p_lock->DbgNextPtr             = (OS_RWLOCK *)0;
+    } else {
+        p_lock->DbgNextPtr             =  OSRwLockDbgListPtr;
+        OSRwLockDbgListPtr->DbgPrevPtr =  p_lock;
+    }
+    OSRwLockDbgListPtr                 =  p_lock;
+}
+
+
+void  OS_RwLockDbgListRemove (OS_RWLOCK  *p_lock)
+{
+    OS_RWLOCK  *p_lock_next;
+    OS_RWLOCK  *p_lock_prev;
+
+
+    p_lock_prev = p_lock->DbgPrevPtr;
+    p_lock_next = p_lock->DbgNextPtr;
+
+    if (p_lock_prev == (OS_RWLOCK *)0) {
+        OSRwLockDbgListPtr = p_lock_next;
+        if (p_lock_next != (OS_RWLOCK *)0) {
+            p_lock_next->DbgPrevPtr = (OS_RWLOCK *)0;
+        }
+        p_lock->DbgNextPtr = (OS_RWLOCK *)0;
+
+    } else if (p_lock_next == (OS_RWLOCK *)0) {
+        p_lock_prev->DbgNextPtr = (OS_RWLOCK *)0;
+        p_lock->DbgPrevPtr      = (OS_RWLOCK *)0;
+
+    } else {
+        p_lock_prev->DbgNextPtr =  p_lock_next;
+        p_lock_next->DbgPrevPtr =  p_lock_prev;
+        p_lock->DbgNextPtr      = (OS_RWLOCK *)0;
+        p_lock->DbgPrevPtr      = (OS_RWLOCK *)0;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                      READER-WRITER LOCK FIND HIGHEST PENDING
+*
+* Description: This function is called by OS_MutexGrpPrioFindHighest() to find the highest task pending on any
+*              reader-writer lock held by a task.
+*
+
+* Argument(s): p_tcb        is a pointer to the tcb of the task to process.
+*
+*
+* Returns    : Highest priority pending or OS_CFG_PRIO_MAX - 1u if none found.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+OS_PRIO  OS_RwLockGrpPrioFindHighest (OS_TCB  *p_tcb)
+{
+    OS_RWLOCK_HOLD  *p_hold;
+    OS_PRIO          highest_prio;
+    OS_TCB          *p_head;
+
+
+    highest_prio = (OS_PRIO)(OS_CFG_PRIO_MAX - 1u);
+    p_hold       = p_tcb->RwLockGrpHeadPtr;
+
+    while (p_hold != (OS_RWLOCK_HOLD *)0) {
+        p_head = p_hold->LockPtr->PendList.HeadPtr;
+        if ((p_head != (OS_TCB *)0) && (p_head->Prio < highest_prio)) {
+            highest_prio = p_head->Prio;
+        }
+        p_hold = p_hold->GrpNextPtr;
+    }
+
+    return (highest_prio);
+}
+
+
+/*
+************************************************************************************************************************
+*                                        READER-WRITER LOCK GROUP POST ALL
+*
+* Description: This function is called by the kernel to release all the reader-writer locks held by a task.  Used when
+*              deleting a task.
+*
+
+* Argument(s): p_tcb        is a pointer to the tcb of the task to process.
+*
+*
+* Returns    : none.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_RwLockGrpPostAll (OS_TCB  *p_tcb)
+{
+    OS_RWLOCK_HOLD  *p_hold;
+    OS_RWLOCK_HOLD  *p_hold_next;
+    OS_RWLOCK       *p_lock;
+    CPU_TS           ts;
+
+
+    p_hold = p_tcb->RwLockGrpHeadPtr;
+
+    while (p_hold != (OS_RWLOCK_HOLD *)0) {
+        p_hold_next = p_hold->GrpNextPtr;
+        p_lock      = p_hold->LockPtr;
+
+        OS_TRACE_RWLOCK_POST(p_lock);
+
+#if (OS_CFG_TS_EN > 0u)
+        ts          = OS_TS_GET();                              /* Get timestamp                                        */
+        p_lock->TS  = ts;
+#else
+        ts          = 0u;
+#endif
+        OS_RwLockHoldRemove(p_hold);                            /* Release the lock whatever the nesting                */
+        OS_RwLockGrant(p_lock, ts);
+        OS_RwLockPrioUpdate(p_lock);
+
+        p_hold = p_hold_next;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                     READER-WRITER LOCK PEND LIST CHANGED
+*
+* Description: This function is called by the kernel when a task waiting on a reader-writer lock leaves its pend list
+*              on a timeout or when it is deleted, or changes priority in it.
+*
+
+* Argument(s): p_lock       is a pointer to the lock.
+*
+*              p_tcb        is a pointer to the tcb of the task which left the pend list, or a NULL pointer if the task
+*                           changed priority in it.
+*
+* Returns    : none.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A writer leaving the list may let the readers waiting behind it get the lock, and the holders inherit
+*                 the priority of the highest priority task still waiting.  Changing the priority of the holders goes
+*                 through OS_TaskChangePrio(), which comes back here when a holder itself waits on another lock: the
+*                 recursion is as deep as the chain of tasks waiting on each other.
+************************************************************************************************************************
+*/
+
+void  OS_RwLockPendChg (OS_RWLOCK  *p_lock,
+                        OS_TCB     *p_tcb)
+{
+    CPU_TS  ts;
+
+
+    if ((p_tcb != (OS_TCB *)0) &&                               /* A writer left the list?                              */
+        (p_tcb->RwLockWr == OS_TRUE)) {
+        p_lock->WrPendCtr--;
+    }
+
+#if (OS_CFG_TS_EN > 0u)
+    ts = OS_TS_GET();
+#else
+    ts = 0u;
+#endif
+    OS_RwLockGrant(p_lock, ts);                                 /* See Note #2                                          */
+    OS_RwLockPrioUpdate(p_lock);
+}
+
+
+/*
+************************************************************************************************************************
+*                                      PEND ON A READER-WRITER LOCK (COMMON CODE)
+*
+* Description: This function waits for a reader-writer lock for OSRwLockRdPend() and OSRwLockWrPend().
+*
+* Arguments  : p_lock        is a pointer to the lock
+*
+*              wr            is OS_TRUE to write the data guarded by the lock, OS_FALSE to read it
+*
+*              timeout       is the timeout of the pend, see OSRwLockRdPend()
+*
+*              opt           OS_OPT_PEND_BLOCKING or OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp, or a NULL pointer
+*
+*              p_err         is a pointer to a variable that will contain an error code, see OSRwLockRdPend()
+*
+* Returns    : none
+*
+* Note(s)    : 1) The holders inherit the priority of the task once it waits on the lock, so it is inserted in the pend
+*                 list before their priority is updated.
+************************************************************************************************************************
+*/
+
+static  void  OS_RwLockPend (OS_RWLOCK    *p_lock,
+                             CPU_BOOLEAN   wr,
+                             OS_TICK       timeout,
+                             OS_OPT        opt,
+                             CPU_TS       *p_ts,
+                             OS_ERR       *p_err)
+{
+    OS_RWLOCK_HOLD  *p_hold;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_TS_EN == 0u)
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
+#endif
+
+#if (OS_CFG_TICK_EN == 0u)
+    if (timeout != 0u) {
+       *p_err = OS_ERR_TICK_DISABLED;
+        OS_TRACE_RWLOCK_PEND_FAILED(p_lock);
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        OS_TRACE_RWLOCK_PEND_FAILED(p_lock);
+       *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_RWLOCK *)0) {                             /* Validate arguments                                   */
+        OS_TRACE_RWLOCK_PEND_FAILED(p_lock);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+             OS_TRACE_RWLOCK_PEND_FAILED(p_lock);
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_lock->Type != OS_OBJ_TYPE_RWLOCK) {                   /* Make sure the lock was created                       */
+        OS_TRACE_RWLOCK_PEND_FAILED(p_lock);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_hold = OS_RwLockHoldFind(p_lock, OSTCBCurPtr);
+    if (p_hold != (OS_RWLOCK_HOLD *)0) {                        /* See if current task already holds the lock           */
+        if ((wr == OS_TRUE) && (p_lock->WrTCBPtr != OSTCBCurPtr)) {
+            CPU_CRITICAL_EXIT();                                /* A reader cannot become a writer                      */
+            OS_TRACE_RWLOCK_PEND_FAILED(p_lock);
+           *p_err = OS_ERR_RWLOCK_UPGRADE;
+            return;
+        }
+        if (p_hold->NestingCtr == (OS_NESTING_CTR)-1) {
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_RWLOCK_PEND_FAILED(p_lock);
+           *p_err = OS_ERR_RWLOCK_OVF;
+            return;
+        }
+        p_hold->NestingCtr++;
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = p_lock->TS;
+        }
+#endif
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_RWLOCK_PEND_FAILED(p_lock);
+       *p_err = OS_ERR_RWLOCK_OWNER;                            /* Indicate that current task already holds the lock    */
+        return;
+    }
+
+    if (OS_RwLockAvail(p_lock, wr) == OS_TRUE) {                /* Resource available?                                  */
+        OS_RwLockHoldAdd(p_lock, OSTCBCurPtr, wr);              /* Yes, caller may proceed                              */
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = p_lock->TS;
+        }
+#endif
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_RWLOCK_PEND(p_lock);
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+#if (OS_CFG_TS_EN > 0u)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = 0u;
+        }
+#endif
+        OS_TRACE_RWLOCK_PEND_FAILED(p_lock);
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return;
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+#if (OS_CFG_TS_EN > 0u)
+            if (p_ts != (CPU_TS *)0) {
+               *p_ts = 0u;
+            }
+#endif
+            OS_TRACE_RWLOCK_PEND_FAILED(p_lock);
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+    }
+
+    OSTCBCurPtr->RwLockWr = wr;
+    if (wr == OS_TRUE) {
+        p_lock->WrPendCtr++;
+    }
+    OS_Pend((OS_PEND_OBJ *)((void *)p_lock),                    /* Block task pending on the lock                       */
+             OSTCBCurPtr,
+             OS_TASK_PEND_ON_RWLOCK,
+             timeout);
+    OS_RwLockPrioUpdate(p_lock);                                /* See Note #1                                          */
+
+    CPU_CRITICAL_EXIT();
+    OS_TRACE_RWLOCK_PEND_BLOCK(p_lock);
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* We got the lock                                      */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_RWLOCK_PEND(p_lock);
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_RWLOCK_PEND_FAILED(p_lock);
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get the lock within timeout  */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = 0u;
+             }
+#endif
+             OS_TRACE_RWLOCK_PEND_FAILED(p_lock);
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+#if (OS_CFG_TS_EN > 0u)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_RWLOCK_PEND_FAILED(p_lock);
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             OS_TRACE_RWLOCK_PEND_FAILED(p_lock);
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+************************************************************************************************************************
+*                                         IS A READER-WRITER LOCK AVAILABLE?
+*
+* Description: This function tells whether a task may take a reader-writer lock at once.
+*
+* Arguments  : p_lock        is a pointer to the lock
+*
+*              wr            is OS_TRUE to write, OS_FALSE to read
+*
+* Returns    : OS_TRUE       if the task may take the lock
+*              OS_FALSE      if it must wait (see OSRwLockRdPend()  Note #1)
+*
+* Note(s)    : 1) No writer can be waiting when neither a writer nor a reader holds the lock: it would have been given it.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_RwLockAvail (OS_RWLOCK    *p_lock,
+                                     CPU_BOOLEAN   wr)
+{
+    if (p_lock->WrTCBPtr != (OS_TCB *)0) {                      /* A writer holds the lock                              */
+        return (OS_FALSE);
+    }
+    if (wr == OS_TRUE) {                                        /* See Note #1                                          */
+        return ((p_lock->RdCtr == 0u) ? OS_TRUE : OS_FALSE);
+    }
+    if ((p_lock->RdCtr >= OS_CFG_RWLOCK_RD_MAX) ||
+        (p_lock->WrPendCtr > 0u)) {                             /* Writer preference, see 'os.h  READER-WRITER LOCKS'   */
+        return (OS_FALSE);
+    }
+    return (OS_TRUE);
+}
+
+
+/*
+************************************************************************************************************************
+*                                         FIND THE HIGHEST PRIORITY WRITER WAITING
+*
+* Description: This function returns the first writer in the pend list of a reader-writer lock.
+*
+* Arguments  : p_lock        is a pointer to the lock
+*
+* Returns    : The TCB of the writer or a NULL pointer if only readers wait.
+*
+* Note(s)    : 1) 'WrPendCtr' tells whether a writer waits, this walk only finds which one when it gets the lock.
+************************************************************************************************************************
+*/
+
+static  OS_TCB  *OS_RwLockWrPendFind (OS_RWLOCK  *p_lock)
+{
+    OS_TCB  *p_tcb;
+
+
+    p_tcb = p_lock->PendList.HeadPtr;
+    while ((p_tcb != (OS_TCB *)0) && (p_tcb->RwLockWr == OS_FALSE)) {
+        p_tcb = p_tcb->PendNextPtr;
+    }
+    return (p_tcb);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          READER-WRITER LOCK HOLD FIND/ADD/REMOVE
+*
+* Description: These functions look up, give or release a reader-writer lock for a task, linking the entry of
+*              'HoldTbl[]' in the task's group (see 'os.h  READER-WRITER LOCKS  Note #2').
+*
+* Arguments  : p_lock        is a pointer to the lock
+*
+*              p_tcb         is a pointer to the tcb of the task
+*
+*              wr            is OS_TRUE if the task writes, OS_FALSE if it reads
+*
+*              p_hold        is a pointer to the entry of the task holding the lock
+*
+* Returns    : OS_RwLockHoldFind() returns the entry of the task or a NULL pointer if it does not hold the lock.
+*
+* Note(s)    : 1) A writer always takes the first entry.  A reader takes the first free one, and there is one since
+*                 fewer than OS_CFG_RWLOCK_RD_MAX readers hold the lock.
+************************************************************************************************************************
+*/
+
+static  OS_RWLOCK_HOLD  *OS_RwLockHoldFind (OS_RWLOCK  *p_lock,
+                                            OS_TCB     *p_tcb)
+{
+    OS_OBJ_QTY  i;
+
+
+    for (i = 0u; i < OS_CFG_RWLOCK_RD_MAX; i++) {
+        if (p_lock->HoldTbl[i].TCBPtr == p_tcb) {
+            return (&p_lock->HoldTbl[i]);
+        }
+    }
+    return ((OS_RWLOCK_HOLD *)0);
+}
+
+
+static  void  OS_RwLockHoldAdd (OS_RWLOCK    *p_lock,
+                                OS_TCB       *p_tcb,
+                                CPU_BOOLEAN   wr)
+{
+    OS_RWLOCK_HOLD  *p_hold;
+
+
+    p_hold = &p_lock->HoldTbl[0];                               /* See Note #1                                          */
+    if (wr == OS_TRUE) {
+        p_lock->WrTCBPtr = p_tcb;
+    } else {
+        while (p_hold->TCBPtr != (OS_TCB *)0) {
+            p_hold++;
+        }
+        p_lock->RdCtr++;
+    }
+    p_hold->TCBPtr          = p_tcb;
+    p_hold->NestingCtr      = 1u;
+    p_hold->GrpNextPtr      = p_tcb->RwLockGrpHeadPtr;          /* The group is not sorted, add to head of list         */
+    p_tcb->RwLockGrpHeadPtr = p_hold;
+}
+
+
+static  void  OS_RwLockHoldRemove (OS_RWLOCK_HOLD  *p_hold)
+{
+    OS_RWLOCK        *p_lock;
+    OS_RWLOCK_HOLD  **pp_hold;
+
+
+    p_lock  =  p_hold->LockPtr;
+    pp_hold = &p_hold->TCBPtr->RwLockGrpHeadPtr;
+    while (*pp_hold != p_hold) {
+        pp_hold = &(*pp_hold)->GrpNextPtr;
+    }
+   *pp_hold = p_hold->GrpNextPtr;
+
+    if (p_lock->WrTCBPtr == p_hold->TCBPtr) {
+        p_lock->WrTCBPtr = (OS_TCB *)0;
+    } else {
+        p_lock->RdCtr--;
+    }
+    p_hold->TCBPtr     = (OS_TCB         *)0;
+    p_hold->GrpNextPtr = (OS_RWLOCK_HOLD *)0;
+    p_hold->NestingCtr =                   0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                    RELEASE A READER-WRITER LOCK FROM ALL ITS HOLDERS
+*
+* Description: This function is called by OSRwLockDel() to take the lock back from the tasks holding it.
+*
+* Arguments  : p_lock        is a pointer to the lock
+*
+* Returns    : none
+*
+* Note(s)    : 1) The holders get back the priority they had before taking the lock, or the highest priority they still
+*                 inherit from the other locks and mutexes they hold.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_RWLOCK_DEL_EN > 0u)
+static  void  OS_RwLockHoldRemoveAll (OS_RWLOCK  *p_lock)
+{
+    OS_TCB      *p_tcb;
+    OS_PRIO      prio_new;
+    OS_OBJ_QTY   i;
+
+
+    for (i = 0u; i < OS_CFG_RWLOCK_RD_MAX; i++) {
+        p_tcb = p_lock->HoldTbl[i].TCBPtr;
+        if (p_tcb != (OS_TCB *)0) {
+            OS_RwLockHoldRemove(&p_lock->HoldTbl[i]);
+            if (p_tcb->Prio != p_tcb->BasePrio) {               /* Did we had to change the prio of holder?             */
+                prio_new = OS_MutexGrpPrioFindHighest(p_tcb);
+                prio_new = (prio_new > p_tcb->BasePrio) ? p_tcb->BasePrio : prio_new;
+                if (prio_new != p_tcb->Prio) {
+                    OS_TaskChangePrio(p_tcb, prio_new);
+                    OS_TRACE_RWLOCK_TASK_PRIO_DISINHERIT(p_tcb, p_tcb->Prio);
+                    if (p_tcb == OSTCBCurPtr) {
+                        OSPrioCur = prio_new;
+                    }
+                }
+            }
+        }
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                       GIVE A READER-WRITER LOCK TO THE TASKS WAITING
+*
+* Description: This function gives a reader-writer lock to the tasks waiting which may now take it.
+*
+* Arguments  : p_lock        is a pointer to the lock
+*
+*              ts            is the timestamp of the post
+*
+* Returns    : none
+*
+* Note(s)    : 1) See OSRwLockPost()  Note #1.  The readers wait in priority order behind the writers, so once no writer
+*                 waits every task of the list is a reader.
+************************************************************************************************************************
+*/
+
+static  void  OS_RwLockGrant (OS_RWLOCK  *p_lock,
+                              CPU_TS      ts)
+{
+    OS_TCB  *p_tcb;
+    OS_TCB  *p_tcb_next;
+
+
+    if (p_lock->WrTCBPtr != (OS_TCB *)0) {                      /* A writer still holds the lock                        */
+        return;
+    }
+
+    if (p_lock->WrPendCtr > 0u) {                               /* A writer waits: it gets the lock after the readers   */
+        if (p_lock->RdCtr == 0u) {
+            p_tcb = OS_RwLockWrPendFind(p_lock);
+            p_lock->WrPendCtr--;
+            OS_RwLockHoldAdd(p_lock, p_tcb, OS_TRUE);
+            OS_Post((OS_PEND_OBJ *)((void *)p_lock),
+                                   p_tcb,
+                                   (void *)0,
+                                   0u,
+                                   ts);
+        }
+        return;
+    }
+
+    p_tcb = p_lock->PendList.HeadPtr;                           /* See Note #1                                          */
+    while ((p_tcb != (OS_TCB *)0) && (p_lock->RdCtr < OS_CFG_RWLOCK_RD_MAX)) {
+        p_tcb_next = p_tcb->PendNextPtr;
+        OS_RwLockHoldAdd(p_lock, p_tcb, OS_FALSE);
+        OS_Post((OS_PEND_OBJ *)((void *)p_lock),
+                               p_tcb,
+                               (void *)0,
+                               0u,
+                               ts);
+        p_tcb = p_tcb_next;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                   UPDATE THE PRIORITY OF THE HOLDERS OF A READER-WRITER LOCK
+*
+* Description: This function gives the holders of a reader-writer lock the priority of the highest priority task
+*              waiting on it, or gives them back their own (see 'os.h  READER-WRITER LOCKS  Note #4').
+*
+* Arguments  : p_lock        is a pointer to the lock
+*
+* Returns    : none
+*
+* Note(s)    : 1) A holder keeps the highest priority it inherits from the other locks and mutexes it holds.
+************************************************************************************************************************
+*/
+
+static  void  OS_RwLockPrioUpdate (OS_RWLOCK  *p_lock)
+{
+    OS_TCB      *p_tcb;
+    OS_PRIO      prio_new;
+    OS_PRIO      prio_cur;
+    OS_OBJ_QTY   i;
+
+
+    for (i = 0u; i < OS_CFG_RWLOCK_RD_MAX; i++) {
+        p_tcb = p_lock->HoldTbl[i].TCBPtr;
+        if (p_tcb != (OS_TCB *)0) {
+            prio_new = OS_MutexGrpPrioFindHighest(p_tcb);       /* See Note #1                                          */
+            prio_new = (prio_new > p_tcb->BasePrio) ? p_tcb->BasePrio : prio_new;
+            if (prio_new != p_tcb->Prio) {
+                prio_cur = p_tcb->Prio;
+                OS_TaskChangePrio(p_tcb, prio_new);
+                if (prio_new < prio_cur) {
+                    OS_TRACE_RWLOCK_TASK_PRIO_INHERIT(p_tcb, prio_new);
+                } else {
+                    OS_TRACE_RWLOCK_TASK_PRIO_DISINHERIT(p_tcb, prio_new);
+                }
+                if (p_tcb == OSTCBCurPtr) {
+                    OSPrioCur = prio_new;
+                }
+            }
+        }
+    }
+}
+
+#endif /* OS_CFG_RWLOCK_EN */
@@ -65,6 +65,8 @@ int main(void)
 {
     OS_ERR err;
 
+    CPU_Init(); //Timestamp timer of OS_TS_GET(), before the kernel uses it
+
     OSInit(&err);
 
     OSQCreate((OS_Q *)&msgQ_A,
@@ -60,6 +60,34 @@ extern  "C" {
 
 CPU_INT32U  OS_KA_BASEPRI_Boundary;                             /* Base Priority boundary.                              */
 
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  CPU_INT32U  OS_CPU_DynTickCnts;                         /* SysTick cnts per tick, 0 until OS_CPU_SysTickInit()  */
+static  OS_TICK     OS_CPU_DynTickStep;                         /* Ticks until the programmed SysTick interrupt         */
+static  CPU_INT32U  OS_CPU_DynTickFrac;                         /* Cnts from the tick base to the SysTick reload        */
+static  OS_TICK     OS_CPU_DynTickElapsed;                      /* Ticks last returned by OS_DynTickGet()               */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        DYNAMIC TICK DEFINES
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_SYST_PERIOD_MAX                    0x01000000uL   /* Largest SysTick period (24-bit reload + 1)  */
+#define  OS_CPU_SYST_PERIOD_MIN                             2uL   /* A reload value of 0 stops the SysTick       */
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+static  CPU_INT32U  OS_CPU_DynTickCntsGet (void);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -565,6 +593,9 @@ void  OSTaskSwHook (void)
     if (OSTCBCurPtr != OSTCBHighRdyPtr) {
         OSTCBCurPtr->CyclesDelta  = ts - OSTCBCurPtr->CyclesStart;
         OSTCBCurPtr->CyclesTotal += (OS_CYCLES)OSTCBCurPtr->CyclesDelta;
+#if (OS_CFG_TASK_PROFILE_HIST_EN > 0u)
+        OS_TaskProfileSwOut(OSTCBCurPtr, ts);                   /* Run & response time histograms                       */
+#endif
     }
 
     OSTCBHighRdyPtr->CyclesStart = ts;
@@ -631,19 +662,39 @@ void  OSTimeTickHook (void)
 * Arguments  : None.
 *
 * Note(s)    : 1) This function MUST be placed on entry 15 of the Cortex-M vector table.
+*
+*              2) With the dynamic tick, each interrupt reports the ticks programmed by OS_DynTickSet().
+*                 Until OS_CPU_SysTickInit() is called, the SysTick is the periodic one started by
+*                 HAL_Init() & every interrupt is a single tick.
 *********************************************************************************************************
 */
 
 void  OS_CPU_SysTickHandler  (void)
 {
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OS_TICK  ticks;
+#endif
     CPU_SR_ALLOC();
 
 
     CPU_CRITICAL_ENTER();
     OSIntEnter();                                               /* Tell uC/OS-III that we are starting an ISR           */
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    if (OS_CPU_DynTickCnts == 0u) {                             /* Periodic SysTick set up by the BSP (see Note #2).    */
+        ticks                 = 1u;
+    } else {                                                    /* The reload is the new tick base                      */
+        ticks                 = OS_CPU_DynTickStep;
+        OS_CPU_DynTickFrac    = 0u;
+        OS_CPU_DynTickElapsed = 0u;
+    }
+#endif
     CPU_CRITICAL_EXIT();
 
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    OSTimeDynTick(ticks);                                       /* Call uC/OS-III's OSTimeDynTick()                     */
+#else
     OSTimeTick();                                               /* Call uC/OS-III's OSTimeTick()                        */
+#endif
 
     OSIntExit();                                                /* Tell uC/OS-III that we are leaving the ISR           */
 }
@@ -689,6 +740,9 @@ void  OS_CPU_SysTickInitFreq (CPU_INT32U  cpu_freq)
 * Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization.
 *
 *              2) Either OS_CPU_SysTickInitFreq or OS_CPU_SysTickInit() can be called.
+*
+*              3) With the dynamic tick, this function MUST be called for the SysTick to follow the
+*                 tick list (see 'OS_CPU_SysTickHandler()  Note #2').
 *********************************************************************************************************
 */
 
@@ -697,6 +751,9 @@ void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
 #if (OS_CFG_TICK_EN > 0u)
     CPU_INT32U  prio;
     CPU_INT32U  basepri;
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_SR_ALLOC();
+#endif
 
 
                                                                 /* Set BASEPRI boundary from the configuration.         */
@@ -715,11 +772,165 @@ void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
                           CPU_REG_SYST_CSR_ENABLE;
 
     CPU_REG_SYST_CSR   |= CPU_REG_SYST_CSR_TICKINT;             /* Enable timer interrupt.                              */
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    OS_CPU_DynTickCnts    = cnts;                               /* The tick base is the last reload                     */
+    OS_CPU_DynTickFrac    = 0u;
+    OS_CPU_DynTickElapsed = 0u;
+    (void)OS_DynTickSet(OSTickCtrStep);                         /* Program the next expiry of the tick list             */
+    CPU_CRITICAL_EXIT();
+#endif
 #else
     (void)cnts;
 #endif
 }
 
+
+/*
+*********************************************************************************************************
+*                                      GET ELAPSED DYNAMIC TICKS
+*
+* Description: Return the number of whole ticks elapsed since the tick base, i.e. since the last
+*              SysTick interrupt or since the kernel last accounted for elapsed ticks.
+*
+* Arguments  : None.
+*
+* Returns    : The number of elapsed ticks, at most the number programmed by OS_DynTickSet().
+*
+* Note(s)    : 1) This function is called by uC/OS-III with interrupts disabled.
+*
+*              2) A pending SysTick interrupt has not updated OSTickCtr yet, so its ticks are reported
+*                 here.  The kernel adds them to OSTickCtr & calls OS_DynTickSet(), which drops the
+*                 interrupt.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DYN_TICK_EN > 0u)
+OS_TICK  OS_DynTickGet (void)
+{
+    OS_TICK  elapsed;
+
+
+    if (OS_CPU_DynTickCnts == 0u) {                             /* SysTick not initialized yet                          */
+        return (0u);
+    }
+
+    elapsed = (OS_TICK)(OS_CPU_DynTickCntsGet() / OS_CPU_DynTickCnts);
+    if (elapsed > OS_CPU_DynTickStep) {                         /* See Note #2.                                         */
+        elapsed = OS_CPU_DynTickStep;
+    }
+    OS_CPU_DynTickElapsed = elapsed;
+
+    return (elapsed);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     SET NEXT DYNAMIC TICK EXPIRY
+*
+* Description: Reprogram the SysTick to interrupt 'ticks' ticks after the tick base.
+*
+* Arguments  : ticks        Number of ticks until the next expiry of the tick list, 0 when the tick list
+*                           is empty.
+*
+* Returns    : The number of ticks programmed, which the next SysTick interrupt reports.
+*
+* Note(s)    : 1) This function is called by uC/OS-III with interrupts disabled.
+*
+*              2) The kernel has added the ticks of the last OS_DynTickGet() to OSTickCtr, so the tick
+*                 base moves forward by as many ticks.  The rest of the elapsed time is kept in
+*                 OS_CPU_DynTickFrac & the period is shortened by it, so reprogramming does not make
+*                 the tick drift.
+*
+*              3) The 24-bit SysTick limits a period to OS_CPU_SYST_PERIOD_MAX counts, about 93 ticks at
+*                 1000 Hz & 180 MHz.  Longer (or no) delays wake the kernel once per period.
+*
+*              4) The counter is restarted from the new reload value, which loses the few cycles between
+*                 reading & writing it.
+*********************************************************************************************************
+*/
+
+OS_TICK  OS_DynTickSet (OS_TICK  ticks)
+{
+    CPU_INT32U  cnts;
+    CPU_INT32U  credit;
+    CPU_INT32U  period;
+    OS_TICK     ticks_max;
+
+
+    if (OS_CPU_DynTickCnts == 0u) {                             /* SysTick not initialized yet                          */
+        return (ticks);
+    }
+
+    cnts   = OS_CPU_DynTickCntsGet();
+    credit = OS_CPU_DynTickElapsed * OS_CPU_DynTickCnts;        /* See Note #2.                                         */
+    OS_CPU_DynTickElapsed = 0u;
+    OS_CPU_DynTickFrac    = (cnts > credit) ? (cnts - credit) : 0u;
+
+    ticks_max = (OS_TICK)(OS_CPU_SYST_PERIOD_MAX / OS_CPU_DynTickCnts);
+    if ((ticks == 0u) || (ticks > ticks_max)) {                 /* See Note #3.                                         */
+        ticks = ticks_max;
+    }
+
+    period = ticks * OS_CPU_DynTickCnts;
+    if (period > (OS_CPU_DynTickFrac + OS_CPU_SYST_PERIOD_MIN)) {
+        period -= OS_CPU_DynTickFrac;
+    } else {                                                    /* Already due                                          */
+        period  = OS_CPU_SYST_PERIOD_MIN;
+    }
+    OS_CPU_DynTickStep = ticks;
+
+    CPU_REG_SYST_RVR   = period - 1u;
+    CPU_REG_SYST_CVR   = 0u;                                    /* Reload on the next count (see Note #4).              */
+    CPU_REG_SCB_ICSR   = CPU_REG_SCB_ICSR_PENDSTCLR;            /* Drop the interrupt of the previous period            */
+
+    return (ticks);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    GET COUNTS SINCE THE TICK BASE
+*
+* Description: Return the number of SysTick counts elapsed since the tick base.
+*
+* Arguments  : None.
+*
+* Returns    : The number of counts.
+*
+* Note(s)    : 1) A pending SysTick interrupt means the counter reloaded once since the base.  The pending
+*                 bit is read on both sides of the counter so a reload in between is not counted twice.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  OS_CPU_DynTickCntsGet (void)
+{
+    CPU_INT32U  period;
+    CPU_INT32U  cvr;
+    CPU_INT32U  cnts;
+    CPU_INT32U  pend;
+
+
+    period = CPU_REG_SYST_RVR + 1u;
+    pend   = CPU_REG_SCB_ICSR & CPU_REG_SCB_ICSR_PENDSTSET;     /* See Note #1.                                         */
+    cvr    = CPU_REG_SYST_CVR;
+    if ((pend == 0u) &&
+        ((CPU_REG_SCB_ICSR & CPU_REG_SCB_ICSR_PENDSTSET) != 0u)) {
+        pend = CPU_REG_SCB_ICSR_PENDSTSET;
+        cvr  = CPU_REG_SYST_CVR;
+    }
+
+    cnts = OS_CPU_DynTickFrac + (period - cvr);
+    if (pend != 0u) {
+        cnts += period;
+    }
+
+    return (cnts);
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
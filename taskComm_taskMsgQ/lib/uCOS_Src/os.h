@@ -117,6 +117,20 @@ extern "C" {
 
 #define  OS_PRIO_TBL_SIZE          (((OS_CFG_PRIO_MAX - 1u) / ((CPU_CFG_DATA_SIZE * 8u))) + 1u)
 
+#define  OS_PRIO_TBL_2LVL          (((OS_CFG_PRIO_TBL_2LVL_EN > 0u) && (OS_PRIO_TBL_SIZE > 2u)) ? 1u : 0u)
+
+#define  OS_TICK_WHEEL_SLOT_BITS   6u                                                 /* 64 slots per timing wheel level */
+#define  OS_TICK_WHEEL_SLOTS       (1u << OS_TICK_WHEEL_SLOT_BITS)
+#define  OS_TICK_WHEEL_SLOT_MSK    (OS_TICK_WHEEL_SLOTS - 1u)
+#define  OS_TICK_WHEEL_LVLS        ((32u + OS_TICK_WHEEL_SLOT_BITS - 1u) / OS_TICK_WHEEL_SLOT_BITS)  /* Span all 32 bits  */
+
+#define  OS_TASK_PROFILE_HIST_SIZE  32u                                                /* One bucket per bit of a CPU_TS  */
+
+#define  OS_FLAG_BITS              (sizeof(OS_FLAGS) * 8u)                            /* Bits of an event flag group     */
+#define  OS_FLAG_SLOTS             (CPU_CFG_DATA_SIZE * 8u)                           /* Indexed waiters per flag group  */
+#define  OS_FLAG_SLOT_NONE         (CPU_INT08U)0xFFu                                  /* Task not waiting on a group     */
+#define  OS_FLAG_SLOT_FULL         (CPU_INT08U)0xFEu                                  /* Waiting, but no slot was free   */
+
 #define  OS_MSG_EN                 (((OS_CFG_TASK_Q_EN > 0u) || (OS_CFG_Q_EN > 0u)) ? 1u : 0u)
 
 #define  OS_OBJ_TYPE_REQ           (((OS_CFG_DBG_EN > 0u) || (OS_CFG_OBJ_TYPE_CHK_EN > 0u)) ? 1u : 0u)
@@ -171,6 +185,7 @@ extern "C" {
 #define  OS_TASK_PEND_ON_Q                    (OS_STATE)(  5u)  /* Pending on queue                                   */
 #define  OS_TASK_PEND_ON_SEM                  (OS_STATE)(  6u)  /* Pending on semaphore                               */
 #define  OS_TASK_PEND_ON_TASK_SEM             (OS_STATE)(  7u)  /* Pending on signal  to be sent to task              */
+#define  OS_TASK_PEND_ON_RWLOCK               (OS_STATE)(  8u)  /* Pending on reader-writer lock                      */
 
 /*
 ------------------------------------------------------------------------------------------------------------------------
@@ -200,7 +215,9 @@ extern "C" {
 #define  OS_OBJ_TYPE_MUTEX                   (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'U', 'T', 'X')
 #define  OS_OBJ_TYPE_COND                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('C', 'O', 'N', 'D')
 #define  OS_OBJ_TYPE_Q                       (OS_OBJ_TYPE)CPU_TYPE_CREATE('Q', 'U', 'E', 'U')
+#define  OS_OBJ_TYPE_RWLOCK                  (OS_OBJ_TYPE)CPU_TYPE_CREATE('R', 'W', 'L', 'K')
 #define  OS_OBJ_TYPE_SEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'E', 'M', 'A')
+#define  OS_OBJ_TYPE_SEQLOCK                 (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'E', 'Q', 'L')
 #define  OS_OBJ_TYPE_TMR                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'M', 'R', ' ')
 
 /*
@@ -273,6 +290,15 @@ extern "C" {
 
 #define  OS_OPT_POST_NO_SCHED                (OS_OPT)(0x8000u)  /* Do not call the scheduler if this is selected      */
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 SEQUENCE LOCK OPTIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_OPT_SEQLOCK_NONE                 (OS_OPT)(0x0000u)  /* Write the snapshot from scratch                    */
+#define  OS_OPT_SEQLOCK_COPY                 (OS_OPT)(0x0001u)  /* Start the write from a copy of the snapshot        */
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     TASK OPTIONS
@@ -428,6 +454,7 @@ typedef  enum  os_err {
     OS_ERR_MUTEX_OWNER               = 22402u,
     OS_ERR_MUTEX_NESTING             = 22403u,
     OS_ERR_MUTEX_OVF                 = 22404u,
+    OS_ERR_MUTEX_CEIL                = 22405u,
 
     OS_ERR_N                         = 23000u,
     OS_ERR_NAME                      = 23001u,
@@ -476,6 +503,12 @@ typedef  enum  os_err {
     OS_ERR_ROUND_ROBIN_1             = 27002u,
     OS_ERR_ROUND_ROBIN_DISABLED      = 27003u,
 
+    OS_ERR_RWLOCK_NOT_OWNER          = 27101u,
+    OS_ERR_RWLOCK_OWNER              = 27102u,
+    OS_ERR_RWLOCK_NESTING            = 27103u,
+    OS_ERR_RWLOCK_OVF                = 27104u,
+    OS_ERR_RWLOCK_UPGRADE            = 27105u,
+
     OS_ERR_S                         = 28000u,
     OS_ERR_SCHED_INVALID_TIME_SLICE  = 28001u,
     OS_ERR_SCHED_LOCK_ISR            = 28002u,
@@ -485,6 +518,8 @@ typedef  enum  os_err {
 
     OS_ERR_SEM_OVF                   = 28101u,
     OS_ERR_SET_ISR                   = 28102u,
+    OS_ERR_SEQLOCK_WR                = 28103u,
+    OS_ERR_SEQLOCK_NOT_WR            = 28104u,
 
     OS_ERR_STAT_RESET_ISR            = 28201u,
     OS_ERR_STAT_PRIO_INVALID         = 28202u,
@@ -547,6 +582,8 @@ typedef  enum  os_err {
     OS_ERR_TIME_NOT_DLY              = 29308u,
     OS_ERR_TIME_SET_ISR              = 29309u,
     OS_ERR_TIME_ZERO_DLY             = 29310u,
+    OS_ERR_TIME_DEADLINE_INVALID     = 29311u,
+    OS_ERR_TIME_NOT_PERIODIC         = 29312u,
 
     OS_ERR_TIMEOUT                   = 29401u,
 
@@ -602,12 +639,25 @@ typedef  struct  os_cond             OS_COND;
 
 typedef  struct  os_q                OS_Q;
 
+typedef  struct  os_rwlock           OS_RWLOCK;
+typedef  struct  os_rwlock_hold      OS_RWLOCK_HOLD;
+
 typedef  struct  os_sem              OS_SEM;
 
+typedef  struct  os_seqlock          OS_SEQLOCK;
+
 typedef  void                      (*OS_TASK_PTR)(void *p_arg);
 
 typedef  struct  os_tcb              OS_TCB;
 
+#if (OS_CFG_TASK_PROFILE_HIST_EN > 0u)
+typedef  struct  os_task_profile     OS_TASK_PROFILE;
+#endif
+
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+typedef  struct  os_periodic_stat    OS_PERIODIC_STAT;
+#endif
+
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
 typedef  void                       *OS_TLS;
 
@@ -624,6 +674,7 @@ typedef  struct  os_tick_list        OS_TICK_LIST;
 
 typedef  void                      (*OS_TMR_CALLBACK_PTR)(void *p_tmr, void *p_arg);
 typedef  struct  os_tmr              OS_TMR;
+typedef  struct  os_tmr_task         OS_TMR_TASK;
 
 typedef  struct  os_pend_list        OS_PEND_LIST;
 typedef  struct  os_pend_obj         OS_PEND_OBJ;
@@ -660,6 +711,15 @@ struct  os_rdy_list {
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                      PEND LIST
+*
+* Note(s) : (1) The tasks waiting on an object are linked from 'HeadPtr' to 'TailPtr' by priority, highest first, and
+*               in FIFO order within a priority.
+*
+*           (2) With OS_CFG_PEND_LIST_BITMAP_EN, 'PrioTbl' has the bit of each priority waiting set, laid out as the
+*               ready bitmap (see OS_PrioGetHighest()), and 'PrioTailPtr[prio]' points to the last task waiting at
+*               'prio' while its bit is set.  A task is inserted after the last task of its priority or, if none, of
+*               the next priority up found in the bitmap, in a fixed number of steps whatever the number of tasks
+*               waiting instead of walking the list.  This takes OS_CFG_PRIO_MAX pointers per kernel object.
 ------------------------------------------------------------------------------------------------------------------------
 */
 
@@ -669,6 +729,13 @@ struct  os_pend_list {
 #if (OS_CFG_DBG_EN > 0u)
     OS_OBJ_QTY           NbrEntries;
 #endif
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+#if (OS_PRIO_TBL_2LVL > 0u)
+    CPU_DATA             PrioTblGrp;                        /* Words of 'PrioTbl' which are non-zero                  */
+#endif
+    CPU_DATA             PrioTbl[OS_PRIO_TBL_SIZE];         /* Priorities waiting, see Note #2                        */
+    OS_TCB              *PrioTailPtr[OS_CFG_PRIO_MAX];      /* Last task waiting at each priority                     */
+#endif
 };
 
 
@@ -707,7 +774,16 @@ struct  os_pend_obj {
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     EVENT FLAGS
 *
-* Note(s) : See  PEND OBJ  Note #1'.
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) With OS_CFG_FLAG_INDEX_EN, each task waiting on the group takes one of OS_FLAG_SLOTS slots, and bit 's'
+*               of 'SlotTbl[b]' is set when the task in slot 's' waits on bit 'b'.  A post only checks the tasks of
+*               the slots found in 'SlotTbl[]' for the bits it changed, along with the bits consumed by OSFlagPend()
+*               since the previous post ('FlagsChg'), instead of every task in the pend list.  The tasks which found
+*               no free slot ('SlotFullCtr') make the posts check every task, as without the index.  A task leaving
+*               the group only frees its slot in 'SlotUsed', which masks 'SlotTbl[]'; the next task given the slot
+*               updates the bits which differ from the flags of the previous one ('SlotFlags[]').  This keeps the
+*               work per task readied constant in the post, and takes OS_FLAG_BITS + 2 * OS_FLAG_SLOTS words per group.
 ------------------------------------------------------------------------------------------------------------------------
 */
 
@@ -731,6 +807,14 @@ struct  os_flag_grp {                                       /* Event Flag Group
 #if (OS_CFG_TS_EN > 0u)
     CPU_TS               TS;                                /* Timestamp of when last post occurred                   */
 #endif
+#if (OS_CFG_FLAG_INDEX_EN > 0u)                             /* See Note #2                                            */
+    OS_FLAGS             FlagsChg;                          /* Flags consumed since the last post                     */
+    CPU_DATA             SlotUsed;                          /* Slots of the tasks waiting                             */
+    OS_OBJ_QTY           SlotFullCtr;                       /* Tasks waiting without a slot                           */
+    CPU_DATA             SlotTbl[OS_FLAG_BITS];             /* Slots of the tasks waiting on each bit                 */
+    OS_TCB              *SlotTCBPtr[OS_FLAG_SLOTS];         /* Task in each slot                                      */
+    OS_FLAGS             SlotFlags[OS_FLAG_SLOTS];          /* Flags recorded in 'SlotTbl[]' for each slot            */
+#endif
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
     CPU_INT16U           FlagID;                            /* Unique ID for third-party debuggers and tracers.       */
 #endif
@@ -813,7 +897,12 @@ struct  os_msg_q {                                          /* OS_MSG_Q
 ------------------------------------------------------------------------------------------------------------------------
 *                                              MUTUAL EXCLUSION SEMAPHORES
 *
-* Note(s) : See  PEND OBJ  Note #1'.
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) A mutex created by OSMutexCreateCeil() follows the immediate priority ceiling protocol instead of priority
+*               inheritance: its owner runs at 'CeilPrio' from the moment it gets the mutex, so no task which may also
+*               take it can preempt the owner.  A task blocks at most once, before it runs, and the owner's priority
+*               never changes because of a task pending.  'CeilPrio' is OS_PRIO_INIT for the other mutexes.
 ------------------------------------------------------------------------------------------------------------------------
 */
 
@@ -838,6 +927,9 @@ struct  os_mutex {                                          /* Mutual Exclusion
 #if (OS_CFG_TS_EN > 0u)
     CPU_TS               TS;
 #endif
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+    OS_PRIO              CeilPrio;                          /* Priority of the owner, see Note #2                     */
+#endif
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
     CPU_INT16U           MutexID;                           /* Unique ID for third-party debuggers and tracers.       */
 #endif
@@ -898,6 +990,65 @@ struct  os_q {                                              /* Message Queue
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  READER-WRITER LOCKS
+*
+* Note(s) : (1) See  PEND OBJ  Note #1'.
+*
+*           (2) A reader-writer lock is held by one writer or by up to OS_CFG_RWLOCK_RD_MAX readers at once, each in an
+*               entry of 'HoldTbl[]'.  The entries of the locks a task holds are linked from its 'RwLockGrpHeadPtr', as
+*               the mutexes of its 'MutexGrpHeadPtr', so that its priority can be restored and the locks released when
+*               it is deleted.
+*
+*           (3) Readers and writers wait in the same pend list, in priority order ('RwLockWr' tells them apart).  A reader
+*               does not get the lock while a writer waits (writer preference), so a stream of readers cannot starve
+*               the writers; the highest priority writer waiting gets the lock when the last holder releases it.
+*               'WrPendCtr' counts the writers waiting, so that a reader checks for them without walking the list.
+*
+*           (4) The holders inherit the priority of the highest priority task waiting: a writer, or a reader kept out by
+*               a writer which itself waits for the holders.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_RWLOCK_EN > 0u)
+struct  os_rwlock_hold {                                    /* Task holding a reader-writer lock                      */
+    OS_TCB              *TCBPtr;                            /* Holder, NULL when the entry is free                    */
+    OS_RWLOCK           *LockPtr;                           /* Lock held                                              */
+    OS_RWLOCK_HOLD      *GrpNextPtr;                        /* Next lock held by the same task                        */
+    OS_NESTING_CTR       NestingCtr;
+};
+
+
+struct  os_rwlock {                                         /* Reader-Writer Lock                                     */
+                                                            /* ------------------ GENERIC  MEMBERS ------------------ */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_RWLOCK                    */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Lock Name (NUL terminated ASCII)            */
+#endif
+    OS_PEND_LIST         PendList;                          /* List of tasks waiting on the lock                      */
+#if (OS_CFG_DBG_EN > 0u)
+    OS_RWLOCK           *DbgPrevPtr;
+    OS_RWLOCK           *DbgNextPtr;
+    CPU_CHAR            *DbgNamePtr;
+#endif
+                                                            /* ------------------ SPECIFIC MEMBERS ------------------ */
+    OS_RWLOCK_HOLD       HoldTbl[OS_CFG_RWLOCK_RD_MAX];     /* Tasks holding the lock, see Note #2                    */
+    OS_TCB              *WrTCBPtr;                          /* Writer holding the lock, NULL if none                  */
+    OS_OBJ_QTY           RdCtr;                             /* Number of readers holding the lock                     */
+    OS_OBJ_QTY           WrPendCtr;                         /* Number of writers waiting, see Note #3                 */
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               TS;
+#endif
+#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN > 0u))
+    CPU_INT16U           RwLockID;                          /* Unique ID for third-party debuggers and tracers.       */
+#endif
+};
+#endif
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                      SEMAPHORES
@@ -931,6 +1082,95 @@ struct  os_sem {                                            /* Semaphore
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    SEQUENCE LOCKS
+*
+* Note(s) : (1) A sequence lock publishes a snapshot of shared data in one of two buffers: 'Seq' is incremented when a
+*               write starts (odd) and when it ends (even), and the snapshot published is in 'BufPtr[(Seq >> 1) & 1]'.
+*               The writer fills the other buffer, so the snapshot published is never written while a write is in
+*               progress.
+*
+*           (2) A reader never blocks nor takes a lock: it reads the buffer published at the start of its read and
+*               restarts only if a later write reused that buffer meanwhile, i.e. if 'Seq' advanced by 3 or more.  A
+*               reader preempted by no more than one write does not restart, and a reader of a higher priority than
+*               the writer never does.
+*
+*           (3) There is one writer at a time: the writers serialize among themselves (one task, or a mutex).
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_seqlock {                                        /* Sequence lock                                          */
+#if (OS_OBJ_TYPE_REQ > 0u)
+    OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_SEQLOCK                   */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    CPU_CHAR            *NamePtr;                           /* Pointer to Sequence Lock Name (NUL terminated ASCII)   */
+#endif
+    void                *BufPtr[2];                         /* Snapshot buffers, see Note #1                          */
+    OS_MEM_SIZE          BufSize;                           /* Size (in bytes) of a snapshot                          */
+    OS_SEQ               Seq;                               /* Odd while a write is in progress                       */
+    OS_SEQ               RdRetryCtr;                        /* Reads restarted, see Note #2                           */
+};
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 TASK PROFILE HISTOGRAMS
+*
+* Note(s) : (1) An activation of a task starts when the task is made ready and ends when it blocks (pends, delays or is
+*               suspended).  'RunHist' counts the CPU time used by the task during its activations, 'RespHist' the time
+*               from the start to the end of the activations (the response time).
+*
+*           (2) Bucket 'i' counts the activations which took from 2^i to 2^(i+1) - 1 timestamp counts (see OS_TS_GET()
+*               and CPU_TS_TmrFreqGet()), bucket 0 also counts those which took 0.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_TASK_PROFILE_HIST_EN > 0u)
+struct os_task_profile {
+    CPU_INT32U           ActCtr;                            /* Number of activations completed                        */
+    CPU_TS               RunMax;                            /* Longest CPU time of an activation                      */
+    CPU_TS               RespMax;                           /* Longest response time                                  */
+    CPU_INT32U           RunHist[OS_TASK_PROFILE_HIST_SIZE];    /* CPU time of the activations, see Note #2           */
+    CPU_INT32U           RespHist[OS_TASK_PROFILE_HIST_SIZE];   /* Response time of the activations, see Note #2      */
+};
+#endif
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                     PERIODIC TASKS
+*
+* Note(s) : (1) A periodic task (see OSTimePeriodicSet()) is released every 'Period' ticks, each release 'Period' ticks
+*               after the previous one whatever the time its jobs take, so the releases do not drift.  A job runs from
+*               its release until the task calls OSTimePeriodicWait() and should end within 'Deadline' ticks of it.
+*
+*           (2) The jitter of a release is the time from its tick to the task running, the response time of a job the
+*               time from the tick of its release to its end.  A job ending after its deadline counts in 'MissCtr'.
+*               A job ending after the next releases skips them, they count in 'SkipCtr' and the task is released at
+*               the first one to come.
+*
+*           (3) The times are in timestamp counts, CPU_TS_TmrFreqGet() per second.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+struct os_periodic_stat {
+    OS_TICK              Period;                            /* Ticks between releases, 0 if the task is not periodic  */
+    OS_TICK              Deadline;                          /* Ticks from a release to the end of its job             */
+    CPU_INT32U           ReleaseCtr;                        /* Jobs released                                          */
+    CPU_INT32U           DoneCtr;                           /* Jobs ended                                             */
+    CPU_INT32U           MissCtr;                           /* Jobs ended after their deadline                        */
+    CPU_INT32U           SkipCtr;                           /* Releases skipped, see Note #2                          */
+    CPU_TS               JitterMax;                         /* Largest release jitter                                 */
+    CPU_INT64U           JitterTotal;                       /* Release jitter of all the releases                     */
+    CPU_TS               RespMax;                           /* Longest response time                                  */
+    CPU_INT64U           RespTotal;                         /* Response time of all the jobs ended                    */
+};
+#endif
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                  TASK CONTROL BLOCK
@@ -954,6 +1194,9 @@ struct os_tcb {
 #if (OS_CFG_TICK_EN > 0u)
     OS_TCB              *TickNextPtr;
     OS_TCB              *TickPrevPtr;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OS_TCB             **TickSlotPtr;                       /* Pointer to the timing wheel slot holding the TCB       */
+#endif
 #endif
 
 #if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) || (OS_CFG_TASK_STK_REDZONE_EN > 0u))
@@ -972,6 +1215,9 @@ struct os_tcb {
     OS_TCB              *PendNextPtr;                       /* Pointer to next     TCB in pend list.                  */
     OS_TCB              *PendPrevPtr;                       /* Pointer to previous TCB in pend list.                  */
     OS_PEND_OBJ         *PendObjPtr;                        /* Pointer to object pended on.                           */
+#if (OS_CFG_PEND_LIST_BITMAP_EN > 0u)
+    OS_PRIO              PendPrio;                          /* Priority of the task in the pend list                  */
+#endif
     OS_STATE             PendOn;                            /* Indicates what task is pending on                      */
     OS_STATUS            PendStatus;                        /* Pend status                                            */
 
@@ -981,6 +1227,10 @@ struct os_tcb {
     OS_PRIO              BasePrio;                          /* Base priority (Not inherited)                          */
     OS_MUTEX            *MutexGrpHeadPtr;                   /* Owned mutex group head pointer                         */
 #endif
+#if (OS_CFG_RWLOCK_EN > 0u)
+    OS_RWLOCK_HOLD      *RwLockGrpHeadPtr;                  /* Held reader-writer lock group head pointer             */
+    CPU_BOOLEAN          RwLockWr;                          /* Waiting to write the lock pended on                    */
+#endif
 
 #if ((OS_CFG_DBG_EN > 0u) || (OS_CFG_STAT_TASK_STK_CHK_EN > 0u) || (OS_CFG_TASK_STK_REDZONE_EN > 0u))
     CPU_STK_SIZE         StkSize;                           /* Size of task stack (in number of stack elements)       */
@@ -999,6 +1249,14 @@ struct os_tcb {
 #if (OS_CFG_TICK_EN > 0u)
     OS_TICK              TickRemain;                        /* Number of ticks remaining                              */
     OS_TICK              TickCtrPrev;                       /* Used by OSTimeDlyXX() in PERIODIC mode                 */
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+    OS_TICK              TickMatch;                         /* Value of OSTickCtr at which the delay expires          */
+#endif
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+    CPU_TS               PeriodicTickTs;                    /* Timestamp counts per tick                              */
+    CPU_TS               PeriodicReleaseTs;                 /* OS_TS_GET() at the tick of the current release         */
+    OS_PERIODIC_STAT     Periodic;                          /* Period, deadline & jobs of a periodic task             */
+#endif
 #endif
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN > 0u)
@@ -1027,6 +1285,9 @@ struct os_tcb {
     OS_FLAGS             FlagsPend;                         /* Event flag(s) to wait on                               */
     OS_FLAGS             FlagsRdy;                          /* Event flags that made task ready to run                */
     OS_OPT               FlagsOpt;                          /* Options (See OS_OPT_FLAG_xxx)                          */
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+    CPU_INT08U           FlagsSlot;                         /* Slot in the index of the group, see 'EVENT FLAGS'      */
+#endif
 #endif
 
 #if (OS_CFG_TASK_SUSPEND_EN > 0u)
@@ -1046,6 +1307,13 @@ struct os_tcb {
     CPU_TS               SemPendTimeMax;                    /* Max amount of time it took for signal to be received   */
 #endif
 
+#if (OS_CFG_TASK_PROFILE_HIST_EN > 0u)
+    CPU_BOOLEAN          ProfileAct;                        /* Task made ready and not blocked since                  */
+    CPU_TS               ProfileActStart;                   /* OS_TS_GET() when the task was made ready               */
+    CPU_TS               ProfileActCycles;                  /* CPU time used in the current activation                */
+    OS_TASK_PROFILE      Profile;                           /* Histograms of the activations                          */
+#endif
+
 #if (OS_CFG_STAT_TASK_STK_CHK_EN > 0u)
     CPU_STK_SIZE         StkUsed;                           /* Number of stack elements used from the stack           */
     CPU_STK_SIZE         StkFree;                           /* Number of stack elements free on   the stack           */
@@ -1099,9 +1367,12 @@ struct  os_tmr {
 #endif
     OS_TMR_CALLBACK_PTR  CallbackPtr;                       /* Function to call when timer expires                    */
     void                *CallbackPtrArg;                    /* Argument to pass to function when timer expires        */
-    OS_TMR              *NextPtr;                           /* Double link list pointers                              */
-    OS_TMR              *PrevPtr;
-    OS_TICK              Remain;                            /* Amount of time remaining before timer expires          */
+    OS_TMR_TASK         *TaskPtr;                           /* Timer task servicing this timer                        */
+    OS_TMR              *HeapParentPtr;                     /* Links in the heap of the timer task                    */
+    OS_TMR              *HeapLeftPtr;
+    OS_TMR              *HeapRightPtr;
+    OS_TICK              Match;                             /* Tick at which the timer expires                        */
+    OS_TICK              Remain;                            /* Delay the timer is linked with                         */
     OS_TICK              Dly;                               /* Delay before start of repeat                           */
     OS_TICK              Period;                            /* Period to repeat timer                                 */
     OS_OPT               Opt;                               /* Options (see OS_OPT_TMR_xxx)                           */
@@ -1113,6 +1384,20 @@ struct  os_tmr {
 };
 
 
+struct  os_tmr_task {
+    OS_TCB              *TCBPtr;                            /* TCB of the timer task                                  */
+    OS_MUTEX             Mutex;                             /* Protects the timers bound to this timer task           */
+    OS_COND              Cond;                              /* Signaled when the earliest timer changes               */
+    OS_TMR              *HeapRootPtr;                       /* Binary min-heap of the running timers, by 'Match'      */
+    OS_OBJ_QTY           HeapQty;                           /* Number of running timers                               */
+    OS_TICK              TickBase;                          /* Tick to which timer delays of callbacks are relative   */
+#if (OS_CFG_TS_EN > 0u)
+    CPU_TS               Time;                              /* Time taken by the last pass over the expired timers    */
+    CPU_TS               TimeMax;
+#endif
+};
+
+
 /*
 ************************************************************************************************************************
 ************************************************************************************************************************
@@ -1192,6 +1477,9 @@ OS_EXT            OS_OBJ_QTY                OSMutexQty;                 /* Numbe
 OS_EXT            OS_PRIO                   OSPrioCur;                  /* Priority of current task                   */
 OS_EXT            OS_PRIO                   OSPrioHighRdy;              /* Priority of highest priority task          */
 OS_EXT            CPU_DATA                  OSPrioTbl[OS_PRIO_TBL_SIZE];
+#if (OS_PRIO_TBL_2LVL > 0u)
+OS_EXT            CPU_DATA                  OSPrioTblGrp;               /* One bit per non-empty OSPrioTbl[] entry    */
+#endif
 
                                                                         /* QUEUES ----------------------------------- */
 #if (OS_CFG_Q_EN > 0u)
@@ -1201,6 +1489,14 @@ OS_EXT            OS_OBJ_QTY                OSQQty;                     /* Numbe
 #endif
 #endif
 
+                                                                        /* READER-WRITER LOCKS ---------------------- */
+#if (OS_CFG_RWLOCK_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+OS_EXT            OS_RWLOCK                *OSRwLockDbgListPtr;
+OS_EXT            OS_OBJ_QTY                OSRwLockQty;                /* Number of reader-writer locks created      */
+#endif
+#endif
+
 
 
                                                                         /* READY LIST ------------------------------- */
@@ -1267,10 +1563,16 @@ OS_EXT            OS_TICK                   OSTickCtr;                  /* Cnts
 OS_EXT            OS_TICK                   OSTickCtrStep;              /* Number of ticks to the next tick task call.*/
 #endif
 OS_EXT            OS_TICK_LIST              OSTickList;
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+OS_EXT            OS_TCB                   *OSTickWheel[OS_TICK_WHEEL_LVLS][OS_TICK_WHEEL_SLOTS];    /* Timing wheel       */
+#endif
 #if (OS_CFG_TS_EN > 0u)
 OS_EXT            CPU_TS                    OSTickTime;
 OS_EXT            CPU_TS                    OSTickTimeMax;
 #endif
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+OS_EXT            CPU_TS                    OSTickTS;                   /* OS_TS_GET() at the last tick               */
+#endif
 #endif
 
 
@@ -1278,21 +1580,13 @@ OS_EXT            CPU_TS                    OSTickTimeMax;
 #if (OS_CFG_TMR_EN > 0u)                                                /* TIMERS ----------------------------------- */
 #if (OS_CFG_DBG_EN > 0u)
 OS_EXT            OS_TMR                   *OSTmrDbgListPtr;
-OS_EXT            OS_OBJ_QTY                OSTmrListEntries;           /* Doubly-linked list of timers               */
 #endif
-OS_EXT            OS_TMR                   *OSTmrListPtr;
-OS_EXT            OS_COND                   OSTmrCond;
-OS_EXT            OS_MUTEX                  OSTmrMutex;
 
 #if (OS_CFG_DBG_EN > 0u)
 OS_EXT            OS_OBJ_QTY                OSTmrQty;                   /* Number of timers created                   */
 #endif
 OS_EXT            OS_TCB                    OSTmrTaskTCB;               /* TCB of timer task                          */
-#if (OS_CFG_TS_EN > 0u)
-OS_EXT            CPU_TS                    OSTmrTaskTime;
-OS_EXT            CPU_TS                    OSTmrTaskTimeMax;
-#endif
-OS_EXT            OS_TICK                   OSTmrTaskTickBase;          /* Tick to which timer delays are relative    */
+OS_EXT            OS_TMR_TASK               OSTmrTaskDflt;              /* Timer task created by OSInit()             */
 OS_EXT            OS_TICK                   OSTmrToTicksMult;           /* Converts Timer time to Ticks Multiplier    */
 #endif
 
@@ -1428,6 +1722,12 @@ void          OS_FlagDbgListRemove      (OS_FLAG_GRP           *p_grp);
 void          OS_FlagTaskRdy            (OS_TCB                *p_tcb,
                                          OS_FLAGS               flags_rdy,
                                          CPU_TS                 ts);
+
+#if (OS_CFG_FLAG_INDEX_EN > 0u)
+void          OS_FlagSlotInsert         (OS_TCB                *p_tcb);
+
+void          OS_FlagSlotRemove         (OS_TCB                *p_tcb);
+#endif
 #endif
 
 
@@ -1472,6 +1772,13 @@ void          OSMutexCreate             (OS_MUTEX              *p_mutex,
                                          CPU_CHAR              *p_name,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_MUTEX_CEIL_EN > 0u)
+void          OSMutexCreateCeil         (OS_MUTEX              *p_mutex,
+                                         CPU_CHAR              *p_name,
+                                         OS_PRIO                prio_ceil,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_MUTEX_DEL_EN > 0u)
 OS_OBJ_QTY    OSMutexDel                (OS_MUTEX              *p_mutex,
                                          OS_OPT                 opt,
@@ -1571,6 +1878,64 @@ void          OS_QDbgListRemove         (OS_Q                  *p_q);
 #endif
 
 
+/* ================================================================================================================== */
+/*                                                READER-WRITER LOCKS                                                 */
+/* ================================================================================================================== */
+
+#if (OS_CFG_RWLOCK_EN > 0u)
+
+void          OSRwLockCreate            (OS_RWLOCK             *p_lock,
+                                         CPU_CHAR              *p_name,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_RWLOCK_DEL_EN > 0u)
+OS_OBJ_QTY    OSRwLockDel               (OS_RWLOCK             *p_lock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+void          OSRwLockRdPend            (OS_RWLOCK             *p_lock,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+void          OSRwLockWrPend            (OS_RWLOCK             *p_lock,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_RWLOCK_PEND_ABORT_EN > 0u)
+OS_OBJ_QTY    OSRwLockPendAbort         (OS_RWLOCK             *p_lock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+void          OSRwLockPost              (OS_RWLOCK             *p_lock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_RwLockClr              (OS_RWLOCK             *p_lock);
+
+#if (OS_CFG_DBG_EN > 0u)
+void          OS_RwLockDbgListAdd       (OS_RWLOCK             *p_lock);
+
+void          OS_RwLockDbgListRemove    (OS_RWLOCK             *p_lock);
+#endif
+
+OS_PRIO       OS_RwLockGrpPrioFindHighest(OS_TCB               *p_tcb);
+
+void          OS_RwLockGrpPostAll       (OS_TCB                *p_tcb);
+
+void          OS_RwLockPendChg          (OS_RWLOCK             *p_lock,
+                                         OS_TCB                *p_tcb);
+
+#endif
+
+
 /* ================================================================================================================== */
 /*                                                     SEMAPHORES                                                     */
 /* ================================================================================================================== */
@@ -1623,6 +1988,40 @@ void          OS_SemDbgListRemove       (OS_SEM                *p_sem);
 #endif
 
 
+/* ================================================================================================================== */
+/*                                                  SEQUENCE LOCKS                                                    */
+/* ================================================================================================================== */
+
+#if (OS_CFG_SEQLOCK_EN > 0u)
+
+void          OSSeqLockCreate           (OS_SEQLOCK            *p_lock,
+                                         CPU_CHAR              *p_name,
+                                         void                  *p_buf0,
+                                         void                  *p_buf1,
+                                         OS_MEM_SIZE            size,
+                                         OS_ERR                *p_err);
+
+void         *OSSeqLockWrBegin          (OS_SEQLOCK            *p_lock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSSeqLockWrEnd            (OS_SEQLOCK            *p_lock,
+                                         OS_ERR                *p_err);
+
+const void   *OSSeqLockRdBegin          (OS_SEQLOCK            *p_lock,
+                                         OS_SEQ                *p_seq,
+                                         OS_ERR                *p_err);
+
+CPU_BOOLEAN   OSSeqLockRdRetry          (OS_SEQLOCK            *p_lock,
+                                         OS_SEQ                 seq);
+
+OS_SEQ        OSSeqLockRead             (OS_SEQLOCK            *p_lock,
+                                         void                  *p_dst,
+                                         OS_ERR                *p_err);
+
+#endif
+
+
 /* ================================================================================================================== */
 /*                                                 TASK MANAGEMENT                                                    */
 /* ================================================================================================================== */
@@ -1674,6 +2073,12 @@ void          OSTaskQPost               (OS_TCB                *p_tcb,
 
 #endif
 
+#if (OS_CFG_TASK_PROFILE_HIST_EN > 0u)
+void          OSTaskProfileGet          (OS_TCB                *p_tcb,
+                                         OS_TASK_PROFILE       *p_profile,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
 OS_REG        OSTaskRegGet              (OS_TCB                *p_tcb,
                                          OS_REG_ID              id,
@@ -1750,6 +2155,13 @@ void          OS_TaskInit               (OS_ERR                *p_err);
 
 void          OS_TaskInitTCB            (OS_TCB                *p_tcb);
 
+#if (OS_CFG_TASK_PROFILE_HIST_EN > 0u)
+void          OS_TaskProfileRdy         (OS_TCB                *p_tcb);
+
+void          OS_TaskProfileSwOut       (OS_TCB                *p_tcb,
+                                         CPU_TS                 ts);
+#endif
+
 void          OS_TaskReturn             (void);
 
 #if (OS_CFG_TASK_STK_REDZONE_EN > 0u)
@@ -1788,6 +2200,18 @@ void          OSTimeDlyResume           (OS_TCB                *p_tcb,
 
 OS_TICK       OSTimeGet                 (OS_ERR                *p_err);
 
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+void          OSTimePeriodicSet         (OS_TICK                period,
+                                         OS_TICK                deadline,
+                                         OS_ERR                *p_err);
+
+void          OSTimePeriodicStatGet     (OS_TCB                *p_tcb,
+                                         OS_PERIODIC_STAT      *p_stat,
+                                         OS_ERR                *p_err);
+
+void          OSTimePeriodicWait        (OS_ERR                *p_err);
+#endif
+
 void          OSTimeSet                 (OS_TICK                ticks,
                                          OS_ERR                *p_err);
 
@@ -1836,6 +2260,19 @@ CPU_BOOLEAN   OSTmrStop                 (OS_TMR                *p_tmr,
                                          void                  *p_callback_arg,
                                          OS_ERR                *p_err);
 
+void          OSTmrTaskCreate           (OS_TMR_TASK           *p_tmr_task,
+                                         OS_TCB                *p_tcb,
+                                         CPU_CHAR              *p_name,
+                                         OS_PRIO                prio,
+                                         CPU_STK               *p_stk_base,
+                                         CPU_STK_SIZE           stk_limit,
+                                         CPU_STK_SIZE           stk_size,
+                                         OS_ERR                *p_err);
+
+void          OSTmrTaskSet              (OS_TMR                *p_tmr,
+                                         OS_TMR_TASK           *p_tmr_task,
+                                         OS_ERR                *p_err);
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_TmrClr                 (OS_TMR                *p_tmr);
@@ -1851,8 +2288,7 @@ void          OS_TmrInit                (OS_ERR                *p_err);
 void          OS_TmrLink                (OS_TMR                *p_tmr,
                                          OS_TICK                time);
 
-void          OS_TmrUnlink              (OS_TMR                *p_tmr,
-                                         OS_TICK                time);
+void          OS_TmrUnlink              (OS_TMR                *p_tmr);
 
 void          OS_TmrTask                (void                  *p_arg);
 
@@ -2026,6 +2462,11 @@ void          OS_Post                   (OS_PEND_OBJ           *p_obj,
                                          OS_MSG_SIZE            msg_size,
                                          CPU_TS                 ts);
 
+void          OS_PostAll                (OS_PEND_OBJ           *p_obj,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         CPU_TS                 ts);
+
 /* ----------------------------------------------- PRIORITY MANAGEMENT ---------------------------------------------- */
 
 void          OS_PrioInit               (void);
@@ -2148,6 +2589,19 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #error  "OS_CFG.H, OS_CFG_PRIO_MAX must be >= 8"
 #endif
 
+#ifndef OS_CFG_PRIO_TBL_2LVL_EN
+#error  "OS_CFG.H, Missing OS_CFG_PRIO_TBL_2LVL_EN: Enable (1) or Disable (0) the two-level priority bitmap"
+#else
+    #if    (OS_CFG_PRIO_TBL_2LVL_EN > 0u) && \
+           (OS_PRIO_TBL_SIZE > (CPU_CFG_DATA_SIZE * 8u))
+    #error  "OS_CFG.H, OS_CFG_PRIO_MAX must be <= (CPU_CFG_DATA_SIZE * 8)^2 with the two-level priority bitmap"
+    #endif
+#endif
+
+#ifndef OS_CFG_PEND_LIST_BITMAP_EN
+#error  "OS_CFG.H, Missing OS_CFG_PEND_LIST_BITMAP_EN: Enable (1) or Disable (0) the priority bitmap of the pend lists"
+#endif
+
 
 #ifndef OS_CFG_SCHED_LOCK_TIME_MEAS_EN
 #error  "OS_CFG.H, Missing OS_CFG_SCHED_LOCK_TIME_MEAS_EN: Include code to measure scheduler lock time"
@@ -2201,6 +2655,10 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #ifndef OS_CFG_FLAG_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_CFG_FLAG_PEND_ABORT_EN: Include code for aborting pends from another task"
     #endif
+
+    #ifndef OS_CFG_FLAG_INDEX_EN
+    #error  "OS_CFG.H, Missing OS_CFG_FLAG_INDEX_EN: Index the tasks waiting on each bit of an event flag group"
+    #endif
 #endif
 
 /*
@@ -2229,6 +2687,10 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #ifndef OS_CFG_MUTEX_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_CFG_MUTEX_PEND_ABORT_EN: Include code for OSMutexPendAbort()"
     #endif
+
+    #ifndef OS_CFG_MUTEX_CEIL_EN
+    #error  "OS_CFG.H, Missing OS_CFG_MUTEX_CEIL_EN: Include code for OSMutexCreateCeil()"
+    #endif
 #endif
 
 /*
@@ -2253,6 +2715,34 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #endif
 #endif
 
+/*
+************************************************************************************************************************
+*                                                 READER-WRITER LOCKS
+************************************************************************************************************************
+*/
+
+#ifndef OS_CFG_RWLOCK_EN
+#error  "OS_CFG.H, Missing OS_CFG_RWLOCK_EN: Enable (1) or Disable (0) code generation for READER-WRITER LOCKS"
+#elif (OS_CFG_RWLOCK_EN > 0u)
+    #ifndef OS_CFG_RWLOCK_DEL_EN
+    #error  "OS_CFG.H, Missing OS_CFG_RWLOCK_DEL_EN: Include code for OSRwLockDel()"
+    #endif
+
+    #ifndef OS_CFG_RWLOCK_PEND_ABORT_EN
+    #error  "OS_CFG.H, Missing OS_CFG_RWLOCK_PEND_ABORT_EN: Include code for OSRwLockPendAbort()"
+    #endif
+
+    #ifndef OS_CFG_RWLOCK_RD_MAX
+    #error  "OS_CFG.H, Missing OS_CFG_RWLOCK_RD_MAX: Maximum number of tasks reading a lock at once"
+    #elif   (OS_CFG_RWLOCK_RD_MAX < 1u)
+    #error  "OS_CFG.H, OS_CFG_RWLOCK_RD_MAX must be >= 1"
+    #endif
+
+    #if (OS_CFG_MUTEX_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_MUTEX_EN must be Enabled (1) to use the reader-writer locks (priority inheritance)"
+    #endif
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                      SEMAPHORES
@@ -2275,6 +2765,16 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #endif
 #endif
 
+/*
+************************************************************************************************************************
+*                                                    SEQUENCE LOCKS
+************************************************************************************************************************
+*/
+
+#ifndef OS_CFG_SEQLOCK_EN
+#error  "OS_CFG.H, Missing OS_CFG_SEQLOCK_EN: Enable (1) or Disable (0) code generation for SEQUENCE LOCKS"
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                   TASK MANAGEMENT
@@ -2314,6 +2814,15 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #endif
 #endif
 
+#ifndef OS_CFG_TASK_PROFILE_HIST_EN
+#error  "OS_CFG.H, Missing OS_CFG_TASK_PROFILE_HIST_EN: Include per-task run & response time histograms"
+#else
+#if    (OS_CFG_TASK_PROFILE_HIST_EN > 0u) && \
+      ((OS_CFG_TASK_PROFILE_EN     == 0u) || (OS_CFG_TS_EN == 0u))
+#error  "OS_CFG.H, OS_CFG_TASK_PROFILE_EN and OS_CFG_TS_EN must be Enabled (1) to use the task profile histograms"
+#endif
+#endif
+
 #ifndef OS_CFG_TASK_REG_TBL_SIZE
 #error  "OS_CFG.H, Missing OS_CFG_TASK_REG_TBL_SIZE: Include support for task specific registers"
 #endif
@@ -2344,6 +2853,14 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
     #endif
 #endif
 
+#ifndef OS_CFG_TICK_WHEEL_EN
+#error  "OS_CFG.H, Missing OS_CFG_TICK_WHEEL_EN: Use a timing wheel (1) or a delta list (0) for the tick list"
+#else
+    #if ((OS_CFG_TICK_WHEEL_EN > 0u) && (OS_CFG_DYN_TICK_EN > 0u))
+    #error "OS_CFG.H, OS_CFG_DYN_TICK_EN must be Disabled (0) to use the timing wheel tick list"
+    #endif
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                  TIME MANAGEMENT
@@ -2358,6 +2875,15 @@ OS_TICK       OS_DynTickSet             (OS_TICK                ticks);
 #error  "OS_CFG.H, Missing OS_CFG_TIME_DLY_RESUME_EN: Include code for OSTimeDlyResume()"
 #endif
 
+#ifndef OS_CFG_TIME_PERIODIC_EN
+#error  "OS_CFG.H, Missing OS_CFG_TIME_PERIODIC_EN: Include code for OSTimePeriodicXXX()"
+#else
+#if    (OS_CFG_TIME_PERIODIC_EN > 0u) && \
+      ((OS_CFG_TICK_EN          == 0u) || (OS_CFG_TS_EN == 0u))
+#error  "OS_CFG.H, OS_CFG_TICK_EN and OS_CFG_TS_EN must be Enabled (1) to use the periodic tasks"
+#endif
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                  TIMER MANAGEMENT
@@ -98,10 +98,12 @@ CPU_INT08U  const  OSDbg_MutexEn               = OS_CFG_MUTEX_EN;
 #if (OS_CFG_MUTEX_EN > 0u)
 CPU_INT08U  const  OSDbg_MutexDelEn            = OS_CFG_MUTEX_DEL_EN;
 CPU_INT08U  const  OSDbg_MutexPendAbortEn      = OS_CFG_MUTEX_PEND_ABORT_EN;
+CPU_INT08U  const  OSDbg_MutexCeilEn           = OS_CFG_MUTEX_CEIL_EN;
 CPU_INT16U  const  OSDbg_MutexSize             = sizeof(OS_MUTEX);             /* Size in bytes of OS_MUTEX           */
 #else
 CPU_INT08U  const  OSDbg_MutexDelEn            = 0u;
 CPU_INT08U  const  OSDbg_MutexPendAbortEn      = 0u;
+CPU_INT08U  const  OSDbg_MutexCeilEn           = 0u;
 CPU_INT16U  const  OSDbg_MutexSize             = 0u;
 #endif
 
@@ -133,6 +135,20 @@ CPU_INT16U  const  OSDbg_QSize                 = 0u;
 #endif
 
 
+CPU_INT08U  const  OSDbg_RwLockEn              = OS_CFG_RWLOCK_EN;
+#if (OS_CFG_RWLOCK_EN > 0u)
+CPU_INT08U  const  OSDbg_RwLockDelEn           = OS_CFG_RWLOCK_DEL_EN;
+CPU_INT08U  const  OSDbg_RwLockPendAbortEn     = OS_CFG_RWLOCK_PEND_ABORT_EN;
+CPU_INT16U  const  OSDbg_RwLockRdMax           = OS_CFG_RWLOCK_RD_MAX;
+CPU_INT16U  const  OSDbg_RwLockSize            = sizeof(OS_RWLOCK);            /* Size in bytes of OS_RWLOCK          */
+#else
+CPU_INT08U  const  OSDbg_RwLockDelEn           = 0u;
+CPU_INT08U  const  OSDbg_RwLockPendAbortEn     = 0u;
+CPU_INT16U  const  OSDbg_RwLockRdMax           = 0u;
+CPU_INT16U  const  OSDbg_RwLockSize            = 0u;
+#endif
+
+
 CPU_INT08U  const  OSDbg_SchedRoundRobinEn     = OS_CFG_SCHED_ROUND_ROBIN_EN;
 
 
@@ -151,6 +167,14 @@ CPU_INT16U  const  OSDbg_SemSize               = 0u;
 #endif
 
 
+CPU_INT08U  const  OSDbg_SeqLockEn             = OS_CFG_SEQLOCK_EN;
+#if (OS_CFG_SEQLOCK_EN > 0u)
+CPU_INT16U  const  OSDbg_SeqLockSize           = sizeof(OS_SEQLOCK);           /* Size in bytes of OS_SEQLOCK         */
+#else
+CPU_INT16U  const  OSDbg_SeqLockSize           = 0u;
+#endif
+
+
 CPU_INT16U  const  OSDbg_RdyList               = sizeof(OS_RDY_LIST);
 CPU_INT32U  const  OSDbg_RdyListSize           = sizeof(OSRdyList);            /* Number of bytes in the ready table  */
 
@@ -175,6 +199,7 @@ CPU_INT16U  const  OSDbg_TickListSize          = sizeof(OS_TICK_LIST);
 
 CPU_INT08U  const  OSDbg_TimeDlyHMSMEn         = OS_CFG_TIME_DLY_HMSM_EN;
 CPU_INT08U  const  OSDbg_TimeDlyResumeEn       = OS_CFG_TIME_DLY_RESUME_EN;
+CPU_INT08U  const  OSDbg_TimePeriodicEn        = OS_CFG_TIME_PERIODIC_EN;
 
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
 CPU_INT16U  const  OSDbg_TLS_TblSize           = OS_CFG_TLS_TBL_SIZE * sizeof(OS_TLS);
@@ -294,6 +319,13 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSQDbgListPtr)
                                   + sizeof(OSQQty)
 #endif
+#endif
+
+#if (OS_CFG_RWLOCK_EN > 0u)
+#if (OS_CFG_DBG_EN > 0u)
+                                  + sizeof(OSRwLockDbgListPtr)
+                                  + sizeof(OSRwLockQty)
+#endif
 #endif
 
                                   + sizeof(OSRdyList)
@@ -345,31 +377,27 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
 #if (OS_CFG_TICK_EN > 0u)
                                   + sizeof(OSTickCtr)
                                   + sizeof(OSTickList)
+#if (OS_CFG_TICK_WHEEL_EN > 0u)
+                                  + sizeof(OSTickWheel)
+#endif
 #if (OS_CFG_TS_EN > 0u)
                                   + sizeof(OSTickTime)
                                   + sizeof(OSTickTimeMax)
 #endif
+#if (OS_CFG_TIME_PERIODIC_EN > 0u)
+                                  + sizeof(OSTickTS)
+#endif
 
 #endif
 
 #if (OS_CFG_TMR_EN > 0u)
 #if (OS_CFG_DBG_EN > 0u)
                                   + sizeof(OSTmrDbgListPtr)
-                                  + sizeof(OSTmrListEntries)
-#endif
-                                  + sizeof(OSTmrListPtr)
-                                  + sizeof(OSTmrMutex)
-                                  + sizeof(OSTmrCond)
-#if (OS_CFG_DBG_EN > 0u)
                                   + sizeof(OSTmrQty)
 #endif
                                   + sizeof(OSTmrTaskTCB)
-                                  + sizeof(OSTmrTaskTickBase)
+                                  + sizeof(OSTmrTaskDflt)
                                   + sizeof(OSTmrToTicksMult)
-#if (OS_CFG_TS_EN > 0u)
-                                  + sizeof(OSTmrTaskTime)
-                                  + sizeof(OSTmrTaskTimeMax)
-#endif
 #endif
 
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
@@ -445,6 +473,7 @@ void  OS_Dbg_Init (void)
 #if (OS_CFG_MUTEX_EN > 0u)
     p_temp08 = (CPU_INT08U const *)&OSDbg_MutexDelEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_MutexPendAbortEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_MutexCeilEn;
     p_temp16 = (CPU_INT16U const *)&OSDbg_MutexSize;
 #endif
 
@@ -467,6 +496,14 @@ void  OS_Dbg_Init (void)
     p_temp16 = (CPU_INT16U const *)&OSDbg_QSize;
 #endif
 
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RwLockEn;
+#if (OS_CFG_RWLOCK_EN > 0u)
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RwLockDelEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_RwLockPendAbortEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_RwLockRdMax;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_RwLockSize;
+#endif
+
     p_temp16 = (CPU_INT16U const *)&OSDbg_SchedRoundRobinEn;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_Sem;
@@ -478,6 +515,9 @@ void  OS_Dbg_Init (void)
     p_temp16 = (CPU_INT16U const *)&OSDbg_SemSize;
 #endif
 
+    p_temp08 = (CPU_INT08U const *)&OSDbg_SeqLockEn;
+    p_temp16 = (CPU_INT16U const *)&OSDbg_SeqLockSize;
+
     p_temp16 = (CPU_INT16U const *)&OSDbg_RdyList;
     p_temp32 = (CPU_INT32U const *)&OSDbg_RdyListSize;
 
@@ -501,6 +541,7 @@ void  OS_Dbg_Init (void)
 
     p_temp08 = (CPU_INT08U const *)&OSDbg_TimeDlyHMSMEn;
     p_temp08 = (CPU_INT08U const *)&OSDbg_TimeDlyResumeEn;
+    p_temp08 = (CPU_INT08U const *)&OSDbg_TimePeriodicEn;
 
     p_temp16 = (CPU_INT16U const *)&OSDbg_TLS_TblSize;
 
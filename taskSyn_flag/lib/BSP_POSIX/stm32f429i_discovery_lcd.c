@@ -0,0 +1,509 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery_lcd.c
+  * @brief   Host (POSIX) stand-in for the STM32F429I-Discovery LCD. The drawing
+  *          algorithms follow the ST BSP so the host framebuffer matches the
+  *          board pixel for pixel, except for the glyphs (see fonts.c).
+  *          The layer address & enable go to the LTDC stand-in registers (see
+  *          stm32f4xx_hal.c) with an immediate reload, as HAL_LTDC_xxx() do, so
+  *          BSP_POSIX_LCD_ScanOut() returns what the panel shows.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f429i_discovery_lcd.h"
+
+/* Private define ------------------------------------------------------------*/
+#define BSP_POSIX_LCD_FB_NBR   2u                 /* LCD_FRAME_BUFFER & LCD_FRAME_BUFFER + BUFFER_OFFSET */
+#define ABS(X)                 ((X) > 0 ? (X) : -(X))
+#define BSP_POSIX_LCD_AWCR     ((269u << 16) | 323u)  /* Accumulated active width & height of the ILI9341 timings */
+
+/* Private types -------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t TextColor;
+  uint32_t BackColor;
+  sFONT *pFont;
+  uint32_t Address;
+} BSP_POSIX_LCD_LayerTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t BSP_POSIX_LCD_FrameBuffer[BSP_POSIX_LCD_FB_NBR][LCD_PIXEL_WIDTH * LCD_PIXEL_HEIGHT];
+static BSP_POSIX_LCD_LayerTypeDef BSP_POSIX_LCD_Layer[MAX_LAYER_NUMBER];
+static uint32_t ActiveLayer = 0;
+static uint8_t BSP_POSIX_LCD_On;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t *BSP_POSIX_LCD_ActiveFrameBuffer(void);
+static void      BSP_POSIX_LCD_LayerReload(uint32_t LayerIndex, uint32_t Address, uint8_t Enable);
+static void      BSP_POSIX_LCD_FillBuffer(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint32_t Color);
+
+/* Exported functions --------------------------------------------------------*/
+uint8_t BSP_LCD_Init(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < MAX_LAYER_NUMBER; i++)
+  {
+    BSP_POSIX_LCD_Layer[i].TextColor = LCD_COLOR_BLACK;
+    BSP_POSIX_LCD_Layer[i].BackColor = LCD_COLOR_WHITE;
+    BSP_POSIX_LCD_Layer[i].pFont = &Font24;
+    BSP_POSIX_LCD_Layer[i].Address = LCD_FRAME_BUFFER;
+  }
+  LTDC->AWCR = BSP_POSIX_LCD_AWCR;
+  return LCD_OK;
+}
+
+uint32_t BSP_LCD_GetXSize(void)
+{
+  return LCD_PIXEL_WIDTH;
+}
+
+uint32_t BSP_LCD_GetYSize(void)
+{
+  return LCD_PIXEL_HEIGHT;
+}
+
+void BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FrameBuffer)
+{
+  BSP_POSIX_LCD_Layer[LayerIndex].Address = FrameBuffer;
+  BSP_POSIX_LCD_LayerReload(LayerIndex, FrameBuffer, 1u);
+  BSP_POSIX_LCD_Layer[LayerIndex].pFont = &Font24;
+  BSP_POSIX_LCD_Layer[LayerIndex].BackColor = LCD_COLOR_WHITE;
+  BSP_POSIX_LCD_Layer[LayerIndex].TextColor = LCD_COLOR_BLACK;
+}
+
+void BSP_LCD_SetTransparency(uint32_t LayerIndex, uint8_t Transparency)
+{
+  (void)LayerIndex;
+  (void)Transparency;
+}
+
+void BSP_LCD_SetLayerAddress(uint32_t LayerIndex, uint32_t Address)
+{
+  BSP_POSIX_LCD_Layer[LayerIndex].Address = Address;
+  BSP_POSIX_LCD_LayerReload(LayerIndex, Address, 2u);
+}
+
+void BSP_LCD_SetLayerVisible(uint32_t LayerIndex, FunctionalState state)
+{
+  BSP_POSIX_LCD_LayerReload(LayerIndex, 0u, (state == ENABLE) ? 1u : 0u);
+}
+
+void BSP_LCD_SelectLayer(uint32_t LayerIndex)
+{
+  ActiveLayer = LayerIndex;
+}
+
+void BSP_LCD_SetTextColor(uint32_t Color)
+{
+  BSP_POSIX_LCD_Layer[ActiveLayer].TextColor = Color;
+}
+
+uint32_t BSP_LCD_GetTextColor(void)
+{
+  return BSP_POSIX_LCD_Layer[ActiveLayer].TextColor;
+}
+
+void BSP_LCD_SetBackColor(uint32_t Color)
+{
+  BSP_POSIX_LCD_Layer[ActiveLayer].BackColor = Color;
+}
+
+uint32_t BSP_LCD_GetBackColor(void)
+{
+  return BSP_POSIX_LCD_Layer[ActiveLayer].BackColor;
+}
+
+void BSP_LCD_SetFont(sFONT *pFonts)
+{
+  BSP_POSIX_LCD_Layer[ActiveLayer].pFont = pFonts;
+}
+
+sFONT *BSP_LCD_GetFont(void)
+{
+  return BSP_POSIX_LCD_Layer[ActiveLayer].pFont;
+}
+
+uint32_t BSP_LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos)
+{
+  uint32_t *fb = BSP_POSIX_LCD_ActiveFrameBuffer();
+
+  if ((fb == NULL) || (Xpos >= LCD_PIXEL_WIDTH) || (Ypos >= LCD_PIXEL_HEIGHT))
+  {
+    return 0u;
+  }
+  return fb[Ypos * LCD_PIXEL_WIDTH + Xpos];
+}
+
+void BSP_LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code)
+{
+  uint32_t *fb = BSP_POSIX_LCD_ActiveFrameBuffer();
+
+  if ((fb == NULL) || (Xpos >= LCD_PIXEL_WIDTH) || (Ypos >= LCD_PIXEL_HEIGHT))
+  {
+    return;
+  }
+  fb[Ypos * LCD_PIXEL_WIDTH + Xpos] = RGB_Code;
+}
+
+void BSP_LCD_Clear(uint32_t Color)
+{
+  BSP_POSIX_LCD_FillBuffer(0, 0, LCD_PIXEL_WIDTH, LCD_PIXEL_HEIGHT, Color);
+}
+
+void BSP_LCD_ClearStringLine(uint32_t Line)
+{
+  uint32_t colorbackup = BSP_POSIX_LCD_Layer[ActiveLayer].TextColor;
+
+  BSP_POSIX_LCD_Layer[ActiveLayer].TextColor = BSP_POSIX_LCD_Layer[ActiveLayer].BackColor;
+  BSP_LCD_FillRect(0, LINE(Line), LCD_PIXEL_WIDTH, BSP_POSIX_LCD_Layer[ActiveLayer].pFont->Height);
+  BSP_POSIX_LCD_Layer[ActiveLayer].TextColor = colorbackup;
+}
+
+/**
+ * \brief Draw one character cell. Without glyph tables the cell is filled with the back color.
+ */
+void BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii)
+{
+  sFONT *font = BSP_POSIX_LCD_Layer[ActiveLayer].pFont;
+  const uint8_t *c;
+  uint32_t i, j, line, width, offset;
+
+  if (font->table == NULL)
+  {
+    BSP_POSIX_LCD_FillBuffer(Xpos, Ypos, font->Width, font->Height, BSP_POSIX_LCD_Layer[ActiveLayer].BackColor);
+    return;
+  }
+
+  width = ((font->Width + 7u) / 8u);
+  offset = 8u * width - font->Width;
+  c = &font->table[(Ascii - ' ') * font->Height * width];
+  for (i = 0u; i < font->Height; i++)
+  {
+    line = 0u;
+    for (j = 0u; j < width; j++)
+    {
+      line = (line << 8) | c[i * width + j];
+    }
+    for (j = 0u; j < font->Width; j++)
+    {
+      if (line & (1u << (font->Width - j + offset - 1u)))
+      {
+        BSP_LCD_DrawPixel(Xpos + j, Ypos + i, BSP_POSIX_LCD_Layer[ActiveLayer].TextColor);
+      }
+      else
+      {
+        BSP_LCD_DrawPixel(Xpos + j, Ypos + i, BSP_POSIX_LCD_Layer[ActiveLayer].BackColor);
+      }
+    }
+  }
+}
+
+void BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_AlignModeTypdef Mode)
+{
+  uint16_t refcolumn = 1, i = 0;
+  uint32_t size = 0, xsize = 0;
+  uint8_t *ptr = Text;
+  uint16_t width = BSP_POSIX_LCD_Layer[ActiveLayer].pFont->Width;
+
+  while (*ptr++)
+  {
+    size++;
+  }
+
+  xsize = (BSP_LCD_GetXSize() / width);
+
+  switch (Mode)
+  {
+  case CENTER_MODE:
+    refcolumn = Xpos + ((xsize - size) * width) / 2;
+    break;
+  case LEFT_MODE:
+    refcolumn = Xpos;
+    break;
+  case RIGHT_MODE:
+    refcolumn = -Xpos + ((xsize - size) * width);
+    break;
+  default:
+    refcolumn = Xpos;
+    break;
+  }
+
+  while ((*Text != 0) & (((BSP_LCD_GetXSize() - (i * width)) & 0xFFFF) >= width))
+  {
+    BSP_LCD_DisplayChar(refcolumn, Ypos, *Text);
+    refcolumn += width;
+    Text++;
+    i++;
+  }
+}
+
+void BSP_LCD_DisplayStringAtLine(uint16_t Line, uint8_t *ptr)
+{
+  BSP_LCD_DisplayStringAt(0, LINE(Line), ptr, LEFT_MODE);
+}
+
+void BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
+{
+  BSP_POSIX_LCD_FillBuffer(Xpos, Ypos, Length, 1, BSP_POSIX_LCD_Layer[ActiveLayer].TextColor);
+}
+
+void BSP_LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
+{
+  BSP_POSIX_LCD_FillBuffer(Xpos, Ypos, 1, Length, BSP_POSIX_LCD_Layer[ActiveLayer].TextColor);
+}
+
+void BSP_LCD_DrawLine(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2)
+{
+  int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0,
+          yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0,
+          curpixel = 0;
+
+  deltax = ABS(X2 - X1);
+  deltay = ABS(Y2 - Y1);
+  x = X1;
+  y = Y1;
+
+  if (X2 >= X1)
+  {
+    xinc1 = 1;
+    xinc2 = 1;
+  }
+  else
+  {
+    xinc1 = -1;
+    xinc2 = -1;
+  }
+
+  if (Y2 >= Y1)
+  {
+    yinc1 = 1;
+    yinc2 = 1;
+  }
+  else
+  {
+    yinc1 = -1;
+    yinc2 = -1;
+  }
+
+  if (deltax >= deltay)
+  {
+    xinc1 = 0;
+    yinc2 = 0;
+    den = deltax;
+    num = deltax / 2;
+    numadd = deltay;
+    numpixels = deltax;
+  }
+  else
+  {
+    xinc2 = 0;
+    yinc1 = 0;
+    den = deltay;
+    num = deltay / 2;
+    numadd = deltax;
+    numpixels = deltay;
+  }
+
+  for (curpixel = 0; curpixel <= numpixels; curpixel++)
+  {
+    BSP_LCD_DrawPixel(x, y, BSP_POSIX_LCD_Layer[ActiveLayer].TextColor);
+    num += numadd;
+    if (num >= den)
+    {
+      num -= den;
+      x += xinc1;
+      y += yinc1;
+    }
+    x += xinc2;
+    y += yinc2;
+  }
+}
+
+void BSP_LCD_DrawRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  BSP_LCD_DrawHLine(Xpos, Ypos, Width);
+  BSP_LCD_DrawHLine(Xpos, (Ypos + Height), Width);
+  BSP_LCD_DrawVLine(Xpos, Ypos, Height);
+  BSP_LCD_DrawVLine((Xpos + Width), Ypos, Height);
+}
+
+void BSP_LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
+{
+  int32_t D;
+  uint32_t CurX;
+  uint32_t CurY;
+  uint32_t color = BSP_POSIX_LCD_Layer[ActiveLayer].TextColor;
+
+  D = 3 - (Radius << 1);
+  CurX = 0;
+  CurY = Radius;
+
+  while (CurX <= CurY)
+  {
+    BSP_LCD_DrawPixel((Xpos + CurX), (Ypos - CurY), color);
+    BSP_LCD_DrawPixel((Xpos - CurX), (Ypos - CurY), color);
+    BSP_LCD_DrawPixel((Xpos + CurY), (Ypos - CurX), color);
+    BSP_LCD_DrawPixel((Xpos - CurY), (Ypos - CurX), color);
+    BSP_LCD_DrawPixel((Xpos + CurX), (Ypos + CurY), color);
+    BSP_LCD_DrawPixel((Xpos - CurX), (Ypos + CurY), color);
+    BSP_LCD_DrawPixel((Xpos + CurY), (Ypos + CurX), color);
+    BSP_LCD_DrawPixel((Xpos - CurY), (Ypos + CurX), color);
+
+    if (D < 0)
+    {
+      D += (CurX << 2) + 6;
+    }
+    else
+    {
+      D += ((CurX - CurY) << 2) + 10;
+      CurY--;
+    }
+    CurX++;
+  }
+}
+
+void BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  BSP_POSIX_LCD_FillBuffer(Xpos, Ypos, Width, Height, BSP_POSIX_LCD_Layer[ActiveLayer].TextColor);
+}
+
+void BSP_LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
+{
+  int32_t D;
+  uint32_t CurX;
+  uint32_t CurY;
+
+  D = 3 - (Radius << 1);
+  CurX = 0;
+  CurY = Radius;
+
+  while (CurX <= CurY)
+  {
+    if (CurY > 0)
+    {
+      BSP_LCD_DrawHLine(Xpos - CurY, Ypos + CurX, 2 * CurY);
+      BSP_LCD_DrawHLine(Xpos - CurY, Ypos - CurX, 2 * CurY);
+    }
+
+    if (CurX > 0)
+    {
+      BSP_LCD_DrawHLine(Xpos - CurX, Ypos - CurY, 2 * CurX);
+      BSP_LCD_DrawHLine(Xpos - CurX, Ypos + CurY, 2 * CurX);
+    }
+    if (D < 0)
+    {
+      D += (CurX << 2) + 6;
+    }
+    else
+    {
+      D += ((CurX - CurY) << 2) + 10;
+      CurY--;
+    }
+    CurX++;
+  }
+
+  BSP_LCD_DrawCircle(Xpos, Ypos, Radius);
+}
+
+void BSP_LCD_DisplayOff(void)
+{
+  BSP_POSIX_LCD_On = 0u;
+}
+
+void BSP_LCD_DisplayOn(void)
+{
+  BSP_POSIX_LCD_On = 1u;
+}
+
+uint32_t *BSP_POSIX_LCD_FrameBufferGet(uint32_t Address)
+{
+  uint32_t index;
+
+  if ((Address < LCD_FRAME_BUFFER) || (((Address - LCD_FRAME_BUFFER) % BUFFER_OFFSET) != 0u))
+  {
+    return NULL;
+  }
+
+  index = (Address - LCD_FRAME_BUFFER) / BUFFER_OFFSET;
+  return (index < BSP_POSIX_LCD_FB_NBR) ? BSP_POSIX_LCD_FrameBuffer[index] : NULL;
+}
+
+/**
+ * \brief Framebuffer scanned out by the LTDC: the foreground layer if enabled, else the background one.
+ *        NULL if no layer is enabled. Blending is not emulated, the top layer is taken as opaque.
+ */
+uint32_t *BSP_POSIX_LCD_ScanOut(void)
+{
+  int32_t i;
+
+  for (i = MAX_LAYER_NUMBER - 1; i >= 0; i--)
+  {
+    if ((HAL_POSIX_LTDC_LayerActive[i].CR & LTDC_LxCR_LEN) != 0u)
+    {
+      return BSP_POSIX_LCD_FrameBufferGet(HAL_POSIX_LTDC_LayerActive[i].CFBAR);
+    }
+  }
+  return NULL;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * \brief Write the layer registers and reload them at once, like HAL_LTDC_ConfigLayer() & co.
+ *        Enable: 0 clear LEN, 1 set LEN, 2 keep it. Address: 0 keeps CFBAR.
+ */
+static void BSP_POSIX_LCD_LayerReload(uint32_t LayerIndex, uint32_t Address, uint8_t Enable)
+{
+  LTDC_Layer_TypeDef *layer = (LayerIndex == 0u) ? LTDC_Layer1 : LTDC_Layer2;
+
+  if (Address != 0u)
+  {
+    layer->CFBAR = Address;
+  }
+  if (Enable == 0u)
+  {
+    layer->CR &= ~LTDC_LxCR_LEN;
+  }
+  else if (Enable == 1u)
+  {
+    layer->CR |= LTDC_LxCR_LEN;
+  }
+  LTDC->SRCR = LTDC_SRCR_IMR;
+  HAL_POSIX_LTDC_Reload();
+}
+
+static uint32_t *BSP_POSIX_LCD_ActiveFrameBuffer(void)
+{
+  return BSP_POSIX_LCD_FrameBufferGet(BSP_POSIX_LCD_Layer[ActiveLayer].Address);
+}
+
+/**
+ * \brief Host equivalent of the DMA2D register-to-memory fill, clipped to the screen.
+ */
+static void BSP_POSIX_LCD_FillBuffer(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint32_t Color)
+{
+  uint32_t *fb = BSP_POSIX_LCD_ActiveFrameBuffer();
+  uint32_t x, y;
+
+  if ((fb == NULL) || (Xpos >= LCD_PIXEL_WIDTH) || (Ypos >= LCD_PIXEL_HEIGHT))
+  {
+    return;
+  }
+  if (Width > (LCD_PIXEL_WIDTH - Xpos))
+  {
+    Width = LCD_PIXEL_WIDTH - Xpos;
+  }
+  if (Height > (LCD_PIXEL_HEIGHT - Ypos))
+  {
+    Height = LCD_PIXEL_HEIGHT - Ypos;
+  }
+
+  for (y = Ypos; y < (uint32_t)(Ypos + Height); y++)
+  {
+    for (x = Xpos; x < (uint32_t)(Xpos + Width); x++)
+    {
+      fb[y * LCD_PIXEL_WIDTH + x] = Color;
+    }
+  }
+}
@@ -679,6 +679,9 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
 * Returns    : The current value of the semaphore counter or 0 upon error.
 *
 * Note(s)    : 1) OS_OPT_POST_NO_SCHED can be added with one of the other options.
+*
+*              2) With OS_OPT_POST_ALL, the tasks waiting are all readied by OS_PostAll() in one critical section and
+*                 the scheduler runs once after them.
 ************************************************************************************************************************
 */
 
@@ -688,8 +691,6 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
 {
     OS_SEM_CTR     ctr;
     OS_PEND_LIST  *p_pend_list;
-    OS_TCB        *p_tcb;
-    OS_TCB        *p_tcb_next;
     CPU_TS         ts;
     CPU_SR_ALLOC();
 
@@ -768,18 +769,17 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
         return (ctr);
     }
 
-    p_tcb = p_pend_list->HeadPtr;
-    while (p_tcb != (OS_TCB *)0) {
-        p_tcb_next = p_tcb->PendNextPtr;
-        OS_Post((OS_PEND_OBJ *)((void *)p_sem),
-                p_tcb,
+    if ((opt & OS_OPT_POST_ALL) == 0u) {                        /* Post to all tasks waiting?                           */
+        OS_Post((OS_PEND_OBJ *)((void *)p_sem),                 /* No,  only to the highest priority one                */
+                p_pend_list->HeadPtr,
                 (void *)0,
                 0u,
                 ts);
-        if ((opt & OS_OPT_POST_ALL) == 0u) {                     /* Post to all tasks waiting?                           */
-            break;                                              /* No                                                   */
-        }
-        p_tcb = p_tcb_next;
+    } else {
+        OS_PostAll((OS_PEND_OBJ *)((void *)p_sem),              /* Yes, ready all of them at once                       */
+                   (void *)0,
+                   0u,
+                   ts);
     }
     CPU_CRITICAL_EXIT();
     if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
@@ -0,0 +1,514 @@
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       SEQUENCE LOCK MANAGEMENT
+*
+* File    : os_seqlock.c
+* Version : V3.08.00
+*********************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_seqlock__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_SEQLOCK_EN > 0u)
+/*
+************************************************************************************************************************
+*                                                  LOCAL PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_SeqLockCopy (void         *p_dst,
+                              const  void  *p_src,
+                              OS_MEM_SIZE   size);
+
+
+/*
+************************************************************************************************************************
+*                                               CREATE A SEQUENCE LOCK
+*
+* Description: This function creates a sequence lock, which publishes snapshots of shared data: a writer publishes a
+*              new snapshot at once and the readers copy the snapshot published without blocking nor taking a lock.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock to initialize.  Your application is responsible for
+*                            allocating storage for the sequence lock.
+*
+*              p_name        is a pointer to the name you would like to give the sequence lock.
+*
+*              p_buf0        are pointers to the two buffers of 'size' bytes holding the snapshots.  'p_buf0' holds the
+*              p_buf1        first snapshot published, so it must be initialized before the first read.  The buffers
+*                            are only accessed through the sequence lock from then on.
+*
+*              size          is the size (in bytes) of a snapshot.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the sequence lock after you
+*                                                                 called OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_CREATED             If the sequence lock was already created
+*                                OS_ERR_PTR_INVALID             If 'p_buf0' or 'p_buf1' is a NULL pointer
+*
+* Returns    : none
+*
+* Note(s)    : (1) A snapshot is copied a word at a time if both buffers and 'size' are aligned on CPU_DATA.
+************************************************************************************************************************
+*/
+
+void  OSSeqLockCreate (OS_SEQLOCK   *p_lock,
+                       CPU_CHAR     *p_name,
+                       void         *p_buf0,
+                       void         *p_buf1,
+                       OS_MEM_SIZE   size,
+                       OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to be called from an ISR                 */
+       *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_SEQLOCK *)0) {                            /* Validate 'p_lock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if ((p_buf0 == (void *)0) ||                                /* Validate the buffers                                 */
+        (p_buf1 == (void *)0)) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if (OS_OBJ_TYPE_REQ > 0u)
+    if (p_lock->Type == OS_OBJ_TYPE_SEQLOCK) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+    p_lock->Type       = OS_OBJ_TYPE_SEQLOCK;                   /* Mark the data structure as a sequence lock           */
+#endif
+#if (OS_CFG_DBG_EN > 0u)
+    p_lock->NamePtr    = p_name;                                /* Save the name of the sequence lock                   */
+#else
+    (void)p_name;
+#endif
+    p_lock->BufPtr[0]  = p_buf0;
+    p_lock->BufPtr[1]  = p_buf1;
+    p_lock->BufSize    = size;
+    p_lock->Seq        = 0u;                                    /* 'p_buf0' is published, no write in progress          */
+    p_lock->RdRetryCtr = 0u;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                   START A WRITE
+*
+* Description: This function starts the write of a new snapshot and returns the buffer to write it in.  The snapshot
+*              published is not changed until OSSeqLockWrEnd() publishes the new one.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock.
+*
+*              opt           determines how the new snapshot starts:
+*
+*                                OS_OPT_SEQLOCK_NONE        The buffer returned holds an old snapshot, to be
+*                                                           written entirely
+*                                OS_OPT_SEQLOCK_COPY        The buffer returned holds a copy of the snapshot published,
+*                                                           to be updated
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_lock' is not pointing at a sequence lock
+*                                OS_ERR_OPT_INVALID             If you specified an invalid option
+*                                OS_ERR_SEQLOCK_WR              If a write is already in progress
+*
+* Returns    : a pointer to the buffer of the new snapshot, or a NULL pointer on error.
+*
+* Note(s)    : (1) There is one write in progress at a time: the writers serialize among themselves (a single task, or
+*                  a mutex held from OSSeqLockWrBegin() to OSSeqLockWrEnd()).  The error returned otherwise catches
+*                  unserialized writers, it does not make them safe.
+*
+*              (2) A write never blocks and may be done from an ISR.
+************************************************************************************************************************
+*/
+
+void  *OSSeqLockWrBegin (OS_SEQLOCK  *p_lock,
+                         OS_OPT       opt,
+                         OS_ERR      *p_err)
+{
+    void  *p_back;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_SEQLOCK *)0) {                            /* Validate 'p_lock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((void *)0);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_SEQLOCK_NONE:
+        case OS_OPT_SEQLOCK_COPY:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((void *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_lock->Type != OS_OBJ_TYPE_SEQLOCK) {                  /* Make sure the sequence lock was created              */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((void *)0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if ((p_lock->Seq & 1u) != 0u) {                             /* See Note #1                                          */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SEQLOCK_WR;
+        return ((void *)0);
+    }
+    p_lock->Seq++;                                              /* Odd: the readers of the back buffer must retry       */
+    p_back = p_lock->BufPtr[((p_lock->Seq >> 1u) + 1u) & 1u];
+    CPU_CRITICAL_EXIT();
+
+    if (opt == OS_OPT_SEQLOCK_COPY) {                           /* The front buffer is not written until WrEnd()        */
+        OS_SeqLockCopy(p_back,
+                       p_lock->BufPtr[(p_lock->Seq >> 1u) & 1u],
+                       p_lock->BufSize);
+    }
+   *p_err = OS_ERR_NONE;
+    return (p_back);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    END A WRITE
+*
+* Description: This function publishes the snapshot written since OSSeqLockWrBegin().
+*
+* Arguments  : p_lock        is a pointer to the sequence lock.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_lock' is not pointing at a sequence lock
+*                                OS_ERR_SEQLOCK_NOT_WR          If no write is in progress
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OSSeqLockWrEnd (OS_SEQLOCK  *p_lock,
+                      OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_SEQLOCK *)0) {                            /* Validate 'p_lock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_lock->Type != OS_OBJ_TYPE_SEQLOCK) {                  /* Make sure the sequence lock was created              */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();                                       /* Orders the writes of the snapshot before its publish */
+    if ((p_lock->Seq & 1u) == 0u) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SEQLOCK_NOT_WR;
+        return;
+    }
+    p_lock->Seq++;                                              /* Even: the back buffer becomes the front one          */
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                    START A READ
+*
+* Description: This function starts the read of the snapshot published, in place.  The read is valid if
+*              OSSeqLockRdRetry() returns OS_FALSE at its end, otherwise it must be restarted.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock.
+*
+*              p_seq         is a pointer to a variable that will receive the sequence number of the read, to be
+*                            passed to OSSeqLockRdRetry().
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_lock' is not pointing at a sequence lock
+*                                OS_ERR_PTR_INVALID             If 'p_seq' is a NULL pointer
+*
+* Returns    : a pointer to the snapshot published, or a NULL pointer on error.
+*
+* Note(s)    : (1) Nothing read from the snapshot may be used before OSSeqLockRdRetry() validates the read: a torn
+*                  snapshot can hold any value, including out of range indexes and pointers.
+*
+*              (2) A read never blocks and may be done from an ISR.  It is only restarted if the reader is preempted
+*                  by 2 writes or more, so a reader of a higher priority than the writers never restarts.
+************************************************************************************************************************
+*/
+
+const  void  *OSSeqLockRdBegin (OS_SEQLOCK  *p_lock,
+                                OS_SEQ      *p_seq,
+                                OS_ERR      *p_err)
+{
+    const  void  *p_front;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((const void *)0);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_lock == (OS_SEQLOCK *)0) {                            /* Validate 'p_lock'                                    */
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return ((const void *)0);
+    }
+    if (p_seq == (OS_SEQ *)0) {                                 /* Validate 'p_seq'                                     */
+       *p_err = OS_ERR_PTR_INVALID;
+        return ((const void *)0);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if (p_lock->Type != OS_OBJ_TYPE_SEQLOCK) {                  /* Make sure the sequence lock was created              */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return ((const void *)0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();                                       /* Orders the publish before the reads of the snapshot  */
+   *p_seq   = p_lock->Seq;
+    p_front = p_lock->BufPtr[(*p_seq >> 1u) & 1u];
+    CPU_CRITICAL_EXIT();
+   *p_err   = OS_ERR_NONE;
+    return (p_front);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  VALIDATE A READ
+*
+* Description: This function tells if a read started by OSSeqLockRdBegin() must be restarted, because the buffer it read
+*              was written meanwhile.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock.
+*
+*              seq           is the sequence number returned by OSSeqLockRdBegin().
+*
+* Returns    : OS_FALSE      if the read is valid
+*              OS_TRUE       if the read must be restarted
+*
+* Note(s)    : (1) The buffer read is written by the second write started after the read: 'Seq' then advanced by 3 from
+*                  the last even value up to 'seq'.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OSSeqLockRdRetry (OS_SEQLOCK  *p_lock,
+                               OS_SEQ       seq)
+{
+    OS_SEQ  seq_now;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();                                       /* Orders the reads of the snapshot before the check    */
+    seq_now = p_lock->Seq;
+    CPU_CRITICAL_EXIT();
+    if ((OS_SEQ)(seq_now - (seq & ~(OS_SEQ)1u)) >= 3u) {        /* See Note #1                                          */
+        return (OS_TRUE);
+    }
+    return (OS_FALSE);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 COPY THE SNAPSHOT
+*
+* Description: This function copies the snapshot published, restarting the copy until it is valid.
+*
+* Arguments  : p_lock        is a pointer to the sequence lock.
+*
+*              p_dst         is a pointer to the buffer of 'BufSize' bytes receiving the copy.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_lock' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE                If 'p_lock' is not pointing at a sequence lock
+*                                OS_ERR_PTR_INVALID             If 'p_dst' is a NULL pointer
+*
+* Returns    : the sequence number of the snapshot copied: the snapshots copied by two reads are the same if their
+*              sequence numbers are the same once rounded down to an even value.
+*
+* Note(s)    : (1) The restarts are counted in 'RdRetryCtr'.  A copy is restarted while the reader is preempted by 2
+*                  writes or more during the copy, so a task which writes often must not have a higher priority than
+*                  a reader of a large snapshot.
+************************************************************************************************************************
+*/
+
+OS_SEQ  OSSeqLockRead (OS_SEQLOCK  *p_lock,
+                       void        *p_dst,
+                       OS_ERR      *p_err)
+{
+    const  void  *p_src;
+    OS_SEQ        seq;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_dst == (void *)0) {                                   /* Validate 'p_dst'                                     */
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+#endif
+
+    for (;;) {
+        p_src = OSSeqLockRdBegin(p_lock, &seq, p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return (0u);
+        }
+        OS_SeqLockCopy(p_dst, p_src, p_lock->BufSize);
+        if (OSSeqLockRdRetry(p_lock, seq) == OS_FALSE) {
+            break;
+        }
+        CPU_CRITICAL_ENTER();
+        p_lock->RdRetryCtr++;
+        CPU_CRITICAL_EXIT();
+    }
+    return (seq);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  COPY A SNAPSHOT
+*
+* Description: This function copies a snapshot, a word at a time if the buffers and the size are aligned.
+*
+* Arguments  : p_dst         is a pointer to the destination.
+*
+*              p_src         is a pointer to the source.
+*
+*              size          is the size (in bytes) to copy.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+static  void  OS_SeqLockCopy (void         *p_dst,
+                              const  void  *p_src,
+                              OS_MEM_SIZE   size)
+{
+           CPU_INT08U  *p_dst08;
+    const  CPU_INT08U  *p_src08;
+           CPU_DATA    *p_dst_word;
+    const  CPU_DATA    *p_src_word;
+
+
+    if ((((CPU_ADDR)p_dst | (CPU_ADDR)p_src | (CPU_ADDR)size) & (sizeof(CPU_DATA) - 1u)) == 0u) {
+        p_dst_word = (CPU_DATA       *)p_dst;
+        p_src_word = (const CPU_DATA *)p_src;
+        for (size /= sizeof(CPU_DATA); size > 0u; size--) {
+           *p_dst_word++ = *p_src_word++;
+        }
+    } else {
+        p_dst08 = (CPU_INT08U       *)p_dst;
+        p_src08 = (const CPU_INT08U *)p_src;
+        for (; size > 0u; size--) {
+           *p_dst08++ = *p_src08++;
+        }
+    }
+}
+#endif
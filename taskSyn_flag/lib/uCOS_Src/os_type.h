@@ -63,7 +63,11 @@ typedef   CPU_INT32U      OS_OBJ_TYPE;                 /* Special flag to determ
 
 typedef   CPU_INT16U      OS_OPT;                      /* Holds function options,                             <16>/32 */
 
+#if (OS_CFG_PRIO_MAX > 255u)
+typedef   CPU_INT16U      OS_PRIO;                     /* Priority of a task,                               8/<16>/32 */
+#else
 typedef   CPU_INT08U      OS_PRIO;                     /* Priority of a task,                               <8>/16/32 */
+#endif
 
 typedef   CPU_INT16U      OS_QTY;                      /* Quantity                                            <16>/32 */
 
@@ -78,6 +82,8 @@ typedef   CPU_INT08U      OS_REG_ID;                   /* Index to task register
 
 typedef   CPU_INT32U      OS_SEM_CTR;                  /* Semaphore value                                     16/<32> */
 
+typedef   CPU_INT32U      OS_SEQ;                      /* Sequence number of a sequence lock                       32 */
+
 typedef   CPU_INT08U      OS_STATE;                    /* State variable                                    <8>/16/32 */
 
 typedef   CPU_INT08U      OS_STATUS;                   /* Status                                            <8>/16/32 */
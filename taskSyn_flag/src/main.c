@@ -71,6 +71,8 @@ int main(void)
 {
     OS_ERR err;
 
+    CPU_Init(); //Timestamp timer of OS_TS_GET(), before the kernel uses it
+
     OSInit(&err);
 
     OSFlagCreate((OS_FLAG_GRP *)&synFlags,
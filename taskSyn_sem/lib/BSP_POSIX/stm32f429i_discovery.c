@@ -0,0 +1,64 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery.c
+  * @brief   Host (POSIX) stand-in for the STM32F429I-Discovery LEDs.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f429i_discovery.h"
+#include "cpu.h"
+
+#include <stdio.h>
+#include <unistd.h>
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t BSP_POSIX_LedState[LEDn];
+
+/* Private function prototypes -----------------------------------------------*/
+static void BSP_POSIX_LedSet(Led_TypeDef Led, uint8_t State);
+
+/* Exported functions --------------------------------------------------------*/
+void BSP_LED_Init(Led_TypeDef Led)
+{
+  BSP_POSIX_LedState[Led] = 0u;
+}
+
+void BSP_LED_On(Led_TypeDef Led)
+{
+  BSP_POSIX_LedSet(Led, 1u);
+}
+
+void BSP_LED_Off(Led_TypeDef Led)
+{
+  BSP_POSIX_LedSet(Led, 0u);
+}
+
+void BSP_LED_Toggle(Led_TypeDef Led)
+{
+  BSP_POSIX_LedSet(Led, BSP_POSIX_LedState[Led] ^ 1u);
+}
+
+uint8_t BSP_LED_GetState(Led_TypeDef Led)
+{
+  return BSP_POSIX_LedState[Led];
+}
+
+/* Private functions ---------------------------------------------------------*/
+static void BSP_POSIX_LedSet(Led_TypeDef Led, uint8_t State)
+{
+  BSP_POSIX_LedState[Led] = State;
+
+#if BSP_POSIX_LED_TRACE_EN
+  {
+    char msg[16];
+    int len;
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER(); /* Called from tasks, see 'os_cpu.h  Note #3' */
+    len = snprintf(msg, sizeof(msg), "LED%d %s\n", (int)Led + 3, (State != 0u) ? "on" : "off");
+    CPU_CRITICAL_EXIT();
+    (void)write(STDERR_FILENO, msg, (size_t)len);
+  }
+#endif
+}
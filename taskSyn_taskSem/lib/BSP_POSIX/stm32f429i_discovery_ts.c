@@ -0,0 +1,189 @@
+/**
+  ******************************************************************************
+  * @file    stm32f429i_discovery_ts.c
+  * @brief   Host (POSIX) stand-in for the STM32F429I-Discovery touch screen.
+  *
+  *          The screen is touched by replaying a recorded trace, given by
+  *          BSP_POSIX_TS_Replay() or read by BSP_TS_Init() from the file named
+  *          by the BSP_POSIX_TS_TRACE environment variable, one sample per
+  *          line: "<ms> <touched> <x> <y>", '#' starts a comment. Without a
+  *          trace the screen is never touched.
+  *
+  *          The replay thread sets the state BSP_TS_GetState() returns at the
+  *          time of each sample. Once BSP_TS_ITConfig() is called, a sample
+  *          touched or a release sets the interrupt status of the STMPE811,
+  *          like its touch detect & FIFO threshold interrupts, and the
+  *          status going from clear to set pulls STMPE811_INT_PIN down: its
+  *          EXTI line is raised (HAL_POSIX_EXTI_Raise()) until BSP_TS_ITClear().
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f429i_discovery_ts.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Private define ------------------------------------------------------------*/
+#define BSP_POSIX_TS_STATE(touched, x, y)  (((uint64_t)(touched) << 32) | ((uint64_t)(x) << 16) | (uint64_t)(y))
+#define BSP_POSIX_TS_IT_TOUCH       0x01u
+
+/* Private variables ---------------------------------------------------------*/
+static uint64_t          BSP_POSIX_TS_State;          /* BSP_POSIX_TS_STATE(), one atomic word for the kernel thread */
+static uint32_t          BSP_POSIX_TS_ITStatus;
+static uint8_t           BSP_POSIX_TS_ITEnabled;
+
+static const BSP_POSIX_TS_SampleTypeDef *BSP_POSIX_TS_Trace;
+static uint32_t          BSP_POSIX_TS_TraceCount;
+static uint8_t           BSP_POSIX_TS_ReplayBusy;
+static pthread_t         BSP_POSIX_TS_Thread;
+static uint8_t           BSP_POSIX_TS_ThreadStarted;
+
+static BSP_POSIX_TS_SampleTypeDef BSP_POSIX_TS_File[BSP_POSIX_TS_TRACE_MAX];
+
+/* Private function prototypes -----------------------------------------------*/
+static void *BSP_POSIX_TS_ThreadMain(void *p_arg);
+static uint32_t BSP_POSIX_TS_FileRead(const char *path);
+
+/* Exported functions --------------------------------------------------------*/
+
+/**
+ * \brief Replay the trace of the file named by BSP_POSIX_TS_TRACE, if any.
+ */
+uint8_t BSP_TS_Init(uint16_t XSize, uint16_t YSize)
+{
+  const char *path = getenv(BSP_POSIX_TS_TRACE_ENV);
+  uint32_t count;
+
+  (void)XSize;
+  (void)YSize;
+  if (path != NULL)
+  {
+    count = BSP_POSIX_TS_FileRead(path);
+    if (count == 0u)
+    {
+      return TS_ERROR;
+    }
+    return BSP_POSIX_TS_Replay(BSP_POSIX_TS_File, count);
+  }
+  return TS_OK;
+}
+
+void BSP_TS_GetState(TS_StateTypeDef *TsState)
+{
+  uint64_t state = __atomic_load_n(&BSP_POSIX_TS_State, __ATOMIC_ACQUIRE);
+
+  TsState->TouchDetected = (uint16_t)(state >> 32);
+  TsState->X = (uint16_t)(state >> 16);
+  TsState->Y = (uint16_t)state;
+  TsState->Z = (TsState->TouchDetected != 0u) ? 128u : 0u;
+}
+
+/**
+ * \brief Enable the interrupts of the controller & its EXTI line, as the board BSP does.
+ */
+uint8_t BSP_TS_ITConfig(void)
+{
+  __atomic_store_n(&BSP_POSIX_TS_ITEnabled, 1u, __ATOMIC_RELEASE);
+  HAL_NVIC_EnableIRQ(STMPE811_INT_EXTI);
+  return TS_OK;
+}
+
+uint8_t BSP_TS_ITGetStatus(void)
+{
+  return (uint8_t)__atomic_load_n(&BSP_POSIX_TS_ITStatus, __ATOMIC_ACQUIRE);
+}
+
+void BSP_TS_ITClear(void)
+{
+  __atomic_store_n(&BSP_POSIX_TS_ITStatus, 0u, __ATOMIC_RELEASE);
+}
+
+/**
+ * \brief Replay a trace from now, in a host thread.
+ * \param Trace: samples in time order, to be kept until the replay is over.
+ * \retval TS_ERROR if a replay is in progress.
+ */
+uint8_t BSP_POSIX_TS_Replay(const BSP_POSIX_TS_SampleTypeDef *Trace, uint32_t Count)
+{
+  if (__atomic_exchange_n(&BSP_POSIX_TS_ReplayBusy, 1u, __ATOMIC_ACQ_REL) != 0u)
+  {
+    return TS_ERROR;
+  }
+  BSP_POSIX_TS_Trace = Trace;
+  BSP_POSIX_TS_TraceCount = Count;
+  BSP_POSIX_TS_ThreadStarted = 0u;                /* One thread per replay, the last one is over */
+  HAL_POSIX_ThreadStart(&BSP_POSIX_TS_Thread, &BSP_POSIX_TS_ThreadStarted, BSP_POSIX_TS_ThreadMain);
+  return TS_OK;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+static void *BSP_POSIX_TS_ThreadMain(void *p_arg)
+{
+  struct timespec start;
+  struct timespec at;
+  uint32_t i;
+  uint64_t ns;
+
+  (void)p_arg;
+  (void)pthread_detach(pthread_self());
+  (void)clock_gettime(CLOCK_MONOTONIC, &start);
+  for (i = 0u; i < BSP_POSIX_TS_TraceCount; i++)
+  {
+    ns = (uint64_t)start.tv_nsec + (uint64_t)BSP_POSIX_TS_Trace[i].Ms * 1000000u;
+    at.tv_sec = start.tv_sec + (time_t)(ns / 1000000000u);
+    at.tv_nsec = (long)(ns % 1000000000u);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &at, NULL) != 0)
+    {
+    }
+
+    __atomic_store_n(&BSP_POSIX_TS_State,
+                     BSP_POSIX_TS_STATE(BSP_POSIX_TS_Trace[i].TouchDetected != 0u, BSP_POSIX_TS_Trace[i].X, BSP_POSIX_TS_Trace[i].Y),
+                     __ATOMIC_RELEASE);
+    if (__atomic_load_n(&BSP_POSIX_TS_ITEnabled, __ATOMIC_ACQUIRE) != 0u)
+    {
+      if (__atomic_fetch_or(&BSP_POSIX_TS_ITStatus, BSP_POSIX_TS_IT_TOUCH, __ATOMIC_ACQ_REL) == 0u)
+      {
+        HAL_POSIX_EXTI_Raise(STMPE811_INT_PIN);   /* INT asserted, falling edge */
+      }
+    }
+  }
+
+  __atomic_store_n(&BSP_POSIX_TS_ReplayBusy, 0u, __ATOMIC_RELEASE);
+  return NULL;
+}
+
+/**
+ * \brief Read a trace file into BSP_POSIX_TS_File[].
+ * \retval Samples read, 0 if the file cannot be read.
+ */
+static uint32_t BSP_POSIX_TS_FileRead(const char *path)
+{
+  FILE *file = fopen(path, "r");
+  char line[128];
+  unsigned long ms;
+  unsigned touched;
+  unsigned x;
+  unsigned y;
+  uint32_t count = 0u;
+
+  if (file == NULL)
+  {
+    return 0u;
+  }
+  while ((count < BSP_POSIX_TS_TRACE_MAX) && (fgets(line, sizeof(line), file) != NULL))
+  {
+    if (sscanf(line, "%lu %u %u %u", &ms, &touched, &x, &y) == 4)
+    {
+      BSP_POSIX_TS_File[count].Ms = (uint32_t)ms;
+      BSP_POSIX_TS_File[count].TouchDetected = (uint16_t)touched;
+      BSP_POSIX_TS_File[count].X = (uint16_t)x;
+      BSP_POSIX_TS_File[count].Y = (uint16_t)y;
+      count++;
+    }
+  }
+  (void)fclose(file);
+  return count;
+}
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""Compare the output of the benchmark app with a baseline run.
+
+Both files are captures of the benchmark output (USART1 on the board, stdout on
+the host). Every result line is 'suite key=value ...'. The fields that hold a
+time (keys ending in 'ns', '_us' or '_ticks') or a count of interrupts ('irqs')
+are compared, the others identify the result. Results present in only one of the
+files are listed apart.
+
+    pio run -e native -t exec > baseline.txt
+    ... change the kernel ...
+    pio run -e native -t exec > current.txt
+    python3 tools/bench_compare.py baseline.txt current.txt --threshold 10
+
+The exit status is 1 when a metric grew by more than the threshold, in percent,
+so the script can gate a kernel change.
+"""
+
+import argparse
+import sys
+
+METRIC_SUFFIXES = ("ns", "_us", "_ticks")
+METRIC_KEYS = {"irqs"}
+
+
+def is_metric(key):
+    return key.endswith(METRIC_SUFFIXES) or key in METRIC_KEYS
+
+
+def parse(path):
+    """Return {identity: {metric: value}} for every result line of a capture."""
+    results = {}
+    with open(path, errors="replace") as f:
+        for line in f:
+            words = line.split()
+            if len(words) < 2 or "=" in words[0]:
+                continue
+            ident = [words[0]]
+            metrics = {}
+            for word in words[1:]:
+                key, sep, value = word.partition("=")
+                if not sep:
+                    break
+                if is_metric(key):
+                    try:
+                        metrics[key] = float(value)
+                    except ValueError:
+                        pass
+                else:
+                    ident.append(word)
+            if metrics:
+                results[" ".join(ident)] = metrics
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="regression threshold in percent (default 10)")
+    parser.add_argument("--metric", action="append",
+                        help="only compare these fields, e.g. --metric p50_ns (default all)")
+    args = parser.parse_args()
+
+    base = parse(args.baseline)
+    cur = parse(args.current)
+    regressions = 0
+
+    for ident in sorted(base.keys() & cur.keys()):
+        for key, old in sorted(base[ident].items()):
+            if key not in cur[ident] or (args.metric and key not in args.metric):
+                continue
+            new = cur[ident][key]
+            if old > 0:
+                delta = (new - old) * 100.0 / old
+            else:
+                delta = 0.0 if new == 0 else float("inf")
+            flag = ""
+            if delta > args.threshold:
+                flag = "  REGRESSION"
+                regressions += 1
+            elif delta < -args.threshold:
+                flag = "  improved"
+            print("%s %s: %g -> %g (%+.1f%%)%s" % (ident, key, old, new, delta, flag))
+
+    for ident in sorted(base.keys() - cur.keys()):
+        print("%s: only in baseline" % ident)
+    for ident in sorted(cur.keys() - base.keys()):
+        print("%s: only in current" % ident)
+
+    print("%d regression(s) above %g%%" % (regressions, args.threshold))
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+"""Convert a uC/OS-III trace capture into Chrome/Perfetto trace JSON.
+
+The capture is the raw byte stream sent by the trace recorder of lib/uCOS_Trace
+(see os_trace_rec.h for the wire format). Text sent on the same UART is skipped.
+Open the output in https://ui.perfetto.dev or chrome://tracing: every task gets
+its own track with a slice per time it ran, interrupts are on the "ISR" track and
+every other kernel event is an instant on the track of the task it happened on.
+
+    python3 tools/os_trace_decode.py trace.bin trace.json
+"""
+
+import json
+import struct
+import sys
+
+SYNC = 0xA5
+WIRE_SIZE = 13
+
+EVT_NAMES = [
+    "CLOCK", "LOST", "TASK_NAME", "OBJ_NAME",
+    "ISR_ENTER", "ISR_EXIT", "ISR_EXIT_TO_SCHED", "TICK",
+    "ISR_REGISTER", "ISR_BEGIN", "ISR_END",
+    "TASK_CREATE", "TASK_CREATE_FAILED", "TASK_DEL", "TASK_READY", "TASK_SWITCHED_IN",
+    "TASK_DLY", "TASK_SUSPEND", "TASK_SUSPENDED", "TASK_RESUME", "TASK_PREEMPT",
+    "TASK_PRIO_CHANGE", "TASK_PRIO_INHERIT", "TASK_PRIO_DISINHERIT",
+    "OBJ_CREATE", "OBJ_DEL", "OBJ_POST", "OBJ_POST_FAILED",
+    "OBJ_PEND", "OBJ_PEND_FAILED", "OBJ_PEND_BLOCK",
+    "API_ENTER", "API_EXIT",
+]
+EVT = {name: i for i, name in enumerate(EVT_NAMES)}
+
+API_NAMES = [
+    "OSMutexDel", "OSMutexPost", "OSMutexPend", "OSTaskQPost", "OSTaskQPend",
+    "OSTaskSemPost", "OSTaskSemPend", "OSTaskResume", "OSTaskSuspend",
+    "OSSemDel", "OSSemPost", "OSSemPend", "OSQDel", "OSQPost", "OSQPend",
+    "OSFlagDel", "OSFlagPost", "OSFlagPend", "OSMemPut", "OSMemGet",
+    "OSRwLockDel", "OSRwLockPost", "OSRwLockRdPend", "OSRwLockWrPend",
+]
+
+TASK_EVTS = {"TASK_CREATE_FAILED", "TASK_DEL", "TASK_READY", "TASK_SUSPEND", "TASK_SUSPENDED",
+             "TASK_RESUME", "TASK_PREEMPT", "TASK_PRIO_CHANGE", "TASK_PRIO_INHERIT",
+             "TASK_PRIO_DISINHERIT"}
+
+PID = 1
+ISR_TID = 0
+
+
+def records(data):
+    """Yield (evt, val, ts, arg) for every record with a valid checksum."""
+    i = 0
+    while i + WIRE_SIZE <= len(data):
+        if data[i] != SYNC:
+            i += 1
+            continue
+        chk = 0
+        for b in data[i + 1:i + WIRE_SIZE - 1]:
+            chk ^= b
+        if chk != data[i + WIRE_SIZE - 1] or data[i + 1] >= len(EVT_NAMES):
+            i += 1
+            continue
+        evt, val, ts, arg = struct.unpack_from("<BHII", data, i + 1)
+        yield evt, val, ts, arg
+        i += WIRE_SIZE
+
+
+def fourcc(value):
+    return struct.pack("<I", value).decode("ascii", "replace")
+
+
+def decode(data):
+    freq = 1e9
+    last_ts = None
+    ts64 = 0
+    names = {"task": {}, "obj": {}}
+    named = set()                               # names complete, a new one starts on the next record
+    obj_types = {}
+    running = None                              # (task ID, start in us)
+    isr_depth = 0
+    events = []
+
+    def task_name(tid):
+        return names["task"].get(tid, "task %d" % tid)
+
+    def obj_name(oid):
+        return names["obj"].get(oid, "%s %d" % (obj_types.get(oid, "obj"), oid))
+
+    def instant(name, us, tid, args=None):
+        ev = {"name": name, "ph": "i", "s": "t", "ts": us, "pid": PID, "tid": tid}
+        if args:
+            ev["args"] = args
+        events.append(ev)
+
+    for evt, val, ts, arg in records(data):
+        if last_ts is not None:
+            delta = (ts - last_ts) & 0xFFFFFFFF  # unwrap, see Note #3 of os_trace_rec.c
+            if delta >= 0x80000000:
+                delta -= 0x100000000
+            ts64 += delta
+        last_ts = ts
+        name = EVT_NAMES[evt]
+
+        if name == "CLOCK":
+            freq = float(arg)
+            continue
+        us = ts64 / freq * 1e6
+        cur = running[0] if running else ISR_TID
+
+        if name in ("TASK_NAME", "OBJ_NAME"):
+            kind = "task" if name == "TASK_NAME" else "obj"
+            if (kind, val) in named or val not in names[kind]:
+                names[kind][val] = ""
+                named.discard((kind, val))
+            chunk = struct.pack("<I", arg).split(b"\0")[0].decode("ascii", "replace")
+            names[kind][val] += chunk
+            if len(chunk) < 4:                  # a record with a NUL ends the name
+                named.add((kind, val))
+        elif name == "LOST":
+            events.append({"name": "LOST %d records" % arg, "ph": "i", "s": "g",
+                           "ts": us, "pid": PID, "tid": ISR_TID})
+        elif name == "TASK_SWITCHED_IN":
+            if running:
+                events.append({"name": task_name(running[0]), "ph": "X", "ts": running[1],
+                               "dur": us - running[1], "pid": PID, "tid": running[0]})
+            running = (val, us)
+        elif name == "ISR_ENTER":
+            isr_depth += 1
+            events.append({"name": "ISR", "ph": "B", "ts": us, "pid": PID, "tid": ISR_TID})
+        elif name in ("ISR_EXIT", "ISR_EXIT_TO_SCHED"):
+            if isr_depth > 0:
+                isr_depth -= 1
+                events.append({"name": "ISR", "ph": "E", "ts": us, "pid": PID, "tid": ISR_TID,
+                               "args": {"to_sched": name == "ISR_EXIT_TO_SCHED"}})
+        elif name == "TICK":
+            instant("tick", us, ISR_TID, {"OSTickCtr": arg})
+        elif name == "TASK_CREATE":
+            instant("task_create", us, cur, {"task": val, "prio": arg})
+        elif name in TASK_EVTS:
+            args = {"task": task_name(val)}
+            if name.startswith("TASK_PRIO"):
+                args["prio"] = arg
+            instant(name.lower(), us, val if name == "TASK_READY" else cur, args)
+        elif name == "TASK_DLY":
+            instant("dly", us, cur, {"ticks": arg})
+        elif name == "OBJ_CREATE":
+            obj_types[val] = fourcc(arg).strip()
+            instant("create " + obj_types[val], us, cur, {"obj": val})
+        elif name.startswith("OBJ_"):
+            instant(name[4:].lower() + " " + obj_name(val), us, cur)
+        elif name in ("API_ENTER", "API_EXIT"):
+            api = API_NAMES[val] if val < len(API_NAMES) else "api %d" % val
+            args = {"obj": obj_name(arg)} if name == "API_ENTER" else {"err": arg}
+            instant(api + (" enter" if name == "API_ENTER" else " exit"), us, cur, args)
+        else:
+            instant(name.lower(), us, cur, {"val": val, "arg": arg})
+
+    meta = [{"name": "thread_name", "ph": "M", "pid": PID, "tid": ISR_TID, "args": {"name": "ISR"}}]
+    tids = {e["tid"] for e in events}
+    for tid in sorted(tids - {ISR_TID}):
+        meta.append({"name": "thread_name", "ph": "M", "pid": PID, "tid": tid,
+                     "args": {"name": task_name(tid)}})
+    return {"traceEvents": meta + events, "displayTimeUnit": "ns"}
+
+
+def main(argv):
+    if len(argv) != 3:
+        sys.stderr.write("usage: %s <capture> <trace.json>\n" % argv[0])
+        return 2
+    with open(argv[1], "rb") as f:
+        trace = decode(f.read())
+    with open(argv[2], "w") as f:
+        json.dump(trace, f)
+    n = sum(1 for e in trace["traceEvents"] if e["ph"] != "M")
+    sys.stderr.write("%d events\n" % n)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))